@@ -7,4 +7,8 @@ name="${2}_IMG"
 gdk-pixbuf-csource --macros $1 > $imageh.tmp
 sed -e "s/MY_PIXBUF/${name}/g" -e "s/guint8/uint8/g" $imageh.tmp > $imageh && rm $imageh.tmp
 
-
+# Append the pre-packed native pixel format variants. This runs on the
+# build machine, so use BUILD_CC rather than a cross compiler.
+${BUILD_CC:-cc} -I. -I`dirname $0` -DIMG_HEADER="\"$imageh\"" -DIMG=${name} \
+    -o $imageh.native `dirname $0`/make-image-native.c
+./$imageh.native >> $imageh && rm $imageh.native
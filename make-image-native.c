@@ -0,0 +1,288 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Build helper for make-image-header.sh: reads a GdkPixbuf RLE image
+ *  header and prints pre-packed native pixel format variants of it.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  Build with -DIMG_HEADER='"foo-img.h"' -DIMG=FOO_IMG
+ */
+
+#include "psplash.h"
+
+#include IMG_HEADER
+
+#define PASTE2(a, b) a ## _ ## b
+#define PASTE(a, b) PASTE2(a, b)
+#define STR2(a) #a
+#define STR(a) STR2(a)
+
+#define WIDTH          PASTE(IMG, WIDTH)
+#define HEIGHT         PASTE(IMG, HEIGHT)
+#define BYTES_PER_PIXEL PASTE(IMG, BYTES_PER_PIXEL)
+#define ROWSTRIDE      PASTE(IMG, ROWSTRIDE)
+#define RLE_PIXEL_DATA PASTE(IMG, RLE_PIXEL_DATA)
+
+/* Runs of at least this many identical pixels become fills */
+#define MIN_FILL 4
+
+typedef struct Format
+{
+  const char *name;
+  const char *rgbmode;
+  int         bpp;
+  uint32_t  (*pack) (uint8 red, uint8 green, uint8 blue);
+}
+Format;
+
+static uint32_t
+pack_rgb565 (uint8 red, uint8 green, uint8 blue)
+{
+  return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3);
+}
+
+static uint32_t
+pack_bgr565 (uint8 red, uint8 green, uint8 blue)
+{
+  return ((blue >> 3) << 11) | ((green >> 2) << 5) | (red >> 3);
+}
+
+static uint32_t
+pack_xrgb8888 (uint8 red, uint8 green, uint8 blue)
+{
+  return (red << 16) | (green << 8) | (blue);
+}
+
+static uint32_t
+pack_xbgr8888 (uint8 red, uint8 green, uint8 blue)
+{
+  return (blue << 16) | (green << 8) | (red);
+}
+
+static const Format formats[] =
+{
+  { "RGB565",   "RGB565", 16, pack_rgb565   },
+  { "BGR565",   "BGR565", 16, pack_bgr565   },
+  { "XRGB8888", "RGB888", 32, pack_xrgb8888 },
+  { "XBGR8888", "BGR888", 32, pack_xbgr8888 },
+};
+
+/* Expands the RLE stream into 'rgba', one byte of alpha per pixel */
+static void
+decode (uint8 *rgba, int row_len)
+{
+  const uint8 *p = RLE_PIXEL_DATA;
+  int          bpp = BYTES_PER_PIXEL, i = 0, n = row_len * HEIGHT;
+  unsigned int len;
+
+  while (i < n && (len = *p++) != 0)
+    {
+      int run = len & 128;
+
+      for (len &= 127; len > 0 && i < n; len--, i++)
+	{
+	  memcpy (rgba + i * 4, p, 3);
+	  rgba[i * 4 + 3] = bpp < 4 ? 255 : p[3];
+	  if (!run)
+	    p += bpp;
+	}
+
+      if (run)
+	p += bpp;
+    }
+}
+
+/* What make-image-header.sh's translucent pixels blend as, mirroring
+ * psplash_blend_select(): the native pixel with alpha on top at 32 bpp,
+ * R, G, B, A bytes otherwise */
+static uint32_t
+pack_blend (const Format *f, const uint8 *rgba)
+{
+  if (f->bpp == 32)
+    return f->pack (rgba[0], rgba[1], rgba[2]) | ((uint32_t) rgba[3] << 24);
+
+  return rgba[0] | (rgba[1] << 8) | (rgba[2] << 16)
+    | ((uint32_t) rgba[3] << 24);
+}
+
+#define OPAQUE(x)      (src[(x) * 4 + 3] == 255)
+#define TRANSLUCENT(x) (src[(x) * 4 + 3] && !OPAQUE (x))
+
+static void
+emit_format (const Format *f, const uint8 *rgba, int row_len)
+{
+  const char *type = f->bpp == 16 ? "uint16_t" : "uint32_t";
+  uint32_t   *row, *blend;
+  int         x, y, n, i, start, kind, offset;
+  int         count = 0, nspans = 0, nblend = 0;
+  int        *spans, *row_spans;
+
+  row       = malloc (WIDTH * sizeof (uint32_t));
+  blend     = malloc (WIDTH * HEIGHT * sizeof (uint32_t));
+  spans     = malloc (WIDTH * HEIGHT * 4 * sizeof (int));
+  row_spans = malloc ((HEIGHT + 1) * sizeof (int));
+
+  printf ("#ifdef PSPLASH_IMG_NATIVE_%s\n\n", f->name);
+  printf ("static const %s %s_%s_PIXELS[] = {", type, STR (IMG), f->name);
+
+  for (y = 0; y < HEIGHT; y++)
+    {
+      const uint8 *src = rgba + y * row_len * 4;
+
+      row_spans[y] = nspans;
+
+      for (x = 0; x < WIDTH; x++)
+	row[x] = f->pack (src[x * 4], src[x * 4 + 1], src[x * 4 + 2]);
+
+      for (x = 0; x < WIDTH; )
+	{
+	  if (!src[x * 4 + 3])
+	    {
+	      x++;
+	      continue;
+	    }
+
+	  start = x;
+
+	  if (TRANSLUCENT (x))
+	    {
+	      for (; x < WIDTH && TRANSLUCENT (x); x++)
+		blend[nblend++] = pack_blend (f, src + x * 4);
+
+	      spans[nspans * 4]     = start;
+	      spans[nspans * 4 + 1] = x - start;
+	      spans[nspans * 4 + 2] = PSPLASH_FB_SPAN_BLEND;
+	      spans[nspans * 4 + 3] = nblend - (x - start);
+	      nspans++;
+	      continue;
+	    }
+
+	  /* A fill, or a literal run up to the next pixel that isn't
+	   * opaque or a fill worth having */
+	  for (n = 1; x + n < WIDTH && OPAQUE (x + n)
+		 && row[x + n] == row[x]; n++)
+	    ;
+
+	  if (n >= MIN_FILL)
+	    {
+	      kind = PSPLASH_FB_SPAN_FILL;
+	      x += n;
+	    }
+	  else
+	    {
+	      kind = PSPLASH_FB_SPAN_COPY;
+	      while (x < WIDTH && OPAQUE (x))
+		{
+		  for (n = 1; x + n < WIDTH && OPAQUE (x + n)
+			 && row[x + n] == row[x]; n++)
+		    ;
+		  if (n >= MIN_FILL)
+		    break;
+		  x += n;
+		}
+	      n = x - start;
+	    }
+
+	  offset = count * (f->bpp >> 3);
+
+	  spans[nspans * 4]     = start;
+	  spans[nspans * 4 + 1] = n;
+	  spans[nspans * 4 + 2] = kind;
+	  spans[nspans * 4 + 3] = offset;
+	  nspans++;
+
+	  /* A fill only needs its one pixel */
+	  for (i = 0; i < (kind == PSPLASH_FB_SPAN_FILL ? 1 : n); i++, count++)
+	    printf ("%s0x%0*x,", count % 8 ? " " : "\n  ", f->bpp >> 2,
+		    row[start + i]);
+	}
+    }
+
+  row_spans[HEIGHT] = nspans;
+
+  if (count == 0)
+    printf ("\n  0");
+  printf ("\n};\n\n");
+
+  if (nblend)
+    {
+      printf ("static const uint32_t %s_%s_BLEND[] = {", STR (IMG), f->name);
+      for (i = 0; i < nblend; i++)
+	printf ("%s0x%08x,", i % 6 ? " " : "\n  ", blend[i]);
+      printf ("\n};\n\n");
+    }
+
+  printf ("static const int %s_%s_SPANS[] = {", STR (IMG), f->name);
+  for (x = 0; x < nspans; x++)
+    printf ("%s%d, %d, %d, %d,", x % 3 ? " " : "\n  ",
+	    spans[x * 4], spans[x * 4 + 1], spans[x * 4 + 2], spans[x * 4 + 3]);
+  if (nspans == 0)
+    printf ("\n  0");
+  printf ("\n};\n\n");
+
+  printf ("static const int %s_%s_ROW_SPANS[] = {", STR (IMG), f->name);
+  for (y = 0; y <= HEIGHT; y++)
+    printf ("%s%d,", y % 12 ? " " : "\n  ", row_spans[y] * 4);
+  printf ("\n};\n\n");
+
+  printf ("static const PSplashFBImage %s_%s = {\n"
+	  "  .rgbmode   = %s,\n"
+	  "  .bpp       = %d,\n"
+	  "  .width     = %d,\n"
+	  "  .height    = %d,\n"
+	  "  .pixels    = (const char *) %s_%s_PIXELS,\n",
+	  STR (IMG), f->name, f->rgbmode, f->bpp, WIDTH, HEIGHT,
+	  STR (IMG), f->name);
+  if (nblend)
+    printf ("  .blend     = %s_%s_BLEND,\n", STR (IMG), f->name);
+  printf ("  .spans     = %s_%s_SPANS,\n"
+	  "  .row_spans = %s_%s_ROW_SPANS,\n"
+	  "};\n\n",
+	  STR (IMG), f->name, STR (IMG), f->name);
+
+  printf ("#endif\n\n");
+
+  free (row);
+  free (blend);
+  free (spans);
+  free (row_spans);
+}
+
+int
+main (void)
+{
+  int          row_len, i;
+  uint8       *rgba;
+
+  row_len = (ROWSTRIDE + BYTES_PER_PIXEL - 1) / BYTES_PER_PIXEL;
+  rgba = calloc (row_len * HEIGHT, 4);
+  decode (rgba, row_len);
+
+  printf ("\n/* Pre-packed native pixel formats, generated by "
+	  "make-image-native.c.\n"
+	  " * Define PSPLASH_IMG_NATIVE_<format> to build a variant in. */\n\n");
+
+  for (i = 0; i < (int) (sizeof (formats) / sizeof (formats[0])); i++)
+    emit_format (&formats[i], rgba, row_len);
+
+  printf ("static const PSplashFBImage *%s_NATIVE_VARIANTS[] = {\n",
+	  STR (IMG));
+  for (i = 0; i < (int) (sizeof (formats) / sizeof (formats[0])); i++)
+    printf ("#ifdef PSPLASH_IMG_NATIVE_%s\n  &%s_%s,\n#endif\n",
+	    formats[i].name, STR (IMG), formats[i].name);
+  printf ("  NULL\n};\n\n");
+  printf ("#define %s_NATIVE (%s_NATIVE_VARIANTS)\n", STR (IMG), STR (IMG));
+
+  free (rgba);
+
+  return 0;
+}
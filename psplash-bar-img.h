@@ -45,3 +45,366 @@
   "\377\236\236\233\377\326\326\315\377\203\354\354\341\377")
 
 
+
+/* Pre-packed native pixel formats, generated by make-image-native.c.
+ * Define PSPLASH_IMG_NATIVE_<format> to build a variant in. */
+
+#ifdef PSPLASH_IMG_NATIVE_RGB565
+
+static const uint16_t BAR_IMG_RGB565_PIXELS[] = {
+  0xef7c, 0xef7c, 0xef7c, 0xd6b9, 0x9cf3, 0x8410, 0x6b6e, 0x8410,
+  0x9cf3, 0xd6b9, 0xef7c, 0xef7c, 0xef7c, 0xef7c, 0xef7c, 0xb595,
+  0x6b6e, 0xb595, 0xef7c, 0xef7c, 0xef7c, 0xb595, 0x6b6e, 0xb595,
+  0xef7c, 0xdeda, 0x738e, 0x6b6e, 0x738e, 0xdeda, 0xa534, 0x6b6e,
+  0x8430, 0xef7c, 0x8430, 0x6b6e, 0xa534, 0x8c51, 0x6b6e, 0x6b6e,
+  0x6b6e, 0x8410, 0xef5b, 0xef7c, 0xef5b, 0x8410, 0x6b6e, 0x6b6e,
+  0x6b6e, 0x8c51, 0x738e, 0x6b6e, 0x6b6e, 0x6b6e, 0xad75, 0xef7c,
+  0xad75, 0x6b6e, 0x6b6e, 0x6b6e, 0x738e, 0x6b6e, 0xbdd6, 0xef7c,
+  0x6b6e, 0x6b6e, 0xbdd6, 0xef7c, 0x6b6e, 0x6b6e, 0xbdd6, 0xef7c,
+  0x6b6e, 0x6b6e, 0xbdd6, 0xef7c, 0x6b6e, 0x6b6e, 0xbdd6, 0xef7c,
+  0x6b6e, 0x6b6e, 0xbdd6, 0xef7c, 0x6b6e, 0x6b6e, 0xbdd6, 0xef7c,
+  0x6b6e, 0x6b6e, 0xbdd6, 0xef7c, 0x6b6e, 0x6b6e, 0xbdd6, 0xef7c,
+  0x6b6e, 0x6b6e, 0xbdd6, 0xef7c, 0x6b6e, 0x6b6e, 0xbdd6, 0xef7c,
+  0x6b6e, 0x6b6e, 0xbdd6, 0xef7c, 0x6b6e, 0x6b6e, 0xbdd6, 0xef7c,
+  0x6b6e, 0x6b6e, 0xbdd6, 0xef7c, 0x6b6e, 0x738e, 0x6b6e, 0x6b6e,
+  0x6b6e, 0xad75, 0xef7c, 0xad75, 0x6b6e, 0x6b6e, 0x6b6e, 0x738e,
+  0x8c51, 0x6b6e, 0x6b6e, 0x6b6e, 0x8410, 0xef5b, 0xef7c, 0xef5b,
+  0x8410, 0x6b6e, 0x6b6e, 0x6b6e, 0x8c51, 0xa534, 0x6b6e, 0x8430,
+  0xef7c, 0x8430, 0x6b6e, 0xa534, 0xdeda, 0x738e, 0x6b6e, 0x738e,
+  0xdeda, 0xef7c, 0xb595, 0x6b6e, 0xb595, 0xef7c, 0xef7c, 0xef7c,
+  0xb595, 0x6b6e, 0xb595, 0xef7c, 0xef7c, 0xef7c, 0xef7c, 0xef7c,
+  0xd6b9, 0x9cf3, 0x8410, 0x6b6e, 0x8410, 0x9cf3, 0xd6b9, 0xef7c,
+  0xef7c, 0xef7c,
+};
+
+static const int BAR_IMG_RGB565_SPANS[] = {
+  0, 6, 0, 0, 6, 218, 1, 12, 224, 6, 0, 14,
+  0, 3, 0, 26, 3, 224, 1, 32, 227, 3, 0, 34,
+  0, 2, 0, 40, 2, 226, 1, 44, 228, 2, 0, 46,
+  0, 2, 0, 50, 2, 226, 1, 54, 228, 2, 0, 56,
+  0, 1, 0, 60, 1, 4, 1, 62, 5, 1, 0, 64,
+  6, 218, 1, 66, 224, 1, 0, 68, 225, 4, 1, 70,
+  229, 1, 0, 72, 0, 6, 0, 74, 6, 218, 1, 86,
+  224, 6, 0, 88, 0, 5, 0, 100, 5, 220, 1, 110,
+  225, 5, 0, 112, 0, 4, 1, 122, 4, 1, 0, 124,
+  5, 221, 1, 126, 226, 4, 1, 128, 0, 4, 1, 130,
+  4, 1, 0, 132, 5, 221, 1, 134, 226, 4, 1, 136,
+  0, 4, 1, 138, 4, 1, 0, 140, 5, 221, 1, 142,
+  226, 4, 1, 144, 0, 4, 1, 146, 4, 1, 0, 148,
+  5, 221, 1, 150, 226, 4, 1, 152, 0, 4, 1, 154,
+  4, 1, 0, 156, 5, 221, 1, 158, 226, 4, 1, 160,
+  0, 4, 1, 162, 4, 1, 0, 164, 5, 221, 1, 166,
+  226, 4, 1, 168, 0, 4, 1, 170, 4, 1, 0, 172,
+  5, 221, 1, 174, 226, 4, 1, 176, 0, 4, 1, 178,
+  4, 1, 0, 180, 5, 221, 1, 182, 226, 4, 1, 184,
+  0, 4, 1, 186, 4, 1, 0, 188, 5, 221, 1, 190,
+  226, 4, 1, 192, 0, 4, 1, 194, 4, 1, 0, 196,
+  5, 221, 1, 198, 226, 4, 1, 200, 0, 4, 1, 202,
+  4, 1, 0, 204, 5, 221, 1, 206, 226, 4, 1, 208,
+  0, 4, 1, 210, 4, 1, 0, 212, 5, 221, 1, 214,
+  226, 4, 1, 216, 0, 4, 1, 218, 4, 1, 0, 220,
+  5, 221, 1, 222, 226, 4, 1, 224, 0, 4, 1, 226,
+  4, 1, 0, 228, 5, 221, 1, 230, 226, 4, 1, 232,
+  0, 5, 0, 234, 5, 220, 1, 244, 225, 5, 0, 246,
+  0, 6, 0, 256, 6, 218, 1, 268, 224, 6, 0, 270,
+  0, 1, 0, 282, 1, 4, 1, 284, 5, 1, 0, 286,
+  6, 218, 1, 288, 224, 1, 0, 290, 225, 4, 1, 292,
+  229, 1, 0, 294, 0, 2, 0, 296, 2, 226, 1, 300,
+  228, 2, 0, 302, 0, 2, 0, 306, 2, 226, 1, 310,
+  228, 2, 0, 312, 0, 3, 0, 316, 3, 224, 1, 322,
+  227, 3, 0, 324, 0, 6, 0, 330, 6, 218, 1, 342,
+  224, 6, 0, 344,
+};
+
+static const int BAR_IMG_RGB565_ROW_SPANS[] = {
+  0, 12, 24, 36, 48, 76, 88, 100, 116, 132, 148, 164,
+  180, 196, 212, 228, 244, 260, 276, 292, 308, 324, 336, 348,
+  376, 388, 400, 412, 424,
+};
+
+static const PSplashFBImage BAR_IMG_RGB565 = {
+  .rgbmode   = RGB565,
+  .bpp       = 16,
+  .width     = 230,
+  .height    = 28,
+  .pixels    = (const char *) BAR_IMG_RGB565_PIXELS,
+  .spans     = BAR_IMG_RGB565_SPANS,
+  .row_spans = BAR_IMG_RGB565_ROW_SPANS,
+};
+
+#endif
+
+#ifdef PSPLASH_IMG_NATIVE_BGR565
+
+static const uint16_t BAR_IMG_BGR565_PIXELS[] = {
+  0xe77d, 0xe77d, 0xe77d, 0xceba, 0x9cf3, 0x8410, 0x736d, 0x8410,
+  0x9cf3, 0xceba, 0xe77d, 0xe77d, 0xe77d, 0xe77d, 0xe77d, 0xad96,
+  0x736d, 0xad96, 0xe77d, 0xe77d, 0xe77d, 0xad96, 0x736d, 0xad96,
+  0xe77d, 0xd6db, 0x738e, 0x736d, 0x738e, 0xd6db, 0xa534, 0x736d,
+  0x8430, 0xe77d, 0x8430, 0x736d, 0xa534, 0x8c51, 0x736d, 0x736d,
+  0x736d, 0x8410, 0xdf5d, 0xe77d, 0xdf5d, 0x8410, 0x736d, 0x736d,
+  0x736d, 0x8c51, 0x738e, 0x736d, 0x736d, 0x736d, 0xad75, 0xe77d,
+  0xad75, 0x736d, 0x736d, 0x736d, 0x738e, 0x736d, 0xb5d7, 0xe77d,
+  0x736d, 0x736d, 0xb5d7, 0xe77d, 0x736d, 0x736d, 0xb5d7, 0xe77d,
+  0x736d, 0x736d, 0xb5d7, 0xe77d, 0x736d, 0x736d, 0xb5d7, 0xe77d,
+  0x736d, 0x736d, 0xb5d7, 0xe77d, 0x736d, 0x736d, 0xb5d7, 0xe77d,
+  0x736d, 0x736d, 0xb5d7, 0xe77d, 0x736d, 0x736d, 0xb5d7, 0xe77d,
+  0x736d, 0x736d, 0xb5d7, 0xe77d, 0x736d, 0x736d, 0xb5d7, 0xe77d,
+  0x736d, 0x736d, 0xb5d7, 0xe77d, 0x736d, 0x736d, 0xb5d7, 0xe77d,
+  0x736d, 0x736d, 0xb5d7, 0xe77d, 0x736d, 0x738e, 0x736d, 0x736d,
+  0x736d, 0xad75, 0xe77d, 0xad75, 0x736d, 0x736d, 0x736d, 0x738e,
+  0x8c51, 0x736d, 0x736d, 0x736d, 0x8410, 0xdf5d, 0xe77d, 0xdf5d,
+  0x8410, 0x736d, 0x736d, 0x736d, 0x8c51, 0xa534, 0x736d, 0x8430,
+  0xe77d, 0x8430, 0x736d, 0xa534, 0xd6db, 0x738e, 0x736d, 0x738e,
+  0xd6db, 0xe77d, 0xad96, 0x736d, 0xad96, 0xe77d, 0xe77d, 0xe77d,
+  0xad96, 0x736d, 0xad96, 0xe77d, 0xe77d, 0xe77d, 0xe77d, 0xe77d,
+  0xceba, 0x9cf3, 0x8410, 0x736d, 0x8410, 0x9cf3, 0xceba, 0xe77d,
+  0xe77d, 0xe77d,
+};
+
+static const int BAR_IMG_BGR565_SPANS[] = {
+  0, 6, 0, 0, 6, 218, 1, 12, 224, 6, 0, 14,
+  0, 3, 0, 26, 3, 224, 1, 32, 227, 3, 0, 34,
+  0, 2, 0, 40, 2, 226, 1, 44, 228, 2, 0, 46,
+  0, 2, 0, 50, 2, 226, 1, 54, 228, 2, 0, 56,
+  0, 1, 0, 60, 1, 4, 1, 62, 5, 1, 0, 64,
+  6, 218, 1, 66, 224, 1, 0, 68, 225, 4, 1, 70,
+  229, 1, 0, 72, 0, 6, 0, 74, 6, 218, 1, 86,
+  224, 6, 0, 88, 0, 5, 0, 100, 5, 220, 1, 110,
+  225, 5, 0, 112, 0, 4, 1, 122, 4, 1, 0, 124,
+  5, 221, 1, 126, 226, 4, 1, 128, 0, 4, 1, 130,
+  4, 1, 0, 132, 5, 221, 1, 134, 226, 4, 1, 136,
+  0, 4, 1, 138, 4, 1, 0, 140, 5, 221, 1, 142,
+  226, 4, 1, 144, 0, 4, 1, 146, 4, 1, 0, 148,
+  5, 221, 1, 150, 226, 4, 1, 152, 0, 4, 1, 154,
+  4, 1, 0, 156, 5, 221, 1, 158, 226, 4, 1, 160,
+  0, 4, 1, 162, 4, 1, 0, 164, 5, 221, 1, 166,
+  226, 4, 1, 168, 0, 4, 1, 170, 4, 1, 0, 172,
+  5, 221, 1, 174, 226, 4, 1, 176, 0, 4, 1, 178,
+  4, 1, 0, 180, 5, 221, 1, 182, 226, 4, 1, 184,
+  0, 4, 1, 186, 4, 1, 0, 188, 5, 221, 1, 190,
+  226, 4, 1, 192, 0, 4, 1, 194, 4, 1, 0, 196,
+  5, 221, 1, 198, 226, 4, 1, 200, 0, 4, 1, 202,
+  4, 1, 0, 204, 5, 221, 1, 206, 226, 4, 1, 208,
+  0, 4, 1, 210, 4, 1, 0, 212, 5, 221, 1, 214,
+  226, 4, 1, 216, 0, 4, 1, 218, 4, 1, 0, 220,
+  5, 221, 1, 222, 226, 4, 1, 224, 0, 4, 1, 226,
+  4, 1, 0, 228, 5, 221, 1, 230, 226, 4, 1, 232,
+  0, 5, 0, 234, 5, 220, 1, 244, 225, 5, 0, 246,
+  0, 6, 0, 256, 6, 218, 1, 268, 224, 6, 0, 270,
+  0, 1, 0, 282, 1, 4, 1, 284, 5, 1, 0, 286,
+  6, 218, 1, 288, 224, 1, 0, 290, 225, 4, 1, 292,
+  229, 1, 0, 294, 0, 2, 0, 296, 2, 226, 1, 300,
+  228, 2, 0, 302, 0, 2, 0, 306, 2, 226, 1, 310,
+  228, 2, 0, 312, 0, 3, 0, 316, 3, 224, 1, 322,
+  227, 3, 0, 324, 0, 6, 0, 330, 6, 218, 1, 342,
+  224, 6, 0, 344,
+};
+
+static const int BAR_IMG_BGR565_ROW_SPANS[] = {
+  0, 12, 24, 36, 48, 76, 88, 100, 116, 132, 148, 164,
+  180, 196, 212, 228, 244, 260, 276, 292, 308, 324, 336, 348,
+  376, 388, 400, 412, 424,
+};
+
+static const PSplashFBImage BAR_IMG_BGR565 = {
+  .rgbmode   = BGR565,
+  .bpp       = 16,
+  .width     = 230,
+  .height    = 28,
+  .pixels    = (const char *) BAR_IMG_BGR565_PIXELS,
+  .spans     = BAR_IMG_BGR565_SPANS,
+  .row_spans = BAR_IMG_BGR565_ROW_SPANS,
+};
+
+#endif
+
+#ifdef PSPLASH_IMG_NATIVE_XRGB8888
+
+static const uint32_t BAR_IMG_XRGB8888_PIXELS[] = {
+  0x00ecece1, 0x00ecece1, 0x00ecece1, 0x00d6d6cd, 0x009e9e9b, 0x00808081, 0x006e6e71, 0x006d6d70,
+  0x006e6e71, 0x00808081, 0x009e9e9b, 0x00d6d6cd, 0x00ecece1, 0x00ecece1, 0x00ecece1, 0x00ecece1,
+  0x00ecece1, 0x00b0b0ab, 0x006f6f72, 0x006d6d70, 0x006f6f72, 0x00b0b0ab, 0x00ecece1, 0x00ecece1,
+  0x00ecece1, 0x00b2b2ae, 0x006d6d70, 0x00b2b2ae, 0x00ecece1, 0x00dadad1, 0x00707073, 0x006d6d70,
+  0x00707073, 0x00dadad1, 0x00a4a4a1, 0x006d6d70, 0x00858585, 0x00ecece1, 0x00858585, 0x006d6d70,
+  0x00a4a4a1, 0x00888888, 0x006d6d70, 0x006d6d70, 0x006d6d70, 0x00838383, 0x00e9e9de, 0x00ecece1,
+  0x00e9e9de, 0x00838383, 0x006d6d70, 0x006d6d70, 0x006d6d70, 0x00888888, 0x00717173, 0x006d6d70,
+  0x006d6d70, 0x006d6d70, 0x00adada9, 0x00ecece1, 0x00adada9, 0x006d6d70, 0x006d6d70, 0x006d6d70,
+  0x00717173, 0x006d6d70, 0x00b8b8b2, 0x00ecece1, 0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1,
+  0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1, 0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1,
+  0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1, 0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1,
+  0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1, 0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1,
+  0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1, 0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1,
+  0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1, 0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1,
+  0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1, 0x006d6d70, 0x006d6d70, 0x00b8b8b2, 0x00ecece1,
+  0x006d6d70, 0x00717173, 0x006d6d70, 0x006d6d70, 0x006d6d70, 0x00adada9, 0x00ecece1, 0x00adada9,
+  0x006d6d70, 0x006d6d70, 0x006d6d70, 0x00717173, 0x00888888, 0x006d6d70, 0x006d6d70, 0x006d6d70,
+  0x00838383, 0x00e9e9de, 0x00ecece1, 0x00e9e9de, 0x00838383, 0x006d6d70, 0x006d6d70, 0x006d6d70,
+  0x00888888, 0x00a4a4a1, 0x006d6d70, 0x00858585, 0x00ecece1, 0x00858585, 0x006d6d70, 0x00a4a4a1,
+  0x00dadad1, 0x00707073, 0x006d6d70, 0x00707073, 0x00dadad1, 0x00ecece1, 0x00b2b2ae, 0x006d6d70,
+  0x00b2b2ae, 0x00ecece1, 0x00ecece1, 0x00ecece1, 0x00b0b0ab, 0x006f6f72, 0x006d6d70, 0x006f6f72,
+  0x00b0b0ab, 0x00ecece1, 0x00ecece1, 0x00ecece1, 0x00ecece1, 0x00ecece1, 0x00d6d6cd, 0x009e9e9b,
+  0x00808081, 0x006e6e71, 0x006d6d70, 0x006e6e71, 0x00808081, 0x009e9e9b, 0x00d6d6cd, 0x00ecece1,
+  0x00ecece1, 0x00ecece1,
+};
+
+static const int BAR_IMG_XRGB8888_SPANS[] = {
+  0, 7, 0, 0, 7, 216, 1, 28, 223, 7, 0, 32,
+  0, 4, 0, 60, 4, 222, 1, 76, 226, 4, 0, 80,
+  0, 2, 0, 96, 2, 226, 1, 104, 228, 2, 0, 108,
+  0, 2, 0, 116, 2, 226, 1, 124, 228, 2, 0, 128,
+  0, 1, 0, 136, 1, 4, 1, 140, 5, 1, 0, 144,
+  6, 218, 1, 148, 224, 1, 0, 152, 225, 4, 1, 156,
+  229, 1, 0, 160, 0, 6, 0, 164, 6, 218, 1, 188,
+  224, 6, 0, 192, 0, 5, 0, 216, 5, 220, 1, 236,
+  225, 5, 0, 240, 0, 4, 1, 260, 4, 1, 0, 264,
+  5, 221, 1, 268, 226, 4, 1, 272, 0, 4, 1, 276,
+  4, 1, 0, 280, 5, 221, 1, 284, 226, 4, 1, 288,
+  0, 4, 1, 292, 4, 1, 0, 296, 5, 221, 1, 300,
+  226, 4, 1, 304, 0, 4, 1, 308, 4, 1, 0, 312,
+  5, 221, 1, 316, 226, 4, 1, 320, 0, 4, 1, 324,
+  4, 1, 0, 328, 5, 221, 1, 332, 226, 4, 1, 336,
+  0, 4, 1, 340, 4, 1, 0, 344, 5, 221, 1, 348,
+  226, 4, 1, 352, 0, 4, 1, 356, 4, 1, 0, 360,
+  5, 221, 1, 364, 226, 4, 1, 368, 0, 4, 1, 372,
+  4, 1, 0, 376, 5, 221, 1, 380, 226, 4, 1, 384,
+  0, 4, 1, 388, 4, 1, 0, 392, 5, 221, 1, 396,
+  226, 4, 1, 400, 0, 4, 1, 404, 4, 1, 0, 408,
+  5, 221, 1, 412, 226, 4, 1, 416, 0, 4, 1, 420,
+  4, 1, 0, 424, 5, 221, 1, 428, 226, 4, 1, 432,
+  0, 4, 1, 436, 4, 1, 0, 440, 5, 221, 1, 444,
+  226, 4, 1, 448, 0, 4, 1, 452, 4, 1, 0, 456,
+  5, 221, 1, 460, 226, 4, 1, 464, 0, 4, 1, 468,
+  4, 1, 0, 472, 5, 221, 1, 476, 226, 4, 1, 480,
+  0, 5, 0, 484, 5, 220, 1, 504, 225, 5, 0, 508,
+  0, 6, 0, 528, 6, 218, 1, 552, 224, 6, 0, 556,
+  0, 1, 0, 580, 1, 4, 1, 584, 5, 1, 0, 588,
+  6, 218, 1, 592, 224, 1, 0, 596, 225, 4, 1, 600,
+  229, 1, 0, 604, 0, 2, 0, 608, 2, 226, 1, 616,
+  228, 2, 0, 620, 0, 2, 0, 628, 2, 226, 1, 636,
+  228, 2, 0, 640, 0, 4, 0, 648, 4, 222, 1, 664,
+  226, 4, 0, 668, 0, 7, 0, 684, 7, 216, 1, 712,
+  223, 7, 0, 716,
+};
+
+static const int BAR_IMG_XRGB8888_ROW_SPANS[] = {
+  0, 12, 24, 36, 48, 76, 88, 100, 116, 132, 148, 164,
+  180, 196, 212, 228, 244, 260, 276, 292, 308, 324, 336, 348,
+  376, 388, 400, 412, 424,
+};
+
+static const PSplashFBImage BAR_IMG_XRGB8888 = {
+  .rgbmode   = RGB888,
+  .bpp       = 32,
+  .width     = 230,
+  .height    = 28,
+  .pixels    = (const char *) BAR_IMG_XRGB8888_PIXELS,
+  .spans     = BAR_IMG_XRGB8888_SPANS,
+  .row_spans = BAR_IMG_XRGB8888_ROW_SPANS,
+};
+
+#endif
+
+#ifdef PSPLASH_IMG_NATIVE_XBGR8888
+
+static const uint32_t BAR_IMG_XBGR8888_PIXELS[] = {
+  0x00e1ecec, 0x00e1ecec, 0x00e1ecec, 0x00cdd6d6, 0x009b9e9e, 0x00818080, 0x00716e6e, 0x00706d6d,
+  0x00716e6e, 0x00818080, 0x009b9e9e, 0x00cdd6d6, 0x00e1ecec, 0x00e1ecec, 0x00e1ecec, 0x00e1ecec,
+  0x00e1ecec, 0x00abb0b0, 0x00726f6f, 0x00706d6d, 0x00726f6f, 0x00abb0b0, 0x00e1ecec, 0x00e1ecec,
+  0x00e1ecec, 0x00aeb2b2, 0x00706d6d, 0x00aeb2b2, 0x00e1ecec, 0x00d1dada, 0x00737070, 0x00706d6d,
+  0x00737070, 0x00d1dada, 0x00a1a4a4, 0x00706d6d, 0x00858585, 0x00e1ecec, 0x00858585, 0x00706d6d,
+  0x00a1a4a4, 0x00888888, 0x00706d6d, 0x00706d6d, 0x00706d6d, 0x00838383, 0x00dee9e9, 0x00e1ecec,
+  0x00dee9e9, 0x00838383, 0x00706d6d, 0x00706d6d, 0x00706d6d, 0x00888888, 0x00737171, 0x00706d6d,
+  0x00706d6d, 0x00706d6d, 0x00a9adad, 0x00e1ecec, 0x00a9adad, 0x00706d6d, 0x00706d6d, 0x00706d6d,
+  0x00737171, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec, 0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec,
+  0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec, 0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec,
+  0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec, 0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec,
+  0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec, 0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec,
+  0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec, 0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec,
+  0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec, 0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec,
+  0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec, 0x00706d6d, 0x00706d6d, 0x00b2b8b8, 0x00e1ecec,
+  0x00706d6d, 0x00737171, 0x00706d6d, 0x00706d6d, 0x00706d6d, 0x00a9adad, 0x00e1ecec, 0x00a9adad,
+  0x00706d6d, 0x00706d6d, 0x00706d6d, 0x00737171, 0x00888888, 0x00706d6d, 0x00706d6d, 0x00706d6d,
+  0x00838383, 0x00dee9e9, 0x00e1ecec, 0x00dee9e9, 0x00838383, 0x00706d6d, 0x00706d6d, 0x00706d6d,
+  0x00888888, 0x00a1a4a4, 0x00706d6d, 0x00858585, 0x00e1ecec, 0x00858585, 0x00706d6d, 0x00a1a4a4,
+  0x00d1dada, 0x00737070, 0x00706d6d, 0x00737070, 0x00d1dada, 0x00e1ecec, 0x00aeb2b2, 0x00706d6d,
+  0x00aeb2b2, 0x00e1ecec, 0x00e1ecec, 0x00e1ecec, 0x00abb0b0, 0x00726f6f, 0x00706d6d, 0x00726f6f,
+  0x00abb0b0, 0x00e1ecec, 0x00e1ecec, 0x00e1ecec, 0x00e1ecec, 0x00e1ecec, 0x00cdd6d6, 0x009b9e9e,
+  0x00818080, 0x00716e6e, 0x00706d6d, 0x00716e6e, 0x00818080, 0x009b9e9e, 0x00cdd6d6, 0x00e1ecec,
+  0x00e1ecec, 0x00e1ecec,
+};
+
+static const int BAR_IMG_XBGR8888_SPANS[] = {
+  0, 7, 0, 0, 7, 216, 1, 28, 223, 7, 0, 32,
+  0, 4, 0, 60, 4, 222, 1, 76, 226, 4, 0, 80,
+  0, 2, 0, 96, 2, 226, 1, 104, 228, 2, 0, 108,
+  0, 2, 0, 116, 2, 226, 1, 124, 228, 2, 0, 128,
+  0, 1, 0, 136, 1, 4, 1, 140, 5, 1, 0, 144,
+  6, 218, 1, 148, 224, 1, 0, 152, 225, 4, 1, 156,
+  229, 1, 0, 160, 0, 6, 0, 164, 6, 218, 1, 188,
+  224, 6, 0, 192, 0, 5, 0, 216, 5, 220, 1, 236,
+  225, 5, 0, 240, 0, 4, 1, 260, 4, 1, 0, 264,
+  5, 221, 1, 268, 226, 4, 1, 272, 0, 4, 1, 276,
+  4, 1, 0, 280, 5, 221, 1, 284, 226, 4, 1, 288,
+  0, 4, 1, 292, 4, 1, 0, 296, 5, 221, 1, 300,
+  226, 4, 1, 304, 0, 4, 1, 308, 4, 1, 0, 312,
+  5, 221, 1, 316, 226, 4, 1, 320, 0, 4, 1, 324,
+  4, 1, 0, 328, 5, 221, 1, 332, 226, 4, 1, 336,
+  0, 4, 1, 340, 4, 1, 0, 344, 5, 221, 1, 348,
+  226, 4, 1, 352, 0, 4, 1, 356, 4, 1, 0, 360,
+  5, 221, 1, 364, 226, 4, 1, 368, 0, 4, 1, 372,
+  4, 1, 0, 376, 5, 221, 1, 380, 226, 4, 1, 384,
+  0, 4, 1, 388, 4, 1, 0, 392, 5, 221, 1, 396,
+  226, 4, 1, 400, 0, 4, 1, 404, 4, 1, 0, 408,
+  5, 221, 1, 412, 226, 4, 1, 416, 0, 4, 1, 420,
+  4, 1, 0, 424, 5, 221, 1, 428, 226, 4, 1, 432,
+  0, 4, 1, 436, 4, 1, 0, 440, 5, 221, 1, 444,
+  226, 4, 1, 448, 0, 4, 1, 452, 4, 1, 0, 456,
+  5, 221, 1, 460, 226, 4, 1, 464, 0, 4, 1, 468,
+  4, 1, 0, 472, 5, 221, 1, 476, 226, 4, 1, 480,
+  0, 5, 0, 484, 5, 220, 1, 504, 225, 5, 0, 508,
+  0, 6, 0, 528, 6, 218, 1, 552, 224, 6, 0, 556,
+  0, 1, 0, 580, 1, 4, 1, 584, 5, 1, 0, 588,
+  6, 218, 1, 592, 224, 1, 0, 596, 225, 4, 1, 600,
+  229, 1, 0, 604, 0, 2, 0, 608, 2, 226, 1, 616,
+  228, 2, 0, 620, 0, 2, 0, 628, 2, 226, 1, 636,
+  228, 2, 0, 640, 0, 4, 0, 648, 4, 222, 1, 664,
+  226, 4, 0, 668, 0, 7, 0, 684, 7, 216, 1, 712,
+  223, 7, 0, 716,
+};
+
+static const int BAR_IMG_XBGR8888_ROW_SPANS[] = {
+  0, 12, 24, 36, 48, 76, 88, 100, 116, 132, 148, 164,
+  180, 196, 212, 228, 244, 260, 276, 292, 308, 324, 336, 348,
+  376, 388, 400, 412, 424,
+};
+
+static const PSplashFBImage BAR_IMG_XBGR8888 = {
+  .rgbmode   = BGR888,
+  .bpp       = 32,
+  .width     = 230,
+  .height    = 28,
+  .pixels    = (const char *) BAR_IMG_XBGR8888_PIXELS,
+  .spans     = BAR_IMG_XBGR8888_SPANS,
+  .row_spans = BAR_IMG_XBGR8888_ROW_SPANS,
+};
+
+#endif
+
+static const PSplashFBImage *BAR_IMG_NATIVE_VARIANTS[] = {
+#ifdef PSPLASH_IMG_NATIVE_RGB565
+  &BAR_IMG_RGB565,
+#endif
+#ifdef PSPLASH_IMG_NATIVE_BGR565
+  &BAR_IMG_BGR565,
+#endif
+#ifdef PSPLASH_IMG_NATIVE_XRGB8888
+  &BAR_IMG_XRGB8888,
+#endif
+#ifdef PSPLASH_IMG_NATIVE_XBGR8888
+  &BAR_IMG_XBGR8888,
+#endif
+  NULL
+};
+
+#define BAR_IMG_NATIVE (BAR_IMG_NATIVE_VARIANTS)
@@ -0,0 +1,288 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Times each drawing primitive on a headless framebuffer, for every
+ *  pixel format psplash has writers for and every rotation. Prints one
+ *  CSV line per case so that results can be compared between releases.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include <time.h>
+#include "psplash.h"
+#include "psplash-colors.h"
+#include "psplash-poky-img.h"
+#include "psplash-bar-img.h"
+
+#ifndef POKY_IMG_NATIVE
+#define POKY_IMG_NATIVE NULL
+#endif
+#ifndef BAR_IMG_NATIVE
+#define BAR_IMG_NATIVE NULL
+#endif
+
+#define BENCH_MSG "Starting kernel log daemon..."
+
+static const struct
+{
+  const char   *name;
+  enum RGBMode  rgbmode;
+  int           bpp;
+}
+formats[] =
+{
+  { "RGB565",  RGB565,  16 },
+  { "BGR565",  BGR565,  16 },
+  { "GENERIC", GENERIC, 16 },
+  { "RGB888",  RGB888,  24 },
+  { "BGR888",  BGR888,  24 },
+  { "RGB888",  RGB888,  32 },
+  { "BGR888",  BGR888,  32 },
+  { "GENERIC", GENERIC, 32 },
+};
+
+static const int angles[] = { 0, 90, 180, 270 };
+
+typedef struct Bench
+{
+  const char *name;
+
+  /* Draws once and returns the number of pixels that were drawn */
+  long (*run) (PSplashFB *fb, long i);
+}
+Bench;
+
+/* Every case flushes, like psplash does, so the numbers include getting
+ * the pixels out of the shadow buffer */
+
+/* What the last draws repainted, for those that only redraw what changed */
+static long
+damaged_pixels (PSplashFB *fb)
+{
+  long pixels = 0;
+  int  i;
+
+  for (i = 0; i < fb->n_damage; i++)
+    pixels += (long) fb->damage[i].width * fb->damage[i].height;
+
+  return pixels;
+}
+
+static long
+bench_rect (PSplashFB *fb, long i)
+{
+  psplash_fb_draw_rect (fb, 0, 0, fb->width, fb->height,
+			i & 1 ? 0xff : 0, 0x80, 0x40);
+  psplash_fb_flush (fb);
+
+  return (long) fb->width * fb->height;
+}
+
+static long
+bench_poky (PSplashFB *fb, long UNUSED(i))
+{
+  psplash_fb_draw_image (fb,
+			 (fb->width - POKY_IMG_WIDTH) / 2,
+			 (fb->height - POKY_IMG_HEIGHT) / 2,
+			 POKY_IMG_WIDTH,
+			 POKY_IMG_HEIGHT,
+			 POKY_IMG_BYTES_PER_PIXEL,
+			 POKY_IMG_ROWSTRIDE,
+			 POKY_IMG_RLE_PIXEL_DATA,
+			 POKY_IMG_NATIVE);
+  psplash_fb_flush (fb);
+
+  return POKY_IMG_WIDTH * POKY_IMG_HEIGHT;
+}
+
+static long
+bench_bar (PSplashFB *fb, long UNUSED(i))
+{
+  psplash_fb_draw_image (fb,
+			 (fb->width - BAR_IMG_WIDTH) / 2,
+			 (fb->height - BAR_IMG_HEIGHT) / 2,
+			 BAR_IMG_WIDTH,
+			 BAR_IMG_HEIGHT,
+			 BAR_IMG_BYTES_PER_PIXEL,
+			 BAR_IMG_ROWSTRIDE,
+			 BAR_IMG_RLE_PIXEL_DATA,
+			 BAR_IMG_NATIVE);
+  psplash_fb_flush (fb);
+
+  return BAR_IMG_WIDTH * BAR_IMG_HEIGHT;
+}
+
+static long
+bench_text (PSplashFB *fb, long UNUSED(i))
+{
+  int w, h;
+
+  psplash_fb_text_size (&w, &h, &radeon_font, BENCH_MSG);
+  psplash_fb_draw_text (fb, (fb->width - w) / 2, fb->height / 2,
+			PSPLASH_TEXT_COLOR, &radeon_font, BENCH_MSG);
+  psplash_fb_flush (fb);
+
+  return (long) w * h;
+}
+
+static long
+bench_progress (PSplashFB *fb, long i)
+{
+  long pixels;
+
+  psplash_draw_progress (fb, i % 101);
+  pixels = damaged_pixels (fb);
+  psplash_fb_flush (fb);
+
+  return pixels;
+}
+
+static long
+bench_msg (PSplashFB *fb, long UNUSED(i))
+{
+  long pixels;
+
+  psplash_draw_msg (fb, BENCH_MSG);
+  pixels = damaged_pixels (fb);
+  psplash_fb_flush (fb);
+
+  return pixels;
+}
+
+static const Bench benches[] =
+{
+  { "draw_rect",       bench_rect     },
+  { "draw_image_poky", bench_poky     },
+  { "draw_image_bar",  bench_bar      },
+  { "draw_text",       bench_text     },
+  { "draw_progress",   bench_progress },
+  { "draw_msg",        bench_msg      },
+};
+
+static double
+now_ns (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Runs 'bench' for at least 'min_ms', after one untimed run so that
+ * image caches and the like are already built */
+static void
+bench_one (PSplashFB *fb, const Bench *bench, const char *format,
+	   int min_ms)
+{
+  double start, elapsed;
+  long   iterations = 0, pixels = 0;
+
+  bench->run (fb, 0);
+
+  start = now_ns ();
+  do
+    {
+      pixels += bench->run (fb, ++iterations);
+      elapsed = now_ns () - start;
+    }
+  while (elapsed < min_ms * 1e6);
+
+  printf ("%s,%s,%i,%i,%i,%i,%li,%.3f,%.1f\n",
+	  bench->name, format, fb->bpp, fb->angle,
+	  fb->real_width, fb->real_height, iterations,
+	  elapsed / pixels,
+	  pixels * (fb->bpp >> 3) * 1e3 / elapsed);
+}
+
+int
+main (int argc, char **argv)
+{
+  int         width = 800, height = 600, min_ms = 200, i = 0;
+  unsigned    f, a, b;
+  const char *snapshots = NULL;
+  char        path[PATH_MAX];
+  PSplashFB  *fb;
+
+  while (++i < argc)
+    {
+      if (!strcmp(argv[i],"-g") || !strcmp(argv[i],"--geometry"))
+	{
+	  if (++i >= argc
+	      || sscanf (argv[i], "%ix%i", &width, &height) != 2)
+	    goto fail;
+	  continue;
+	}
+
+      if (!strcmp(argv[i],"-t") || !strcmp(argv[i],"--time"))
+	{
+	  if (++i >= argc) goto fail;
+	  min_ms = atoi(argv[i]);
+	  continue;
+	}
+
+      if (!strcmp(argv[i],"-s") || !strcmp(argv[i],"--snapshot"))
+	{
+	  if (++i >= argc) goto fail;
+	  snapshots = argv[i];
+	  continue;
+	}
+
+    fail:
+      fprintf(stderr,
+	      "Usage: %s [-g|--geometry <width>x<height>][-t|--time <ms per case>]\n"
+	      "       [-s|--snapshot <dir>]\n",
+	      argv[0]);
+      exit(-1);
+    }
+
+  printf ("primitive,format,bpp,angle,width,height,iterations,"
+	  "ns_per_pixel,mb_per_s\n");
+
+  for (f = 0; f < sizeof (formats) / sizeof (formats[0]); f++)
+    for (a = 0; a < sizeof (angles) / sizeof (angles[0]); a++)
+      {
+	fb = psplash_headless_new (width, height, formats[f].bpp,
+				   formats[f].rgbmode, angles[a], NULL);
+	if (fb == NULL)
+	  exit(-1);
+
+	psplash_fb_draw_rect (fb, 0, 0, fb->width, fb->height,
+			      PSPLASH_BACKGROUND_COLOR);
+	psplash_draw_bar (fb);
+
+	for (b = 0; b < sizeof (benches) / sizeof (benches[0]); b++)
+	  bench_one (fb, &benches[b], formats[f].name, min_ms);
+
+	/* The whole splash screen as psplash would show it, for checking
+	 * each writer against the others by eye or by checksum */
+	if (snapshots)
+	  {
+	    psplash_fb_draw_rect (fb, 0, 0, fb->width, fb->height,
+				  PSPLASH_BACKGROUND_COLOR);
+	    psplash_draw_logo (fb);
+	    psplash_draw_bar (fb);
+	    psplash_draw_progress (fb, 50);
+	    psplash_draw_msg (fb, BENCH_MSG);
+	    psplash_fb_flush (fb);
+
+	    snprintf (path, sizeof (path), "%s/%s-%i-%i.ppm", snapshots,
+		      formats[f].name, formats[f].bpp, angles[a]);
+	    if (!psplash_headless_write_ppm (fb, path))
+	      exit(-1);
+	  }
+
+	psplash_fb_destroy (fb);
+      }
+
+  return 0;
+}
@@ -0,0 +1,303 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Source-over blending of image spans onto the shadow buffer.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include <endian.h>
+#include "psplash.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PSPLASH_BLEND_SSE2 1
+#include <emmintrin.h>
+#elif defined(__GNUC__) && (defined(__aarch64__) || defined(__ARM_NEON))
+#define PSPLASH_BLEND_NEON 1
+#include <arm_neon.h>
+#if !defined(__aarch64__)
+#include <sys/auxv.h>
+#ifndef HWCAP_NEON
+#define HWCAP_NEON (1 << 12)
+#endif
+#endif
+#endif
+
+/* All kernels round the same way, (s * a + d * (255 - a) + 128) / 255
+ * done as (t + (t >> 8)) >> 8, which is exact for every 8 bit input and
+ * fits 16 bit lanes. */
+static inline uint32_t
+blend_channel (uint32_t s, uint32_t d, uint32_t a)
+{
+  uint32_t t = s * a + d * (255 - a) + 128;
+
+  return (t + (t >> 8)) >> 8;
+}
+
+/* Source pixels are the native 8,8,8 pixel with alpha in the top byte */
+
+static uint32_t
+pack_blend_8888 (const PSplashFB *fb,
+		 uint8 red, uint8 green, uint8 blue, uint8 alpha)
+{
+  return fb->pack_pixel (fb, red, green, blue) | ((uint32_t) alpha << 24);
+}
+
+static void
+blend_span_8888 (const PSplashFB *UNUSED(fb), char *dst,
+		 const uint32_t *src, int len)
+{
+  uint32_t *d = (uint32_t *) dst;
+
+  for (; len > 0; len--, d++, src++)
+    {
+      uint32_t a = *src >> 24;
+
+      *d = (*d & 0xff000000)
+	| blend_channel (*src & 0xff, *d & 0xff, a)
+	| blend_channel ((*src >> 8) & 0xff, (*d >> 8) & 0xff, a) << 8
+	| blend_channel ((*src >> 16) & 0xff, (*d >> 16) & 0xff, a) << 16;
+    }
+}
+
+/* Everything else works on R, G, B, A source bytes. The destination is
+ * unpacked with the channel masks the pack writer itself produces, which
+ * aren't always those the driver reported. */
+
+static uint32_t
+pack_blend_rgba (const PSplashFB *UNUSED(fb),
+		 uint8 red, uint8 green, uint8 blue, uint8 alpha)
+{
+  return red | (green << 8) | (blue << 16) | ((uint32_t) alpha << 24);
+}
+
+typedef struct Channel
+{
+  int offset, length;
+}
+Channel;
+
+static inline void
+channel_from_mask (Channel *c, uint32_t mask)
+{
+  c->offset = __builtin_ctz (mask);
+  c->length = __builtin_popcount (mask);
+}
+
+static inline uint8
+unpack_channel (uint32_t pixel, const Channel *c)
+{
+  return psplash_blend_unpack_channel (pixel, c->offset, c->length);
+}
+
+static void
+blend_span_rgba (const PSplashFB *fb, char *dst, const uint32_t *src, int len)
+{
+  uint32_t red   = fb->pack_pixel (fb, 0xff, 0, 0);
+  uint32_t green = fb->pack_pixel (fb, 0, 0xff, 0);
+  uint32_t blue  = fb->pack_pixel (fb, 0, 0, 0xff);
+  int      bytes = fb->bpp >> 3;
+  Channel  r, g, b;
+
+  if (!red || !green || !blue)
+    return;
+
+  channel_from_mask (&r, red);
+  channel_from_mask (&g, green);
+  channel_from_mask (&b, blue);
+
+  for (; len > 0; len--, dst += bytes, src++)
+    {
+      uint32_t a = *src >> 24, d = 0;
+
+      memcpy (&d, dst, bytes);
+#if __BYTE_ORDER == __BIG_ENDIAN
+      d >>= 8 * (4 - bytes);
+#endif
+
+      d = fb->pack_pixel (fb,
+			  blend_channel (*src & 0xff, unpack_channel (d, &r), a),
+			  blend_channel ((*src >> 8) & 0xff,
+					 unpack_channel (d, &g), a),
+			  blend_channel ((*src >> 16) & 0xff,
+					 unpack_channel (d, &b), a));
+#if __BYTE_ORDER == __BIG_ENDIAN
+      d <<= 8 * (4 - bytes);
+#endif
+      memcpy (dst, &d, bytes);
+    }
+}
+
+/* Without a shadow buffer the destination can't be read back, so do what
+ * psplash always did and draw anything that isn't fully transparent. */
+
+static void
+blend_span_opaque_8888 (const PSplashFB *UNUSED(fb), char *dst,
+			const uint32_t *src, int len)
+{
+  uint32_t *d = (uint32_t *) dst;
+
+  for (; len > 0; len--, d++, src++)
+    if (*src >> 24)
+      *d = *src & 0x00ffffff;
+}
+
+static void
+blend_span_opaque_rgba (const PSplashFB *fb, char *dst,
+			const uint32_t *src, int len)
+{
+  int      bytes = fb->bpp >> 3;
+  uint8    rgba[4];
+
+  for (; len > 0; len--, dst += bytes, src++)
+    if (*src >> 24)
+      {
+	rgba[0] = *src;
+	rgba[1] = *src >> 8;
+	rgba[2] = *src >> 16;
+	rgba[3] = *src >> 24;
+	fb->copy_span (fb, dst, rgba, 4, 4, 1);
+      }
+}
+
+#ifdef PSPLASH_BLEND_SSE2
+
+#ifdef __i386__
+#define SSE2_TARGET __attribute__((target("sse2")))
+#else
+#define SSE2_TARGET
+#endif
+
+static SSE2_TARGET inline __m128i
+blend_sse2_half (__m128i s, __m128i d)
+{
+  __m128i a, ia, t;
+
+  /* Broadcast each pixel's alpha over its four 16 bit lanes */
+  a  = _mm_shufflehi_epi16 (_mm_shufflelo_epi16 (s, 0xff), 0xff);
+  ia = _mm_sub_epi16 (_mm_set1_epi16 (255), a);
+
+  t = _mm_add_epi16 (_mm_mullo_epi16 (s, a), _mm_mullo_epi16 (d, ia));
+  t = _mm_add_epi16 (t, _mm_set1_epi16 (128));
+  t = _mm_add_epi16 (t, _mm_srli_epi16 (t, 8));
+
+  return _mm_srli_epi16 (t, 8);
+}
+
+static SSE2_TARGET void
+blend_span_8888_sse2 (const PSplashFB *fb, char *dst,
+		      const uint32_t *src, int len)
+{
+  const __m128i zero  = _mm_setzero_si128 ();
+  const __m128i xmask = _mm_set1_epi32 (0xff000000);
+
+  for (; len >= 4; len -= 4, dst += 16, src += 4)
+    {
+      __m128i s = _mm_loadu_si128 ((const __m128i *) src);
+      __m128i d = _mm_loadu_si128 ((const __m128i *) dst);
+      __m128i lo, hi, r;
+
+      lo = blend_sse2_half (_mm_unpacklo_epi8 (s, zero),
+			    _mm_unpacklo_epi8 (d, zero));
+      hi = blend_sse2_half (_mm_unpackhi_epi8 (s, zero),
+			    _mm_unpackhi_epi8 (d, zero));
+      r  = _mm_packus_epi16 (lo, hi);
+
+      /* Keep whatever the destination had in its padding byte */
+      r = _mm_or_si128 (_mm_andnot_si128 (xmask, r), _mm_and_si128 (xmask, d));
+      _mm_storeu_si128 ((__m128i *) dst, r);
+    }
+
+  blend_span_8888 (fb, dst, src, len);
+}
+
+#endif /* PSPLASH_BLEND_SSE2 */
+
+#ifdef PSPLASH_BLEND_NEON
+
+static void
+blend_span_8888_neon (const PSplashFB *fb, char *dst,
+		      const uint32_t *src, int len)
+{
+  const uint8x16_t xmask = vreinterpretq_u8_u32 (vdupq_n_u32 (0xff000000));
+  const uint16x8_t round = vdupq_n_u16 (128);
+
+  for (; len >= 4; len -= 4, dst += 16, src += 4)
+    {
+      uint32x4_t s32 = vld1q_u32 (src);
+      uint8x16_t s   = vreinterpretq_u8_u32 (s32);
+      uint8x16_t d   = vld1q_u8 ((uint8_t *) dst);
+      uint8x16_t a, ia, r;
+      uint16x8_t lo, hi;
+
+      /* Broadcast each pixel's alpha over its four bytes */
+      a  = vreinterpretq_u8_u32 (vmulq_n_u32 (vshrq_n_u32 (s32, 24),
+					      0x01010101));
+      ia = vmvnq_u8 (a);
+
+      lo = vmull_u8 (vget_low_u8 (s), vget_low_u8 (a));
+      lo = vmlal_u8 (lo, vget_low_u8 (d), vget_low_u8 (ia));
+      lo = vaddq_u16 (lo, round);
+      lo = vaddq_u16 (lo, vshrq_n_u16 (lo, 8));
+
+      hi = vmull_u8 (vget_high_u8 (s), vget_high_u8 (a));
+      hi = vmlal_u8 (hi, vget_high_u8 (d), vget_high_u8 (ia));
+      hi = vaddq_u16 (hi, round);
+      hi = vaddq_u16 (hi, vshrq_n_u16 (hi, 8));
+
+      r = vcombine_u8 (vshrn_n_u16 (lo, 8), vshrn_n_u16 (hi, 8));
+
+      /* Keep whatever the destination had in its padding byte */
+      vst1q_u8 ((uint8_t *) dst, vbslq_u8 (xmask, d, r));
+    }
+
+  blend_span_8888 (fb, dst, src, len);
+}
+
+#endif /* PSPLASH_BLEND_NEON */
+
+void
+psplash_blend_select (PSplashFB *fb, bool readable)
+{
+  /* Every non generic mode packs 8,8,8 into the low bytes at 32 bpp */
+  bool native = fb->bpp == 32 && fb->rgbmode != GENERIC;
+
+  fb->pack_blend = native ? pack_blend_8888 : pack_blend_rgba;
+
+  if (!readable)
+    {
+      fb->blend_span = native ? blend_span_opaque_8888 : blend_span_opaque_rgba;
+      return;
+    }
+
+  if (!native)
+    {
+      fb->blend_span = blend_span_rgba;
+      return;
+    }
+
+  fb->blend_span = blend_span_8888;
+
+#ifdef PSPLASH_BLEND_SSE2
+  __builtin_cpu_init ();
+
+  if (__builtin_cpu_supports ("sse2"))
+    fb->blend_span = blend_span_8888_sse2;
+#endif
+
+#ifdef PSPLASH_BLEND_NEON
+#if !defined(__aarch64__)
+  if (getauxval (AT_HWCAP) & HWCAP_NEON)
+#endif
+    fb->blend_span = blend_span_8888_neon;
+#endif
+}
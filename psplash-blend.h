@@ -0,0 +1,48 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_BLEND_H
+#define _HAVE_PSPLASH_BLEND_H
+
+/* Picks fb->pack_blend and fb->blend_span for the framebuffer's format.
+ * Unless fb->data is 'readable' RAM, translucent pixels are drawn opaque
+ * instead of being blended. */
+void
+psplash_blend_select (PSplashFB *fb, bool readable);
+
+/* One channel of 'pixel' as 8 bits, with the top bits of narrower
+ * channels replicated downwards so that full scale stays full scale, and
+ * wider ones cut down to their top 8 bits */
+static inline uint8
+psplash_blend_unpack_channel (uint32_t pixel, int offset, int length)
+{
+  uint32_t v;
+  int      shift;
+
+  if (length <= 0)
+    return 0;
+
+  if (length >= 8)
+    return (pixel >> (offset + length - 8)) & 0xff;
+
+  v = ((pixel >> offset) & ((1u << length) - 1)) << (8 - length);
+
+  for (shift = length; shift < 8; shift *= 2)
+    v |= v >> shift;
+
+  return v;
+}
+
+#endif
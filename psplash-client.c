@@ -0,0 +1,187 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  libpsplash-client: posts updates over the control socket, keeping one
+ *  connection for as long as the program runs.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "psplash.h"
+#include "psplash-client.h"
+
+/* Commands that are kept until the next flush, in the order sent */
+enum {
+    PSPLASH_CLIENT_PROGRESS,
+    PSPLASH_CLIENT_MSG,
+    PSPLASH_CLIENT_QUIT,
+    PSPLASH_CLIENT_N_COMMANDS,
+};
+
+struct PSplashClient
+{
+  int                fd;
+  struct sockaddr_un addr;
+
+  bool               set[PSPLASH_CLIENT_N_COMMANDS];
+  int                progress;
+  char               msg[PSPLASH_COMMAND_MAX];
+};
+
+static int
+psplash_client_connect (PSplashClient *client)
+{
+  if (client->fd >= 0)
+    return 0;
+
+  client->fd = socket (AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+  if (client->fd < 0)
+    return -1;
+
+  if (connect (client->fd, (struct sockaddr *) &client->addr,
+	       sizeof (client->addr)) < 0)
+    {
+      close (client->fd);
+      client->fd = -1;
+      return -1;
+    }
+
+  return 0;
+}
+
+PSplashClient*
+psplash_client_open (void)
+{
+  PSplashClient *client;
+  const char    *tmpdir;
+
+  if ((client = calloc (1, sizeof (PSplashClient))) == NULL)
+    return NULL;
+
+  if ((tmpdir = getenv ("TMPDIR")) == NULL)
+    tmpdir = "/tmp";
+
+  client->fd = -1;
+  client->addr.sun_family = AF_UNIX;
+  snprintf (client->addr.sun_path, sizeof (client->addr.sun_path),
+	    "%s/%s", tmpdir, PSPLASH_SOCKET);
+
+  psplash_client_connect (client);
+
+  return client;
+}
+
+int
+psplash_client_progress (PSplashClient *client, int value)
+{
+  client->progress = value;
+  client->set[PSPLASH_CLIENT_PROGRESS] = TRUE;
+
+  return 0;
+}
+
+int
+psplash_client_msg (PSplashClient *client, const char *msg)
+{
+  snprintf (client->msg, sizeof (client->msg), "MSG %s", msg);
+  client->set[PSPLASH_CLIENT_MSG] = TRUE;
+
+  return 0;
+}
+
+int
+psplash_client_quit (PSplashClient *client)
+{
+  client->set[PSPLASH_CLIENT_QUIT] = TRUE;
+
+  return 0;
+}
+
+int
+psplash_client_flush (PSplashClient *client)
+{
+  struct mmsghdr msgs[PSPLASH_CLIENT_N_COMMANDS];
+  struct iovec   iovs[PSPLASH_CLIENT_N_COMMANDS];
+  int            commands[PSPLASH_CLIENT_N_COMMANDS];
+  char           progress[32];
+  int            i, n = 0, sent, retried = FALSE;
+
+  memset (msgs, 0, sizeof (msgs));
+
+  for (i = 0; i < PSPLASH_CLIENT_N_COMMANDS; i++)
+    {
+      if (!client->set[i])
+	continue;
+
+      switch (i)
+	{
+	case PSPLASH_CLIENT_PROGRESS:
+	  snprintf (progress, sizeof (progress), "PROGRESS %i",
+		    client->progress);
+	  iovs[n].iov_base = progress;
+	  break;
+	case PSPLASH_CLIENT_MSG:
+	  iovs[n].iov_base = client->msg;
+	  break;
+	case PSPLASH_CLIENT_QUIT:
+	  iovs[n].iov_base = "QUIT";
+	  break;
+	}
+
+      iovs[n].iov_len = strlen (iovs[n].iov_base);
+      msgs[n].msg_hdr.msg_iov    = &iovs[n];
+      msgs[n].msg_hdr.msg_iovlen = 1;
+      commands[n++] = i;
+    }
+
+  /* All of it in one system call, going round again for what is left if
+   * psplash went away in between */
+  i = 0;
+  while (i < n)
+    {
+      if (psplash_client_connect (client) < 0)
+	return -1;
+
+      if ((sent = sendmmsg (client->fd, msgs + i, n - i, MSG_NOSIGNAL)) < 0)
+	{
+	  if (errno == EINTR)
+	    continue;
+
+	  close (client->fd);
+	  client->fd = -1;
+
+	  /* Maybe psplash was restarted; have one go at the new one */
+	  if (retried)
+	    return -1;
+	  retried = TRUE;
+	  continue;
+	}
+
+      for (; sent > 0; sent--, i++)
+	client->set[commands[i]] = FALSE;
+    }
+
+  return 0;
+}
+
+void
+psplash_client_close (PSplashClient *client)
+{
+  psplash_client_flush (client);
+
+  if (client->fd >= 0)
+    close (client->fd);
+
+  free (client);
+}
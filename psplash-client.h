@@ -0,0 +1,56 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_CLIENT_H
+#define _HAVE_PSPLASH_CLIENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A connection to psplash's control socket, for programs that post
+ * updates for longer than one command. Updates are kept until
+ * psplash_client_flush(), and only the newest progress and message are
+ * sent then. If psplash is not running, or has gone away, each flush
+ * tries to connect again and what could not be sent is kept for the
+ * next one. */
+typedef struct PSplashClient PSplashClient;
+
+/* NULL only when out of memory; psplash need not be running yet */
+PSplashClient*
+psplash_client_open (void);
+
+int
+psplash_client_progress (PSplashClient *client, int value);
+
+int
+psplash_client_msg (PSplashClient *client, const char *msg);
+
+int
+psplash_client_quit (PSplashClient *client);
+
+/* 0 once everything kept has been sent, otherwise -1 with errno set */
+int
+psplash_client_flush (PSplashClient *client);
+
+/* Flushes, then closes the connection */
+void
+psplash_client_close (PSplashClient *client);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
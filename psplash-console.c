@@ -17,45 +17,41 @@
 
 #include "psplash.h"
 
-/* Globals, needed for signal handling */
+/* Globals, the VT switch requests come in through psplash's main loop */
 static int ConsoleFd      = -1;
 static int VTNum          = -1;
 static int VTNumInitial   = -1;
 static int Visible        =  1;
 
-static void
-vt_request (int UNUSED(sig))
+int
+psplash_console_handle_request (void)
 {
   DBG("mark, visible:%i", Visible);
 
+  /* Not our VT, so all anyone can want is a repaint */
+  if (ConsoleFd < 0)
+    return 1;
+
   if (Visible)
     {
       /* Allow Switch Away */
       if (ioctl (ConsoleFd, VT_RELDISP, 1) < 0)
 	perror("Error cannot switch away from console");
       Visible = 0;
-
-      /* FIXME: 
-       * We likely now want to signal the main loop as to exit	 
-       * and we've now likely switched to the X tty. Note, this
-       * seems to happen anyway atm due to select() call getting
-       * a signal interuption error - not sure if this is really
-       * reliable however. 
-      */
     }
   else
     {
       if (ioctl (ConsoleFd, VT_RELDISP, VT_ACKACQ))
 	perror ("Error can't acknowledge VT switch");
       Visible = 1;
-      /* FIXME: need to schedule repaint some how ? */
     }
+
+  return Visible;
 }
 
 static void
 psplash_console_ignore_switches (void)
 {
-  struct sigaction    act;
   struct vt_mode      vt_mode;
   
   if (ioctl(ConsoleFd, VT_GETMODE, &vt_mode) < 0)
@@ -64,11 +60,6 @@ psplash_console_ignore_switches (void)
       return;
     }
 
-  act.sa_handler = SIG_IGN;
-  sigemptyset (&act.sa_mask);
-  act.sa_flags = 0;
-  sigaction (SIGUSR1, &act, 0);
-  
   vt_mode.mode = VT_AUTO;
   vt_mode.relsig = 0;
   vt_mode.acqsig = 0;
@@ -77,10 +68,11 @@ psplash_console_ignore_switches (void)
     perror("Error VT_SETMODE failed");
 }
 
+/* SIGUSR1 is blocked and read from psplash's signalfd, which then calls
+ * psplash_console_handle_request() */
 static void
 psplash_console_handle_switches (void)
 {
-  struct sigaction    act;
   struct vt_mode      vt_mode;
  
   if (ioctl(ConsoleFd, VT_GETMODE, &vt_mode) < 0)
@@ -89,11 +81,6 @@ psplash_console_handle_switches (void)
       return;
     }
 
-  act.sa_handler = vt_request;
-  sigemptyset (&act.sa_mask);
-  act.sa_flags = 0;
-  sigaction (SIGUSR1, &act, 0);
-  
   vt_mode.mode   = VT_PROCESS;
   vt_mode.relsig = SIGUSR1;
   vt_mode.acqsig = SIGUSR1;
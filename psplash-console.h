@@ -24,4 +24,9 @@ psplash_console_switch (void);
 void
 psplash_console_reset (void);
 
+/* Answers the SIGUSR1 the kernel sends when our VT is switched away from
+ * or back to, returning whether it is showing now */
+int
+psplash_console_handle_request (void);
+
 #endif
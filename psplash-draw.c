@@ -0,0 +1,214 @@
+/* 
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices. 
+ *
+ *  Copyright (c) 2006 Matthew Allum <mallum@o-hand.com>
+ *
+ *  The pieces of the splash screen, shared by psplash and psplash-bench.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include "psplash.h"
+#include "psplash-config.h"
+#include "psplash-colors.h"
+#include "psplash-poky-img.h"
+#include "psplash-bar-img.h"
+#include "radeon-font.h"
+
+/* Image headers from an older make-image-header.sh come without the
+ * pre-packed native variants */
+#ifndef POKY_IMG_NATIVE
+#define POKY_IMG_NATIVE NULL
+#endif
+#ifndef BAR_IMG_NATIVE
+#define BAR_IMG_NATIVE NULL
+#endif
+
+#define SPLIT_LINE_POS(fb)                                  \
+	(  (fb)->height                                     \
+	 - ((  PSPLASH_IMG_SPLIT_DENOMINATOR                \
+	     - PSPLASH_IMG_SPLIT_NUMERATOR)                 \
+	    * (fb)->height / PSPLASH_IMG_SPLIT_DENOMINATOR) \
+	)
+
+void
+psplash_draw_logo (PSplashFB *fb)
+{
+  psplash_fb_draw_image (fb, 
+    (fb->width  - POKY_IMG_WIDTH)/2,
+#if PSPLASH_IMG_FULLSCREEN
+    (fb->height - POKY_IMG_HEIGHT)/2,
+#else
+    (fb->height * PSPLASH_IMG_SPLIT_NUMERATOR
+      / PSPLASH_IMG_SPLIT_DENOMINATOR - POKY_IMG_HEIGHT)/2,
+#endif
+    POKY_IMG_WIDTH,
+    POKY_IMG_HEIGHT,
+    POKY_IMG_BYTES_PER_PIXEL,
+    POKY_IMG_ROWSTRIDE,
+    POKY_IMG_RLE_PIXEL_DATA,
+    POKY_IMG_NATIVE);
+}
+
+/* The border the progress bar is drawn into */
+void
+psplash_draw_bar (PSplashFB *fb)
+{
+  psplash_fb_draw_image (fb, 
+			 (fb->width  - BAR_IMG_WIDTH)/2, 
+			 fb->height - (fb->height/6), 
+			 BAR_IMG_WIDTH,
+			 BAR_IMG_HEIGHT,
+			 BAR_IMG_BYTES_PER_PIXEL,
+			 BAR_IMG_ROWSTRIDE,
+			 BAR_IMG_RLE_PIXEL_DATA,
+			 BAR_IMG_NATIVE);
+
+  fb->progress_drawn = FALSE;
+}
+
+void
+psplash_draw_msg (PSplashFB *fb, const char *msg)
+{
+  int w, h, x, y, cx, cy, cw, ch;
+
+  psplash_fb_text_size (&w, &h, &radeon_font, msg);
+
+  DBG("displaying '%s' %ix%i\n", msg, w, h);
+
+  x = (fb->width-w)/2;
+  y = SPLIT_LINE_POS(fb) - h;
+
+  /* Clear the last message and where this one goes, or the whole line
+   * if there was none */
+
+  if (fb->msg_drawn)
+    {
+      const PSplashFBRect *last = &fb->msg_rect;
+
+      cx = MIN (x, last->x);
+      cy = MIN (y, last->y);
+      cw = MAX (x + w, last->x + last->width) - cx;
+      ch = MAX (y + h, last->y + last->height) - cy;
+    }
+  else
+    {
+      cx = 0;
+      cy = y;
+      cw = fb->width;
+      ch = h;
+    }
+
+  psplash_fb_draw_rect (fb, cx, cy, cw, ch, PSPLASH_BACKGROUND_COLOR);
+
+  psplash_fb_draw_text (fb,
+			x,
+			y,
+			PSPLASH_TEXT_COLOR,
+			&radeon_font,
+			msg);
+
+  fb->msg_drawn       = TRUE;
+  fb->msg_rect.x      = x;
+  fb->msg_rect.y      = y;
+  fb->msg_rect.width  = w;
+  fb->msg_rect.height = h;
+}
+
+/* Paints the columns of the bar that go from 'old' to 'new', each the
+ * filled part as a start and end column. Without 'old' nothing of the bar
+ * is known to be on the screen and all of it is painted. */
+static void
+psplash_draw_progress_delta (PSplashFB *fb,
+			     int        x,
+			     int        y,
+			     int        width,
+			     int        height,
+			     const int  old[2],
+			     const int  new[2])
+{
+  int edges[6] = { 0, new[0], new[1], width, width, width };
+  int i, j, t, in_old, in_new;
+
+  if (old)
+    {
+      edges[4] = old[0];
+      edges[5] = old[1];
+    }
+
+  /* Between any two consecutive edges a column is either in or out of
+   * each of the filled parts */
+  for (i = 1; i < 6; i++)
+    for (j = i; j > 0 && edges[j - 1] > edges[j]; j--)
+      {
+	t = edges[j]; edges[j] = edges[j - 1]; edges[j - 1] = t;
+      }
+
+  for (i = 0; i < 5; i++)
+    {
+      if (edges[i] == edges[i + 1])
+	continue;
+
+      in_old = old && old[0] <= edges[i] && edges[i] < old[1];
+      in_new = new[0] <= edges[i] && edges[i] < new[1];
+
+      if (old && in_old == in_new)
+	continue;
+
+      if (in_new)
+	psplash_fb_draw_rect (fb, x + edges[i], y,
+			      edges[i + 1] - edges[i], height,
+			      PSPLASH_BAR_COLOR);
+      else
+	psplash_fb_draw_rect (fb, x + edges[i], y,
+			      edges[i + 1] - edges[i], height,
+			      PSPLASH_BAR_BACKGROUND_COLOR);
+    }
+}
+
+void
+psplash_draw_progress (PSplashFB *fb, int value)
+{
+  int x, y, width, height, barwidth;
+  int filled[2];
+
+  /* 4 pix border */
+  x      = ((fb->width  - BAR_IMG_WIDTH)/2) + 4 ;
+  y      = SPLIT_LINE_POS(fb) + 4;
+  width  = BAR_IMG_WIDTH - 8; 
+  height = BAR_IMG_HEIGHT - 8;
+
+  if (value > 0)
+    {
+      barwidth  = (CLAMP(value,0,100) * width) / 100;
+      filled[0] = 0;
+      filled[1] = barwidth;
+    }
+  else
+    {
+      barwidth  = (CLAMP(-value,0,100) * width) / 100;
+      filled[0] = width - barwidth;
+      filled[1] = width;
+    }
+
+  /* Only the columns that change are repainted */
+  psplash_draw_progress_delta (fb, x, y, width, height,
+			       fb->progress_drawn ? fb->progress_filled : NULL,
+			       filled);
+
+  fb->progress_drawn     = TRUE;
+  fb->progress_filled[0] = filled[0];
+  fb->progress_filled[1] = filled[1];
+
+  DBG("value: %i, width: %i, barwidth :%i\n", value, 
+		width, barwidth);
+}
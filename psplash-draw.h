@@ -0,0 +1,36 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_DRAW_H
+#define _HAVE_PSPLASH_DRAW_H
+
+extern const PSplashFont radeon_font;
+
+/* None of these flush, so that several can be drawn and then flushed
+ * together */
+
+void
+psplash_draw_logo (PSplashFB *fb);
+
+void
+psplash_draw_bar (PSplashFB *fb);
+
+void
+psplash_draw_msg (PSplashFB *fb, const char *msg);
+
+void
+psplash_draw_progress (PSplashFB *fb, int value);
+
+#endif
@@ -0,0 +1,633 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  DRM/KMS backend: dumb buffers on the preferred mode of the first
+ *  connected output, flipped on vblank. Talks to the kernel directly so
+ *  there is no need for libdrm.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include <poll.h>
+#include <drm/drm.h>
+#include "psplash.h"
+
+/* Not part of the kernel's uapi headers */
+#define DRM_CONNECTED          1
+#define DRM_PLANE_TYPE_PRIMARY 1
+
+/* How long a flush waits for its flip to land; after that the event is
+ * picked up before the next flip instead */
+#define FLIP_TIMEOUT_MS 100
+
+#define U64_PTR(p) ((__u64) (uintptr_t) (p))
+
+typedef struct PSplashDRMBuffer
+{
+  __u32   handle;
+  __u32   fb_id;
+  __u64   size;
+  char   *map;
+}
+PSplashDRMBuffer;
+
+typedef struct PSplashDRM
+{
+  __u32                    connector_id;
+  __u32                    crtc_id;
+  struct drm_mode_modeinfo mode;
+  struct drm_mode_crtc     saved_crtc;
+
+  PSplashDRMBuffer         buffers[2];
+  int                      n_buffers;
+
+  /* Atomic flips only touch the primary plane's FB_ID */
+  int                      atomic;
+  __u32                    plane_id;
+  __u32                    fb_id_prop;
+
+  /* A flip was queued and its event has not been read yet */
+  int                      flip_pending;
+}
+PSplashDRM;
+
+static int
+drm_ioctl (int fd, unsigned long request, void *arg)
+{
+  int ret;
+
+  do
+    ret = ioctl (fd, request, arg);
+  while (ret == -1 && (errno == EINTR || errno == EAGAIN));
+
+  return ret;
+}
+
+/* Finds a connected connector, its preferred mode and a CRTC to drive it */
+static int
+psplash_drm_find_output (int fd, PSplashDRM *drm, __u32 *crtc_index)
+{
+  struct drm_mode_card_res       res;
+  struct drm_mode_get_connector  conn;
+  struct drm_mode_get_encoder    enc;
+  __u32                         *connectors = NULL, *crtcs = NULL;
+  __u32                         *encoders = NULL;
+  struct drm_mode_modeinfo      *modes = NULL;
+  __u32                          i, j, k;
+  int                            found = FALSE;
+
+  memset (&res, 0, sizeof (res));
+  if (drm_ioctl (fd, DRM_IOCTL_MODE_GETRESOURCES, &res) == -1)
+    return FALSE;
+
+  connectors = calloc (res.count_connectors + 1, sizeof (__u32));
+  crtcs      = calloc (res.count_crtcs + 1, sizeof (__u32));
+  if (!connectors || !crtcs)
+    goto out;
+
+  res.count_fbs          = 0;
+  res.count_encoders     = 0;
+  res.connector_id_ptr   = U64_PTR (connectors);
+  res.crtc_id_ptr        = U64_PTR (crtcs);
+
+  if (drm_ioctl (fd, DRM_IOCTL_MODE_GETRESOURCES, &res) == -1)
+    goto out;
+
+  for (i = 0; i < res.count_connectors && !found; i++)
+    {
+      memset (&conn, 0, sizeof (conn));
+      conn.connector_id = connectors[i];
+
+      if (drm_ioctl (fd, DRM_IOCTL_MODE_GETCONNECTOR, &conn) == -1
+	  || conn.connection != DRM_CONNECTED || conn.count_modes == 0)
+	continue;
+
+      free (modes);
+      free (encoders);
+      modes    = calloc (conn.count_modes, sizeof (*modes));
+      encoders = calloc (conn.count_encoders + 1, sizeof (__u32));
+      if (!modes || !encoders)
+	goto out;
+
+      conn.count_props = 0;
+      conn.modes_ptr    = U64_PTR (modes);
+      conn.encoders_ptr = U64_PTR (encoders);
+
+      if (drm_ioctl (fd, DRM_IOCTL_MODE_GETCONNECTOR, &conn) == -1
+	  || conn.count_modes == 0)
+	continue;
+
+      drm->connector_id = conn.connector_id;
+      drm->mode         = modes[0];
+
+      for (j = 0; j < conn.count_modes; j++)
+	if (modes[j].type & DRM_MODE_TYPE_PREFERRED)
+	  {
+	    drm->mode = modes[j];
+	    break;
+	  }
+
+      /* Keep the CRTC the connector is already on if there is one */
+      memset (&enc, 0, sizeof (enc));
+      enc.encoder_id = conn.encoder_id;
+
+      if (conn.encoder_id
+	  && drm_ioctl (fd, DRM_IOCTL_MODE_GETENCODER, &enc) == 0
+	  && enc.crtc_id)
+	for (k = 0; k < res.count_crtcs; k++)
+	  if (crtcs[k] == enc.crtc_id)
+	    {
+	      drm->crtc_id = enc.crtc_id;
+	      *crtc_index  = k;
+	      found        = TRUE;
+	      break;
+	    }
+
+      for (j = 0; j < conn.count_encoders && !found; j++)
+	{
+	  memset (&enc, 0, sizeof (enc));
+	  enc.encoder_id = encoders[j];
+
+	  if (drm_ioctl (fd, DRM_IOCTL_MODE_GETENCODER, &enc) == -1)
+	    continue;
+
+	  for (k = 0; k < res.count_crtcs; k++)
+	    if (enc.possible_crtcs & (1 << k))
+	      {
+		drm->crtc_id = crtcs[k];
+		*crtc_index  = k;
+		found        = TRUE;
+		break;
+	      }
+	}
+    }
+
+ out:
+  free (connectors);
+  free (crtcs);
+  free (encoders);
+  free (modes);
+
+  return found;
+}
+
+/* Looks up a property of an object by name, returning its id and value */
+static int
+psplash_drm_get_property (int         fd,
+			  __u32       obj_id,
+			  __u32       obj_type,
+			  const char *name,
+			  __u32      *prop_id,
+			  __u64      *value)
+{
+  struct drm_mode_obj_get_properties  props;
+  struct drm_mode_get_property        prop;
+  __u32                              *ids = NULL;
+  __u64                              *values = NULL;
+  __u32                               i;
+  int                                 found = FALSE;
+
+  memset (&props, 0, sizeof (props));
+  props.obj_id   = obj_id;
+  props.obj_type = obj_type;
+
+  if (drm_ioctl (fd, DRM_IOCTL_MODE_OBJ_GETPROPERTIES, &props) == -1)
+    return FALSE;
+
+  ids    = calloc (props.count_props + 1, sizeof (__u32));
+  values = calloc (props.count_props + 1, sizeof (__u64));
+  if (!ids || !values)
+    goto out;
+
+  props.props_ptr       = U64_PTR (ids);
+  props.prop_values_ptr = U64_PTR (values);
+
+  if (drm_ioctl (fd, DRM_IOCTL_MODE_OBJ_GETPROPERTIES, &props) == -1)
+    goto out;
+
+  for (i = 0; i < props.count_props && !found; i++)
+    {
+      memset (&prop, 0, sizeof (prop));
+      prop.prop_id = ids[i];
+
+      if (drm_ioctl (fd, DRM_IOCTL_MODE_GETPROPERTY, &prop) == 0
+	  && !strncmp (prop.name, name, sizeof (prop.name)))
+	{
+	  *prop_id = ids[i];
+	  *value   = values[i];
+	  found    = TRUE;
+	}
+    }
+
+ out:
+  free (ids);
+  free (values);
+
+  return found;
+}
+
+/* Switches to atomic flips if the driver does them, which needs the
+ * primary plane of our CRTC */
+static void
+psplash_drm_setup_atomic (int fd, PSplashDRM *drm, __u32 crtc_index)
+{
+  struct drm_set_client_cap       cap;
+  struct drm_mode_get_plane_res   res;
+  struct drm_mode_get_plane       plane;
+  __u32                          *planes;
+  __u32                           i, prop_id;
+  __u64                           type;
+
+  cap.capability = DRM_CLIENT_CAP_ATOMIC;
+  cap.value      = 1;
+
+  if (drm_ioctl (fd, DRM_IOCTL_SET_CLIENT_CAP, &cap) == -1)
+    return;
+
+  memset (&res, 0, sizeof (res));
+  if (drm_ioctl (fd, DRM_IOCTL_MODE_GETPLANERESOURCES, &res) == -1
+      || (planes = calloc (res.count_planes + 1, sizeof (__u32))) == NULL)
+    return;
+
+  res.plane_id_ptr = U64_PTR (planes);
+
+  if (drm_ioctl (fd, DRM_IOCTL_MODE_GETPLANERESOURCES, &res) == 0)
+    for (i = 0; i < res.count_planes; i++)
+      {
+	memset (&plane, 0, sizeof (plane));
+	plane.plane_id = planes[i];
+
+	if (drm_ioctl (fd, DRM_IOCTL_MODE_GETPLANE, &plane) == -1
+	    || !(plane.possible_crtcs & (1 << crtc_index)))
+	  continue;
+
+	if (psplash_drm_get_property (fd, planes[i], DRM_MODE_OBJECT_PLANE,
+				      "type", &prop_id, &type)
+	    && type == DRM_PLANE_TYPE_PRIMARY
+	    && psplash_drm_get_property (fd, planes[i], DRM_MODE_OBJECT_PLANE,
+					 "FB_ID", &drm->fb_id_prop, &type))
+	  {
+	    drm->plane_id = planes[i];
+	    drm->atomic   = TRUE;
+	    break;
+	  }
+      }
+
+  free (planes);
+}
+
+static int
+psplash_drm_create_buffer (int fd, PSplashDRM *drm, PSplashDRMBuffer *buf,
+			   __u32 *pitch)
+{
+  struct drm_mode_create_dumb create;
+  struct drm_mode_map_dumb    map;
+  struct drm_mode_fb_cmd      cmd;
+  void                       *p;
+
+  memset (&create, 0, sizeof (create));
+  create.width  = drm->mode.hdisplay;
+  create.height = drm->mode.vdisplay;
+  create.bpp    = 32;
+
+  if (drm_ioctl (fd, DRM_IOCTL_MODE_CREATE_DUMB, &create) == -1)
+    return FALSE;
+
+  buf->handle = create.handle;
+  buf->size   = create.size;
+  *pitch      = create.pitch;
+
+  memset (&cmd, 0, sizeof (cmd));
+  cmd.width  = create.width;
+  cmd.height = create.height;
+  cmd.pitch  = create.pitch;
+  cmd.bpp    = 32;
+  cmd.depth  = 24;
+  cmd.handle = create.handle;
+
+  if (drm_ioctl (fd, DRM_IOCTL_MODE_ADDFB, &cmd) == -1)
+    return FALSE;
+
+  buf->fb_id = cmd.fb_id;
+
+  memset (&map, 0, sizeof (map));
+  map.handle = create.handle;
+
+  if (drm_ioctl (fd, DRM_IOCTL_MODE_MAP_DUMB, &map) == -1)
+    return FALSE;
+
+  p = mmap (NULL, create.size, PROT_READ | PROT_WRITE, MAP_SHARED,
+	    fd, map.offset);
+  if (p == MAP_FAILED)
+    return FALSE;
+
+  buf->map = p;
+
+  return TRUE;
+}
+
+static void
+psplash_drm_destroy_buffer (int fd, PSplashDRMBuffer *buf)
+{
+  struct drm_mode_destroy_dumb destroy;
+
+  if (buf->map)
+    munmap (buf->map, buf->size);
+  if (buf->fb_id)
+    drm_ioctl (fd, DRM_IOCTL_MODE_RMFB, &buf->fb_id);
+  if (buf->handle)
+    {
+      destroy.handle = buf->handle;
+      drm_ioctl (fd, DRM_IOCTL_MODE_DESTROY_DUMB, &destroy);
+    }
+
+  memset (buf, 0, sizeof (*buf));
+}
+
+/* Waits up to 'timeout' milliseconds for the event of the flip that is
+ * pending */
+static int
+psplash_drm_wait_flip (int fd, int timeout)
+{
+  struct pollfd     pfd = { .fd = fd, .events = POLLIN };
+  char              buf[1024];
+  struct drm_event *ev;
+  ssize_t           len, i;
+
+  for (;;)
+    {
+      if ((len = poll (&pfd, 1, timeout)) == -1 && errno == EINTR)
+	continue;
+      if (len <= 0)
+	return FALSE;
+
+      if ((len = read (fd, buf, sizeof (buf))) <= 0)
+	{
+	  if (len == -1 && (errno == EINTR || errno == EAGAIN))
+	    continue;
+	  return FALSE;
+	}
+
+      for (i = 0; i + (ssize_t) sizeof (*ev) <= len; i += ev->length)
+	{
+	  ev = (struct drm_event *) (buf + i);
+
+	  if (ev->type == DRM_EVENT_FLIP_COMPLETE)
+	    return TRUE;
+	  if (ev->length == 0)
+	    break;
+	}
+    }
+}
+
+/* A flip the kernel accepted will happen, however late its event is */
+static int
+psplash_drm_flip_queued (PSplashFB *fb)
+{
+  PSplashDRM *drm = fb->priv;
+
+  drm->flip_pending = !psplash_drm_wait_flip (fb->fd, FLIP_TIMEOUT_MS);
+
+  return TRUE;
+}
+
+static int
+psplash_drm_flip (PSplashFB *fb, int page)
+{
+  PSplashDRM                     *drm = fb->priv;
+  struct drm_mode_crtc_page_flip  flip;
+  __u32                           fb_id = drm->buffers[page].fb_id;
+
+  /* The kernel refuses a flip while the last one is still in flight. If
+   * its event never comes, stay on the page it put up, which is the
+   * front one, rather than wait for ever. */
+  if (drm->flip_pending)
+    {
+      drm->flip_pending = FALSE;
+      if (!psplash_drm_wait_flip (fb->fd, FLIP_TIMEOUT_MS))
+	{
+	  fprintf (stderr, "Error, the last page flip never completed\n");
+	  return FALSE;
+	}
+    }
+
+  if (drm->atomic)
+    {
+      struct drm_mode_atomic atomic;
+      __u32                  count_props = 1;
+      __u64                  value = fb_id;
+
+      memset (&atomic, 0, sizeof (atomic));
+      atomic.flags           = DRM_MODE_PAGE_FLIP_EVENT
+	| DRM_MODE_ATOMIC_NONBLOCK;
+      atomic.count_objs      = 1;
+      atomic.objs_ptr        = U64_PTR (&drm->plane_id);
+      atomic.count_props_ptr = U64_PTR (&count_props);
+      atomic.props_ptr       = U64_PTR (&drm->fb_id_prop);
+      atomic.prop_values_ptr = U64_PTR (&value);
+
+      if (drm_ioctl (fb->fd, DRM_IOCTL_MODE_ATOMIC, &atomic) == 0)
+	return psplash_drm_flip_queued (fb);
+
+      perror ("Error committing atomic flip, trying a legacy one");
+      drm->atomic = FALSE;
+    }
+
+  memset (&flip, 0, sizeof (flip));
+  flip.crtc_id = drm->crtc_id;
+  flip.fb_id   = fb_id;
+  flip.flags   = DRM_MODE_PAGE_FLIP_EVENT;
+
+  if (drm_ioctl (fb->fd, DRM_IOCTL_MODE_PAGE_FLIP, &flip) == -1)
+    {
+      perror ("Error flipping page");
+      return FALSE;
+    }
+
+  return psplash_drm_flip_queued (fb);
+}
+
+/* Single buffered, some drivers need telling what changed */
+static void
+psplash_drm_dirty (PSplashFB *fb)
+{
+  PSplashDRM                   *drm = fb->priv;
+  struct drm_mode_fb_dirty_cmd  dirty;
+  struct drm_clip_rect          clips[PSPLASH_FB_MAX_DAMAGE];
+  int                           i;
+
+  if (fb->n_damage == 0)
+    return;
+
+  for (i = 0; i < fb->n_damage; i++)
+    {
+      clips[i].x1 = fb->damage[i].x;
+      clips[i].y1 = fb->damage[i].y;
+      clips[i].x2 = fb->damage[i].x + fb->damage[i].width;
+      clips[i].y2 = fb->damage[i].y + fb->damage[i].height;
+    }
+
+  memset (&dirty, 0, sizeof (dirty));
+  dirty.fb_id     = drm->buffers[fb->front].fb_id;
+  dirty.num_clips = fb->n_damage;
+  dirty.clips_ptr = U64_PTR (clips);
+
+  /* ENOSYS just means the driver scans out straight from memory */
+  drm_ioctl (fb->fd, DRM_IOCTL_MODE_DIRTYFB, &dirty);
+}
+
+static void
+psplash_drm_destroy (PSplashFB *fb)
+{
+  PSplashDRM *drm = fb->priv;
+  int         i;
+
+  if (drm)
+    {
+      /* Don't free a buffer that is about to be scanned out */
+      if (drm->flip_pending)
+	psplash_drm_wait_flip (fb->fd, FLIP_TIMEOUT_MS);
+
+      /* Put back whatever was showing before us */
+      if (drm->saved_crtc.crtc_id)
+	{
+	  drm->saved_crtc.set_connectors_ptr = U64_PTR (&drm->connector_id);
+	  drm->saved_crtc.count_connectors   = 1;
+	  drm_ioctl (fb->fd, DRM_IOCTL_MODE_SETCRTC, &drm->saved_crtc);
+	}
+
+      for (i = 0; i < 2; i++)
+	psplash_drm_destroy_buffer (fb->fd, &drm->buffers[i]);
+
+      free (drm);
+    }
+
+  if (fb->fd >= 0)
+    close (fb->fd);
+}
+
+static const PSplashFBBackend psplash_drm_backend =
+{
+  .name    = "drm",
+  .flip    = psplash_drm_flip,
+  .dirty   = psplash_drm_dirty,
+  .destroy = psplash_drm_destroy,
+};
+
+PSplashFB*
+psplash_drm_new (int angle, int card_id)
+{
+  struct drm_get_cap   cap;
+  struct drm_mode_crtc crtc;
+  PSplashFB           *fb = NULL;
+  PSplashDRM          *drm;
+  char                 card[32];
+  __u32                crtc_index = 0, pitch = 0, pitch2 = 0;
+
+  snprintf (card, sizeof (card), "/dev/dri/card%i", card_id);
+
+  if ((fb = calloc (1, sizeof (PSplashFB))) == NULL
+      || (fb->priv = drm = calloc (1, sizeof (PSplashDRM))) == NULL)
+    {
+      perror ("Error no memory");
+      goto fail;
+    }
+
+  fb->fd      = -1;
+  fb->alloc   = -1;
+  fb->backend = &psplash_drm_backend;
+
+  if ((fb->fd = open (card, O_RDWR | O_CLOEXEC)) < 0)
+    {
+      fprintf(stderr, "Error opening %s\n", card);
+      goto fail;
+    }
+
+  cap.capability = DRM_CAP_DUMB_BUFFER;
+  if (drm_ioctl (fb->fd, DRM_IOCTL_GET_CAP, &cap) == -1 || !cap.value)
+    {
+      fprintf(stderr, "Error, %s has no dumb buffers\n", card);
+      goto fail;
+    }
+
+  if (!psplash_drm_find_output (fb->fd, drm, &crtc_index))
+    {
+      fprintf(stderr, "Error, no connected output on %s\n", card);
+      goto fail;
+    }
+
+  if (!psplash_drm_create_buffer (fb->fd, drm, &drm->buffers[0], &pitch))
+    {
+      perror ("Error creating a dumb buffer");
+      goto fail;
+    }
+
+  /* Without a second buffer everything is drawn onto the one showing */
+  drm->n_buffers = 1;
+  if (psplash_drm_create_buffer (fb->fd, drm, &drm->buffers[1], &pitch2)
+      && pitch2 == pitch)
+    drm->n_buffers = 2;
+  else
+    psplash_drm_destroy_buffer (fb->fd, &drm->buffers[1]);
+
+  memset (&drm->saved_crtc, 0, sizeof (drm->saved_crtc));
+  drm->saved_crtc.crtc_id = drm->crtc_id;
+  if (drm_ioctl (fb->fd, DRM_IOCTL_MODE_GETCRTC, &drm->saved_crtc) == -1)
+    drm->saved_crtc.crtc_id = 0;
+
+  memset (&crtc, 0, sizeof (crtc));
+  crtc.crtc_id            = drm->crtc_id;
+  crtc.fb_id              = drm->buffers[0].fb_id;
+  crtc.set_connectors_ptr = U64_PTR (&drm->connector_id);
+  crtc.count_connectors   = 1;
+  crtc.mode               = drm->mode;
+  crtc.mode_valid         = 1;
+
+  if (drm_ioctl (fb->fd, DRM_IOCTL_MODE_SETCRTC, &crtc) == -1)
+    {
+      perror ("Error setting mode");
+      goto fail;
+    }
+
+  if (drm->n_buffers == 2)
+    psplash_drm_setup_atomic (fb->fd, drm, crtc_index);
+
+  fprintf(stdout, "Using %s, %ix%i %s flips\n", card,
+	  drm->mode.hdisplay, drm->mode.vdisplay,
+	  drm->n_buffers < 2 ? "without" : drm->atomic ? "atomic" : "legacy");
+
+  fb->width        = drm->mode.hdisplay;
+  fb->height       = drm->mode.vdisplay;
+  fb->bpp          = 32;
+  fb->stride       = pitch;
+  fb->red_offset   = 16;
+  fb->red_length   = 8;
+  fb->green_offset = 8;
+  fb->green_length = 8;
+  fb->blue_offset  = 0;
+  fb->blue_length  = 8;
+
+  fb->pages[0]        = drm->buffers[0].map;
+  fb->pages[1]        = drm->buffers[1].map;
+  fb->double_buffered = drm->n_buffers == 2;
+
+  psplash_fb_setup (fb, angle);
+
+  return fb;
+
+ fail:
+
+  if (fb)
+    psplash_fb_destroy (fb);
+
+  return NULL;
+}
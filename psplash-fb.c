@@ -18,22 +18,338 @@
 #include <endian.h>
 #include "psplash.h"
 
+static void
+psplash_fb_image_free (PSplashFBImage *img);
+
+static void
+psplash_fb_glyph_cache_free (struct PSplashFBGlyphCache *cache);
+
 void
 psplash_fb_destroy (PSplashFB *fb)
 {
-  if (fb->alloc == 1)
-      free(fb->base);
-  if (fb->fd >= 0)
-    close (fb->fd);
+  while (fb->images)
+    {
+      PSplashFBImage *next = fb->images->next;
+
+      psplash_fb_image_free (fb->images);
+      fb->images = next;
+    }
+
+  psplash_fb_glyph_cache_free (fb->glyph_caches);
+
+  free(fb->shadow);
+
+  if (fb->backend)
+    fb->backend->destroy (fb);
 
   free(fb);
 }
 
+/* Damage tracking */
+
+static inline int
+psplash_fb_rect_touches (const PSplashFBRect *a, const PSplashFBRect *b)
+{
+  return a->x <= b->x + b->width && b->x <= a->x + a->width
+    && a->y <= b->y + b->height && b->y <= a->y + a->height;
+}
+
+static inline void
+psplash_fb_rect_union (PSplashFBRect *a, const PSplashFBRect *b)
+{
+  int x2 = MAX (a->x + a->width, b->x + b->width);
+  int y2 = MAX (a->y + a->height, b->y + b->height);
+
+  a->x      = MIN (a->x, b->x);
+  a->y      = MIN (a->y, b->y);
+  a->width  = x2 - a->x;
+  a->height = y2 - a->y;
+}
+
+/* Records a drawn physical rectangle. Anything it touches is merged into
+ * it, and when the list is full it goes to whichever rectangle grows the
+ * least by taking it in. */
+static void
+psplash_fb_damage (PSplashFB *fb, int x, int y, int width, int height)
+{
+  PSplashFBRect r = { x, y, width, height }, u;
+  long          growth, best_growth;
+  int           i, best;
+
+  for (;;)
+    {
+      for (i = 0; i < fb->n_damage; i++)
+	if (psplash_fb_rect_touches (&fb->damage[i], &r))
+	  break;
+
+      if (i == fb->n_damage)
+	{
+	  if (fb->n_damage < PSPLASH_FB_MAX_DAMAGE)
+	    {
+	      fb->damage[fb->n_damage++] = r;
+	      return;
+	    }
+
+	  best = 0;
+	  best_growth = LONG_MAX;
+
+	  for (i = 0; i < fb->n_damage; i++)
+	    {
+	      u = fb->damage[i];
+	      psplash_fb_rect_union (&u, &r);
+	      growth = (long) u.width * u.height
+		- (long) fb->damage[i].width * fb->damage[i].height;
+
+	      if (growth < best_growth)
+		{
+		  best = i;
+		  best_growth = growth;
+		}
+	    }
+
+	  i = best;
+	}
+
+      psplash_fb_rect_union (&r, &fb->damage[i]);
+      fb->damage[i] = fb->damage[--fb->n_damage];
+    }
+}
+
+/* Writes the rows the damage covers, coalescing overlapping row ranges so
+ * that each ends up as a single pwrite() */
+static void
+psplash_fb_flush_rows (PSplashFB *fb)
+{
+  int ys[PSPLASH_FB_MAX_DAMAGE], ye[PSPLASH_FB_MAX_DAMAGE];
+  int i, j, n = fb->n_damage, start, end;
+  off_t off;
+  size_t length;
+  ssize_t written;
+
+  for (i = 0; i < n; i++)
+    {
+      start = fb->damage[i].y;
+      end   = fb->damage[i].y + fb->damage[i].height;
+
+      for (j = i; j > 0 && ys[j - 1] > start; j--)
+	{
+	  ys[j] = ys[j - 1];
+	  ye[j] = ye[j - 1];
+	}
+
+      ys[j] = start;
+      ye[j] = end;
+    }
+
+  /* Offset 0 of the device is the start of the first page, not of our
+   * copy of it; 'data' may also be the second page */
+  off = fb->data - fb->pages[0];
+
+  for (i = 0; i < n; i = j)
+    {
+      start = ys[i];
+      end   = ye[i];
+
+      for (j = i + 1; j < n && ys[j] <= end; j++)
+	end = MAX (end, ye[j]);
+
+      /* A device may take less than it was given, or be interrupted */
+      for (length = 0; length < (size_t) (end - start) * fb->stride;
+	   length += written)
+	{
+	  written = pwrite (fb->fd, fb->data + start * fb->stride + length,
+			    (end - start) * fb->stride - length,
+			    off + start * fb->stride + length);
+	  if (written > 0)
+	    continue;
+
+	  if (written < 0 && errno == EINTR)
+	    {
+	      written = 0;
+	      continue;
+	    }
+
+	  if (written < 0)
+	    perror ("Error writing to framebuffer");
+	  else
+	    fprintf (stderr, "Error writing to framebuffer, no space left\n");
+	  return;
+	}
+    }
+}
+
+/* Copies the damaged rectangles from the shadow buffer onto a page */
+static void
+psplash_fb_copy_damage (PSplashFB *fb, char *page)
+{
+  int bytes = fb->bpp >> 3;
+  int i, dy;
+
+  for (i = 0; i < fb->n_damage; i++)
+    {
+      const PSplashFBRect *r = &fb->damage[i];
+      size_t               offset = r->y * fb->stride + r->x * bytes;
+
+      for (dy = 0; dy < r->height; dy++, offset += fb->stride)
+	memcpy (page + offset, fb->shadow + offset, r->width * bytes);
+    }
+}
+
+static void
+psplash_fb_flip (PSplashFB *fb)
+{
+  PSplashFBRect damage[PSPLASH_FB_MAX_DAMAGE];
+  int           n_damage = fb->n_damage, back = fb->front ^ 1, i;
+
+  if (n_damage == 0)
+    return;
+
+  /* The back page also missed what went onto the front one last time */
+  memcpy (damage, fb->damage, sizeof (damage));
+  for (i = 0; i < fb->n_prev_damage; i++)
+    psplash_fb_damage (fb, fb->prev_damage[i].x, fb->prev_damage[i].y,
+		       fb->prev_damage[i].width, fb->prev_damage[i].height);
+
+  psplash_fb_copy_damage (fb, fb->pages[back]);
+
+  if (!fb->backend->flip (fb, back))
+    {
+      fprintf(stderr, "Error, cannot flip pages, no longer double buffering\n");
+
+      /* Stay on the page that is showing, it only lacks this damage */
+      fb->double_buffered = FALSE;
+      psplash_fb_copy_damage (fb, fb->pages[fb->front]);
+      if (fb->backend->dirty)
+	fb->backend->dirty (fb);
+      return;
+    }
+
+  fb->front = back;
+  memcpy (fb->prev_damage, damage, sizeof (damage));
+  fb->n_prev_damage = n_damage;
+}
+
 void
 psplash_fb_flush (PSplashFB *fb)
+{
+  /* Someone else has the screen, keep the damage for later */
+  if (fb->suspended)
+    return;
+
+  if (fb->double_buffered)
+    psplash_fb_flip (fb);
+  else
+    {
+      if (fb->shadow)
+	psplash_fb_copy_damage (fb, fb->pages[fb->front]);
+      if (fb->backend->dirty)
+	fb->backend->dirty (fb);
+    }
+
+  fb->n_damage = 0;
+}
+
+/* Stops flushes reaching the screen, say while our VT is switched away
+ * from. Drawing carries on in the shadow buffer. */
+void
+psplash_fb_suspend (PSplashFB *fb)
+{
+  fb->suspended = TRUE;
+}
+
+/* Puts all of the shadow buffer back on a screen that may have been drawn
+ * over in the meantime */
+void
+psplash_fb_resume (PSplashFB *fb)
+{
+  fb->suspended = FALSE;
+
+  /* With double buffering the other page gets it all on the next flip */
+  psplash_fb_damage (fb, 0, 0, fb->real_width, fb->real_height);
+  psplash_fb_flush (fb);
+}
+
+/* The fbdev backend */
+
+static int
+psplash_fbdev_flip (PSplashFB *fb, int page)
+{
+  __u32 crtc = 0;
+
+  fb->fb_var.yoffset = page * fb->real_height;
+
+  if (ioctl (fb->fd, FBIOPAN_DISPLAY, &fb->fb_var) == -1)
+    {
+      perror ("Error panning display");
+      fb->fb_var.yoffset = fb->front * fb->real_height;
+      return FALSE;
+    }
+
+  /* Drivers that pan asynchronously would otherwise still be scanning
+   * out the page the next flush draws on */
+  ioctl (fb->fd, FBIO_WAITFORVSYNC, &crtc);
+
+  return TRUE;
+}
+
+static void
+psplash_fbdev_dirty (PSplashFB *fb)
+{
+  if (fb->alloc == 1)
+    psplash_fb_flush_rows (fb);
+}
+
+static void
+psplash_fbdev_destroy (PSplashFB *fb)
 {
   if (fb->alloc == 1)
-      pwrite(fb->fd, fb->base, fb->stride * fb->height, 0);
+      free(fb->base);
+  if (fb->fd >= 0)
+    close (fb->fd);
+}
+
+static const PSplashFBBackend psplash_fbdev_backend =
+{
+  .name    = "fbdev",
+  .flip    = psplash_fbdev_flip,
+  .dirty   = psplash_fbdev_dirty,
+  .destroy = psplash_fbdev_destroy,
+};
+
+/* Asks for a second page below the visible one to flip to. Leaves the
+ * screen info as it was if the driver can't or won't. */
+static int
+psplash_fb_setup_pages (PSplashFB                *fb,
+			struct fb_var_screeninfo *fb_var,
+			struct fb_fix_screeninfo *fb_fix)
+{
+  struct fb_var_screeninfo var = *fb_var;
+
+  var.yres_virtual = fb_var->yres * 2;
+  var.yoffset      = 0;
+
+  if (ioctl (fb->fd, FBIOPUT_VSCREENINFO, &var) == 0
+      && ioctl (fb->fd, FBIOGET_VSCREENINFO, &var) == 0
+      && ioctl (fb->fd, FBIOGET_FSCREENINFO, fb_fix) == 0
+      && var.yres_virtual >= var.yres * 2
+      && var.yres == fb_var->yres
+      && var.bits_per_pixel == fb_var->bits_per_pixel
+      && fb_fix->ypanstep != 0
+      && (fb_fix->smem_len == 0
+	  || fb_fix->smem_len >= fb_fix->line_length * var.yres * 2))
+    {
+      fprintf(stdout, "Double buffering with a %i line virtual screen\n",
+	      var.yres_virtual);
+      *fb_var = var;
+      return 1;
+    }
+
+  fprintf(stderr, "Error, no room to double buffer, drawing directly\n");
+
+  ioctl (fb->fd, FBIOPUT_VSCREENINFO, fb_var);
+  ioctl (fb->fd, FBIOGET_FSCREENINFO, fb_fix);
+
+  return 0;
 }
 
 static int
@@ -107,8 +423,282 @@ attempt_to_change_pixel_format (PSplashFB *fb,
   return 0;
 }
 
+#define OFFSET(fb,x,y) (((y) * (fb)->stride) + ((x) * ((fb)->bpp >> 3)))
+
+/* Pixel packing for each colour order. The 24 and 32 bpp variants of a
+ * mode share the same 8,8,8 value and only differ in how it is stored. */
+
+static inline uint32_t
+pack_rgb565 (const PSplashFB *UNUSED(fb), uint8 red, uint8 green, uint8 blue)
+{
+  return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3);
+}
+
+static inline uint32_t
+pack_bgr565 (const PSplashFB *UNUSED(fb), uint8 red, uint8 green, uint8 blue)
+{
+  return ((blue >> 3) << 11) | ((green >> 2) << 5) | (red >> 3);
+}
+
+static inline uint32_t
+pack_rgb888 (const PSplashFB *UNUSED(fb), uint8 red, uint8 green, uint8 blue)
+{
+  return (red << 16) | (green << 8) | (blue);
+}
+
+static inline uint32_t
+pack_bgr888 (const PSplashFB *UNUSED(fb), uint8 red, uint8 green, uint8 blue)
+{
+  return (blue << 16) | (green << 8) | (red);
+}
+
+static inline uint32_t
+pack_generic (const PSplashFB *fb, uint8 red, uint8 green, uint8 blue)
+{
+  return ((uint32_t) (red >> (8 - fb->red_length)) << fb->red_offset)
+    | ((uint32_t) (green >> (8 - fb->green_length)) << fb->green_offset)
+    | ((uint32_t) (blue >> (8 - fb->blue_length)) << fb->blue_offset);
+}
+
+static inline uint32_t
+pack_none (const PSplashFB *UNUSED(fb),
+	   uint8 UNUSED(red), uint8 UNUSED(green), uint8 UNUSED(blue))
+{
+  return 0;
+}
+
+static inline void
+store_16 (char *dst, uint32_t pixel)
+{
+  *(uint16_t *) dst = pixel;
+}
+
+static inline void
+store_24 (char *dst, uint32_t pixel)
+{
+#if __BYTE_ORDER == __BIG_ENDIAN
+  *(dst + 0) = pixel >> 16;
+  *(dst + 1) = pixel >> 8;
+  *(dst + 2) = pixel;
+#else
+  *(dst + 0) = pixel;
+  *(dst + 1) = pixel >> 8;
+  *(dst + 2) = pixel >> 16;
+#endif
+}
+
+static inline void
+store_32 (char *dst, uint32_t pixel)
+{
+  *(uint32_t *) dst = pixel;
+}
+
+static inline uint32_t
+load_pixel (const char *src, int bytes)
+{
+  const uint8 *p = (const uint8 *) src;
+
+  switch (bytes)
+    {
+    case 2:
+      return *(const uint16_t *) src;
+    case 3:
+#if __BYTE_ORDER == __BIG_ENDIAN
+      return (*(p + 0) << 16) | (*(p + 1) << 8) | *(p + 2);
+#else
+      return *(p + 0) | (*(p + 1) << 8) | (*(p + 2) << 16);
+#endif
+    case 4:
+      return *(const uint32_t *) src;
+    default:
+      return 0;
+    }
+}
+
+static inline void
+store_none (char *UNUSED(dst), uint32_t UNUSED(pixel))
+{
+}
+
+/* Solid spans. Spans always run along a physical framebuffer row, the
+ * rotation is taken care of by whoever hands them out. */
+
+static void
+fill_span_16 (char *dst, int len, uint32_t pixel)
+{
+  uint16_t *p = (uint16_t *) dst;
+
+  while (len-- > 0)
+    *p++ = pixel;
+}
+
+static void
+fill_span_24 (char *dst, int len, uint32_t pixel)
+{
+  for (; len > 0; len--, dst += 3)
+    store_24 (dst, pixel);
+}
+
+static void
+fill_span_32 (char *dst, int len, uint32_t pixel)
+{
+  uint32_t *p = (uint32_t *) dst;
+
+  while (len-- > 0)
+    *p++ = pixel;
+}
+
+static void
+fill_span_none (char *UNUSED(dst), int UNUSED(len), uint32_t UNUSED(pixel))
+{
+}
+
+/* Image spans, converting RGB or RGBA source pixels on the way. Source
+ * pixels are 'src_step' bytes apart, so a span can be gathered from a
+ * column of a rotated image. Pixels with a zero alpha byte are left out. */
+
+#define DEFINE_COPY_SPAN(name, pack, store, bytes)			\
+static void								\
+copy_span_##name (const PSplashFB *fb, char *dst, const uint8 *src,	\
+		  int src_bpp, int src_step, int len)			\
+{									\
+  for (; len > 0; len--, dst += (bytes), src += src_step)		\
+    if (src_bpp < 4 || *(src + 3))					\
+      store (dst, pack (fb, *(src), *(src + 1), *(src + 2)));		\
+}
+
+DEFINE_COPY_SPAN (rgb565_16,  pack_rgb565,  store_16, 2)
+DEFINE_COPY_SPAN (bgr565_16,  pack_bgr565,  store_16, 2)
+DEFINE_COPY_SPAN (rgb888_24,  pack_rgb888,  store_24, 3)
+DEFINE_COPY_SPAN (bgr888_24,  pack_bgr888,  store_24, 3)
+DEFINE_COPY_SPAN (rgb888_32,  pack_rgb888,  store_32, 4)
+DEFINE_COPY_SPAN (bgr888_32,  pack_bgr888,  store_32, 4)
+DEFINE_COPY_SPAN (generic_16, pack_generic, store_16, 2)
+DEFINE_COPY_SPAN (generic_32, pack_generic, store_32, 4)
+DEFINE_COPY_SPAN (none,       pack_none,    store_none, 0)
+
+static const struct
+{
+  enum RGBMode      rgbmode;
+  int               bpp;
+  PSplashFBPack     pack;
+  PSplashFBFillSpan fill;
+  PSplashFBCopySpan copy;
+}
+span_writers[] =
+{
+  { RGB565,  16, pack_rgb565,  fill_span_16, copy_span_rgb565_16  },
+  { RGB565,  24, pack_rgb888,  fill_span_24, copy_span_rgb888_24  },
+  { RGB565,  32, pack_rgb888,  fill_span_32, copy_span_rgb888_32  },
+  { RGB888,  16, pack_rgb565,  fill_span_16, copy_span_rgb565_16  },
+  { RGB888,  24, pack_rgb888,  fill_span_24, copy_span_rgb888_24  },
+  { RGB888,  32, pack_rgb888,  fill_span_32, copy_span_rgb888_32  },
+  { BGR565,  16, pack_bgr565,  fill_span_16, copy_span_bgr565_16  },
+  { BGR565,  24, pack_bgr888,  fill_span_24, copy_span_bgr888_24  },
+  { BGR565,  32, pack_bgr888,  fill_span_32, copy_span_bgr888_32  },
+  { BGR888,  16, pack_bgr565,  fill_span_16, copy_span_bgr565_16  },
+  { BGR888,  24, pack_bgr888,  fill_span_24, copy_span_bgr888_24  },
+  { BGR888,  32, pack_bgr888,  fill_span_32, copy_span_bgr888_32  },
+  { GENERIC, 16, pack_generic, fill_span_16, copy_span_generic_16 },
+  { GENERIC, 32, pack_generic, fill_span_32, copy_span_generic_32 },
+};
+
+static void
+psplash_fb_setup_span_writers (PSplashFB *fb)
+{
+  unsigned int i;
+
+  /* depth not supported yet, draw nothing */
+  fb->pack_pixel = pack_none;
+  fb->fill_span  = fill_span_none;
+  fb->copy_span  = copy_span_none;
+
+  for (i = 0; i < sizeof (span_writers) / sizeof (span_writers[0]); i++)
+    if (span_writers[i].rgbmode == fb->rgbmode
+	&& span_writers[i].bpp == fb->bpp)
+      {
+	fb->pack_pixel = span_writers[i].pack;
+	fb->fill_span  = span_writers[i].fill;
+	fb->copy_span  = span_writers[i].copy;
+	break;
+      }
+
+  fb->stream_span = fb->fill_span;
+
+  if (fb->fill_span != fill_span_none)
+    psplash_fill_select (fb->bpp, &fb->fill_span, &fb->stream_span);
+}
+
+/* Finishes off a framebuffer whose backend has filled in the geometry,
+ * pixel format and pages: picks the span writers, sets up the shadow
+ * buffer and applies the rotation. */
+void
+psplash_fb_setup (PSplashFB *fb, int angle)
+{
+  fb->real_width  = fb->width;
+  fb->real_height = fb->height;
+
+  if (fb->red_offset == 11 && fb->red_length == 5 &&
+      fb->green_offset == 5 && fb->green_length == 6 &&
+      fb->blue_offset == 0 && fb->blue_length == 5) {
+         fb->rgbmode = RGB565;
+  } else if (fb->red_offset == 0 && fb->red_length == 5 &&
+      fb->green_offset == 5 && fb->green_length == 6 &&
+      fb->blue_offset == 11 && fb->blue_length == 5) {
+         fb->rgbmode = BGR565;
+  } else if (fb->red_offset == 16 && fb->red_length == 8 &&
+      fb->green_offset == 8 && fb->green_length == 8 &&
+      fb->blue_offset == 0 && fb->blue_length == 8) {
+         fb->rgbmode = RGB888;
+  } else if (fb->red_offset == 0 && fb->red_length == 8 &&
+      fb->green_offset == 8 && fb->green_length == 8 &&
+      fb->blue_offset == 16 && fb->blue_length == 8) {
+         fb->rgbmode = BGR888;
+  } else {
+         fb->rgbmode = GENERIC;
+  }
+
+  psplash_fb_setup_span_writers (fb);
+
+  DBG("%s width: %i, height: %i, bpp: %i, stride: %i", fb->backend->name,
+      fb->width, fb->height, fb->bpp, fb->stride);
+
+  fb->data = fb->pages[0];
+
+  /* Blending has to read back what is underneath, which is painfully slow
+   * from write-combined video memory, so draw into a copy in normal RAM
+   * and have psplash_fb_flush() push it out. */
+  if (fb->alloc != 1
+      && (fb->shadow = calloc (1, fb->stride * fb->real_height)) != NULL)
+    fb->data = fb->shadow;
+
+  /* Pages are filled from the shadow buffer, and neither of them holds
+   * anything of it yet */
+  if (fb->double_buffered && fb->shadow == NULL)
+    fb->double_buffered = FALSE;
+  if (fb->double_buffered)
+    psplash_fb_damage (fb, 0, 0, fb->real_width, fb->real_height);
+
+  psplash_blend_select (fb, fb->shadow != NULL || fb->alloc == 1);
+
+  fb->angle = angle;
+
+  switch (fb->angle)
+    {
+    case 270:
+    case 90:
+      fb->width  = fb->real_height;
+      fb->height = fb->real_width;
+      break;
+    case 180:
+    case 0:
+    default:
+      break;
+    }
+}
+
 PSplashFB*
-psplash_fb_new (int angle, int fbdev_id)
+psplash_fb_new (int angle, int fbdev_id, bool double_buffer)
 {
   struct fb_var_screeninfo fb_var;
   struct fb_fix_screeninfo fb_fix;
@@ -133,6 +723,7 @@ psplash_fb_new (int angle, int fbdev_id)
 
   fb->fd = -1;
   fb->alloc = -1;
+  fb->backend = &psplash_fbdev_backend;
 
   if ((fb->fd = open (fbdev, O_RDWR)) < 0)
     {
@@ -173,8 +764,13 @@ psplash_fb_new (int angle, int fbdev_id)
       goto fail;
     }
 
-  fb->real_width  = fb->width  = fb_var.xres;
-  fb->real_height = fb->height = fb_var.yres;
+  if (double_buffer)
+    fb->double_buffered = psplash_fb_setup_pages (fb, &fb_var, &fb_fix);
+
+  fb->fb_var = fb_var;
+
+  fb->width  = fb_var.xres;
+  fb->height = fb_var.yres;
   fb->bpp    = fb_var.bits_per_pixel;
   fb->stride = fb_fix.line_length;
   fb->type   = fb_fix.type;
@@ -187,30 +783,7 @@ psplash_fb_new (int angle, int fbdev_id)
   fb->blue_offset = fb_var.blue.offset;
   fb->blue_length = fb_var.blue.length;
 
-  if (fb->red_offset == 11 && fb->red_length == 5 &&
-      fb->green_offset == 5 && fb->green_length == 6 &&
-      fb->blue_offset == 0 && fb->blue_length == 5) {
-         fb->rgbmode = RGB565;
-  } else if (fb->red_offset == 0 && fb->red_length == 5 &&
-      fb->green_offset == 5 && fb->green_length == 6 &&
-      fb->blue_offset == 11 && fb->blue_length == 5) {
-         fb->rgbmode = BGR565;
-  } else if (fb->red_offset == 16 && fb->red_length == 8 &&
-      fb->green_offset == 8 && fb->green_length == 8 &&
-      fb->blue_offset == 0 && fb->blue_length == 8) {
-         fb->rgbmode = RGB888;
-  } else if (fb->red_offset == 0 && fb->red_length == 8 &&
-      fb->green_offset == 8 && fb->green_length == 8 &&
-      fb->blue_offset == 16 && fb->blue_length == 8) {
-         fb->rgbmode = BGR888;
-  } else {
-         fb->rgbmode = GENERIC;
-  }
-
-  DBG("width: %i, height: %i, bpp: %i, stride: %i",
-      fb->width, fb->height, fb->bpp, fb->stride);
-
-  size_t size = fb->stride * fb->height;
+  size_t size = fb->stride * fb->height * (fb->double_buffered ? 2 : 1);
 
   fb->base = (char *) mmap ((caddr_t) NULL,
 			    /*fb_fix.smem_len */
@@ -222,6 +795,8 @@ psplash_fb_new (int angle, int fbdev_id)
   if (fb->base == (char *)-1)
     {
       fprintf(stdout, "Error cannot mmap framebuffer. Using malloc instead.\n");
+      fb->double_buffered = FALSE;
+      size = fb->stride * fb->height;
 	  fb->base = (char*)malloc(size);
       if (!fb->base)
         {
@@ -231,9 +806,15 @@ psplash_fb_new (int angle, int fbdev_id)
       fb->alloc = 1;
     }
 
-  off = (unsigned long) fb_fix.smem_start % (unsigned long) getpagesize();
+  /* A mapping starts at the page holding smem_start, a copy at the
+   * framebuffer itself */
+  if (fb->alloc == 1)
+    off = 0;
+  else
+    off = (unsigned long) fb_fix.smem_start % (unsigned long) getpagesize();
 
-  fb->data = fb->base + off;
+  fb->pages[0] = fb->base + off;
+  fb->pages[1] = fb->pages[0] + fb->stride * fb->height;
 
 #if 0
   /* FIXME: No support for 8pp as yet  */
@@ -257,136 +838,149 @@ psplash_fb_new (int angle, int fbdev_id)
   status = 2;
 #endif
 
-  fb->angle = angle;
+  psplash_fb_setup (fb, angle);
+
+  return fb;
+
+ fail:
+
+  if (fb)
+    psplash_fb_destroy (fb);
+
+  return NULL;
+}
+
+/* Clips a logical rectangle to the screen, returns FALSE if nothing of it
+ * is left. */
+static inline int
+psplash_fb_clip_rect (PSplashFB *fb, int *x, int *y, int *width, int *height)
+{
+  if (*x < 0)
+    {
+      *width += *x;
+      *x = 0;
+    }
+
+  if (*y < 0)
+    {
+      *height += *y;
+      *y = 0;
+    }
+
+  if (*x + *width > fb->width)
+    *width = fb->width - *x;
+
+  if (*y + *height > fb->height)
+    *height = fb->height - *y;
+
+  return *width > 0 && *height > 0;
+}
+
+/* Maps a clipped logical rectangle onto the physical framebuffer */
+static inline void
+psplash_fb_rotate_rect (PSplashFB *fb, int *x, int *y, int *width, int *height)
+{
+  int t;
 
   switch (fb->angle)
     {
     case 270:
-    case 90:
-      fb->width  = fb->real_height;
-      fb->height = fb->real_width;
+      t  = *x;
+      *x = fb->height - *y - *height;
+      *y = t;
+      t  = *width; *width = *height; *height = t;
       break;
     case 180:
+      *x = fb->width - *x - *width;
+      *y = fb->height - *y - *height;
+      break;
+    case 90:
+      t  = *y;
+      *y = fb->width - *x - *width;
+      *x = t;
+      t  = *width; *width = *height; *height = t;
+      break;
     case 0:
     default:
       break;
     }
+}
 
-  return fb;
+static void
+psplash_fb_fill_rect (PSplashFB *fb,
+		      int        x,
+		      int        y,
+		      int        width,
+		      int        height,
+		      uint32_t   pixel)
+{
+  PSplashFBFillSpan fill = fb->fill_span;
+  int               dy;
 
- fail:
+  if (!psplash_fb_clip_rect (fb, &x, &y, &width, &height))
+    return;
 
-  if (fb)
-    psplash_fb_destroy (fb);
+  /* Whole screen clears would only flush the caches, so bypass them */
+  if (width == fb->width && height == fb->height)
+    fill = fb->stream_span;
 
-  return NULL;
-}
+  psplash_fb_rotate_rect (fb, &x, &y, &width, &height);
+  psplash_fb_damage (fb, x, y, width, height);
 
-#define OFFSET(fb,x,y) (((y) * (fb)->stride) + ((x) * ((fb)->bpp >> 3)))
+  for (dy = 0; dy < height; dy++)
+    fill (fb->data + OFFSET (fb, x, y + dy), width, pixel);
+}
 
-static inline void
-psplash_fb_plot_pixel (PSplashFB    *fb,
-		       int          x,
-		       int          y,
-		       uint8        red,
-		       uint8        green,
-		       uint8        blue)
+/* Copies a block of RGB(A) pixels to the screen, one physical row at a
+ * time whatever the rotation. */
+static void
+psplash_fb_copy_rect (PSplashFB   *fb,
+		      int          x,
+		      int          y,
+		      int          width,
+		      int          height,
+		      const uint8 *src,
+		      int          src_bpp,
+		      int          src_rowstride)
 {
-  int off;
+  int cx = x, cy = y, dy, row_step, pixel_step;
 
-  if (x < 0 || x > fb->width-1 || y < 0 || y > fb->height-1)
+  if (!psplash_fb_clip_rect (fb, &cx, &cy, &width, &height))
     return;
 
+  src += (cy - y) * src_rowstride + (cx - x) * src_bpp;
+
+  /* Walk the source so that it comes out in physical row order */
   switch (fb->angle)
     {
     case 270:
-      off = OFFSET (fb, fb->height - y - 1, x);
+      src        += (height - 1) * src_rowstride;
+      row_step    = src_bpp;
+      pixel_step  = -src_rowstride;
       break;
     case 180:
-      off = OFFSET (fb, fb->width - x - 1, fb->height - y - 1);
+      src        += (height - 1) * src_rowstride + (width - 1) * src_bpp;
+      row_step    = -src_rowstride;
+      pixel_step  = -src_bpp;
       break;
     case 90:
-      off = OFFSET (fb, y, fb->width - x - 1);
+      src        += (width - 1) * src_bpp;
+      row_step    = -src_bpp;
+      pixel_step  = src_rowstride;
       break;
     case 0:
     default:
-      off = OFFSET (fb, x, y);
+      row_step    = src_rowstride;
+      pixel_step  = src_bpp;
       break;
     }
 
-  if (fb->rgbmode == RGB565 || fb->rgbmode == RGB888) {
-    switch (fb->bpp)
-      {
-      case 24:
-#if __BYTE_ORDER == __BIG_ENDIAN
-        *(fb->data + off + 0) = red;
-        *(fb->data + off + 1) = green;
-        *(fb->data + off + 2) = blue;
-#else
-        *(fb->data + off + 0) = blue;
-        *(fb->data + off + 1) = green;
-        *(fb->data + off + 2) = red;
-#endif
-        break;
-      case 32:
-        *(volatile uint32_t *) (fb->data + off)
-          = (red << 16) | (green << 8) | (blue);
-        break;
-
-      case 16:
-        *(volatile uint16_t *) (fb->data + off)
-	  = ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3);
-        break;
-      default:
-        /* depth not supported yet */
-        break;
-      }
-  } else if (fb->rgbmode == BGR565 || fb->rgbmode == BGR888) {
-    switch (fb->bpp)
-      {
-      case 24:
-#if __BYTE_ORDER == __BIG_ENDIAN
-        *(fb->data + off + 0) = blue;
-        *(fb->data + off + 1) = green;
-        *(fb->data + off + 2) = red;
-#else
-        *(fb->data + off + 0) = red;
-        *(fb->data + off + 1) = green;
-        *(fb->data + off + 2) = blue;
-#endif
-        break;
-      case 32:
-        *(volatile uint32_t *) (fb->data + off)
-          = (blue << 16) | (green << 8) | (red);
-        break;
-      case 16:
-        *(volatile uint16_t *) (fb->data + off)
-	  = ((blue >> 3) << 11) | ((green >> 2) << 5) | (red >> 3);
-        break;
-      default:
-        /* depth not supported yet */
-        break;
-      }
-  } else {
-    switch (fb->bpp)
-      {
-      case 32:
-        *(volatile uint32_t *) (fb->data + off)
-	  = ((red >> (8 - fb->red_length)) << fb->red_offset) 
-	      | ((green >> (8 - fb->green_length)) << fb->green_offset)
-	      | ((blue >> (8 - fb->blue_length)) << fb->blue_offset);
-        break;
-      case 16:
-        *(volatile uint16_t *) (fb->data + off)
-	  = ((red >> (8 - fb->red_length)) << fb->red_offset) 
-	      | ((green >> (8 - fb->green_length)) << fb->green_offset)
-	      | ((blue >> (8 - fb->blue_length)) << fb->blue_offset);
-        break;
-      default:
-        /* depth not supported yet */
-        break;
-      }
-  }
+  psplash_fb_rotate_rect (fb, &cx, &cy, &width, &height);
+  psplash_fb_damage (fb, cx, cy, width, height);
+
+  for (dy = 0; dy < height; dy++, src += row_step)
+    fb->copy_span (fb, fb->data + OFFSET (fb, cx, cy + dy),
+		   src, src_bpp, pixel_step, width);
 }
 
 void
@@ -399,87 +993,905 @@ psplash_fb_draw_rect (PSplashFB    *fb,
 		      uint8        green,
 		      uint8        blue)
 {
-  int dx, dy;
+  psplash_fb_fill_rect (fb, x, y, width, height,
+			fb->pack_pixel (fb, red, green, blue));
+}
 
-  for (dy=0; dy < height; dy++)
-    for (dx=0; dx < width; dx++)
-	psplash_fb_plot_pixel (fb, x+dx, y+dy, red, green, blue);
+typedef void (*PSplashFBImageSpanFunc) (void        *user_data,
+					int          x,
+					int          y,
+					int          len,
+					const uint8 *src,
+					int          src_step);
+
+/* Decodes a GdkPixbuf RLE stream into spans of the image. A repeated run
+ * comes out as a span with a src_step of 0, split where it wraps onto the
+ * next row, and is left out altogether when it is transparent. Like
+ * before, a row ends once img_rowstride bytes worth of pixels have been
+ * decoded, anything past img_width is padding and is dropped here.
+ *
+ * Decoding stops after img_height rows or at a zero length byte, so
+ * neither a truncated nor an overlong stream can write outside the
+ * image. Returns FALSE if the image geometry makes no sense. */
+static int
+psplash_fb_decode_image (int                     img_width,
+			 int                     img_height,
+			 int                     img_bytes_per_pixel,
+			 int                     img_rowstride,
+			 const uint8            *rle_data,
+			 PSplashFBImageSpanFunc  func,
+			 void                   *user_data)
+{
+  const uint8 *p = rle_data;
+  int          bpp = img_bytes_per_pixel;
+  int          dx = 0, dy = 0, row_len, run, len, n;
+
+  if (img_width <= 0 || img_height <= 0 || (bpp != 3 && bpp != 4)
+      || img_rowstride < bpp)
+    return FALSE;
+
+  row_len = (img_rowstride + bpp - 1) / bpp;
+
+  if (img_width > row_len)
+    img_width = row_len;
+
+  while (dy < img_height)
+    {
+      len = *(p++);
+      run = len & 128;
+      len &= 127;
+
+      if (len == 0)
+	break;
+
+      for (; len > 0 && dy < img_height; len -= n)
+	{
+	  n = row_len - dx < len ? row_len - dx : len;
+
+	  if (dx < img_width && (!run || bpp < 4 || *(p + 3)))
+	    func (user_data, dx, dy,
+		  dx + n > img_width ? img_width - dx : n,
+		  p, run ? 0 : bpp);
+
+	  if (!run)
+	    p += n * bpp;
+
+	  if ((dx += n) == row_len)
+	    {
+	      dx = 0;
+	      dy++;
+	    }
+	}
+
+      p += run ? bpp : len * bpp;
+    }
+
+  return TRUE;
 }
 
-void
-psplash_fb_draw_image (PSplashFB    *fb,
+/* Draws a decoded span onto a framebuffer, or onto a view of a cache */
+static void
+psplash_fb_image_span (PSplashFB   *fb,
 		       int          x,
 		       int          y,
-		       int          img_width,
-		       int          img_height,
-		       int          img_bytes_per_pixel,
-		       int          img_rowstride,
-		       uint8       *rle_data)
+		       int          len,
+		       const uint8 *src,
+		       int          src_bpp,
+		       int          src_step)
+{
+  if (src_step != 0)
+    psplash_fb_copy_rect (fb, x, y, len, 1, src, src_bpp, 0);
+  else if (src_bpp < 4 || *(src + 3) == 0xff)
+    psplash_fb_fill_rect (fb, x, y, len, 1,
+			  fb->pack_pixel (fb, *(src), *(src + 1), *(src + 2)));
+  else
+    /* Translucent runs are rare, copying them keeps their alpha */
+    for (; len > 0; len--, x++)
+      psplash_fb_copy_rect (fb, x, y, 1, 1, src, src_bpp, 0);
+}
+
+/* Image cache. Each image is decoded once into the framebuffer's own
+ * pixel format, already rotated, together with the spans of each physical
+ * row that are opaque or translucent. Drawing it again is then a memcpy
+ * per opaque span and a blend per translucent one. */
+
+typedef struct PSplashFBImageBuild
+{
+  PSplashFB  *pixels;			/* Views onto the cached pixels, */
+  PSplashFB  *blend;			/* their pack_blend() values */
+  PSplashFB  *mask;			/* and a byte per pixel alpha */
+  int         img_bytes_per_pixel;
+}
+PSplashFBImageBuild;
+
+/* Span writers for the alpha mask and the blend sources. Runs only ever
+ * get filled when they are opaque. */
+
+static uint32_t
+pack_mask (const PSplashFB *UNUSED(fb),
+	   uint8 UNUSED(red), uint8 UNUSED(green), uint8 UNUSED(blue))
 {
-  uint8       *p = rle_data;
-  int          dx = 0, dy = 0,  total_len;
-  unsigned int len;
+  return 0xff;
+}
 
-  total_len = img_rowstride * img_height;
+static void
+fill_span_mask (char *dst, int len, uint32_t pixel)
+{
+  memset (dst, pixel, len);
+}
 
-  /* FIXME: Optimise, check for over runs ... */
-  while ((p - rle_data) < total_len)
+static void
+copy_span_mask (const PSplashFB *UNUSED(fb), char *dst, const uint8 *src,
+		int src_bpp, int src_step, int len)
+{
+  for (; len > 0; len--, dst++, src += src_step)
+    *dst = src_bpp < 4 ? 0xff : *(src + 3);
+}
+
+static void
+copy_span_blend (const PSplashFB *fb, char *dst, const uint8 *src,
+		 int src_bpp, int src_step, int len)
+{
+  for (; len > 0; len--, dst += 4, src += src_step)
+    store_32 (dst, fb->pack_blend (fb, *(src), *(src + 1), *(src + 2),
+				   src_bpp < 4 ? 0xff : *(src + 3)));
+}
+
+static void
+psplash_fb_image_build_span (void        *user_data,
+			     int          x,
+			     int          y,
+			     int          len,
+			     const uint8 *src,
+			     int          src_step)
+{
+  PSplashFBImageBuild *build = user_data;
+
+  psplash_fb_image_span (build->pixels, x, y, len, src,
+			 build->img_bytes_per_pixel, src_step);
+  psplash_fb_image_span (build->mask, x, y, len, src,
+			 build->img_bytes_per_pixel, src_step);
+  if (build->blend->data)
+    psplash_fb_image_span (build->blend, x, y, len, src,
+			   build->img_bytes_per_pixel, src_step);
+}
+
+/* Appends a span to the list, growing it as needed */
+static int
+psplash_fb_image_add_span (int **spans, int *n, int *size,
+			   int x, int len, int kind, int offset)
+{
+  int *p;
+
+  if (*n + 4 > *size)
     {
-      len = *(p++);
+      *size = *size ? *size * 2 : 512;
+      if ((p = realloc (*spans, *size * sizeof (int))) == NULL)
+	return FALSE;
+      *spans = p;
+    }
+
+  p = *spans + *n;
+  p[0] = x;
+  p[1] = len;
+  p[2] = kind;
+  p[3] = offset;
+  *n += 4;
+
+  return TRUE;
+}
+
+/* Turns the alpha mask into per row span lists, opaque ones over the full
+ * rows of pixels in the cache and translucent ones over their blend
+ * sources, which get packed together into their own array */
+static int
+psplash_fb_image_build_spans (PSplashFBImage  *img,
+			      const uint8     *mask,
+			      int              stride,
+			      const uint32_t  *blend,
+			      int            **spans_out,
+			      int            **row_spans_out,
+			      uint32_t       **blend_out)
+{
+  int       size = 0, n = 0, nblend = 0, blend_size = 0;
+  int       x, y, start, opaque;
+  int       bytes = img->bpp >> 3;
+  int      *row_spans;
+  uint32_t *packed;
+
+  if ((row_spans = malloc ((img->height + 1) * sizeof (int))) == NULL)
+    return FALSE;
+
+  *row_spans_out = row_spans;
+
+  for (y = 0; y < img->height; y++, mask += img->width)
+    {
+      row_spans[y] = n;
 
-      if (len & 128)
+      for (x = 0; x < img->width; )
 	{
-	  len -= 128;
+	  if (!mask[x])
+	    {
+	      x++;
+	      continue;
+	    }
+
+	  opaque = mask[x] == 0xff;
+
+	  for (start = x; x < img->width && mask[x]
+		 && (mask[x] == 0xff) == opaque; x++)
+	    ;
+
+	  if (opaque)
+	    {
+	      if (!psplash_fb_image_add_span (spans_out, &n, &size,
+					      start, x - start,
+					      PSPLASH_FB_SPAN_COPY,
+					      y * stride + start * bytes))
+		return FALSE;
+	      continue;
+	    }
 
-	  if (len == 0) break;
+	  if (!psplash_fb_image_add_span (spans_out, &n, &size,
+					  start, x - start,
+					  PSPLASH_FB_SPAN_BLEND, nblend))
+	    return FALSE;
 
-	  do
+	  if (nblend + x - start > blend_size)
 	    {
-	      if ((img_bytes_per_pixel < 4 || *(p+3)) && dx < img_width)
-	        psplash_fb_plot_pixel (fb, x+dx, y+dy, *(p), *(p+1), *(p+2));
-	      if (++dx * img_bytes_per_pixel >= img_rowstride) { dx=0; dy++; }
+	      blend_size = (nblend + x - start) * 2;
+	      packed = realloc (*blend_out, blend_size * sizeof (uint32_t));
+	      if (packed == NULL)
+		return FALSE;
+	      *blend_out = packed;
 	    }
-	  while (--len);
+	  packed = *blend_out;
 
-	  p += img_bytes_per_pixel;
+	  memcpy (packed + nblend, blend + y * img->width + start,
+		  (x - start) * sizeof (uint32_t));
+	  nblend += x - start;
 	}
-      else
+    }
+
+  row_spans[y] = n;
+
+  return TRUE;
+}
+
+static void
+psplash_fb_image_free (PSplashFBImage *img)
+{
+  free ((char *) img->pixels);
+  free ((uint32_t *) img->blend);
+  free ((int *) img->spans);
+  free ((int *) img->row_spans);
+  free (img);
+}
+
+static PSplashFBImage *
+psplash_fb_image_new (PSplashFB   *fb,
+		      int          img_width,
+		      int          img_height,
+		      int          img_bytes_per_pixel,
+		      int          img_rowstride,
+		      const uint8 *rle_data)
+{
+  PSplashFBImageBuild build;
+  PSplashFBImage     *img;
+  PSplashFB           pixels, blend, mask;
+  int                *spans = NULL, *row_spans = NULL;
+  uint32_t           *packed = NULL;
+  int                 rotated = (fb->angle == 90 || fb->angle == 270);
+  int                 ok;
+
+  if ((img = calloc (1, sizeof (PSplashFBImage))) == NULL)
+    return NULL;
+
+  img->rgbmode    = fb->rgbmode;
+  img->bpp        = fb->bpp;
+  img->width      = rotated ? img_height : img_width;
+  img->height     = rotated ? img_width : img_height;
+  img->rle_data   = rle_data;
+  img->img_width  = img_width;
+  img->img_height = img_height;
+
+  pixels        = *fb;
+  pixels.stride = img->width * (fb->bpp >> 3);
+  pixels.data   = malloc (pixels.stride * img->height);
+  pixels.width  = img_width;
+  pixels.height = img_height;
+  img->pixels   = pixels.data;
+
+  mask           = pixels;
+  mask.data      = calloc (img->width, img->height);
+  mask.stride    = img->width;
+  mask.bpp         = 8;
+  mask.pack_pixel  = pack_mask;
+  mask.fill_span   = fill_span_mask;
+  mask.stream_span = fill_span_mask;
+  mask.copy_span   = copy_span_mask;
+
+  /* Only RGBA images can have anything to blend */
+  blend             = pixels;
+  blend.data        = NULL;
+  blend.stride      = img->width * 4;
+  blend.bpp         = 32;
+  blend.fill_span   = fill_span_none;
+  blend.stream_span = fill_span_none;
+  blend.copy_span   = copy_span_blend;
+  if (img_bytes_per_pixel == 4)
+    blend.data = malloc (blend.stride * img->height);
+
+  build.pixels              = &pixels;
+  build.blend               = &blend;
+  build.mask                = &mask;
+  build.img_bytes_per_pixel = img_bytes_per_pixel;
+
+  ok = pixels.data != NULL && mask.data != NULL
+    && (blend.data != NULL || img_bytes_per_pixel != 4)
+    && psplash_fb_decode_image (img_width, img_height, img_bytes_per_pixel,
+				img_rowstride, rle_data,
+				psplash_fb_image_build_span, &build)
+    && psplash_fb_image_build_spans (img, (uint8 *) mask.data, pixels.stride,
+				     (uint32_t *) blend.data,
+				     &spans, &row_spans, &packed);
+
+  img->spans     = spans;
+  img->row_spans = row_spans;
+  img->blend     = packed;
+
+  free (mask.data);
+  free (blend.data);
+
+  if (!ok)
+    {
+      psplash_fb_image_free (img);
+      return NULL;
+    }
+
+  return img;
+}
+
+static PSplashFBImage *
+psplash_fb_image_lookup (PSplashFB   *fb,
+			 int          img_width,
+			 int          img_height,
+			 int          img_bytes_per_pixel,
+			 int          img_rowstride,
+			 const uint8 *rle_data)
+{
+  PSplashFBImage *img;
+
+  /* Nothing to cache for depths we can't draw */
+  if (fb->copy_span == copy_span_none)
+    return NULL;
+
+  for (img = fb->images; img; img = img->next)
+    if (img->rle_data == rle_data
+	&& img->img_width == img_width && img->img_height == img_height)
+      return img;
+
+  img = psplash_fb_image_new (fb, img_width, img_height,
+			      img_bytes_per_pixel, img_rowstride, rle_data);
+  if (img)
+    {
+      img->next  = fb->images;
+      fb->images = img;
+    }
+
+  return img;
+}
+
+/* Pre-packed images from make-image-header.sh are unrotated and only fit
+ * framebuffers that use the same span writers as their format */
+static int
+psplash_fb_image_fits (PSplashFB *fb, const PSplashFBImage *img)
+{
+  unsigned int i;
+
+  if (fb->angle != 0 || img->bpp != fb->bpp)
+    return FALSE;
+
+  for (i = 0; i < sizeof (span_writers) / sizeof (span_writers[0]); i++)
+    if (span_writers[i].rgbmode == img->rgbmode
+	&& span_writers[i].bpp == img->bpp)
+      return span_writers[i].pack == fb->pack_pixel;
+
+  return FALSE;
+}
+
+static void
+psplash_fb_image_blit (PSplashFB            *fb,
+		       const PSplashFBImage *img,
+		       int                   x,
+		       int                   y)
+{
+  int bytes = fb->bpp >> 3;
+  int ix, iy, iw, ih, cx, cy, cw, ch, r, i;
+
+  /* Place the image on the physical screen and clip it there */
+  ix = x;
+  iy = y;
+  iw = (fb->angle == 90 || fb->angle == 270) ? img->height : img->width;
+  ih = (fb->angle == 90 || fb->angle == 270) ? img->width : img->height;
+  psplash_fb_rotate_rect (fb, &ix, &iy, &iw, &ih);
+
+  cx = ix < 0 ? 0 : ix;
+  cy = iy < 0 ? 0 : iy;
+  cw = (ix + iw > fb->real_width ? fb->real_width : ix + iw) - cx;
+  ch = (iy + ih > fb->real_height ? fb->real_height : iy + ih) - cy;
+
+  if (cw <= 0 || ch <= 0)
+    return;
+
+  psplash_fb_damage (fb, cx, cy, cw, ch);
+
+  for (r = cy - iy; r < cy - iy + ch; r++)
+    {
+      char *dst = fb->data + OFFSET (fb, ix, iy + r);
+
+      for (i = img->row_spans[r]; i < img->row_spans[r + 1]; i += 4)
 	{
-	  if (len == 0) break;
+	  int start  = img->spans[i];
+	  int end    = start + img->spans[i + 1];
+	  int kind   = img->spans[i + 2];
+	  int offset = img->spans[i + 3];
 
-	  do
+	  if (start < cx - ix)
 	    {
-	      if ((img_bytes_per_pixel < 4 || *(p+3)) && dx < img_width)
-	        psplash_fb_plot_pixel (fb, x+dx, y+dy, *(p), *(p+1), *(p+2));
-	      if (++dx * img_bytes_per_pixel >= img_rowstride) { dx=0; dy++; }
-	      p += img_bytes_per_pixel;
+	      if (kind == PSPLASH_FB_SPAN_COPY)
+		offset += (cx - ix - start) * bytes;
+	      else if (kind == PSPLASH_FB_SPAN_BLEND)
+		offset += cx - ix - start;
+	      start = cx - ix;
+	    }
+	  if (end > cx - ix + cw)
+	    end = cx - ix + cw;
+
+	  if (end <= start)
+	    continue;
+
+	  switch (kind)
+	    {
+	    case PSPLASH_FB_SPAN_FILL:
+	      fb->fill_span (dst + start * bytes, end - start,
+			     load_pixel (img->pixels + offset, bytes));
+	      break;
+	    case PSPLASH_FB_SPAN_BLEND:
+	      fb->blend_span (fb, dst + start * bytes, img->blend + offset,
+			      end - start);
+	      break;
+	    case PSPLASH_FB_SPAN_COPY:
+	    default:
+	      memcpy (dst + start * bytes, img->pixels + offset,
+		      (end - start) * bytes);
+	      break;
 	    }
-	  while (--len && (p - rle_data) < total_len);
 	}
     }
 }
 
+typedef struct PSplashFBDirect
+{
+  PSplashFB  *fb;
+  int         x, y;
+  int         img_bytes_per_pixel;
+}
+PSplashFBDirect;
+
+static void
+psplash_fb_direct_span (void        *user_data,
+			int          x,
+			int          y,
+			int          len,
+			const uint8 *src,
+			int          src_step)
+{
+  PSplashFBDirect *direct = user_data;
+
+  psplash_fb_image_span (direct->fb, direct->x + x, direct->y + y, len, src,
+			 direct->img_bytes_per_pixel, src_step);
+}
+
+void
+psplash_fb_draw_image (PSplashFB    *fb,
+		       int          x,
+		       int          y,
+		       int          img_width,
+		       int          img_height,
+		       int          img_bytes_per_pixel,
+		       int          img_rowstride,
+		       uint8       *rle_data,
+		       const PSplashFBImage **native)
+{
+  PSplashFBImage  *img;
+  PSplashFBDirect  direct;
+
+  /* A pre-packed variant in our format needs no decoding at all */
+  for (; native && *native; native++)
+    if (psplash_fb_image_fits (fb, *native))
+      {
+	psplash_fb_image_blit (fb, *native, x, y);
+	return;
+      }
+
+  img = psplash_fb_image_lookup (fb, img_width, img_height,
+				 img_bytes_per_pixel, img_rowstride, rle_data);
+  if (img)
+    {
+      psplash_fb_image_blit (fb, img, x, y);
+      return;
+    }
+
+  /* No memory for the cache, decode straight to the screen */
+  direct.fb                  = fb;
+  direct.x                   = x;
+  direct.y                   = y;
+  direct.img_bytes_per_pixel = img_bytes_per_pixel;
+
+  psplash_fb_decode_image (img_width, img_height, img_bytes_per_pixel,
+			   img_rowstride, rle_data,
+			   psplash_fb_direct_span, &direct);
+}
+
 /* Font rendering code based on BOGL by Ben Pfaff */
 
+/* Walks the font's hash chain for 'wc', which ends at a zero entry */
 static int
-psplash_font_glyph (const PSplashFont *font, wchar_t wc, u_int32_t **bitmap)
+psplash_font_find (const PSplashFont *font, wchar_t wc, u_int32_t **bitmap)
 {
   int mask = font->index_mask;
   int i;
 
-  for (;;)
+  for (i = font->offset[wc & mask]; font->index[i]; i += 2)
     {
-      for (i = font->offset[wc & mask]; font->index[i]; i += 2)
+      if ((wchar_t)(font->index[i] & ~mask) == (wc & ~mask))
 	{
-	  if ((wchar_t)(font->index[i] & ~mask) == (wc & ~mask))
+	  *bitmap = &font->content[font->index[i+1]];
+	  return font->index[i] & mask;
+	}
+    }
+
+  *bitmap = NULL;
+  return 0;
+}
+
+/* Characters missing from the font are drawn as the first of these it
+ * has, or not at all */
+static const wchar_t psplash_font_replacements[] = { 0xfffd, '?' };
+
+static int
+psplash_font_find_or_replace (const PSplashFont *font,
+			      wchar_t            wc,
+			      u_int32_t        **bitmap)
+{
+  unsigned int i;
+  int          w;
+
+  w = psplash_font_find (font, wc, bitmap);
+
+  for (i = 0; *bitmap == NULL && i < sizeof (psplash_font_replacements)
+	 / sizeof (psplash_font_replacements[0]); i++)
+    w = psplash_font_find (font, psplash_font_replacements[i], bitmap);
+
+  return w;
+}
+
+/* Direct lookup of ASCII and Latin-1, which is all any boot message uses,
+ * built the first time a font is used. Fonts are static data, so the
+ * tables live as long as the program. */
+
+#define PSPLASH_FONT_TABLE_SIZE 256
+
+typedef struct PSplashFontTable
+{
+  const PSplashFont       *font;
+  int                      width[PSPLASH_FONT_TABLE_SIZE];
+  u_int32_t               *bitmap[PSPLASH_FONT_TABLE_SIZE];
+  struct PSplashFontTable *next;
+}
+PSplashFontTable;
+
+static PSplashFontTable *psplash_font_tables;
+
+static const PSplashFontTable *
+psplash_font_table (const PSplashFont *font)
+{
+  PSplashFontTable *table;
+  wchar_t           wc;
+
+  if (psplash_font_tables && psplash_font_tables->font == font)
+    return psplash_font_tables;
+
+  for (table = psplash_font_tables; table; table = table->next)
+    if (table->font == font)
+      return table;
+
+  if ((table = malloc (sizeof (PSplashFontTable))) == NULL)
+    return NULL;
+
+  table->font = font;
+
+  for (wc = 0; wc < PSPLASH_FONT_TABLE_SIZE; wc++)
+    table->width[wc] = psplash_font_find_or_replace (font, wc,
+						     &table->bitmap[wc]);
+
+  table->next         = psplash_font_tables;
+  psplash_font_tables = table;
+
+  return table;
+}
+
+static int
+psplash_font_glyph (const PSplashFont *font, wchar_t wc, u_int32_t **bitmap)
+{
+  const PSplashFontTable *table;
+  u_int32_t              *glyph;
+
+  if (wc >= 0 && wc < PSPLASH_FONT_TABLE_SIZE
+      && (table = psplash_font_table (font)) != NULL)
+    {
+      if (bitmap != NULL)
+	*bitmap = table->bitmap[wc];
+      return table->width[wc];
+    }
+
+  return psplash_font_find_or_replace (font, wc, bitmap ? bitmap : &glyph);
+}
+
+/* Glyph cache. Text comes in one colour at a time, so each glyph is
+ * rasterized once per font and colour into an image of fill spans in the
+ * framebuffer's format and rotation, and a string is drawn as a blit per
+ * character. Only the first PSPLASH_FB_GLYPH_CACHE_SIZE characters are
+ * cached, and only the few most recently used colours are kept. */
+
+#define PSPLASH_FB_GLYPH_CACHE_SIZE 256
+#define PSPLASH_FB_MAX_GLYPH_CACHES 4
+
+typedef struct PSplashFBGlyphCache
+{
+  const PSplashFont          *font;
+  uint32_t                    pixel;
+  PSplashFBImage             *glyphs[PSPLASH_FB_GLYPH_CACHE_SIZE];
+  struct PSplashFBGlyphCache *next;
+}
+PSplashFBGlyphCache;
+
+static void
+psplash_fb_glyph_cache_free (PSplashFBGlyphCache *cache)
+{
+  PSplashFBGlyphCache *next;
+  int                  i;
+
+  for (; cache; cache = next)
+    {
+      next = cache->next;
+
+      for (i = 0; i < PSPLASH_FB_GLYPH_CACHE_SIZE; i++)
+	if (cache->glyphs[i])
+	  psplash_fb_image_free (cache->glyphs[i]);
+
+      free (cache);
+    }
+}
+
+static PSplashFBGlyphCache *
+psplash_fb_glyph_cache_lookup (PSplashFB         *fb,
+			       const PSplashFont *font,
+			       uint32_t           pixel)
+{
+  PSplashFBGlyphCache **link, *cache;
+  int                   n;
+
+  if (fb->fill_span == fill_span_none)
+    return NULL;
+
+  for (link = &fb->glyph_caches, n = 0; *link; link = &(*link)->next, n++)
+    {
+      cache = *link;
+
+      if (cache->font == font && cache->pixel == pixel)
+	{
+	  /* Keep the most recently used colour at the front */
+	  *link       = cache->next;
+	  cache->next = fb->glyph_caches;
+	  fb->glyph_caches = cache;
+	  return cache;
+	}
+
+      if (n == PSPLASH_FB_MAX_GLYPH_CACHES - 1)
+	{
+	  psplash_fb_glyph_cache_free (cache);
+	  *link = NULL;
+	  break;
+	}
+    }
+
+  if ((cache = calloc (1, sizeof (PSplashFBGlyphCache))) == NULL)
+    return NULL;
+
+  cache->font      = font;
+  cache->pixel     = pixel;
+  cache->next      = fb->glyph_caches;
+  fb->glyph_caches = cache;
+
+  return cache;
+}
+
+/* Sets every bit of a glyph on 'fb', one run of set bits at a time */
+static void
+psplash_fb_glyph_rasterize (PSplashFB       *fb,
+			    int              x,
+			    int              y,
+			    const u_int32_t *glyph,
+			    int              w,
+			    int              h,
+			    uint32_t         pixel)
+{
+  int cx, cy, run;
+
+  if (fb->angle == 90 || fb->angle == 270)
+    {
+      /* Glyph columns are physical rows here, so draw the vertical
+       * runs of set bits, column by column. */
+      for (cx = 0; cx < w; cx++)
+	for (cy = 0; cy < h; cy += run ? run : 1)
+	  {
+	    for (run = 0; cy + run < h; run++)
+	      if (!(glyph[cy + run] & (0x80000000 >> cx)))
+		break;
+
+	    if (run)
+	      psplash_fb_fill_rect (fb, x+cx, y+cy, 1, run, pixel);
+	  }
+    }
+  else
+    {
+      for (cy = 0; cy < h; cy++)
+	{
+	  u_int32_t g = glyph[cy];
+
+	  /* Draw each run of set bits as one span */
+	  for (cx = 0; g != 0 && cx < w; cx += run)
 	    {
-	      if (bitmap != NULL)
-		*bitmap = &font->content[font->index[i+1]];
-	      return font->index[i] & mask;
+	      while (!(g & 0x80000000))
+		{
+		  g <<= 1;
+		  cx++;
+		}
+
+	      if (cx >= w)
+		break;
+
+	      for (run = 0; g & 0x80000000; run++)
+		g <<= 1;
+
+	      if (cx + run > w)
+		run = w - cx;
+
+	      psplash_fb_fill_rect (fb, x+cx, y+cy, run, 1, pixel);
 	    }
 	}
     }
-  return 0;
+}
+
+/* Builds the cached image of a glyph, its advance in img_width */
+static PSplashFBImage *
+psplash_fb_glyph_new (PSplashFB       *fb,
+		      const u_int32_t *glyph,
+		      int              w,
+		      int              h,
+		      uint32_t         pixel)
+{
+  PSplashFBImage *img;
+  PSplashFB       mask;
+  int            *spans = NULL, *row_spans;
+  const uint8    *row;
+  int             x, y, start, n = 0, size = 0, ok = TRUE;
+  int             rotated = (fb->angle == 90 || fb->angle == 270);
+
+  if ((img = calloc (1, sizeof (PSplashFBImage))) == NULL)
+    return NULL;
+
+  img->rgbmode    = fb->rgbmode;
+  img->bpp        = fb->bpp;
+  img->width      = rotated ? h : w;
+  img->height     = rotated ? w : h;
+  img->img_width  = w;
+  img->img_height = h;
+
+  /* Every span fills with the one pixel */
+  img->pixels    = calloc (1, sizeof (uint32_t));
+  img->row_spans = row_spans = malloc ((img->height + 1) * sizeof (int));
+
+  mask             = *fb;
+  mask.data        = calloc (img->width ? img->width : 1, img->height);
+  mask.stride      = img->width;
+  mask.width       = w;
+  mask.height      = h;
+  mask.bpp         = 8;
+  mask.fill_span   = fill_span_mask;
+  mask.stream_span = fill_span_mask;
+
+  if (img->pixels == NULL || row_spans == NULL || mask.data == NULL)
+    {
+      free (mask.data);
+      psplash_fb_image_free (img);
+      return NULL;
+    }
+
+  switch (fb->bpp >> 3)
+    {
+    case 2:
+      store_16 ((char *) img->pixels, pixel);
+      break;
+    case 3:
+      store_24 ((char *) img->pixels, pixel);
+      break;
+    case 4:
+      store_32 ((char *) img->pixels, pixel);
+      break;
+    }
+
+  psplash_fb_glyph_rasterize (&mask, 0, 0, glyph, w, h, 0xff);
+
+  for (y = 0; y < img->height && ok; y++)
+    {
+      row = (const uint8 *) mask.data + y * mask.stride;
+      row_spans[y] = n;
+
+      for (x = 0; x < img->width && ok; )
+	{
+	  if (!row[x])
+	    {
+	      x++;
+	      continue;
+	    }
+
+	  for (start = x; x < img->width && row[x]; x++)
+	    ;
+
+	  ok = psplash_fb_image_add_span (&spans, &n, &size, start, x - start,
+					  PSPLASH_FB_SPAN_FILL, 0);
+	}
+    }
+
+  row_spans[img->height] = n;
+  img->spans = spans;
+
+  free (mask.data);
+
+  if (!ok)
+    {
+      psplash_fb_image_free (img);
+      return NULL;
+    }
+
+  return img;
+}
+
+static const PSplashFBImage *
+psplash_fb_glyph_lookup (PSplashFBGlyphCache *cache,
+			 PSplashFB           *fb,
+			 wchar_t              wc)
+{
+  u_int32_t *glyph = NULL;
+  int        w;
+
+  if (cache == NULL || wc < 0 || wc >= PSPLASH_FB_GLYPH_CACHE_SIZE)
+    return NULL;
+
+  if (cache->glyphs[wc] == NULL)
+    {
+      w = psplash_font_glyph (cache->font, wc, &glyph);
+
+      if (glyph != NULL)
+	cache->glyphs[wc] = psplash_fb_glyph_new (fb, glyph, w,
+						  cache->font->height,
+						  cache->pixel);
+    }
+
+  return cache->glyphs[wc];
 }
 
 void
@@ -524,13 +1936,18 @@ psplash_fb_draw_text (PSplashFB         *fb,
 		      const PSplashFont *font,
 		      const char        *text)
 {
-  int     h, w, k, n, cx, cy, dx, dy;
-  char   *c = (char*)text;
-  wchar_t wc;
+  PSplashFBGlyphCache  *cache;
+  const PSplashFBImage *img;
+  int                   h, w, k, n, dx, dy;
+  char                 *c = (char*)text;
+  uint32_t              pixel;
+  wchar_t               wc;
 
   n = strlen (text);
   h = font->height;
   dx = dy = 0;
+  pixel = fb->pack_pixel (fb, red, green, blue);
+  cache = psplash_fb_glyph_cache_lookup (fb, font, pixel);
 
   mbtowc (0, 0, 0);
   for (; (k = mbtowc (&wc, c, n)) > 0; c += k, n -= k)
@@ -544,25 +1961,23 @@ psplash_fb_draw_text (PSplashFB         *fb,
 	  continue;
 	}
 
+      if ((img = psplash_fb_glyph_lookup (cache, fb, wc)) != NULL)
+	{
+	  /* Blank glyphs like space only move along */
+	  if (img->row_spans[img->height] > 0)
+	    psplash_fb_image_blit (fb, img, x+dx, y+dy);
+	  dx += img->img_width;
+	  continue;
+	}
+
+      /* Not cached, or no memory to cache it */
       w = psplash_font_glyph (font, wc, &glyph);
 
       if (glyph == NULL)
 	continue;
 
-      for (cy = 0; cy < h; cy++)
-	{
-	  u_int32_t g = *glyph++;
-
-	  for (cx = 0; cx < w; cx++)
-	    {
-	      if (g & 0x80000000)
-		psplash_fb_plot_pixel (fb, x+dx+cx, y+dy+cy,
-				       red, green, blue);
-	      g <<= 1;
-	    }
-	}
+      psplash_fb_glyph_rasterize (fb, x+dx, y+dy, glyph, w, h, pixel);
 
       dx += w;
     }
 }
-
@@ -26,6 +26,101 @@ enum RGBMode {
     GENERIC,
 };
 
+struct PSplashFB;
+
+/* Per RGBMode/bpp span writers, picked once in psplash_fb_new(). Spans
+ * always run along a physical framebuffer row; 'src_step' is the byte
+ * distance between two source pixels of a copied span. */
+typedef uint32_t (*PSplashFBPack) (const struct PSplashFB *fb,
+				   uint8                   red,
+				   uint8                   green,
+				   uint8                   blue);
+
+typedef void (*PSplashFBFillSpan) (char     *dst,
+				   int       len,
+				   uint32_t  pixel);
+
+typedef void (*PSplashFBCopySpan) (const struct PSplashFB *fb,
+				   char                   *dst,
+				   const uint8            *src,
+				   int                     src_bpp,
+				   int                     src_step,
+				   int                     len);
+
+/* Source-over blends 'len' pixels made by the pack_blend writer onto
+ * 'dst', which must be readable RAM rather than the framebuffer itself */
+typedef uint32_t (*PSplashFBPackBlend) (const struct PSplashFB *fb,
+					uint8                   red,
+					uint8                   green,
+					uint8                   blue,
+					uint8                   alpha);
+
+typedef void (*PSplashFBBlendSpan) (const struct PSplashFB *fb,
+				    char                   *dst,
+				    const uint32_t         *src,
+				    int                     len);
+
+enum PSplashFBSpanKind {
+    PSPLASH_FB_SPAN_COPY,		/* memcpy from 'pixels' */
+    PSPLASH_FB_SPAN_FILL,		/* the one pixel found in 'pixels' */
+    PSPLASH_FB_SPAN_BLEND,		/* blend from 'blend' */
+};
+
+/* An image in a native pixel format and rotation. The spans of each
+ * physical row are x, length, kind, offset quadruplets, those of row r
+ * running from spans[row_spans[r]] to spans[row_spans[r + 1]]. The offset
+ * is in bytes into 'pixels', or in pixels into 'blend' for translucent
+ * spans. Pre-packed images from make-image-header.sh only fill in the
+ * first part, the rest is bookkeeping for the images psplash caches
+ * itself. */
+typedef struct PSplashFBImage
+{
+  enum RGBMode   rgbmode;
+  int            bpp;
+  int            width, height;
+  const char    *pixels;
+  const uint32_t *blend;
+  const int     *spans;
+  const int     *row_spans;
+
+  const uint8   *rle_data;
+  int            img_width, img_height;
+
+  struct PSplashFBImage *next;
+}
+PSplashFBImage;
+
+/* What psplash_fb_flush() needs from the device underneath. A backend
+ * fills in the geometry, pixel format and pages of a PSplashFB and hands
+ * it to psplash_fb_setup(). */
+typedef struct PSplashFBBackend
+{
+  const char *name;
+
+  /* Shows page 'page' of a double buffered framebuffer once it has been
+   * drawn, returning FALSE if the device refused the flip or never
+   * finished the last one. A flip that was accepted but is slow to land
+   * still counts as done. */
+  int  (*flip)    (struct PSplashFB *fb, int page);
+
+  /* Pushes out the damage of a single buffered framebuffer, can be NULL */
+  void (*dirty)   (struct PSplashFB *fb);
+
+  void (*destroy) (struct PSplashFB *fb);
+}
+PSplashFBBackend;
+
+/* Drawing records what it touched, in physical framebuffer coordinates,
+ * merged down to at most this many rectangles. psplash_fb_flush() only
+ * pushes those out. */
+#define PSPLASH_FB_MAX_DAMAGE 8
+
+typedef struct PSplashFBRect
+{
+  int x, y, width, height;
+}
+PSplashFBRect;
+
 typedef struct PSplashFB
 {
   int            fd;			
@@ -37,6 +132,8 @@ typedef struct PSplashFB
   int            stride;
   char		*data;
   char		*base;
+  char		*pages[2];		/* what gets scanned out, */
+  char		*shadow;		/* a copy of it in cached RAM */
 
   int            angle, fbdev_id;
   int            real_width, real_height;
@@ -49,6 +146,43 @@ typedef struct PSplashFB
   int            blue_offset;
   int            blue_length;
   int            alloc;
+
+  PSplashFBPack     pack_pixel;
+  PSplashFBFillSpan fill_span;
+  PSplashFBFillSpan stream_span;
+  PSplashFBCopySpan copy_span;
+  PSplashFBPackBlend pack_blend;
+  PSplashFBBlendSpan blend_span;
+
+  PSplashFBImage   *images;
+  struct PSplashFBGlyphCache *glyph_caches;
+
+  PSplashFBRect     damage[PSPLASH_FB_MAX_DAMAGE];
+  int               n_damage;
+
+  /* With double buffering psplash_fb_flush() flips between the pages.
+   * The back page still lacks whatever the previous flush put on the
+   * front one. */
+  int               double_buffered;
+  int               front;
+  PSplashFBRect     prev_damage[PSPLASH_FB_MAX_DAMAGE];
+  int               n_prev_damage;
+
+  int               suspended;
+
+  /* The filled part of the progress bar as start and end column, valid
+   * once psplash_draw_progress() has drawn it. psplash_draw_bar() starts
+   * it over. */
+  int               progress_drawn;
+  int               progress_filled[2];
+
+  /* Where psplash_draw_msg() put the last message, if it drew one */
+  int               msg_drawn;
+  PSplashFBRect     msg_rect;
+
+  const PSplashFBBackend *backend;
+  void             *priv;
+  struct fb_var_screeninfo fb_var;
 }
 PSplashFB;
 
@@ -56,18 +190,19 @@ void
 psplash_fb_destroy (PSplashFB *fb);
 
 PSplashFB*
-psplash_fb_new (int angle, int fbdev_id);
+psplash_fb_new (int angle, int fbdev_id, bool double_buffer);
+
+void
+psplash_fb_setup (PSplashFB *fb, int angle);
 
 void
 psplash_fb_flush (PSplashFB *fb);
 
-inline void
-psplash_fb_plot_pixel (PSplashFB    *fb, 
-		       int          x, 
-		       int          y, 
-		       uint8        red,
-		       uint8        green,
-		       uint8        blue);
+void
+psplash_fb_suspend (PSplashFB *fb);
+
+void
+psplash_fb_resume (PSplashFB *fb);
 
 void
 psplash_fb_draw_rect (PSplashFB    *fb, 
@@ -87,7 +222,8 @@ psplash_fb_draw_image (PSplashFB    *fb,
 		       int          img_height,
 		       int          img_bytes_pre_pixel,
 		       int          img_rowstride,
-		       uint8       *rle_data);
+		       uint8       *rle_data,
+		       const PSplashFBImage **native);
 
 void
 psplash_fb_text_size (int                *width,
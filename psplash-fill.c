@@ -0,0 +1,314 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Vectorised span fills, picked at runtime from the CPU features.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include <endian.h>
+#include "psplash.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PSPLASH_FILL_X86 1
+#include <immintrin.h>
+#elif defined(__GNUC__) && (defined(__aarch64__) || defined(__ARM_NEON))
+#define PSPLASH_FILL_NEON 1
+#include <arm_neon.h>
+#if !defined(__aarch64__)
+#include <sys/auxv.h>
+#ifndef HWCAP_NEON
+#define HWCAP_NEON (1 << 12)
+#endif
+#endif
+#endif
+
+/* Spans shorter than this many bytes aren't worth setting up vectors for,
+ * which is most glyph runs. */
+#define SHORT_SPAN 64
+
+/* The fill pattern is the pixel repeated over 96 bytes, the least common
+ * multiple of 3 and 32, so one pattern serves 16, 24 and 32 bpp spans
+ * with 16 or 32 byte vectors. */
+#define PATTERN_LEN 96
+
+static inline void
+store_pixel (uint8 *dst, int bytes, uint32_t pixel)
+{
+  switch (bytes)
+    {
+    case 2:
+      *(uint16_t *) dst = pixel;
+      break;
+    case 3:
+#if __BYTE_ORDER == __BIG_ENDIAN
+      *(dst + 0) = pixel >> 16;
+      *(dst + 1) = pixel >> 8;
+      *(dst + 2) = pixel;
+#else
+      *(dst + 0) = pixel;
+      *(dst + 1) = pixel >> 8;
+      *(dst + 2) = pixel >> 16;
+#endif
+      break;
+    case 4:
+      *(uint32_t *) dst = pixel;
+      break;
+    }
+}
+
+static void
+make_pattern (uint8 *pattern, int bytes, uint32_t pixel)
+{
+  int i;
+
+  for (i = 0; i < PATTERN_LEN; i += bytes)
+    store_pixel (pattern + i, bytes, pixel);
+}
+
+/* Writes single pixels until dst is 'align' aligned. Returns the number of
+ * pixels written, or -1 if dst can never get there (a 16 bpp span at an
+ * odd address). */
+static inline int
+align_head (uint8 **dst, int *len, int bytes, int align, uint32_t pixel)
+{
+  int n = 0;
+
+  while (((uintptr_t) *dst & (align - 1)) && *len > 0)
+    {
+      if (++n == align)
+	return -1;
+      store_pixel (*dst, bytes, pixel);
+      *dst += bytes;
+      (*len)--;
+    }
+
+  return n;
+}
+
+static inline void
+fill_short (uint8 *dst, int bytes, int len, uint32_t pixel)
+{
+  for (; len > 0; len--, dst += bytes)
+    store_pixel (dst, bytes, pixel);
+}
+
+#ifdef PSPLASH_FILL_X86
+
+#ifdef __i386__
+#define SSE2_TARGET __attribute__((target("sse2")))
+#else
+#define SSE2_TARGET
+#endif
+
+static SSE2_TARGET void
+fill_sse2 (uint8 *dst, int bytes, int len, uint32_t pixel, bool stream)
+{
+  uint8   pattern[PATTERN_LEN];
+  __m128i v0, v1, v2;
+  size_t  n;
+
+  if (len * bytes < SHORT_SPAN)
+    {
+      fill_short (dst, bytes, len, pixel);
+      return;
+    }
+
+  if (stream && align_head (&dst, &len, bytes, 16, pixel) < 0)
+    stream = FALSE;
+
+  make_pattern (pattern, bytes, pixel);
+  v0 = _mm_loadu_si128 ((__m128i *) (pattern + 0));
+  v1 = _mm_loadu_si128 ((__m128i *) (pattern + 16));
+  v2 = _mm_loadu_si128 ((__m128i *) (pattern + 32));
+
+  for (n = (size_t) len * bytes; n >= 48; n -= 48, dst += 48)
+    {
+      if (stream)
+	{
+	  _mm_stream_si128 ((__m128i *) (dst + 0), v0);
+	  _mm_stream_si128 ((__m128i *) (dst + 16), v1);
+	  _mm_stream_si128 ((__m128i *) (dst + 32), v2);
+	}
+      else
+	{
+	  _mm_storeu_si128 ((__m128i *) (dst + 0), v0);
+	  _mm_storeu_si128 ((__m128i *) (dst + 16), v1);
+	  _mm_storeu_si128 ((__m128i *) (dst + 32), v2);
+	}
+    }
+
+  if (stream)
+    _mm_sfence ();
+
+  memcpy (dst, pattern, n);
+}
+
+static __attribute__((target("avx2"))) void
+fill_avx2 (uint8 *dst, int bytes, int len, uint32_t pixel, bool stream)
+{
+  uint8   pattern[PATTERN_LEN];
+  __m256i v0, v1, v2;
+  size_t  n;
+
+  if (len * bytes < SHORT_SPAN)
+    {
+      fill_short (dst, bytes, len, pixel);
+      return;
+    }
+
+  if (stream && align_head (&dst, &len, bytes, 32, pixel) < 0)
+    stream = FALSE;
+
+  make_pattern (pattern, bytes, pixel);
+  v0 = _mm256_loadu_si256 ((__m256i *) (pattern + 0));
+  v1 = _mm256_loadu_si256 ((__m256i *) (pattern + 32));
+  v2 = _mm256_loadu_si256 ((__m256i *) (pattern + 64));
+
+  for (n = (size_t) len * bytes; n >= 96; n -= 96, dst += 96)
+    {
+      if (stream)
+	{
+	  _mm256_stream_si256 ((__m256i *) (dst + 0), v0);
+	  _mm256_stream_si256 ((__m256i *) (dst + 32), v1);
+	  _mm256_stream_si256 ((__m256i *) (dst + 64), v2);
+	}
+      else
+	{
+	  _mm256_storeu_si256 ((__m256i *) (dst + 0), v0);
+	  _mm256_storeu_si256 ((__m256i *) (dst + 32), v1);
+	  _mm256_storeu_si256 ((__m256i *) (dst + 64), v2);
+	}
+    }
+
+  if (stream)
+    _mm_sfence ();
+
+  memcpy (dst, pattern, n);
+}
+
+#define DEFINE_FILL(isa, bpp)						\
+static void								\
+fill_##isa##_##bpp (char *dst, int len, uint32_t pixel)		\
+{									\
+  fill_##isa ((uint8 *) dst, (bpp) >> 3, len, pixel, FALSE);		\
+}									\
+									\
+static void								\
+stream_##isa##_##bpp (char *dst, int len, uint32_t pixel)		\
+{									\
+  fill_##isa ((uint8 *) dst, (bpp) >> 3, len, pixel, TRUE);		\
+}
+
+DEFINE_FILL (sse2, 16)
+DEFINE_FILL (sse2, 24)
+DEFINE_FILL (sse2, 32)
+DEFINE_FILL (avx2, 16)
+DEFINE_FILL (avx2, 24)
+DEFINE_FILL (avx2, 32)
+
+#endif /* PSPLASH_FILL_X86 */
+
+#ifdef PSPLASH_FILL_NEON
+
+/* There are no non-temporal stores to be had from the intrinsics, so the
+ * streaming variants are the plain ones. */
+static void
+fill_neon (uint8 *dst, int bytes, int len, uint32_t pixel)
+{
+  uint8      pattern[PATTERN_LEN];
+  uint8x16_t v0, v1, v2;
+  size_t     n;
+
+  if (len * bytes < SHORT_SPAN)
+    {
+      fill_short (dst, bytes, len, pixel);
+      return;
+    }
+
+  make_pattern (pattern, bytes, pixel);
+  v0 = vld1q_u8 (pattern + 0);
+  v1 = vld1q_u8 (pattern + 16);
+  v2 = vld1q_u8 (pattern + 32);
+
+  for (n = (size_t) len * bytes; n >= 48; n -= 48, dst += 48)
+    {
+      vst1q_u8 (dst + 0, v0);
+      vst1q_u8 (dst + 16, v1);
+      vst1q_u8 (dst + 32, v2);
+    }
+
+  memcpy (dst, pattern, n);
+}
+
+#define DEFINE_FILL(isa, bpp)						\
+static void								\
+fill_##isa##_##bpp (char *dst, int len, uint32_t pixel)		\
+{									\
+  fill_##isa ((uint8 *) dst, (bpp) >> 3, len, pixel);			\
+}
+
+DEFINE_FILL (neon, 16)
+DEFINE_FILL (neon, 24)
+DEFINE_FILL (neon, 32)
+
+#endif /* PSPLASH_FILL_NEON */
+
+void
+psplash_fill_select (int                bpp,
+		     PSplashFBFillSpan *fill,
+		     PSplashFBFillSpan *stream)
+{
+#ifdef PSPLASH_FILL_X86
+  __builtin_cpu_init ();
+
+  if (__builtin_cpu_supports ("avx2"))
+    {
+      DBG("using AVX2 fills");
+      switch (bpp)
+	{
+	case 16: *fill = fill_avx2_16; *stream = stream_avx2_16; return;
+	case 24: *fill = fill_avx2_24; *stream = stream_avx2_24; return;
+	case 32: *fill = fill_avx2_32; *stream = stream_avx2_32; return;
+	}
+    }
+
+  if (__builtin_cpu_supports ("sse2"))
+    {
+      DBG("using SSE2 fills");
+      switch (bpp)
+	{
+	case 16: *fill = fill_sse2_16; *stream = stream_sse2_16; return;
+	case 24: *fill = fill_sse2_24; *stream = stream_sse2_24; return;
+	case 32: *fill = fill_sse2_32; *stream = stream_sse2_32; return;
+	}
+    }
+#endif
+
+#ifdef PSPLASH_FILL_NEON
+#if !defined(__aarch64__)
+  if (!(getauxval (AT_HWCAP) & HWCAP_NEON))
+    return;
+#endif
+
+  DBG("using NEON fills");
+  switch (bpp)
+    {
+    case 16: *fill = *stream = fill_neon_16; return;
+    case 24: *fill = *stream = fill_neon_24; return;
+    case 32: *fill = *stream = fill_neon_32; return;
+    }
+#endif
+
+  /* Keep the scalar writers */
+  (void) bpp; (void) fill; (void) stream;
+}
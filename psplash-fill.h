@@ -0,0 +1,28 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_FILL_H
+#define _HAVE_PSPLASH_FILL_H
+
+/* Replaces *fill and *stream with the best vectorised span fills the CPU
+ * supports for the given depth, leaving them alone if there are none.
+ * The *stream variant uses non-temporal stores where available and is
+ * meant for fills much larger than the caches. */
+void
+psplash_fill_select (int                bpp,
+		     PSplashFBFillSpan *fill,
+		     PSplashFBFillSpan *stream);
+
+#endif
@@ -0,0 +1,244 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Headless backend: a framebuffer that is just memory, in a memfd or a
+ *  file, so that drawing can be run and checked without a display.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include <endian.h>
+#include "psplash.h"
+
+typedef struct PSplashHeadless
+{
+  size_t size;
+}
+PSplashHeadless;
+
+/* An anonymous file to draw into */
+static int
+psplash_headless_open_anon (void)
+{
+#ifdef HAVE_MEMFD_CREATE
+  return memfd_create ("psplash", MFD_CLOEXEC);
+#else
+  char        path[PATH_MAX];
+  const char *tmpdir = getenv ("TMPDIR");
+  int         fd;
+
+  snprintf (path, sizeof (path), "%s/psplash-XXXXXX",
+	    tmpdir ? tmpdir : "/tmp");
+
+  if ((fd = mkostemp (path, O_CLOEXEC)) >= 0)
+    unlink (path);
+
+  return fd;
+#endif
+}
+
+static void
+psplash_headless_destroy (PSplashFB *fb)
+{
+  PSplashHeadless *headless = fb->priv;
+
+  if (headless)
+    {
+      if (fb->base)
+	munmap (fb->base, headless->size);
+      free (headless);
+    }
+
+  if (fb->fd >= 0)
+    close (fb->fd);
+}
+
+/* Nothing scans the memory out, so there is nothing to flip or dirty */
+static const PSplashFBBackend psplash_headless_backend =
+{
+  .name    = "headless",
+  .destroy = psplash_headless_destroy,
+};
+
+/* Channel layouts the RGBMode stands for, as fbdev would report them */
+static int
+psplash_headless_set_format (PSplashFB *fb, enum RGBMode rgbmode)
+{
+  bool is_565 = fb->bpp == 16;
+
+  switch (rgbmode)
+    {
+    case RGB565:
+    case RGB888:
+      fb->red_offset   = is_565 ? 11 : 16;
+      fb->green_offset = is_565 ? 5 : 8;
+      fb->blue_offset  = 0;
+      break;
+    case BGR565:
+    case BGR888:
+      fb->red_offset   = 0;
+      fb->green_offset = is_565 ? 5 : 8;
+      fb->blue_offset  = is_565 ? 11 : 16;
+      break;
+    case GENERIC:
+      /* Something none of the fixed writers handle, xRGB1555 or RGBx */
+      if (fb->bpp == 24)
+	return FALSE;
+      fb->red_offset   = is_565 ? 10 : 24;
+      fb->green_offset = is_565 ? 5 : 16;
+      fb->blue_offset  = is_565 ? 0 : 8;
+      fb->red_length   = fb->green_length = fb->blue_length = is_565 ? 5 : 8;
+      return TRUE;
+    default:
+      return FALSE;
+    }
+
+  fb->red_length   = is_565 ? 5 : 8;
+  fb->green_length = is_565 ? 6 : 8;
+  fb->blue_length  = is_565 ? 5 : 8;
+
+  return TRUE;
+}
+
+PSplashFB*
+psplash_headless_new (int          width,
+		      int          height,
+		      int          bpp,
+		      enum RGBMode rgbmode,
+		      int          angle,
+		      const char  *path)
+{
+  PSplashFB       *fb;
+  PSplashHeadless *headless;
+  void            *p;
+
+  if ((fb = calloc (1, sizeof (PSplashFB))) == NULL
+      || (fb->priv = headless = calloc (1, sizeof (PSplashHeadless))) == NULL)
+    {
+      perror ("Error no memory");
+      free (fb);
+      return NULL;
+    }
+
+  fb->fd      = -1;
+  fb->backend = &psplash_headless_backend;
+  fb->width   = width;
+  fb->height  = height;
+  fb->bpp     = bpp;
+  fb->stride  = width * (bpp >> 3);
+
+  if (width <= 0 || height <= 0
+      || (bpp != 16 && bpp != 24 && bpp != 32)
+      || !psplash_headless_set_format (fb, rgbmode))
+    {
+      fprintf(stderr, "Error, can't do a %ix%i %i bpp headless framebuffer"
+	      " in mode %i\n", width, height, bpp, rgbmode);
+      goto fail;
+    }
+
+  if (path)
+    fb->fd = open (path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  else
+    fb->fd = psplash_headless_open_anon ();
+
+  if (fb->fd < 0)
+    {
+      perror ("Error opening headless framebuffer");
+      goto fail;
+    }
+
+  headless->size = (size_t) fb->stride * fb->height;
+
+  if (ftruncate (fb->fd, headless->size) == -1)
+    {
+      perror ("Error sizing headless framebuffer");
+      goto fail;
+    }
+
+  p = mmap (NULL, headless->size, PROT_READ | PROT_WRITE, MAP_SHARED,
+	    fb->fd, 0);
+  if (p == MAP_FAILED)
+    {
+      perror ("Error mapping headless framebuffer");
+      goto fail;
+    }
+
+  /* Treated like a mapped fbdev, so drawing goes through the same shadow
+   * buffer and flushes as it would on hardware */
+  fb->base     = p;
+  fb->pages[0] = p;
+  fb->alloc    = 0;
+
+  psplash_fb_setup (fb, angle);
+
+  return fb;
+
+ fail:
+  psplash_fb_destroy (fb);
+
+  return NULL;
+}
+
+int
+psplash_headless_write_ppm (PSplashFB *fb, const char *path)
+{
+  FILE        *f;
+  const uint8 *row;
+  uint8       *rgb;
+  uint32_t     pixel;
+  int          x, y, bytes = fb->bpp >> 3, ok;
+
+  if ((rgb = malloc (fb->real_width * 3)) == NULL)
+    return FALSE;
+
+  if ((f = fopen (path, "wb")) == NULL)
+    {
+      perror ("Error opening snapshot");
+      free (rgb);
+      return FALSE;
+    }
+
+  fprintf (f, "P6\n%i %i\n255\n", fb->real_width, fb->real_height);
+
+  for (y = 0; y < fb->real_height; y++)
+    {
+      row = (const uint8 *) fb->pages[fb->front] + y * fb->stride;
+
+      for (x = 0; x < fb->real_width; x++, row += bytes)
+	{
+	  pixel = 0;
+	  memcpy (&pixel, row, bytes);
+#if __BYTE_ORDER == __BIG_ENDIAN
+	  pixel >>= 8 * (4 - bytes);
+#endif
+	  rgb[x * 3]     = psplash_blend_unpack_channel (pixel,
+							 fb->red_offset,
+							 fb->red_length);
+	  rgb[x * 3 + 1] = psplash_blend_unpack_channel (pixel,
+							 fb->green_offset,
+							 fb->green_length);
+	  rgb[x * 3 + 2] = psplash_blend_unpack_channel (pixel,
+							 fb->blue_offset,
+							 fb->blue_length);
+	}
+
+      fwrite (rgb, 3, fb->real_width, f);
+    }
+
+  ok = !ferror (f);
+  if (fclose (f) != 0)
+    ok = FALSE;
+
+  free (rgb);
+
+  return ok;
+}
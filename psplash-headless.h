@@ -0,0 +1,33 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_HEADLESS_H
+#define _HAVE_PSPLASH_HEADLESS_H
+
+/* A width x height framebuffer of the given depth and channel order that
+ * lives in the file 'path', or in anonymous memory if that is NULL */
+PSplashFB*
+psplash_headless_new (int          width,
+		      int          height,
+		      int          bpp,
+		      enum RGBMode rgbmode,
+		      int          angle,
+		      const char  *path);
+
+/* Writes what has been flushed to the screen out as a binary PPM */
+int
+psplash_headless_write_ppm (PSplashFB *fb, const char *path);
+
+#endif
@@ -1019,3 +1019,5970 @@
   "\337\243\377\371\346\264\377\377\363ZE\0\377\363ZE\0\377\363ZE\0\377" \
   "\363ZE\0\377\363ZE\0\377\363ZE\0\377\363ZE\0\217\363ZE\0")
 
+
+/* Pre-packed native pixel formats, generated by make-image-native.c.
+ * Define PSPLASH_IMG_NATIVE_<format> to build a variant in. */
+
+#ifdef PSPLASH_IMG_NATIVE_RGB565
+
+static const uint16_t POKY_IMG_RGB565_PIXELS[] = {
+  0xcef1, 0xc6af, 0xc6b0, 0xcef1, 0xd714, 0xe756, 0xb66b, 0xae28,
+  0xb64a, 0xb64b, 0xc6ae, 0xced0, 0xdf35, 0xb66b, 0xae28, 0xb64a,
+  0xb68c, 0xced0, 0xdf56, 0xb66b, 0xae28, 0xb64a, 0xc6b0, 0xb66b,
+  0xae28, 0xb66b, 0xd713, 0xb66b, 0xae28, 0xae49, 0xcef1, 0xb66b,
+  0xae28, 0xae49, 0xcef1, 0xb66b, 0xae28, 0xb64b, 0xd734, 0xb66b,
+  0xae28, 0xbe8d, 0xb66b, 0xae28, 0xb64a, 0xd6f2, 0xb66b, 0xae28,
+  0xbe8d, 0xb66b, 0xae28, 0xb64b, 0xb66b, 0xae28, 0xb64a, 0xdf35,
+  0xb66b, 0xae28, 0xd6f2, 0xb66b, 0xae28, 0xc6b0, 0xb66b, 0xae28,
+  0xc6af, 0xb66b, 0xae28, 0xc6cf, 0xb66b, 0xae28, 0xced0, 0xb66b,
+  0xae28, 0xb628, 0xd714, 0xb66b, 0xae28, 0xae49, 0xdf56, 0xb66b,
+  0xae28, 0xb64a, 0xb66b, 0xae28, 0xbe8d, 0xb66b, 0xae28, 0xcef1,
+  0xb66b, 0xae28, 0xae49, 0xb66b, 0xae28, 0xbe6c, 0xb66b, 0xae28,
+  0xcef1, 0xb66b, 0xae28, 0xb64a, 0xb66b, 0xae28, 0xc6b0, 0xb66b,
+  0xae28, 0xb64a, 0xb66b, 0xae28, 0xc6af, 0xb66b, 0xae28, 0xb64a,
+  0xb66b, 0xae28, 0xced0, 0xb66b, 0xae28, 0xae49, 0xb66b, 0xae28,
+  0xd714, 0xb66b, 0xae28, 0xb66b, 0xb66b, 0xae28, 0xb66b, 0xae28,
+  0xd713, 0xb66b, 0xae28, 0xb68c, 0xb66b, 0xae28, 0xae49, 0xb66b,
+  0xae28, 0xdf56, 0xb66b, 0xae28, 0xcef2, 0xb66b, 0xae28, 0xbe6c,
+  0xb66b, 0xae28, 0xb64a, 0xb66b, 0xae28, 0xb66b, 0xae28, 0xdf35,
+  0xb66b, 0xae28, 0xd6f2, 0xb66b, 0xae28, 0xced0, 0xb66b, 0xae28,
+  0xc6cf, 0xb66b, 0xae28, 0xc6ae, 0xb66b, 0xae28, 0xbe6c, 0xb66b,
+  0xae28, 0xb66b, 0xfd95, 0xf4b0, 0xf40e, 0xf38c, 0xf34a, 0xf34a,
+  0xf309, 0xf34a, 0xf34a, 0xf38c, 0xf40d, 0xfc90, 0xfd94, 0xfdf6,
+  0xbf3c, 0xbf3c, 0xbf3c, 0xb71b, 0x96b9, 0x8e98, 0x8eba, 0x9ed9,
+  0xa6fa, 0xb71b, 0xb66b, 0xae28, 0xb64b, 0xfdd6, 0xf44f, 0xf34a,
+  0xf2c8, 0xea67, 0xf246, 0xf247, 0xea67, 0xf2c8, 0xf34a, 0xf40e,
+  0xfdd5, 0x9eda, 0xa6fa, 0xaefa, 0xaefa, 0xb71b, 0xb71b, 0xaefa,
+  0xa6fa, 0x9efa, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7657, 0x7678,
+  0x7e78, 0x8eb9, 0xaefa, 0xbe8d, 0xb64a, 0xb64a, 0xb64b, 0xb64b,
+  0xb66b, 0xb68c, 0xb68c, 0xbe8d, 0xc6ae, 0xbe8d, 0xb68c, 0xb68c,
+  0xb66b, 0xb64b, 0xb64b, 0xb64a, 0xb64a, 0xb64b, 0xbe6c, 0xbe8d,
+  0xceae, 0xfeb0, 0xfeb0, 0xfed1, 0xfed2, 0xfef4, 0xfef4, 0xfef2,
+  0xfed1, 0xfeb0, 0xfeb0, 0xfc90, 0xf34a, 0xf287, 0xf246, 0xf287,
+  0xf34a, 0xf44f, 0x9eda, 0x9efa, 0xaefa, 0xb71b, 0xb71b, 0xa6fa,
+  0x9efa, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x6e58, 0x7e78, 0x8eb9,
+  0xb71b, 0xc6ae, 0xb64b, 0xb66b, 0xb66b, 0xbe6c, 0xc6ae, 0xc6af,
+  0xc6b0, 0xced0, 0xc6b0, 0xc6af, 0xc6ae, 0xb68c, 0xb66b, 0xb66b,
+  0xb64b, 0xb64a, 0xb628, 0xae28, 0xc64a, 0xfe4b, 0xfe4c, 0xfe6d,
+  0xfeb0, 0xfed2, 0xff36, 0xfef3, 0xfeb0, 0xfe8e, 0xfe4c, 0xfe4b,
+  0xfef4, 0xf4b0, 0xf34a, 0xea67, 0xf246, 0xf309, 0xf490, 0x9eda,
+  0xa6fa, 0xb71b, 0xaf1b, 0x9efa, 0x9eda, 0x9ed9, 0x7e78, 0x6e57,
+  0x7657, 0x7e78, 0x8eba, 0xb71b, 0xc6ae, 0xb64b, 0xb66b, 0xbe6c,
+  0xc6ae, 0xc6af, 0xced0, 0xc6af, 0xc6ae, 0xbe8d, 0xb66b, 0xb64b,
+  0xb64a, 0xb628, 0xae28, 0xc64a, 0xfe4b, 0xfe4c, 0xfeaf, 0xfef3,
+  0xfef4, 0xfeb0, 0xfe4c, 0xfe4b, 0xfef4, 0xf3cd, 0xea67, 0xf246,
+  0xf247, 0xf38c, 0xfdd5, 0x9eda, 0xaefa, 0xb71b, 0xa6fa, 0x9eda,
+  0x9ed9, 0x7e78, 0x6e57, 0x7657, 0x7e78, 0xa6fa, 0xc6ae, 0xb64b,
+  0xb66b, 0xbe8d, 0xc6ae, 0xc6b0, 0xced0, 0xc6b0, 0xc6ae, 0xbe6c,
+  0xb66b, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xc64a, 0xfe4b, 0xfe6d,
+  0xfef3, 0xfef4, 0xfeaf, 0xfe4b, 0xfef4, 0xfdd6, 0xf36b, 0xf246,
+  0xf309, 0xfd53, 0x9efa, 0x9eda, 0xa6fa, 0xbf3c, 0xaf1b, 0x9eda,
+  0x9ed9, 0x7e78, 0x6e57, 0x7657, 0x9ed9, 0xc6af, 0xb64b, 0xb66b,
+  0xc6ae, 0xc6cf, 0xced0, 0xc6b0, 0xbe8d, 0xb66b, 0xb64b, 0xb64a,
+  0xb628, 0xae28, 0xce4b, 0xfe4b, 0xfeb0, 0xff36, 0xfed1, 0xfe4c,
+  0xfe4b, 0xfef4, 0xf34b, 0xf246, 0xf2c9, 0xfdd5, 0x9efa, 0x9eda,
+  0xa6fa, 0xbf3c, 0xaefa, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7658,
+  0x9ed9, 0xc6af, 0xb64b, 0xbe8d, 0xc6cf, 0xced0, 0xc6af, 0xbe8d,
+  0xb64b, 0xb64a, 0xb628, 0xae28, 0xce6c, 0xf64c, 0xfe4b, 0xfe6d,
+  0xff15, 0xfeaf, 0xfe4b, 0xfef4, 0xf38c, 0xf246, 0xf34b, 0xa6fa,
+  0x9eda, 0x9ed9, 0x96b9, 0x9ed9, 0x9eda, 0x9ed9, 0x7e78, 0x6e57,
+  0x7657, 0xa6fa, 0xced0, 0xb64b, 0xbe8d, 0xc6cf, 0xc6cf, 0xbe8d,
+  0xb64b, 0xb64a, 0xb628, 0xae28, 0xd68d, 0xf64c, 0xfe4b, 0xfe4c,
+  0xff15, 0xfe6d, 0xfe4b, 0xfef4, 0xf4d1, 0xf287, 0xf246, 0xea66,
+  0xf44f, 0xaefa, 0x9eda, 0x9ed9, 0x8e98, 0x7e78, 0x7e78, 0x7e78,
+  0x8eba, 0x9ed9, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7e78, 0xced0,
+  0xb64b, 0xb64a, 0xb64a, 0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28,
+  0xdeb0, 0xf64c, 0xfe4b, 0xfe6d, 0xfeb0, 0xfe4b, 0xfef4, 0xf34a,
+  0xf246, 0xf309, 0xb71b, 0x9eda, 0x9ed9, 0x96b9, 0x7e78, 0x7e79,
+  0x8e98, 0x9ed9, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7e57, 0x9ed9,
+  0xcef1, 0xb64b, 0xb64a, 0xae49, 0xae28, 0xae28, 0xae49, 0xb64a,
+  0xb64b, 0xb64a, 0xb628, 0xae28, 0xef14, 0xf64c, 0xfe4b, 0xfe4c,
+  0xfed1, 0xfef4, 0xfe4c, 0xfe4b, 0xfef4, 0xf533, 0xf2c8, 0xf246,
+  0xf287, 0xf4d1, 0x9eda, 0x9ed9, 0x8e98, 0x7e78, 0x8eb9, 0x9eda,
+  0x9ed9, 0x7e78, 0x6e57, 0x7e79, 0xcef2, 0xb64b, 0xb64a, 0xb64a,
+  0xae28, 0xae49, 0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xb64a,
+  0xf64c, 0xfe4b, 0xfe6d, 0xfeb0, 0xfe4b, 0xfef4, 0xf450, 0xf246,
+  0xf3cd, 0xa6fa, 0x9eda, 0x9ed9, 0x8e98, 0x7e78, 0x7e79, 0x8e98,
+  0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7e78, 0xb71b, 0xd6f2, 0xb66b,
+  0xb64b, 0xb64a, 0xb64a, 0xae28, 0xb64a, 0xb64a, 0xb64b, 0xb64a,
+  0xb628, 0xae28, 0xb68c, 0xf64c, 0xfe4b, 0xfe4c, 0xfef3, 0xff35,
+  0xfe4c, 0xfe4b, 0xfef4, 0xf38c, 0xf246, 0xf309, 0xa6fa, 0x9eda,
+  0x9ed9, 0x7e78, 0x8e98, 0x9ed9, 0x9eda, 0x9ed9, 0x7e78, 0x6e57,
+  0x7658, 0xa6fa, 0xd713, 0xb68c, 0xb64b, 0xb64a, 0xae28, 0xb628,
+  0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xcef1, 0xf64c, 0xfe4b,
+  0xfeb0, 0xfed2, 0xfe4b, 0xfef4, 0xf309, 0xf246, 0xf2c8, 0xaf1b,
+  0x9eda, 0x96d9, 0x7e78, 0x8698, 0x9ed9, 0x9eda, 0x9ed9, 0x7e78,
+  0x6e57, 0x96b9, 0xd713, 0xbe8d, 0xb64b, 0xae49, 0xae28, 0xb64a,
+  0xb64b, 0xb64a, 0xb628, 0xae28, 0xdf56, 0xf64c, 0xfe4b, 0xfe6d,
+  0xfeaf, 0xfe4b, 0xfef4, 0xf2c9, 0xf246, 0xf287, 0xfdd6, 0x9eda,
+  0x8eb9, 0x7e79, 0x7e78, 0x9ed9, 0x9eda, 0x9ed9, 0x7e78, 0x6e57,
+  0x8e98, 0xd713, 0xc6af, 0xb64b, 0xb64a, 0xae49, 0xae28, 0xb64a,
+  0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xb64a, 0xf64c, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xfe4b, 0xfef4, 0xf2c8, 0xf246, 0xea67, 0xfdd5,
+  0x9efa, 0x9eda, 0x8eb9, 0x7e79, 0x7e78, 0x9ed9, 0x9eda, 0x9ed9,
+  0x7e78, 0x6e57, 0x8e98, 0xd713, 0xc6b0, 0xb66b, 0xb64b, 0xae49,
+  0xae28, 0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xb64b, 0xf64c,
+  0xfe4b, 0xff36, 0xfe4c, 0xfe4b, 0xfef4, 0xf287, 0xf246, 0xf287,
+  0xfdd5, 0xaefa, 0x9eda, 0x8eb9, 0x7678, 0x7e78, 0x9ed9, 0x9eda,
+  0x9ed9, 0x7e78, 0x6e57, 0x8698, 0xd713, 0xced0, 0xbe8d, 0xb64b,
+  0xae49, 0xae28, 0xae49, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xd6f2,
+  0xf64c, 0xfe4b, 0xff35, 0xfe4c, 0xfe4b, 0xfef4, 0xf2c8, 0xf246,
+  0xf2c8, 0x9eda, 0x96b9, 0x7e78, 0x8698, 0x9ed9, 0x9eda, 0x9ed9,
+  0x7e78, 0x6e57, 0x8eba, 0xd713, 0xced0, 0xc6ae, 0xb64b, 0xb64a,
+  0xae49, 0xae28, 0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xb64a,
+  0xf64c, 0xfe4b, 0xff36, 0xfe6d, 0xfe4b, 0xfef4, 0xf34a, 0xf246,
+  0xf309, 0xa6fa, 0x9eda, 0x9ed9, 0x7e78, 0x8e98, 0x9ed9, 0x9eda,
+  0x9ed9, 0x7e78, 0x6e57, 0x9ed9, 0xd713, 0xced0, 0xced0, 0xb64b,
+  0xae49, 0xae28, 0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xb66b,
+  0xf64c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4b, 0xfef4, 0xf3cd, 0xf246,
+  0xf34a, 0xb71b, 0x9eda, 0x9ed9, 0x7e79, 0x7e78, 0x8e98, 0x9ed9,
+  0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0xaefa, 0xd713, 0xced0, 0xced0,
+  0xbe8d, 0xb64b, 0xb64a, 0xae28, 0xae49, 0xb64b, 0xb64a, 0xb628,
+  0xae28, 0xd713, 0xf64c, 0xfe4b, 0xfe4c, 0xfe8e, 0xfe4b, 0xfef4,
+  0xf4d1, 0xf246, 0xf3cd, 0x9eda, 0x9ed9, 0x8e98, 0x7e78, 0x8eb9,
+  0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7658, 0xd713, 0xced0, 0xced0,
+  0xc6af, 0xb64b, 0xae4a, 0xae28, 0xb64a, 0xb64b, 0xb64a, 0xb628,
+  0xae28, 0xb64a, 0xf64c, 0xfe4b, 0xfe6d, 0xfeb0, 0xfe4b, 0xfef4,
+  0xea67, 0xf246, 0xf533, 0xaefa, 0x9eda, 0x8e98, 0x7e78, 0x9ed9,
+  0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7e78, 0xd713, 0xced0, 0xced0,
+  0xced0, 0xb66b, 0xb64b, 0xb64a, 0xae28, 0xb64a, 0xb64b, 0xb64a,
+  0xb628, 0xae28, 0xc6af, 0xf64c, 0xfe4b, 0xfeb0, 0xfef3, 0xfe4b,
+  0xfef4, 0xf309, 0xf246, 0xea67, 0x9eda, 0x9eda, 0x9eda, 0x9ed9,
+  0x7e79, 0x7e78, 0x8e98, 0x9ed9, 0x9eda, 0x9ed9, 0x7e78, 0x6e57,
+  0x8eb9, 0xd713, 0xced0, 0xced0, 0xced0, 0xc6ae, 0xb64b, 0xb64a,
+  0xae49, 0xae28, 0xae49, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xae49,
+  0xf64c, 0xfe4b, 0xfef3, 0xfe4b, 0xfef4, 0xf44f, 0xf246, 0xf34b,
+  0xa6fa, 0x9eda, 0x9ed9, 0x7e78, 0x8e98, 0x9eda, 0x9ed9, 0x7e78,
+  0x6e57, 0x7657, 0xb71b, 0xd713, 0xced0, 0xb66b, 0xb64b, 0xb64b,
+  0xb64b, 0xae49, 0xae28, 0xae49, 0xb64b, 0xb64a, 0xb628, 0xae28,
+  0xbe6c, 0xf64c, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe4b, 0xfef4, 0xfdd6,
+  0xea67, 0xf246, 0xf533, 0x9eda, 0x8e98, 0x7e78, 0x7e79, 0x9ed9,
+  0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7e78, 0xd713, 0xced0, 0xbe8d,
+  0xb64b, 0xb64b, 0xb64a, 0xae28, 0xb64a, 0xb64b, 0xb64a, 0xb628,
+  0xae28, 0xdf56, 0xf64c, 0xfe4b, 0xfe4c, 0xfed1, 0xfe4b, 0xfef4,
+  0xf309, 0xf246, 0xf287, 0x9efa, 0x7e78, 0x7e79, 0x9eda, 0x9ed9,
+  0x7e78, 0x6e57, 0x8eb9, 0xd713, 0xced0, 0xc6b0, 0xb66b, 0xb64a,
+  0xae28, 0xb64a, 0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xbe8d,
+  0xf64c, 0xfe4b, 0xfed1, 0xff36, 0xfe4b, 0xfef4, 0xf4d1, 0xf246,
+  0xf40e, 0xa6fa, 0x7e78, 0x8eba, 0x9eda, 0x9ed9, 0x7e78, 0x6e57,
+  0x7657, 0xd713, 0xced0, 0xc6ae, 0xb64a, 0xae28, 0xae49, 0xb64b,
+  0xb64a, 0xb628, 0xae28, 0xae49, 0xf64c, 0xfe4b, 0xfe6d, 0xfe4b,
+  0xfef4, 0xf2c8, 0xf246, 0xea67, 0x9eda, 0x8e98, 0x7e78, 0x9ed9,
+  0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7e78, 0xd713, 0xced0, 0xc6af,
+  0xae49, 0xae28, 0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xc6af,
+  0xf64c, 0xfe4b, 0xfe8e, 0xfef3, 0xfe4b, 0xfef4, 0xf44f, 0xf246,
+  0xf3cd, 0xb71b, 0x9eda, 0x9ed9, 0x7e79, 0x7e78, 0x8eb9, 0x9eda,
+  0x9ed9, 0x7e78, 0x6e57, 0xd713, 0xced0, 0xbe6c, 0xb64a, 0xae28,
+  0xae49, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xb64a, 0xf64c, 0xfe4b,
+  0xfe4c, 0xfe4b, 0xfef4, 0xf287, 0xf246, 0xea67, 0x9efa, 0x9eda,
+  0x9eda, 0x8e98, 0x7e78, 0x9ed9, 0x9eda, 0x9eda, 0x9eda, 0x9ed9,
+  0x7e78, 0x6e57, 0x7e78, 0xd713, 0xced0, 0xc6af, 0xb64b, 0xb64b,
+  0xae49, 0xae28, 0xb64a, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xd714,
+  0xf64c, 0xfe4b, 0xfe8e, 0xfef2, 0xfe4b, 0xfef4, 0xf4b0, 0xf246,
+  0xf3cd, 0xb71b, 0x9eda, 0x9eda, 0x9eda, 0x9ed9, 0x7e78, 0x8eb9,
+  0x9eda, 0x9eda, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0xd713, 0xced0,
+  0xb68c, 0xb64b, 0xb64b, 0xb64a, 0xae28, 0xae49, 0xb64b, 0xb64a,
+  0xb628, 0xae28, 0xbe6c, 0xf64c, 0xfe4b, 0xff36, 0xfe4c, 0xfe4b,
+  0xfef4, 0xf288, 0xf246, 0xea67, 0x9efa, 0x9eda, 0x9ed9, 0x7e79,
+  0x7e78, 0x8679, 0x9ed9, 0x9eda, 0x9eda, 0x9ed9, 0x7e78, 0x6e57,
+  0x8e98, 0xd713, 0xced0, 0xced0, 0xced0, 0xc6af, 0xb64b, 0xb64a,
+  0xae28, 0xb64a, 0xb64b, 0xb64b, 0xb64b, 0xb64a, 0xb628, 0xae28,
+  0xb64a, 0xf64c, 0xfe4b, 0xfe8e, 0xfed2, 0xfe4b, 0xfef4, 0xfd53,
+  0xf246, 0xf450, 0x9eda, 0x8eb9, 0x7e79, 0x7e78, 0x8eb9, 0x9eda,
+  0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0xd713, 0xced0, 0xced0, 0xced0,
+  0xbe8d, 0xb64b, 0xae49, 0xae28, 0xae49, 0xb64b, 0xb64b, 0xb64b,
+  0xb64a, 0xb628, 0xae28, 0xd734, 0xf64c, 0xfe4b, 0xfe4c, 0xfe4b,
+  0xfef4, 0xf309, 0xf246, 0xf2c9, 0xaefa, 0x9eda, 0x8eb9, 0x7e78,
+  0x8e98, 0x9eda, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0xa6fa, 0xd713,
+  0xced0, 0xced0, 0xc6b0, 0xb64b, 0xb64a, 0xae28, 0xb64a, 0xb64b,
+  0xb64b, 0xb64a, 0xb628, 0xae28, 0xced0, 0xf64c, 0xfe4b, 0xfed1,
+  0xfef4, 0xfe4b, 0xfef4, 0xf246, 0xfdd5, 0x9eda, 0x8e98, 0x7e78,
+  0x9ed9, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x7e78, 0xd713, 0xced0,
+  0xced0, 0xc6ae, 0xb64b, 0xb64a, 0xae28, 0xb64a, 0xb64b, 0xb64b,
+  0xb64a, 0xb628, 0xae28, 0xbe8d, 0xf64c, 0xfe4b, 0xfe4c, 0xfe8e,
+  0xfe4b, 0xfef4, 0xf4b0, 0xf246, 0xf3ac, 0xb71b, 0x9eda, 0x9ed9,
+  0x8e98, 0x7e78, 0x8eb9, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0xd713,
+  0xced0, 0xced0, 0xb68c, 0xb64b, 0xb64a, 0xae28, 0xb64a, 0xb64b,
+  0xb64b, 0xb64a, 0xb628, 0xae28, 0xb68c, 0xf64c, 0xfe4b, 0xfef3,
+  0xfe4b, 0xfef4, 0xf309, 0xf246, 0xf288, 0xa6fa, 0x9eda, 0x9ed9,
+  0x8e98, 0x7e78, 0x8698, 0x9eda, 0x9ed9, 0x7e78, 0x6e57, 0x9eda,
+  0xd713, 0xced0, 0xc6af, 0xb64b, 0xb64a, 0xae28, 0xb64a, 0xb64b,
+  0xb64a, 0xb628, 0xae28, 0xb64b, 0xf64c, 0xfe4b, 0xfe8e, 0xfed1,
+  0xfe4b, 0xfef4, 0xf246, 0xfdd5, 0x9eda, 0x9ed9, 0x8e98, 0x7e78,
+  0x9ed9, 0x9ed9, 0x7e78, 0x6e57, 0x7e78, 0xd713, 0xced0, 0xc6ae,
+  0xb64b, 0xb64a, 0xae28, 0xae49, 0xb64b, 0xb64a, 0xb628, 0xae28,
+  0xb64b, 0xf64c, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe4b, 0xfef4, 0xfd13,
+  0xf246, 0xf40e, 0xb71b, 0x9eda, 0x9ed9, 0x8e98, 0x7e78, 0x96b9,
+  0x9ed9, 0x7e78, 0x6e57, 0xd713, 0xc6b0, 0xb68c, 0xb64b, 0xb64a,
+  0xb628, 0xae28, 0xae49, 0xb64b, 0xb64a, 0xb628, 0xae28, 0xb64b,
+  0xf64c, 0xfe4b, 0xfef4, 0xf64c, 0xfe4b, 0xfef4, 0xf3cd, 0xf246,
+  0xf2c8, 0xaefa, 0x9eda, 0x9ed9, 0x8e98, 0x7e78, 0x8e98, 0x9ed9,
+  0x7e78, 0x6e57, 0xaefa, 0xd713, 0xc6af, 0xb64b, 0xb64a, 0xae28,
+  0xb64a, 0xb64a, 0xb628, 0xae28, 0xb66b, 0xf64c, 0xfe4b, 0xfeb0,
+  0xfef4, 0xfe4b, 0xfef4, 0xf2c8, 0xf246, 0xea67, 0xa6fa, 0x9eda,
+  0x8e98, 0x7e79, 0x7e78, 0x9ed9, 0x7e78, 0x6e57, 0x96b9, 0xd713,
+  0xc6ae, 0xb64b, 0xb64a, 0xae28, 0xb64a, 0xb64a, 0xb628, 0xae28,
+  0xb68c, 0xf64c, 0xfe4b, 0xfe4c, 0xfe8e, 0xfe4b, 0xfef4, 0xf246,
+  0xfd95, 0x9eda, 0x96b9, 0x7e79, 0x7e78, 0x9ed9, 0x7e78, 0x6e57,
+  0x7e78, 0xd713, 0xbe8d, 0xb64b, 0xb64a, 0xae49, 0xae28, 0xae49,
+  0xb64a, 0xb628, 0xae28, 0xc6ae, 0xf64c, 0xfe4b, 0xf64c, 0xfe4c,
+  0xfe4b, 0xfef4, 0xfd53, 0xf246, 0xf4d1, 0x9eda, 0x9ed9, 0x8e98,
+  0x7e78, 0x7e79, 0x8eb9, 0x7e78, 0x6e57, 0x7658, 0xd6f2, 0xb66b,
+  0xb64b, 0xae49, 0xae28, 0xb64a, 0xb628, 0xae28, 0xcef1, 0xf64c,
+  0xfe4b, 0xfef4, 0xfe4b, 0xfef4, 0xf450, 0xf246, 0xf38c, 0xaefa,
+  0x9eda, 0x9ed9, 0x8eb9, 0x7e78, 0x8e98, 0x7e78, 0x6e57, 0x7657,
+  0xd6f2, 0xb64b, 0xb64a, 0xae28, 0xb64a, 0xb628, 0xae28, 0xb64b,
+  0xf64c, 0xfe4b, 0xfeb0, 0xff15, 0xfe4b, 0xfef4, 0xf3cd, 0xf246,
+  0xf288, 0xa6fa, 0x9eda, 0x9ed9, 0x8e98, 0x7e78, 0x8e98, 0x7e78,
+  0x6e57, 0x9ed9, 0xcef2, 0xb64b, 0xb64a, 0xae49, 0xae28, 0xb64a,
+  0xb628, 0xae28, 0xae49, 0xced0, 0xf64c, 0xfe4b, 0xfe8e, 0xfed2,
+  0xfe4b, 0xfef4, 0xf34a, 0xf246, 0x9efa, 0x9eda, 0x96d9, 0x8e98,
+  0x7e78, 0x6e57, 0x96b8, 0xced0, 0xb64b, 0xae49, 0xb64a, 0xae28,
+  0xb64a, 0xb628, 0xae28, 0xbe6c, 0xe756, 0xf64c, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe4b, 0xfef4, 0xf2c8, 0xf246, 0xea67, 0xf287, 0xea67,
+  0xf246, 0x9efa, 0x9eda, 0x9ed9, 0x8eb9, 0x8679, 0x7e79, 0x7e78,
+  0x7e79, 0x8e98, 0x8679, 0x7657, 0x6e57, 0x8698, 0xced0, 0xb64b,
+  0xb64a, 0xae49, 0xae28, 0xb64a, 0xb628, 0xae28, 0xb64b, 0xd713,
+  0xf64c, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe4b, 0xfef4, 0xf287, 0xf246,
+  0xf2c8, 0xfc90, 0xfd13, 0xf2c9, 0xf246, 0xddb5, 0x9efa, 0x9eda,
+  0x9ed9, 0x96b9, 0x8e98, 0x7e78, 0x7e79, 0x96d9, 0x9efa, 0x7678,
+  0x6e58, 0x6e57, 0x7e78, 0xbeaf, 0xb64b, 0xb64a, 0xae49, 0xae28,
+  0xb628, 0xb64a, 0xb64a, 0xb628, 0xae28, 0xb64a, 0xced0, 0xf64c,
+  0xfe4b, 0xfe4c, 0xfe4c, 0xfe4b, 0xfef4, 0xea66, 0xf246, 0xf2c8,
+  0xf36b, 0xf246, 0xcd33, 0x9eda, 0x9ed9, 0x96d9, 0x8e98, 0x7e78,
+  0xa6fa, 0x7e78, 0x6e57, 0x7e78, 0xb68f, 0xb64b, 0xb64a, 0xae49,
+  0xae28, 0xb628, 0xc6ae, 0xdf56, 0xbe8d, 0xae28, 0xae49, 0xb64b,
+  0xcef1, 0xf64c, 0xfe4b, 0xfe4c, 0xfef3, 0xff15, 0xfe6d, 0xfe4b,
+  0xfef4, 0xf246, 0xea67, 0xf287, 0xf246, 0xc4f1, 0x9eda, 0x9ed9,
+  0x8eb9, 0x8e98, 0x7e79, 0x7e78, 0x96b9, 0xbf3c, 0x6e57, 0x7e57,
+  0xae6e, 0xb64b, 0xb64a, 0xae49, 0xb628, 0xae28, 0xd713, 0xcef1,
+  0xae28, 0xb66b, 0xd714, 0xf64c, 0xfe4b, 0xfe6d, 0xfe8e, 0xfe4b,
+  0xfef4, 0xf246, 0xf36b, 0xfc90, 0xf246, 0xc4f1, 0x9eda, 0x9ed9,
+  0x96b9, 0x8e98, 0x7e78, 0x7e79, 0x7e78, 0x8e98, 0x6e57, 0x7657,
+  0xae6d, 0xb64b, 0xb64a, 0xb64a, 0xae28, 0xced0, 0xc6af, 0xae28,
+  0xb64b, 0xd6f2, 0xf64c, 0xfe4b, 0xfe6d, 0xfe4b, 0xfef4, 0xf246,
+  0xf4d1, 0xfd95, 0xf246, 0xc4f1, 0x9eda, 0x9ed9, 0x9ed9, 0x8eb9,
+  0x8e98, 0x8e98, 0x7e78, 0x9ed9, 0x6e57, 0x7657, 0xae6d, 0xb64b,
+  0xb64a, 0xb64a, 0xb64a, 0xb628, 0xae28, 0xae49, 0xae28, 0xb64a,
+  0xc6af, 0xd734, 0xf64c, 0xfe4b, 0xfeb0, 0xfef3, 0xfe4b, 0xfef4,
+  0xf288, 0xf288, 0xf2c8, 0xf2c8, 0xf2c9, 0xf309, 0xf309, 0xf34a,
+  0xf36b, 0xf38c, 0xf34b, 0xf32a, 0xf309, 0xfd95, 0xfdd5, 0xf246,
+  0xacb0, 0x7678, 0x7e78, 0x7e78, 0x7e78, 0x9ed9, 0x6e57, 0x7657,
+  0xae6d, 0xb64b, 0xb64a, 0xb64a, 0xb64a, 0xae49, 0xb64a, 0xae49,
+  0xb66b, 0xb64b, 0xb68c, 0xc6af, 0xd6f2, 0xdf35, 0xf64c, 0xfe4b,
+  0xfef4, 0xfe4b, 0xfef4, 0xf2c8, 0xf2c9, 0xf34a, 0xf38c, 0xf3cd,
+  0xf40d, 0xf40e, 0xf40d, 0xf3cd, 0xf38c, 0xf34a, 0xf309, 0xf2c9,
+  0xf2c8, 0xf2c8, 0xf2c8, 0xfc90, 0xfd13, 0xf246, 0xacb0, 0x6e57,
+  0x8eb9, 0x6e57, 0x7657, 0xa64c, 0xae49, 0xb64a, 0xb68c, 0xd6f2,
+  0xdf56, 0xf64c, 0xfe4b, 0xfef4, 0xfe4c, 0xff36, 0xf2c8, 0xf309,
+  0xf34a, 0xf38c, 0xf3cd, 0xf40e, 0xf40d, 0xf3cd, 0xf34b, 0xf309,
+  0xf2c8, 0xf34a, 0xf34b, 0xf246, 0xacb0, 0x6e57, 0x9ed9, 0x7e78,
+  0x6e57, 0x7657, 0xa64c, 0xae28, 0xb64b, 0xae28, 0xae28, 0xae49,
+  0xb64a, 0xb68c, 0xc6af, 0xd714, 0xfe4b, 0xfef2, 0xff36, 0xfe4b,
+  0xfe4c, 0xfe4c, 0xfe4c, 0xfe6d, 0xff36, 0xf2c8, 0xf309, 0xf34a,
+  0xf3ac, 0xf40d, 0xf40e, 0xf40d, 0xf3cd, 0xf36b, 0xf309, 0xf2c8,
+  0xfc90, 0xf512, 0xf246, 0xb4d1, 0x6e57, 0x7e57, 0x8eb9, 0x6e57,
+  0x7657, 0xae4b, 0xae28, 0xae49, 0xdf56, 0xd714, 0xae28, 0xae49,
+  0xb66b, 0xc6cf, 0xdf35, 0xfe4b, 0xfe6d, 0xfeb0, 0xfe4b, 0xfe4c,
+  0xfe4c, 0xfe4c, 0xfe6d, 0xf2c8, 0xf309, 0xf38c, 0xf3cd, 0xf40e,
+  0xf40d, 0xf38c, 0xf309, 0xf2c8, 0xf490, 0xf490, 0xea67, 0xf246,
+  0xbd32, 0x6e57, 0x7e78, 0xb71b, 0x8eba, 0x6e57, 0x7657, 0xb64c,
+  0xae28, 0xb66b, 0xb64a, 0xae28, 0xb64a, 0xc6af, 0xdf56, 0xfe4c,
+  0xfe4b, 0xfef2, 0xff15, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe6d,
+  0xf2c9, 0xf2c8, 0xf36b, 0xf3cd, 0xf40e, 0xf40e, 0xf40e, 0xf40d,
+  0xf38c, 0xf309, 0xf2c8, 0xf309, 0xf40e, 0xfc90, 0xf3cd, 0xf2c7,
+  0xf246, 0xc5d6, 0x6e57, 0x7e78, 0x9ed9, 0xa6fa, 0x8eb9, 0x7658,
+  0x6e57, 0x7e76, 0xb64c, 0xae28, 0xb68c, 0xe756, 0xb64b, 0xae28,
+  0xb628, 0xb64b, 0xd6f2, 0xfe4c, 0xfe4b, 0xfed2, 0xfef4, 0xfe4c,
+  0xfe4b, 0xfe4c, 0xfe6d, 0xf309, 0xf2c8, 0xf36b, 0xf40d, 0xf3ac,
+  0xf309, 0xf2c8, 0xf287, 0xf246, 0x7657, 0x6e57, 0x8677, 0xb66b,
+  0xae28, 0xb68c, 0xcf13, 0xcef1, 0xb68c, 0xae28, 0xb64a, 0xced0,
+  0xfe4c, 0xfe4b, 0xfe4c, 0xfeb0, 0xfef4, 0xfed2, 0xfe4c, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xf309, 0xf2c8, 0xf2c7, 0xf287, 0xf287, 0xf2c8,
+  0xf287, 0xf246, 0xea67, 0x7677, 0x6e57, 0x9697, 0xb66b, 0xae28,
+  0xb68c, 0xb64a, 0xae28, 0xb64a, 0xcef1, 0xfe6d, 0xfe4b, 0xfe4c,
+  0xfe4b, 0xf64c, 0xfe4c, 0xfe6d, 0xf34a, 0xf2c8, 0xea67, 0xf246,
+  0xf246, 0xf246, 0xf247, 0xf287, 0xf2c8, 0xf287, 0xf246, 0xf309,
+  0x7e78, 0x6e57, 0xa6f8, 0xb66b, 0xae28, 0xc6ae, 0xb64a, 0xae28,
+  0xae4a, 0xd734, 0xfeaf, 0xfe4b, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d,
+  0xfe8e, 0xf38c, 0xf2c8, 0xf287, 0xea66, 0xf246, 0xf287, 0xf2c8,
+  0xf287, 0xf246, 0xf44f, 0x8e98, 0x6e57, 0xb66b, 0xae28, 0xd6f2,
+  0xb64a, 0xae28, 0xbe8d, 0xfef2, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xf3cd, 0xf2c8, 0xf287, 0xf246, 0xf247, 0xf288,
+  0xf2c8, 0xf287, 0xf246, 0xfd53, 0x9efa, 0x6e57, 0x7678, 0xb66b,
+  0xae28, 0xae49, 0xe756, 0xb64a, 0xae28, 0xb64a, 0xd6f2, 0xfe4b,
+  0xfe4c, 0xfe4c, 0xfe4b, 0xf64c, 0xfe4c, 0xfe6d, 0xfeaf, 0xf3cd,
+  0xf2c8, 0xf2c7, 0xea67, 0xf246, 0xf287, 0xf2c8, 0xf287, 0xf246,
+  0x6e57, 0x8e98, 0xb66b, 0xae28, 0xb64b, 0xb64a, 0xae28, 0xb628,
+  0xc6ae, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfeb0,
+  0xf40e, 0xf309, 0xf2c8, 0xf287, 0xea66, 0xf246, 0xf287, 0xf2c8,
+  0xf287, 0xf246, 0xf287, 0x7678, 0x6e57, 0x9eda, 0xb66b, 0xae28,
+  0xc6af, 0xb64a, 0xae28, 0xb64b, 0xfe6d, 0xfe4b, 0xfe4c, 0xfe4c,
+  0xfe4b, 0xfe4c, 0xfe6d, 0xfed1, 0xf40e, 0xf34b, 0xf2c8, 0xf287,
+  0xf246, 0xf287, 0xf2c8, 0xf287, 0xf246, 0xf34b, 0x7e79, 0x6e57,
+  0xbf3c, 0xb66b, 0xae28, 0xd714, 0xb64a, 0xae28, 0xb64a, 0xdf35,
+  0xfeaf, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4b, 0xfe4c, 0xfe6d, 0xfed1,
+  0xf40e, 0xf3ac, 0xf2c8, 0xf287, 0xf246, 0xf287, 0xf2c8, 0xf287,
+  0xf246, 0xf533, 0x9ed9, 0x6e57, 0x7e57, 0xb66b, 0xae28, 0xb64a,
+  0xae28, 0xd713, 0xfef3, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xfe8e, 0xfed2, 0xf40e, 0xf40d, 0xf2c8, 0xf288,
+  0xf246, 0xf287, 0xf2c8, 0xf287, 0xf246, 0xea67, 0x6e57, 0x8e98,
+  0xb66b, 0xae28, 0xb64a, 0xb64a, 0xae28, 0xcef1, 0xf64c, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe6d, 0xfeb0,
+  0xfef2, 0xf40e, 0xf40e, 0xf34a, 0xf2c8, 0xf287, 0xf246, 0xf287,
+  0xf2c8, 0xf287, 0xf246, 0xf309, 0x7e79, 0x6e57, 0xb71b, 0xb66b,
+  0xae28, 0xc6cf, 0xb64a, 0xae28, 0xc6b0, 0xfe8e, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe6d, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe6d, 0xfed1, 0xfef2,
+  0xf40e, 0xf40e, 0xf3ac, 0xf2c8, 0xf2c7, 0xf246, 0xf287, 0xf2c8,
+  0xf287, 0xf246, 0xf512, 0x9ed9, 0x6e57, 0x7658, 0xb66b, 0xae28,
+  0xdf35, 0xb64a, 0xae28, 0xced0, 0xfed2, 0xfe4b, 0xfe4c, 0xfe6d,
+  0xfe6d, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe8e, 0xfed2, 0xfef2, 0xf40e,
+  0xf40e, 0xf40e, 0xf2c9, 0xf2c8, 0xf246, 0xf287, 0xf2c8, 0xf287,
+  0xf246, 0xf287, 0x7658, 0x6e57, 0x8eb9, 0xb66b, 0xae28, 0xb64a,
+  0xb64a, 0xae28, 0xb628, 0xd6f2, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe6d,
+  0xfe4c, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe6d, 0xfeb0, 0xfef2, 0xfef2,
+  0xf40e, 0xf40e, 0xf40e, 0xf34b, 0xf2c8, 0xea67, 0xf246, 0xf287,
+  0xf2c8, 0xf287, 0xf246, 0xf38c, 0x8e98, 0x6e57, 0xb66b, 0xae28,
+  0xc6b0, 0xb64a, 0xae28, 0xae49, 0xdf35, 0xfe8e, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfed1, 0xfef2,
+  0xfef2, 0xf40e, 0xf40e, 0xf40e, 0xf3cd, 0xf2c8, 0xf287, 0xf246,
+  0xf288, 0xf2c8, 0xf287, 0xf246, 0xfdd5, 0xb71b, 0x6e57, 0x7678,
+  0xb66b, 0xae28, 0xb64a, 0xae28, 0xb64a, 0xfef4, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe6d, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe6d, 0xfe8e, 0xfed2,
+  0xfef2, 0xfef2, 0xf40e, 0xf309, 0xf2c8, 0xf287, 0xf246, 0xea67,
+  0xf2c8, 0xf287, 0xf246, 0xf309, 0x7e78, 0x6e57, 0xaefa, 0xb66b,
+  0xae28, 0xb66b, 0xb64a, 0xae28, 0xb64b, 0xfe4c, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe6d, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfeb0,
+  0xfef2, 0xfef2, 0xfef2, 0xf40e, 0xf3ac, 0xf2c8, 0xf2c8, 0xf2c8,
+  0xf288, 0xf246, 0xf287, 0xf2c8, 0xf287, 0xf246, 0xf512, 0x9efa,
+  0x6e57, 0x7657, 0xb66b, 0xae28, 0xdf14, 0xb64a, 0xae28, 0xc6ae,
+  0xfed1, 0xfe4b, 0xfe4c, 0xfe6d, 0xf64c, 0xfe4b, 0xfe4c, 0xfe6d,
+  0xfed2, 0xfef2, 0xfef2, 0xfef2, 0xf40e, 0xf309, 0xf2c8, 0xf2c8,
+  0xea67, 0xf246, 0xf288, 0xf2c8, 0xf287, 0xf246, 0xf309, 0x7e78,
+  0x6e57, 0x9efa, 0xb66b, 0xae28, 0xb64b, 0xb64a, 0xae28, 0xcf13,
+  0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe6d,
+  0xfe6d, 0xfeb0, 0xfef2, 0xf40e, 0xf3ac, 0xf2c8, 0xf287, 0xf246,
+  0xea67, 0xf2c8, 0xf287, 0xf246, 0xf512, 0xa6fa, 0x6e57, 0x7e57,
+  0xb66b, 0xae28, 0xd714, 0xb64a, 0xae28, 0xae49, 0xfeb0, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xf64c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe6d, 0xfe6d,
+  0xfed2, 0xfef2, 0xf40e, 0xf309, 0xf246, 0xf287, 0xf2c8, 0xf287,
+  0xf246, 0xf32a, 0x7678, 0x6e57, 0xaefa, 0xb66b, 0xae28, 0xb66b,
+  0xb64a, 0xae28, 0xbe8d, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xfeb0, 0xfef2, 0xf40e, 0xf34a, 0xf246, 0xf2c8,
+  0xf287, 0xf246, 0xfdd6, 0xb71b, 0x6e57, 0x7e78, 0xb66b, 0xae28,
+  0xdf35, 0xb64a, 0xae28, 0xdf35, 0xfed1, 0xfe4b, 0xfe4c, 0xfe6d,
+  0xfe4b, 0xfe6d, 0xfef2, 0xf40e, 0xf3cd, 0xf2c8, 0xea67, 0xf246,
+  0xf287, 0xf2c8, 0xf287, 0xf246, 0xf3cd, 0x8698, 0x6e57, 0x7657,
+  0xbf3c, 0xb66b, 0xae28, 0xbe8d, 0xb64a, 0xae28, 0xb64b, 0xfe4c,
+  0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe6d, 0xfef2, 0xf40e,
+  0xf34a, 0xf2c8, 0xf288, 0xf246, 0xf288, 0xf2c8, 0xf287, 0xf246,
+  0xf287, 0x7657, 0x6e57, 0x6e58, 0x9ed9, 0xb66b, 0xae28, 0xae49,
+  0xb64a, 0xae28, 0xcef1, 0xfef4, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c,
+  0xfe4b, 0xfe6d, 0xfed1, 0xfef2, 0xf40e, 0xf3cd, 0xf2c8, 0xf2c8,
+  0xf2c8, 0xf287, 0xf246, 0xf287, 0xf2c8, 0xf287, 0xf246, 0xf533,
+  0xa6fa, 0x6e57, 0x7e78, 0xb66b, 0xae28, 0xcef1, 0xb64a, 0xae28,
+  0xb64a, 0xfe8e, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe8e, 0xfef2, 0xf40e, 0xf34b, 0xf2c8, 0xea67, 0xf246,
+  0xf2c8, 0xf287, 0xf246, 0xf38c, 0x8e98, 0x7657, 0x6e57, 0x7657,
+  0xbf3c, 0xb66b, 0xae28, 0xb68c, 0xb64a, 0xae28, 0xced0, 0xfe4c,
+  0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe6d,
+  0xfe6d, 0xfed1, 0xfef2, 0xf40e, 0xf40e, 0xf40e, 0xf40d, 0xf2c8,
+  0xf288, 0xf246, 0xf287, 0xf2c8, 0xf2c8, 0xf2c8, 0xf287, 0xf246,
+  0xf2c8, 0x7e78, 0x6e57, 0x9ed9, 0xb66b, 0xae28, 0xb64a, 0xb64a,
+  0xae28, 0xb64a, 0xfef3, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b,
+  0xfe6d, 0xfeaf, 0xfed2, 0xfef2, 0xfef2, 0xfef2, 0xf40e, 0xf40e,
+  0xf40e, 0xf38c, 0xf2c8, 0xf287, 0xf246, 0xf2c8, 0xf2c8, 0xf2c8,
+  0xf287, 0xf246, 0xf287, 0xb71b, 0x7657, 0x6e57, 0x6e58, 0x8e98,
+  0xb66b, 0xae28, 0xd6f2, 0xb64a, 0xae28, 0xd713, 0xfeb0, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xfe4b, 0xfe4c, 0xfe6d, 0xfed1, 0xfef2, 0xfef2,
+  0xfef2, 0xf40e, 0xf40e, 0xf40e, 0xf309, 0xf2c8, 0xf287, 0xf246,
+  0xf288, 0xf2c8, 0xf2c8, 0xf287, 0xf246, 0xfd13, 0xaefa, 0x7657,
+  0x6e57, 0x7e78, 0xb66b, 0xae28, 0xc6ae, 0xb64a, 0xae28, 0xb66b,
+  0xfe6d, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d,
+  0xfeb0, 0xfef2, 0xfef2, 0xfef2, 0xf40e, 0xf40e, 0xf3cd, 0xf2c8,
+  0xf287, 0xf246, 0xea67, 0xf2c8, 0xf2c8, 0xf287, 0xf246, 0xfc90,
+  0x9ed9, 0x6e57, 0x7657, 0xb66b, 0xae28, 0xb64b, 0xb64a, 0xae28,
+  0xe756, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfed2, 0xfef2, 0xfef2, 0xf40e, 0xf40e, 0xf34b, 0xf2c8,
+  0xf287, 0xf246, 0xf2c8, 0xf2c8, 0xf287, 0xf246, 0xf44f, 0x8eb9,
+  0x6e57, 0x7657, 0xb66b, 0xae28, 0xb64b, 0xb64a, 0xae28, 0xc6ae,
+  0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d,
+  0xfed1, 0xfef2, 0xfef2, 0xf40e, 0xf40d, 0xf309, 0xf2c8, 0xea67,
+  0xf246, 0xf287, 0xf2c8, 0xf287, 0xf246, 0xf40e, 0x8e98, 0x6e57,
+  0x7657, 0xb66b, 0xae28, 0xb64a, 0xb64a, 0xae28, 0xb64a, 0xff15,
+  0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe6d,
+  0xfe8e, 0xfef2, 0xfef2, 0xf40e, 0xf3cd, 0xf2c8, 0xea67, 0xf246,
+  0xea67, 0xf2c8, 0xf287, 0xf246, 0xf40e, 0x8eb9, 0x6e57, 0x7e57,
+  0xbf3c, 0xb66b, 0xae28, 0xb64a, 0xb64a, 0xae28, 0xb628, 0xdf35,
+  0xfef4, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d,
+  0xfed1, 0xfef2, 0xf40e, 0xf38c, 0xf2c8, 0xea67, 0xf246, 0xf247,
+  0xf2c8, 0xf287, 0xf246, 0xf450, 0x8eb9, 0x6e57, 0x7e78, 0xb66b,
+  0xae28, 0xb64a, 0xb64a, 0xae28, 0xc6ae, 0xfef4, 0xf64c, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfeb0, 0xfef2,
+  0xf40e, 0xf32a, 0xf2c8, 0xf287, 0xf246, 0xf288, 0xf287, 0xf246,
+  0xfc90, 0x9eda, 0x7657, 0x6e57, 0x7e79, 0xb66b, 0xae28, 0xb64b,
+  0xb64a, 0xae28, 0xb64a, 0xfef4, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c,
+  0xfe4b, 0xfe4c, 0xfe6d, 0xfeaf, 0xfef2, 0xf40d, 0xf2c9, 0xf2c8,
+  0xf287, 0xf246, 0xf287, 0xf287, 0xf246, 0xea67, 0xf533, 0xaefa,
+  0x7658, 0x6e57, 0x8e98, 0xb66b, 0xae28, 0xb628, 0xb66b, 0xb64a,
+  0xae28, 0xae49, 0xff36, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c,
+  0xfe4b, 0xfe4c, 0xfe6d, 0xfe8e, 0xfed2, 0xf3cd, 0xf2c8, 0xf2c7,
+  0xea66, 0xf246, 0xf287, 0xf287, 0xf246, 0xf309, 0x7e78, 0x6e57,
+  0x9ed9, 0xb66b, 0xae28, 0xbe8d, 0xb64a, 0xae28, 0xd734, 0xfe6d,
+  0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfed1,
+  0xf38c, 0xf2c8, 0xea67, 0xf246, 0xea67, 0xf287, 0xf246, 0xf40e,
+  0x8eb9, 0x6e57, 0x7658, 0xb66b, 0xae28, 0xced0, 0xb64a, 0xae28,
+  0xc6ae, 0xfeb0, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfeb0, 0xf34b, 0xf2c8, 0xf287, 0xf246, 0xea67, 0xf246,
+  0xf2c8, 0xfd94, 0xb71b, 0x7678, 0x6e57, 0x8eba, 0xb66b, 0xae28,
+  0xb64a, 0xe756, 0xb64a, 0xae28, 0xb64a, 0xfef4, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe6d, 0xfeb0, 0xf309,
+  0xf2c8, 0xf288, 0xea67, 0xf246, 0xf287, 0xf246, 0xf44f, 0x9ed9,
+  0x6e57, 0x7657, 0x7e78, 0xb71b, 0xb66b, 0xae28, 0xc6af, 0xb64a,
+  0xae28, 0xfe8e, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe8e, 0xf309, 0xf2c8, 0xf287, 0xea67, 0xf246, 0xea67,
+  0xf246, 0xf38c, 0x8e98, 0x6e57, 0x7e78, 0xa6fa, 0xb66b, 0xae28,
+  0xb66b, 0xdf56, 0xb64a, 0xae28, 0xfef4, 0xfe4c, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe6d, 0xfe8e, 0xf2c9,
+  0xf2c8, 0xf287, 0xf246, 0xf34a, 0xfd95, 0xb71b, 0x8e98, 0x6e57,
+  0x7e78, 0x9ed9, 0xb66b, 0xae28, 0xb64a, 0xcef1, 0xb64a, 0xae28,
+  0xdf35, 0xfed1, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe8e, 0xfeb0,
+  0xfe8e, 0xfe6d, 0xf2c8, 0xf287, 0xea67, 0xf246, 0xea67, 0xf38c,
+  0xfdd6, 0x8e98, 0x7677, 0x6e57, 0x7e78, 0x9efa, 0xb66b, 0xae28,
+  0xb64a, 0xcef1, 0xb64a, 0xae28, 0xd714, 0xfeb0, 0xfe4c, 0xfe4b,
+  0xfe4c, 0xfe6d, 0xfe8e, 0xfeb0, 0xfef2, 0xfef2, 0xfef2, 0xfed1,
+  0xfe8e, 0xfe6d, 0xf2c8, 0xf287, 0xf287, 0xf246, 0xf2c8, 0xf44f,
+  0x9ed9, 0x7e78, 0x7657, 0x6e57, 0x7657, 0x7658, 0x8e98, 0xb71b,
+  0xb66b, 0xae28, 0xb64b, 0xcef1, 0xb64a, 0xae28, 0xcef2, 0xfed1,
+  0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe8e, 0xfeb0, 0xfed2, 0xfef2,
+  0xfed1, 0xfe8e, 0xfe6d, 0xf2c8, 0xf287, 0xea67, 0xf246, 0xf287,
+  0xf3ac, 0xfdd5, 0x8e98, 0x7e78, 0x7658, 0x6e57, 0x7658, 0x7e78,
+  0xaefa, 0xb66b, 0xae28, 0xb64a, 0xb68c, 0xd734, 0xb64a, 0xae28,
+  0xc6b0, 0xfef3, 0xfe6d, 0xfe4b, 0xfe4c, 0xfe6d, 0xfeaf, 0xfed1,
+  0xfef2, 0xfed1, 0xfe8f, 0xfe6d, 0xf2c8, 0xf287, 0xea67, 0xea66,
+  0xf246, 0xf247, 0xf309, 0xfc90, 0xfdd6, 0x9efa, 0x7e78, 0x6e57,
+  0x7657, 0x6e57, 0x7e57, 0x8eba, 0xb71b, 0xb66b, 0xae28, 0xb64b,
+  0xd6f2, 0xb64a, 0xae28, 0xc6ae, 0xfed2, 0xfe4c, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe8e, 0xfeb0, 0xfed2, 0xfef2, 0xfed2, 0xfeb0, 0xfe8e,
+  0xfe6d, 0xf2c8, 0xf287, 0xf287, 0xea67, 0xf247, 0xf246, 0xf287,
+  0xf2c9, 0xf38c, 0xfc90, 0xfd53, 0xbf3c, 0xa6fa, 0x8eb9, 0x7e79,
+  0x7658, 0x6e57, 0x6e57, 0x7657, 0x6e57, 0x6e57, 0x6e57, 0x7657,
+  0x7657, 0x7657, 0x7678, 0x8698, 0x9ed9, 0xb71b, 0xb66b, 0xae28,
+  0xb628, 0xae28, 0xb64a, 0xc6ae, 0xd734, 0xb64a, 0xae28, 0xbe8d,
+  0xfef4, 0xfe8f, 0xfe4c, 0xfe4b, 0xfe4c, 0xfe6d, 0xfe8e, 0xfeb0,
+  0xfeb0, 0xfed2, 0xfef2, 0xfed1, 0xfeb0, 0xfe8e, 0xfe6d, 0xf246,
+  0xf3cd, 0xb66b, 0xae28, 0xae28, 0xb628, 0xb64a, 0xb64b, 0xbe6c,
+  0xc6b0, 0xd6f2, 0xdf35, 0xb64a, 0xae28, 0xbe6c, 0xff15, 0xfef4,
+  0xfed1, 0xfeaf, 0xfe4c, 0xfe4c, 0xfe4b, 0xfe4b, 0xfe4b, 0xfe4c,
+  0xfe6d, 0xfe8e, 0xfeaf, 0xfeaf, 0xfeb0, 0xfed1, 0xfed2, 0xfed2,
+  0xfef2, 0xfed2, 0xfed2, 0xfed1, 0xfeb0, 0xfe8f, 0xfeaf, 0xfe8e,
+  0xfe8e, 0xfe6d, 0xff36, 0xf246, 0xf490, 0xfef3, 0xfe4b, 0xfe4b,
+  0xfe4c, 0xfe4b, 0xf64c, 0xff15, 0xf246, 0xfc90, 0xff36, 0xfe4b,
+  0xff15, 0xf246, 0xf4d1, 0xff36, 0xfe4b, 0xff36, 0xf246, 0xfd13,
+  0xff36, 0xfe4b, 0xf246, 0xfd95, 0xff36, 0xfe4b, 0xf246, 0xff36,
+  0xfe4b, 0xf246, 0xff36, 0xfe4b, 0xfe4c, 0xf246, 0xf2c8, 0xff36,
+  0xfe4b, 0xfe6d, 0xf246, 0xf38c, 0xff36, 0xfe4b, 0xfeb0, 0xf246,
+  0xfc90, 0xff36, 0xfe4b, 0xfed1, 0xf246, 0xfd95, 0xff36, 0xfe4b,
+  0xfef4, 0xf246, 0xff36, 0xfe4b, 0xf246, 0xf2c8, 0xff36, 0xfe4b,
+  0xfe4c, 0xf246, 0xf490, 0xff36, 0xfe4b, 0xfed1, 0xf246, 0xfdd5,
+  0xff36, 0xfe4b, 0xfef4, 0xf246, 0xea67, 0xff36, 0xfe4b, 0xf246,
+  0xf40e, 0xff36, 0xfe4b, 0xfeaf, 0xf246, 0xfdf6, 0xff36, 0xfe4b,
+  0xfef4, 0xf246, 0xf2c8, 0xff36, 0xfe4b, 0xf246, 0xf512, 0xff36,
+  0xfe4b, 0xfeb0, 0xf246, 0xf2c8, 0xff36, 0xfe4b, 0xf246, 0xf450,
+  0xff36, 0xfe4b, 0xfe6d, 0xf246, 0xf288, 0xff36, 0xfe4b, 0xff15,
+  0xf246, 0xf490, 0xff36, 0xfe4b, 0xfe4c, 0xf246, 0xf2c8, 0xff36,
+  0xfe4b, 0xff15, 0xf246, 0xf512, 0xff36, 0xfe4b, 0xfe6d, 0xf246,
+  0xf34b, 0xff36, 0xfe4b, 0xf246, 0xf287, 0xff36, 0xfe4b, 0xfed1,
+  0xf246, 0xf4b0, 0xff36, 0xfe4b, 0xfe4c, 0xf246, 0xf34b, 0xff36,
+  0xfe4b, 0xf64c, 0xff15, 0xf246, 0xf287, 0xff36, 0xfe4b, 0xfeb0,
+  0xf246, 0xfd95, 0xff36, 0xfe4b, 0xfe6d, 0xf246, 0xfc90, 0xff36,
+  0xfe4b, 0xfe4c, 0xf246, 0xf40d, 0xff36, 0xfe4b, 0xff36, 0xf246,
+  0xf3cd, 0xff36, 0xfe4b, 0xfef4, 0xf246, 0xf3cc, 0xff36, 0xfe4b,
+  0xfed2, 0xf246, 0xf3cd, 0xff36, 0xfe4b, 0xfed1, 0xf246, 0xf3cd,
+  0xff36, 0xfe4b, 0xfed1, 0xf246, 0xf450, 0xff36, 0xfe4b, 0xfef2,
+  0xf246, 0xea67, 0xfd13, 0xff36, 0xfe4b, 0xfe4c, 0xfef4, 0xf246,
+  0xf287, 0xff36, 0xfe4b, 0xfe4c, 0xff36, 0xf246, 0xf38c, 0xff36,
+  0xfe4b, 0xfe6d, 0xf246, 0xf2c8, 0xf533, 0xff36, 0xfe4b, 0xfed2,
+  0xf246, 0xf3cd, 0xff36, 0xfe4b, 0xfe4c, 0xf246, 0xf38c, 0xff36,
+  0xfe4b, 0xfe4c, 0xfef2, 0xf246, 0xf34a, 0xfdd5, 0xff36, 0xfe4b,
+  0xf64c, 0xfeb0, 0xf246, 0xea67, 0xf36b, 0xfdd5, 0xff36, 0xfe4b,
+  0xfeb0, 0xf246, 0xf2c8, 0xf40e, 0xff36, 0xfe4b, 0xfe4c, 0xfeb0,
+  0xf246, 0xf288, 0xf3ac, 0xfd95, 0xff36, 0xfe4b, 0xfe4c, 0xfef2,
+  0xf246, 0xf309, 0xfc90, 0xfdd6, 0xff36, 0xfe4b, 0xfe4c, 0xfed1,
+  0xf246, 0xf246, 0xf246, 0xea66, 0xf287, 0xf309, 0xf3cd, 0xf4d1,
+  0xfd95, 0xff36, 0xfe4b, 0xfe4c, 0xfeaf, 0xfef4, 0xff36, 0xfe4b,
+  0xfe4b, 0xfe4b, 0xfe4c, 0xfe4c, 0xfe8e, 0xfed2, 0xfef4, 0xff36,
+};
+
+static const int POKY_IMG_RGB565_SPANS[] = {
+  212, 6, 0, 0, 212, 1, 0, 12, 213, 6, 1, 14,
+  219, 5, 0, 16, 212, 1, 0, 26, 213, 11, 1, 28,
+  224, 4, 0, 30, 212, 1, 0, 38, 213, 15, 1, 40,
+  228, 2, 0, 42, 212, 1, 0, 46, 213, 18, 1, 48,
+  231, 2, 0, 50, 212, 1, 0, 54, 213, 20, 1, 56,
+  233, 2, 0, 58, 212, 1, 0, 62, 213, 22, 1, 64,
+  235, 2, 0, 66, 212, 1, 0, 70, 213, 24, 1, 72,
+  237, 2, 0, 74, 212, 1, 0, 78, 213, 26, 1, 80,
+  239, 1, 0, 82, 212, 1, 0, 84, 213, 27, 1, 86,
+  240, 2, 0, 88, 212, 1, 0, 92, 213, 29, 1, 94,
+  242, 1, 0, 96, 212, 1, 0, 98, 213, 30, 1, 100,
+  243, 1, 0, 102, 212, 1, 0, 104, 213, 31, 1, 106,
+  244, 2, 0, 108, 212, 1, 0, 112, 213, 33, 1, 114,
+  246, 1, 0, 116, 212, 1, 0, 118, 213, 34, 1, 120,
+  247, 1, 0, 122, 212, 1, 0, 124, 213, 35, 1, 126,
+  248, 1, 0, 128, 212, 1, 0, 130, 213, 36, 1, 132,
+  249, 1, 0, 134, 212, 1, 0, 136, 213, 37, 1, 138,
+  250, 1, 0, 140, 212, 1, 0, 142, 213, 37, 1, 144,
+  250, 2, 0, 146, 212, 1, 0, 150, 213, 38, 1, 152,
+  251, 2, 0, 154, 212, 1, 0, 158, 213, 39, 1, 160,
+  252, 1, 0, 162, 212, 1, 0, 164, 213, 40, 1, 166,
+  253, 1, 0, 168, 212, 1, 0, 170, 213, 41, 1, 172,
+  254, 1, 0, 174, 212, 1, 0, 176, 213, 41, 1, 178,
+  254, 1, 0, 180, 212, 1, 0, 182, 213, 42, 1, 184,
+  255, 1, 0, 186, 212, 1, 0, 188, 213, 43, 1, 190,
+  256, 1, 0, 192, 212, 1, 0, 194, 213, 43, 1, 196,
+  256, 1, 0, 198, 212, 1, 0, 200, 213, 44, 1, 202,
+  257, 1, 0, 204, 212, 1, 0, 206, 213, 44, 1, 208,
+  257, 1, 0, 210, 212, 1, 0, 212, 213, 45, 1, 214,
+  258, 1, 0, 216, 212, 1, 0, 218, 213, 45, 1, 220,
+  258, 1, 0, 222, 212, 1, 0, 224, 213, 46, 1, 226,
+  259, 1, 0, 228, 212, 1, 0, 230, 213, 46, 1, 232,
+  259, 1, 0, 234, 212, 1, 0, 236, 213, 47, 1, 238,
+  260, 1, 0, 240, 212, 1, 0, 242, 213, 47, 1, 244,
+  260, 1, 0, 246, 212, 1, 0, 248, 213, 48, 1, 250,
+  212, 1, 0, 252, 213, 48, 1, 254, 261, 1, 0, 256,
+  212, 1, 0, 258, 213, 48, 1, 260, 261, 1, 0, 262,
+  212, 1, 0, 264, 213, 48, 1, 266, 261, 1, 0, 268,
+  212, 1, 0, 270, 213, 49, 1, 272, 262, 1, 0, 274,
+  212, 1, 0, 276, 213, 49, 1, 278, 262, 1, 0, 280,
+  212, 1, 0, 282, 213, 49, 1, 284, 262, 1, 0, 286,
+  212, 1, 0, 288, 213, 49, 1, 290, 262, 1, 0, 292,
+  212, 1, 0, 294, 213, 50, 1, 296, 212, 1, 0, 298,
+  213, 50, 1, 300, 263, 1, 0, 302, 212, 1, 0, 304,
+  213, 50, 1, 306, 263, 1, 0, 308, 212, 1, 0, 310,
+  213, 50, 1, 312, 263, 1, 0, 314, 212, 1, 0, 316,
+  213, 50, 1, 318, 263, 1, 0, 320, 212, 1, 0, 322,
+  213, 50, 1, 324, 263, 1, 0, 326, 212, 1, 0, 328,
+  213, 50, 1, 330, 263, 1, 0, 332, 212, 1, 0, 334,
+  213, 50, 1, 336, 263, 1, 0, 338, 50, 14, 0, 340,
+  109, 2, 0, 368, 158, 8, 0, 372, 212, 1, 0, 388,
+  213, 50, 1, 390, 263, 1, 0, 392, 44, 5, 0, 394,
+  49, 14, 1, 404, 63, 6, 0, 406, 109, 6, 1, 418,
+  115, 4, 0, 420, 150, 4, 0, 428, 154, 5, 1, 436,
+  159, 2, 0, 438, 161, 6, 1, 442, 167, 5, 0, 444,
+  212, 9, 0, 454, 221, 34, 1, 472, 255, 10, 0, 474,
+  265, 50, 1, 494, 315, 6, 0, 496, 414, 5, 0, 508,
+  41, 3, 0, 518, 44, 25, 1, 524, 69, 3, 0, 526,
+  109, 11, 1, 532, 120, 3, 0, 534, 146, 3, 0, 540,
+  149, 10, 1, 546, 159, 2, 0, 548, 161, 11, 1, 552,
+  172, 4, 0, 554, 212, 1, 0, 562, 213, 7, 1, 564,
+  220, 6, 0, 566, 226, 24, 1, 578, 250, 6, 0, 580,
+  256, 7, 1, 592, 263, 2, 0, 594, 265, 50, 1, 598,
+  315, 1, 0, 600, 316, 7, 1, 602, 323, 5, 0, 604,
+  408, 4, 0, 614, 412, 7, 1, 622, 419, 1, 0, 624,
+  38, 3, 0, 626, 41, 32, 1, 632, 73, 2, 0, 634,
+  109, 15, 1, 638, 124, 2, 0, 640, 143, 2, 0, 644,
+  145, 14, 1, 648, 159, 2, 0, 650, 161, 14, 1, 654,
+  175, 4, 0, 656, 212, 1, 0, 664, 213, 12, 1, 666,
+  225, 4, 0, 668, 229, 18, 1, 676, 247, 4, 0, 678,
+  251, 12, 1, 686, 263, 2, 0, 688, 265, 50, 1, 692,
+  315, 1, 0, 694, 316, 12, 1, 696, 328, 3, 0, 698,
+  404, 3, 0, 704, 407, 12, 1, 710, 419, 1, 0, 712,
+  36, 2, 0, 714, 38, 37, 1, 718, 75, 3, 0, 720,
+  109, 18, 1, 726, 127, 1, 0, 728, 140, 2, 0, 730,
+  142, 17, 1, 734, 159, 2, 0, 736, 161, 17, 1, 740,
+  178, 3, 0, 742, 212, 1, 0, 748, 213, 15, 1, 750,
+  228, 4, 0, 752, 232, 12, 1, 760, 244, 4, 0, 762,
+  248, 15, 1, 770, 263, 2, 0, 772, 265, 50, 1, 776,
+  315, 1, 0, 778, 316, 16, 1, 780, 332, 2, 0, 782,
+  401, 2, 0, 786, 403, 16, 1, 790, 419, 1, 0, 792,
+  33, 2, 0, 794, 35, 43, 1, 798, 78, 2, 0, 800,
+  109, 1, 0, 804, 110, 19, 1, 806, 129, 2, 0, 808,
+  138, 1, 0, 812, 139, 20, 1, 814, 159, 2, 0, 816,
+  161, 20, 1, 820, 181, 2, 0, 822, 212, 1, 0, 826,
+  213, 18, 1, 828, 231, 3, 0, 830, 234, 8, 1, 836,
+  242, 3, 0, 838, 245, 18, 1, 844, 263, 2, 0, 846,
+  265, 50, 1, 850, 315, 1, 0, 852, 316, 19, 1, 854,
+  335, 2, 0, 856, 399, 2, 0, 860, 401, 18, 1, 864,
+  419, 1, 0, 866, 32, 1, 0, 868, 33, 47, 1, 870,
+  80, 2, 0, 872, 109, 1, 0, 876, 110, 21, 1, 878,
+  131, 2, 0, 880, 136, 1, 0, 884, 137, 22, 1, 886,
+  159, 2, 0, 888, 161, 22, 1, 892, 183, 2, 0, 894,
+  212, 1, 0, 898, 213, 21, 1, 900, 234, 2, 0, 902,
+  236, 4, 1, 906, 240, 2, 0, 908, 242, 21, 1, 912,
+  263, 2, 0, 914, 265, 50, 1, 918, 315, 2, 0, 920,
+  317, 20, 1, 924, 337, 2, 0, 926, 397, 1, 0, 930,
+  398, 21, 1, 932, 419, 1, 0, 934, 30, 1, 0, 936,
+  31, 51, 1, 938, 82, 1, 0, 940, 109, 1, 0, 942,
+  110, 23, 1, 944, 133, 3, 0, 946, 136, 23, 1, 952,
+  159, 2, 0, 954, 161, 24, 1, 958, 185, 2, 0, 960,
+  212, 1, 0, 964, 213, 23, 1, 966, 236, 4, 0, 968,
+  240, 23, 1, 976, 263, 2, 0, 978, 265, 50, 1, 982,
+  315, 2, 0, 984, 317, 22, 1, 988, 339, 2, 0, 990,
+  395, 1, 0, 994, 396, 23, 1, 996, 419, 1, 0, 998,
+  28, 2, 0, 1000, 30, 53, 1, 1004, 83, 2, 0, 1006,
+  109, 1, 0, 1010, 110, 21, 1, 1012, 131, 7, 0, 1014,
+  138, 21, 1, 1028, 159, 2, 0, 1030, 161, 26, 1, 1034,
+  187, 1, 0, 1036, 212, 1, 0, 1038, 213, 23, 1, 1040,
+  236, 3, 0, 1042, 239, 24, 1, 1048, 263, 2, 0, 1050,
+  265, 50, 1, 1054, 315, 2, 0, 1056, 317, 24, 1, 1060,
+  341, 1, 0, 1062, 393, 1, 0, 1064, 394, 25, 1, 1066,
+  419, 1, 0, 1068, 27, 1, 0, 1070, 28, 57, 1, 1072,
+  85, 1, 0, 1074, 109, 1, 0, 1076, 110, 19, 1, 1078,
+  129, 2, 0, 1080, 131, 5, 1, 1084, 136, 3, 0, 1086,
+  139, 20, 1, 1092, 159, 2, 0, 1094, 161, 27, 1, 1098,
+  188, 2, 0, 1100, 212, 1, 0, 1104, 213, 22, 1, 1106,
+  235, 6, 0, 1108, 241, 22, 1, 1120, 263, 2, 0, 1122,
+  265, 50, 1, 1126, 315, 2, 0, 1128, 317, 25, 1, 1132,
+  342, 2, 0, 1134, 391, 2, 0, 1138, 393, 26, 1, 1142,
+  419, 1, 0, 1144, 25, 2, 0, 1146, 27, 59, 1, 1150,
+  86, 2, 0, 1152, 110, 18, 1, 1156, 128, 2, 0, 1158,
+  130, 9, 1, 1162, 139, 1, 0, 1164, 140, 19, 1, 1166,
+  159, 2, 0, 1168, 161, 29, 1, 1172, 190, 1, 0, 1174,
+  212, 1, 0, 1176, 213, 20, 1, 1178, 233, 2, 0, 1180,
+  235, 6, 1, 1184, 241, 2, 0, 1186, 243, 20, 1, 1190,
+  263, 2, 0, 1192, 265, 49, 1, 1196, 314, 1, 0, 1198,
+  316, 1, 0, 1200, 317, 27, 1, 1202, 344, 1, 0, 1204,
+  390, 1, 0, 1206, 391, 28, 1, 1208, 419, 1, 0, 1210,
+  24, 1, 0, 1212, 25, 63, 1, 1214, 88, 1, 0, 1216,
+  110, 1, 0, 1218, 111, 16, 1, 1220, 127, 2, 0, 1222,
+  129, 10, 1, 1226, 139, 2, 0, 1228, 141, 18, 1, 1232,
+  159, 2, 0, 1234, 161, 30, 1, 1238, 191, 2, 0, 1240,
+  212, 2, 0, 1244, 214, 18, 1, 1248, 232, 2, 0, 1250,
+  234, 8, 1, 1254, 242, 2, 0, 1256, 244, 19, 1, 1260,
+  263, 2, 0, 1262, 265, 49, 1, 1266, 314, 1, 0, 1268,
+  316, 1, 0, 1270, 317, 28, 1, 1272, 345, 2, 0, 1274,
+  388, 2, 0, 1278, 390, 29, 1, 1282, 419, 1, 0, 1284,
+  23, 1, 0, 1286, 24, 65, 1, 1288, 89, 1, 0, 1290,
+  110, 1, 0, 1292, 111, 15, 1, 1294, 126, 1, 0, 1296,
+  127, 14, 1, 1298, 141, 2, 0, 1300, 143, 16, 1, 1304,
+  159, 2, 0, 1306, 161, 31, 1, 1310, 192, 2, 0, 1312,
+  212, 2, 0, 1316, 214, 17, 1, 1320, 231, 1, 0, 1322,
+  232, 11, 1, 1324, 243, 2, 0, 1326, 245, 18, 1, 1330,
+  263, 2, 0, 1332, 265, 49, 1, 1336, 314, 1, 0, 1338,
+  316, 1, 0, 1340, 317, 30, 1, 1342, 347, 1, 0, 1344,
+  387, 1, 0, 1346, 388, 31, 1, 1348, 419, 1, 0, 1350,
+  22, 1, 0, 1352, 23, 67, 1, 1354, 90, 1, 0, 1356,
+  110, 1, 0, 1358, 111, 14, 1, 1360, 125, 1, 0, 1362,
+  126, 16, 1, 1364, 142, 2, 0, 1366, 144, 15, 1, 1370,
+  159, 2, 0, 1372, 161, 33, 1, 1376, 194, 1, 0, 1378,
+  212, 2, 0, 1380, 214, 16, 1, 1384, 230, 1, 0, 1386,
+  231, 14, 1, 1388, 245, 1, 0, 1390, 246, 17, 1, 1392,
+  263, 2, 0, 1394, 265, 49, 1, 1398, 314, 1, 0, 1400,
+  316, 1, 0, 1402, 317, 31, 1, 1404, 348, 1, 0, 1406,
+  386, 1, 0, 1408, 387, 32, 1, 1410, 419, 1, 0, 1412,
+  21, 1, 0, 1414, 22, 69, 1, 1416, 91, 2, 0, 1418,
+  111, 13, 1, 1422, 124, 2, 0, 1424, 126, 18, 1, 1428,
+  144, 1, 0, 1430, 145, 14, 1, 1432, 159, 2, 0, 1434,
+  161, 34, 1, 1438, 195, 1, 0, 1440, 212, 2, 0, 1442,
+  214, 14, 1, 1446, 228, 2, 0, 1448, 230, 16, 1, 1452,
+  246, 2, 0, 1454, 248, 15, 1, 1458, 263, 2, 0, 1460,
+  265, 48, 1, 1464, 313, 1, 0, 1466, 316, 1, 0, 1468,
+  317, 32, 1, 1470, 349, 1, 0, 1472, 385, 1, 0, 1474,
+  386, 33, 1, 1476, 419, 1, 0, 1478, 20, 1, 0, 1480,
+  21, 71, 1, 1482, 92, 2, 0, 1484, 111, 1, 0, 1488,
+  112, 11, 1, 1490, 123, 2, 0, 1492, 125, 20, 1, 1496,
+  145, 1, 0, 1498, 146, 13, 1, 1500, 159, 2, 0, 1502,
+  161, 35, 1, 1506, 196, 1, 0, 1508, 212, 3, 0, 1510,
+  215, 13, 1, 1516, 228, 1, 0, 1518, 229, 18, 1, 1520,
+  247, 1, 0, 1522, 248, 15, 1, 1524, 263, 2, 0, 1526,
+  265, 48, 1, 1530, 313, 1, 0, 1532, 316, 1, 0, 1534,
+  317, 34, 1, 1536, 351, 1, 0, 1538, 384, 1, 0, 1540,
+  385, 34, 1, 1542, 419, 1, 0, 1544, 19, 1, 0, 1546,
+  20, 73, 1, 1548, 93, 2, 0, 1550, 111, 1, 0, 1554,
+  112, 10, 1, 1556, 122, 2, 0, 1558, 124, 22, 1, 1562,
+  146, 1, 0, 1564, 147, 12, 1, 1566, 159, 2, 0, 1568,
+  161, 36, 1, 1572, 197, 1, 0, 1574, 212, 3, 0, 1576,
+  215, 12, 1, 1582, 227, 1, 0, 1584, 228, 20, 1, 1586,
+  248, 1, 0, 1588, 249, 14, 1, 1590, 263, 2, 0, 1592,
+  265, 48, 1, 1596, 313, 1, 0, 1598, 316, 1, 0, 1600,
+  317, 35, 1, 1602, 352, 1, 0, 1604, 383, 1, 0, 1606,
+  384, 35, 1, 1608, 419, 1, 0, 1610, 18, 1, 0, 1612,
+  19, 75, 1, 1614, 94, 1, 0, 1616, 112, 9, 1, 1618,
+  121, 1, 0, 1620, 122, 24, 1, 1622, 146, 2, 0, 1624,
+  148, 11, 1, 1628, 159, 2, 0, 1630, 161, 37, 1, 1634,
+  198, 1, 0, 1636, 212, 3, 0, 1638, 215, 10, 1, 1644,
+  225, 2, 0, 1646, 227, 22, 1, 1650, 249, 1, 0, 1652,
+  250, 13, 1, 1654, 263, 2, 0, 1656, 265, 47, 1, 1660,
+  312, 1, 0, 1662, 316, 1, 0, 1664, 317, 36, 1, 1666,
+  353, 1, 0, 1668, 382, 1, 0, 1670, 383, 36, 1, 1672,
+  419, 1, 0, 1674, 17, 1, 0, 1676, 18, 77, 1, 1678,
+  95, 1, 0, 1680, 112, 1, 0, 1682, 113, 7, 1, 1684,
+  120, 1, 0, 1686, 121, 26, 1, 1688, 147, 2, 0, 1690,
+  149, 10, 1, 1694, 159, 2, 0, 1696, 161, 38, 1, 1700,
+  199, 1, 0, 1702, 212, 3, 0, 1704, 215, 10, 1, 1710,
+  225, 1, 0, 1712, 226, 24, 1, 1714, 250, 1, 0, 1716,
+  251, 12, 1, 1718, 263, 2, 0, 1720, 265, 47, 1, 1724,
+  312, 1, 0, 1726, 316, 1, 0, 1728, 317, 36, 1, 1730,
+  353, 1, 0, 1732, 381, 1, 0, 1734, 382, 37, 1, 1736,
+  419, 1, 0, 1738, 16, 1, 0, 1740, 17, 79, 1, 1742,
+  96, 1, 0, 1744, 112, 1, 0, 1746, 113, 6, 1, 1748,
+  119, 2, 0, 1750, 121, 27, 1, 1754, 148, 2, 0, 1756,
+  150, 9, 1, 1760, 159, 2, 0, 1762, 161, 39, 1, 1766,
+  200, 1, 0, 1768, 212, 4, 0, 1770, 216, 8, 1, 1778,
+  224, 1, 0, 1780, 225, 26, 1, 1782, 251, 1, 0, 1784,
+  252, 11, 1, 1786, 263, 2, 0, 1788, 265, 47, 1, 1792,
+  312, 1, 0, 1794, 316, 1, 0, 1796, 317, 37, 1, 1798,
+  354, 1, 0, 1800, 380, 1, 0, 1802, 381, 38, 1, 1804,
+  419, 1, 0, 1806, 15, 1, 0, 1808, 16, 81, 1, 1810,
+  97, 1, 0, 1812, 113, 5, 1, 1814, 118, 2, 0, 1816,
+  120, 29, 1, 1820, 149, 1, 0, 1822, 150, 9, 1, 1824,
+  159, 2, 0, 1826, 161, 39, 1, 1830, 200, 1, 0, 1832,
+  212, 4, 0, 1834, 216, 7, 1, 1842, 223, 1, 0, 1844,
+  224, 28, 1, 1846, 252, 1, 0, 1848, 253, 10, 1, 1850,
+  263, 2, 0, 1852, 265, 46, 1, 1856, 311, 1, 0, 1858,
+  316, 1, 0, 1860, 317, 38, 1, 1862, 355, 1, 0, 1864,
+  379, 1, 0, 1866, 380, 39, 1, 1868, 419, 1, 0, 1870,
+  15, 1, 0, 1872, 16, 82, 1, 1874, 98, 1, 0, 1876,
+  113, 1, 0, 1878, 114, 4, 1, 1880, 118, 1, 0, 1882,
+  119, 31, 1, 1884, 150, 1, 0, 1886, 151, 8, 1, 1888,
+  159, 2, 0, 1890, 161, 40, 1, 1894, 201, 1, 0, 1896,
+  212, 5, 0, 1898, 217, 5, 1, 1908, 222, 1, 0, 1910,
+  223, 30, 1, 1912, 253, 1, 0, 1914, 254, 9, 1, 1916,
+  263, 2, 0, 1918, 265, 46, 1, 1922, 311, 1, 0, 1924,
+  316, 1, 0, 1926, 317, 39, 1, 1928, 356, 1, 0, 1930,
+  378, 1, 0, 1932, 379, 40, 1, 1934, 419, 1, 0, 1936,
+  14, 1, 0, 1938, 15, 83, 1, 1940, 98, 1, 0, 1942,
+  114, 5, 0, 1944, 119, 31, 1, 1954, 150, 2, 0, 1956,
+  152, 7, 1, 1960, 159, 2, 0, 1962, 161, 41, 1, 1966,
+  202, 1, 0, 1968, 212, 5, 0, 1970, 217, 4, 1, 1980,
+  221, 2, 0, 1982, 223, 30, 1, 1986, 253, 1, 0, 1988,
+  254, 9, 1, 1990, 263, 2, 0, 1992, 265, 45, 1, 1996,
+  310, 1, 0, 1998, 316, 1, 0, 2000, 317, 40, 1, 2002,
+  357, 1, 0, 2004, 378, 41, 1, 2006, 419, 1, 0, 2008,
+  13, 1, 0, 2010, 14, 85, 1, 2012, 99, 1, 0, 2014,
+  114, 3, 0, 2016, 117, 34, 1, 2022, 151, 1, 0, 2024,
+  152, 7, 1, 2026, 159, 2, 0, 2028, 161, 41, 1, 2032,
+  202, 2, 0, 2034, 212, 1, 0, 2038, 213, 4, 1, 2040,
+  217, 5, 0, 2042, 222, 32, 1, 2052, 254, 1, 0, 2054,
+  255, 8, 1, 2056, 263, 2, 0, 2058, 265, 45, 1, 2062,
+  310, 1, 0, 2064, 316, 1, 0, 2066, 317, 40, 1, 2068,
+  357, 1, 0, 2070, 377, 1, 0, 2072, 378, 41, 1, 2074,
+  419, 1, 0, 2076, 12, 2, 0, 2078, 14, 86, 1, 2082,
+  100, 1, 0, 2084, 115, 2, 0, 2086, 117, 34, 1, 2090,
+  151, 2, 0, 2092, 153, 6, 1, 2096, 159, 2, 0, 2098,
+  161, 42, 1, 2102, 203, 1, 0, 2104, 212, 1, 0, 2106,
+  213, 4, 1, 2108, 217, 4, 0, 2110, 221, 34, 1, 2118,
+  255, 1, 0, 2120, 256, 7, 1, 2122, 263, 2, 0, 2124,
+  265, 45, 1, 2128, 310, 1, 0, 2130, 316, 1, 0, 2132,
+  317, 41, 1, 2134, 358, 1, 0, 2136, 376, 1, 0, 2138,
+  377, 42, 1, 2140, 419, 1, 0, 2142, 12, 1, 0, 2144,
+  13, 87, 1, 2146, 100, 1, 0, 2148, 115, 1, 0, 2150,
+  116, 36, 1, 2152, 152, 1, 0, 2154, 153, 6, 1, 2156,
+  159, 2, 0, 2158, 161, 43, 1, 2162, 204, 1, 0, 2164,
+  212, 1, 0, 2166, 213, 4, 1, 2168, 217, 3, 0, 2170,
+  220, 35, 1, 2176, 255, 2, 0, 2178, 257, 6, 1, 2182,
+  263, 2, 0, 2184, 265, 44, 1, 2188, 309, 1, 0, 2190,
+  316, 1, 0, 2192, 317, 42, 1, 2194, 359, 1, 0, 2196,
+  375, 1, 0, 2198, 376, 43, 1, 2200, 419, 1, 0, 2202,
+  11, 1, 0, 2204, 12, 89, 1, 2206, 101, 1, 0, 2208,
+  115, 1, 0, 2210, 116, 37, 1, 2212, 153, 1, 0, 2214,
+  154, 5, 1, 2216, 159, 2, 0, 2218, 161, 43, 1, 2222,
+  204, 1, 0, 2224, 212, 1, 0, 2226, 213, 5, 1, 2228,
+  218, 2, 0, 2230, 220, 36, 1, 2234, 256, 1, 0, 2236,
+  257, 6, 1, 2238, 263, 2, 0, 2240, 265, 43, 1, 2244,
+  308, 1, 0, 2246, 316, 1, 0, 2248, 317, 43, 1, 2250,
+  375, 1, 0, 2252, 376, 43, 1, 2254, 419, 1, 0, 2256,
+  11, 1, 0, 2258, 12, 89, 1, 2260, 101, 1, 0, 2262,
+  115, 2, 0, 2264, 117, 37, 1, 2268, 154, 1, 0, 2270,
+  155, 4, 1, 2272, 159, 2, 0, 2274, 161, 44, 1, 2278,
+  205, 1, 0, 2280, 212, 1, 0, 2282, 213, 5, 1, 2284,
+  218, 2, 0, 2286, 220, 37, 1, 2290, 257, 1, 0, 2292,
+  258, 5, 1, 2294, 263, 2, 0, 2296, 265, 43, 1, 2300,
+  308, 1, 0, 2302, 316, 1, 0, 2304, 317, 43, 1, 2306,
+  360, 1, 0, 2308, 374, 1, 0, 2310, 375, 44, 1, 2312,
+  419, 1, 0, 2314, 10, 1, 0, 2316, 11, 91, 1, 2318,
+  102, 1, 0, 2320, 114, 4, 0, 2322, 118, 36, 1, 2330,
+  154, 1, 0, 2332, 155, 4, 1, 2334, 159, 2, 0, 2336,
+  161, 45, 1, 2340, 212, 1, 0, 2342, 213, 5, 1, 2344,
+  218, 2, 0, 2346, 220, 37, 1, 2350, 257, 1, 0, 2352,
+  258, 5, 1, 2354, 263, 2, 0, 2356, 265, 42, 1, 2360,
+  307, 1, 0, 2362, 316, 1, 0, 2364, 317, 44, 1, 2366,
+  374, 1, 0, 2368, 375, 44, 1, 2370, 419, 1, 0, 2372,
+  10, 1, 0, 2374, 11, 91, 1, 2376, 102, 1, 0, 2378,
+  114, 4, 0, 2380, 118, 37, 1, 2388, 155, 6, 0, 2390,
+  161, 45, 1, 2402, 206, 1, 0, 2404, 212, 1, 0, 2406,
+  213, 4, 1, 2408, 217, 4, 0, 2410, 221, 37, 1, 2418,
+  258, 1, 0, 2420, 259, 4, 1, 2422, 263, 2, 0, 2424,
+  265, 42, 1, 2428, 307, 1, 0, 2430, 316, 1, 0, 2432,
+  317, 44, 1, 2434, 361, 1, 0, 2436, 373, 1, 0, 2438,
+  374, 45, 1, 2440, 419, 1, 0, 2442, 9, 1, 0, 2444,
+  10, 93, 1, 2446, 103, 1, 0, 2448, 113, 5, 0, 2450,
+  118, 37, 1, 2460, 155, 6, 0, 2462, 161, 46, 1, 2474,
+  212, 1, 0, 2476, 213, 4, 1, 2478, 217, 4, 0, 2480,
+  221, 37, 1, 2488, 258, 1, 0, 2490, 259, 4, 1, 2492,
+  263, 2, 0, 2494, 265, 41, 1, 2498, 306, 1, 0, 2500,
+  316, 1, 0, 2502, 317, 45, 1, 2504, 362, 1, 0, 2506,
+  373, 1, 0, 2508, 374, 45, 1, 2510, 419, 1, 0, 2512,
+  9, 1, 0, 2514, 10, 93, 1, 2516, 103, 1, 0, 2518,
+  113, 1, 0, 2520, 114, 4, 1, 2522, 118, 2, 0, 2524,
+  120, 35, 1, 2528, 155, 6, 0, 2530, 161, 46, 1, 2542,
+  207, 1, 0, 2544, 212, 5, 0, 2546, 217, 4, 1, 2556,
+  221, 1, 0, 2558, 222, 37, 1, 2560, 259, 6, 0, 2562,
+  265, 40, 1, 2574, 305, 1, 0, 2576, 316, 1, 0, 2578,
+  317, 45, 1, 2580, 362, 1, 0, 2582, 372, 1, 0, 2584,
+  373, 46, 1, 2586, 419, 1, 0, 2588, 8, 1, 0, 2590,
+  9, 95, 1, 2592, 104, 1, 0, 2594, 113, 6, 1, 2596,
+  119, 2, 0, 2598, 121, 35, 1, 2602, 156, 5, 0, 2604,
+  161, 47, 1, 2614, 212, 5, 0, 2616, 217, 5, 1, 2626,
+  222, 1, 0, 2628, 223, 36, 1, 2630, 259, 6, 0, 2632,
+  265, 40, 1, 2644, 305, 1, 0, 2646, 316, 1, 0, 2648,
+  317, 46, 1, 2650, 372, 1, 0, 2652, 373, 46, 1, 2654,
+  419, 1, 0, 2656, 8, 1, 0, 2658, 9, 95, 1, 2660,
+  104, 1, 0, 2662, 112, 1, 0, 2664, 113, 7, 1, 2666,
+  120, 1, 0, 2668, 121, 35, 1, 2670, 156, 5, 0, 2672,
+  161, 47, 1, 2682, 208, 1, 0, 2684, 212, 4, 0, 2686,
+  216, 7, 1, 2694, 223, 1, 0, 2696, 224, 36, 1, 2698,
+  260, 5, 0, 2700, 265, 39, 1, 2710, 304, 1, 0, 2712,
+  316, 1, 0, 2714, 317, 46, 1, 2716, 363, 1, 0, 2718,
+  371, 1, 0, 2720, 372, 47, 1, 2722, 419, 1, 0, 2724,
+  8, 97, 1, 2726, 105, 1, 0, 2728, 112, 9, 1, 2730,
+  121, 1, 0, 2732, 122, 35, 1, 2734, 157, 4, 0, 2736,
+  161, 47, 1, 2744, 208, 1, 0, 2746, 212, 4, 0, 2748,
+  216, 8, 1, 2756, 224, 1, 0, 2758, 225, 35, 1, 2760,
+  260, 5, 0, 2762, 265, 38, 1, 2772, 303, 1, 0, 2774,
+  316, 1, 0, 2776, 317, 46, 1, 2778, 363, 1, 0, 2780,
+  371, 1, 0, 2782, 372, 47, 1, 2784, 419, 1, 0, 2786,
+  7, 1, 0, 2788, 8, 97, 1, 2790, 105, 1, 0, 2792,
+  111, 1, 0, 2794, 112, 9, 1, 2796, 121, 2, 0, 2798,
+  123, 34, 1, 2802, 157, 4, 0, 2804, 161, 48, 1, 2812,
+  212, 4, 0, 2814, 216, 8, 1, 2822, 224, 1, 0, 2824,
+  225, 35, 1, 2826, 260, 5, 0, 2828, 265, 37, 1, 2838,
+  302, 1, 0, 2840, 316, 1, 0, 2842, 317, 47, 1, 2844,
+  364, 1, 0, 2846, 371, 48, 1, 2848, 419, 1, 0, 2850,
+  7, 1, 0, 2852, 8, 97, 1, 2854, 105, 1, 0, 2856,
+  111, 1, 0, 2858, 112, 10, 1, 2860, 122, 2, 0, 2862,
+  124, 33, 1, 2866, 157, 4, 0, 2868, 161, 48, 1, 2876,
+  209, 1, 0, 2878, 212, 3, 0, 2880, 215, 10, 1, 2886,
+  225, 1, 0, 2888, 226, 35, 1, 2890, 261, 4, 0, 2892,
+  265, 36, 1, 2900, 301, 1, 0, 2902, 316, 1, 0, 2904,
+  317, 47, 1, 2906, 364, 1, 0, 2908, 370, 1, 0, 2910,
+  371, 48, 1, 2912, 419, 1, 0, 2914, 7, 99, 1, 2916,
+  106, 1, 0, 2918, 111, 12, 1, 2920, 123, 2, 0, 2922,
+  125, 33, 1, 2926, 158, 3, 0, 2928, 161, 48, 1, 2934,
+  209, 1, 0, 2936, 212, 3, 0, 2938, 215, 11, 1, 2944,
+  226, 1, 0, 2946, 227, 34, 1, 2948, 261, 4, 0, 2950,
+  265, 35, 1, 2958, 300, 1, 0, 2960, 316, 1, 0, 2962,
+  317, 47, 1, 2964, 364, 1, 0, 2966, 370, 1, 0, 2968,
+  371, 48, 1, 2970, 419, 1, 0, 2972, 6, 1, 0, 2974,
+  7, 99, 1, 2976, 106, 1, 0, 2978, 110, 1, 0, 2980,
+  111, 13, 1, 2982, 124, 2, 0, 2984, 126, 32, 1, 2988,
+  158, 3, 0, 2990, 161, 49, 1, 2996, 212, 3, 0, 2998,
+  215, 12, 1, 3004, 227, 2, 0, 3006, 229, 32, 1, 3010,
+  261, 4, 0, 3012, 265, 34, 1, 3020, 299, 1, 0, 3022,
+  316, 1, 0, 3024, 317, 48, 1, 3026, 365, 1, 0, 3028,
+  370, 1, 0, 3030, 371, 48, 1, 3032, 419, 1, 0, 3034,
+  6, 1, 0, 3036, 7, 99, 1, 3038, 106, 1, 0, 3040,
+  110, 1, 0, 3042, 111, 14, 1, 3044, 125, 2, 0, 3046,
+  127, 31, 1, 3050, 158, 3, 0, 3052, 161, 49, 1, 3058,
+  210, 1, 0, 3060, 212, 2, 0, 3062, 214, 14, 1, 3066,
+  228, 1, 0, 3068, 229, 33, 1, 3070, 262, 3, 0, 3072,
+  265, 33, 1, 3078, 298, 1, 0, 3080, 316, 1, 0, 3082,
+  317, 48, 1, 3084, 365, 1, 0, 3086, 369, 1, 0, 3088,
+  370, 49, 1, 3090, 419, 1, 0, 3092, 6, 1, 0, 3094,
+  7, 99, 1, 3096, 106, 1, 0, 3098, 110, 1, 0, 3100,
+  111, 16, 1, 3102, 127, 2, 0, 3104, 129, 30, 1, 3108,
+  159, 2, 0, 3110, 161, 49, 1, 3114, 210, 1, 0, 3116,
+  212, 2, 0, 3118, 214, 15, 1, 3122, 229, 1, 0, 3124,
+  230, 32, 1, 3126, 262, 3, 0, 3128, 265, 32, 1, 3134,
+  297, 1, 0, 3136, 316, 1, 0, 3138, 317, 48, 1, 3140,
+  365, 1, 0, 3142, 369, 1, 0, 3144, 370, 49, 1, 3146,
+  419, 1, 0, 3148, 6, 101, 1, 3150, 107, 1, 0, 3152,
+  110, 18, 1, 3154, 128, 2, 0, 3156, 130, 29, 1, 3160,
+  159, 2, 0, 3162, 161, 49, 1, 3166, 210, 1, 0, 3168,
+  212, 2, 0, 3170, 214, 16, 1, 3174, 230, 2, 0, 3176,
+  232, 30, 1, 3180, 262, 3, 0, 3182, 265, 31, 1, 3188,
+  296, 1, 0, 3190, 316, 1, 0, 3192, 317, 48, 1, 3194,
+  365, 1, 0, 3196, 369, 1, 0, 3198, 370, 49, 1, 3200,
+  419, 1, 0, 3202, 5, 1, 0, 3204, 6, 101, 1, 3206,
+  107, 1, 0, 3208, 110, 19, 1, 3210, 129, 2, 0, 3212,
+  131, 27, 1, 3216, 158, 3, 0, 3218, 161, 49, 1, 3224,
+  210, 1, 0, 3226, 212, 2, 0, 3228, 214, 18, 1, 3232,
+  232, 1, 0, 3234, 233, 30, 1, 3236, 263, 2, 0, 3238,
+  265, 30, 1, 3242, 295, 1, 0, 3244, 316, 1, 0, 3246,
+  317, 49, 1, 3248, 366, 1, 0, 3250, 369, 50, 1, 3252,
+  419, 1, 0, 3254, 5, 1, 0, 3256, 6, 101, 1, 3258,
+  107, 1, 0, 3260, 109, 1, 0, 3262, 110, 20, 1, 3264,
+  130, 2, 0, 3266, 132, 27, 1, 3270, 159, 2, 0, 3272,
+  161, 49, 1, 3276, 210, 1, 0, 3278, 212, 1, 0, 3280,
+  213, 20, 1, 3282, 233, 1, 0, 3284, 234, 29, 1, 3286,
+  263, 2, 0, 3288, 265, 28, 1, 3292, 293, 1, 0, 3294,
+  316, 1, 0, 3296, 317, 49, 1, 3298, 366, 1, 0, 3300,
+  368, 1, 0, 3302, 369, 50, 1, 3304, 419, 1, 0, 3306,
+  5, 1, 0, 3308, 6, 101, 1, 3310, 107, 1, 0, 3312,
+  109, 1, 0, 3314, 110, 22, 1, 3316, 132, 2, 0, 3318,
+  134, 25, 1, 3322, 159, 2, 0, 3324, 161, 50, 1, 3328,
+  211, 2, 0, 3330, 213, 21, 1, 3334, 234, 2, 0, 3336,
+  236, 27, 1, 3340, 263, 2, 0, 3342, 265, 26, 1, 3346,
+  291, 2, 0, 3348, 316, 1, 0, 3352, 317, 49, 1, 3354,
+  366, 1, 0, 3356, 368, 1, 0, 3358, 369, 50, 1, 3360,
+  419, 1, 0, 3362, 5, 1, 0, 3364, 6, 102, 1, 3366,
+  109, 1, 0, 3368, 110, 24, 1, 3370, 134, 2, 0, 3372,
+  136, 25, 1, 3376, 161, 50, 1, 3378, 211, 2, 0, 3380,
+  213, 23, 1, 3384, 236, 2, 0, 3386, 238, 25, 1, 3390,
+  263, 2, 0, 3392, 265, 25, 1, 3396, 290, 2, 0, 3398,
+  316, 1, 0, 3402, 317, 49, 1, 3404, 366, 1, 0, 3406,
+  368, 1, 0, 3408, 369, 50, 1, 3410, 419, 1, 0, 3412,
+  5, 1, 0, 3414, 6, 49, 1, 3416, 55, 3, 0, 3418,
+  58, 50, 1, 3424, 109, 1, 0, 3426, 110, 25, 1, 3428,
+  135, 4, 0, 3430, 139, 19, 1, 3438, 158, 4, 0, 3440,
+  162, 49, 1, 3448, 211, 2, 0, 3450, 213, 24, 1, 3454,
+  237, 2, 0, 3456, 239, 24, 1, 3460, 263, 2, 0, 3462,
+  265, 23, 1, 3466, 288, 2, 0, 3468, 316, 1, 0, 3472,
+  317, 49, 1, 3474, 366, 1, 0, 3476, 368, 1, 0, 3478,
+  369, 50, 1, 3480, 419, 1, 0, 3482, 5, 1, 0, 3484,
+  6, 47, 1, 3486, 53, 2, 0, 3488, 58, 2, 0, 3492,
+  60, 48, 1, 3496, 108, 2, 0, 3498, 110, 27, 1, 3502,
+  137, 3, 0, 3504, 140, 16, 1, 3510, 156, 2, 0, 3512,
+  162, 3, 0, 3516, 165, 46, 1, 3522, 211, 2, 0, 3524,
+  213, 26, 1, 3528, 239, 2, 0, 3530, 241, 21, 1, 3534,
+  262, 4, 0, 3536, 266, 20, 1, 3544, 286, 2, 0, 3546,
+  316, 1, 0, 3550, 317, 49, 1, 3552, 366, 1, 0, 3554,
+  368, 1, 0, 3556, 369, 50, 1, 3558, 419, 1, 0, 3560,
+  5, 1, 0, 3562, 6, 46, 1, 3564, 52, 1, 0, 3566,
+  60, 1, 0, 3568, 61, 47, 1, 3570, 108, 1, 0, 3572,
+  109, 30, 1, 3574, 139, 3, 0, 3576, 142, 14, 1, 3582,
+  156, 1, 0, 3584, 164, 1, 0, 3586, 165, 46, 1, 3588,
+  211, 2, 0, 3590, 213, 28, 1, 3594, 241, 2, 0, 3596,
+  243, 17, 1, 3600, 260, 2, 0, 3602, 265, 2, 0, 3606,
+  267, 16, 1, 3610, 283, 3, 0, 3612, 316, 1, 0, 3618,
+  317, 47, 1, 3620, 364, 2, 0, 3622, 369, 2, 0, 3626,
+  371, 48, 1, 3630, 419, 1, 0, 3632, 5, 46, 1, 3634,
+  51, 1, 0, 3636, 61, 1, 0, 3638, 62, 46, 1, 3640,
+  108, 1, 0, 3642, 109, 33, 1, 3644, 142, 4, 0, 3646,
+  146, 9, 1, 3654, 155, 1, 0, 3656, 164, 1, 0, 3658,
+  165, 46, 1, 3660, 211, 2, 0, 3662, 213, 30, 1, 3666,
+  243, 3, 0, 3668, 246, 14, 1, 3674, 260, 1, 0, 3676,
+  267, 1, 0, 3678, 268, 14, 1, 3680, 282, 2, 0, 3682,
+  316, 1, 0, 3686, 317, 46, 1, 3688, 363, 1, 0, 3690,
+  371, 1, 0, 3692, 372, 47, 1, 3694, 419, 1, 0, 3696,
+  5, 46, 1, 3698, 51, 1, 0, 3700, 61, 1, 0, 3702,
+  62, 46, 1, 3704, 108, 1, 0, 3706, 109, 36, 1, 3708,
+  145, 5, 0, 3710, 150, 5, 1, 3720, 165, 1, 0, 3722,
+  166, 45, 1, 3724, 211, 2, 0, 3726, 213, 33, 1, 3730,
+  246, 2, 0, 3732, 248, 11, 1, 3736, 259, 1, 0, 3738,
+  268, 1, 0, 3740, 269, 10, 1, 3742, 279, 2, 0, 3744,
+  316, 1, 0, 3748, 317, 46, 1, 3750, 372, 1, 0, 3752,
+  373, 46, 1, 3754, 419, 1, 0, 3756, 5, 46, 1, 3758,
+  51, 1, 0, 3760, 61, 1, 0, 3762, 62, 46, 1, 3764,
+  108, 1, 0, 3766, 109, 40, 1, 3768, 149, 6, 0, 3770,
+  165, 1, 0, 3782, 166, 45, 1, 3784, 211, 2, 0, 3786,
+  213, 36, 1, 3790, 249, 4, 0, 3792, 253, 5, 1, 3800,
+  258, 1, 0, 3802, 269, 6, 1, 3804, 275, 3, 0, 3806,
+  316, 1, 0, 3812, 317, 45, 1, 3814, 362, 1, 0, 3816,
+  372, 1, 0, 3818, 373, 46, 1, 3820, 419, 1, 0, 3822,
+  5, 9, 0, 3824, 14, 34, 1, 3842, 48, 4, 0, 3844,
+  61, 1, 0, 3852, 62, 46, 1, 3854, 108, 1, 0, 3856,
+  109, 43, 1, 3858, 152, 3, 0, 3860, 165, 1, 0, 3866,
+  166, 45, 1, 3868, 211, 2, 0, 3870, 213, 39, 1, 3874,
+  252, 7, 0, 3876, 269, 5, 0, 3890, 316, 1, 0, 3900,
+  317, 45, 1, 3902, 362, 1, 0, 3904, 373, 46, 1, 3906,
+  419, 1, 0, 3908, 5, 9, 1, 3910, 14, 5, 0, 3912,
+  19, 23, 1, 3922, 42, 10, 0, 3924, 61, 1, 0, 3944,
+  62, 46, 1, 3946, 108, 1, 0, 3948, 109, 46, 1, 3950,
+  165, 1, 0, 3952, 166, 45, 1, 3954, 211, 2, 0, 3956,
+  213, 44, 1, 3960, 257, 2, 0, 3962, 269, 2, 0, 3966,
+  316, 1, 0, 3970, 317, 45, 1, 3972, 362, 1, 0, 3974,
+  373, 46, 1, 3976, 419, 1, 0, 3978, 5, 13, 1, 3980,
+  18, 4, 0, 3982, 22, 17, 1, 3990, 39, 4, 0, 3992,
+  43, 8, 1, 4000, 51, 1, 0, 4002, 61, 1, 0, 4004,
+  62, 46, 1, 4006, 108, 1, 0, 4008, 109, 46, 1, 4010,
+  155, 1, 0, 4012, 165, 1, 0, 4014, 166, 45, 1, 4016,
+  211, 2, 0, 4018, 213, 45, 1, 4022, 258, 1, 0, 4024,
+  269, 7, 0, 4026, 316, 46, 1, 4040, 362, 1, 0, 4042,
+  372, 1, 0, 4044, 373, 5, 1, 4046, 378, 3, 0, 4048,
+  381, 38, 1, 4054, 419, 1, 0, 4056, 5, 16, 1, 4058,
+  21, 4, 0, 4060, 25, 11, 1, 4068, 36, 4, 0, 4070,
+  40, 12, 1, 4078, 52, 1, 0, 4080, 60, 1, 0, 4082,
+  61, 47, 1, 4084, 108, 1, 0, 4086, 109, 46, 1, 4088,
+  155, 1, 0, 4090, 164, 1, 0, 4092, 165, 46, 1, 4094,
+  211, 2, 0, 4096, 213, 45, 1, 4100, 258, 2, 0, 4102,
+  268, 1, 0, 4106, 269, 7, 1, 4108, 276, 4, 0, 4110,
+  316, 46, 1, 4118, 362, 1, 0, 4120, 372, 1, 0, 4122,
+  373, 9, 1, 4124, 382, 3, 0, 4126, 385, 34, 1, 4132,
+  5, 19, 1, 4134, 24, 3, 0, 4136, 27, 7, 1, 4142,
+  34, 3, 0, 4144, 37, 16, 1, 4150, 53, 1, 0, 4152,
+  59, 2, 0, 4154, 61, 47, 1, 4158, 108, 1, 0, 4160,
+  109, 47, 1, 4162, 156, 2, 0, 4164, 163, 1, 0, 4168,
+  164, 47, 1, 4170, 211, 2, 0, 4172, 213, 46, 1, 4176,
+  259, 1, 0, 4178, 268, 1, 0, 4180, 269, 11, 1, 4182,
+  280, 3, 0, 4184, 316, 1, 0, 4190, 317, 46, 1, 4192,
+  363, 1, 0, 4194, 371, 2, 0, 4196, 373, 12, 1, 4200,
+  385, 2, 0, 4202, 387, 32, 1, 4206, 5, 1, 0, 4208,
+  6, 21, 1, 4210, 27, 8, 0, 4212, 35, 19, 1, 4228,
+  54, 5, 0, 4230, 59, 49, 1, 4240, 108, 1, 0, 4242,
+  109, 49, 1, 4244, 158, 5, 0, 4246, 163, 48, 1, 4256,
+  211, 2, 0, 4258, 213, 47, 1, 4262, 260, 1, 0, 4264,
+  266, 2, 0, 4266, 268, 14, 1, 4270, 282, 3, 0, 4272,
+  316, 1, 0, 4278, 317, 47, 1, 4280, 364, 1, 0, 4282,
+  370, 2, 0, 4284, 372, 15, 1, 4288, 387, 4, 1, 4290,
+  391, 28, 1, 4292, 5, 1, 0, 4294, 6, 23, 1, 4296,
+  29, 4, 0, 4298, 33, 23, 1, 4306, 56, 1, 0, 4308,
+  57, 51, 1, 4310, 109, 1, 0, 4312, 110, 101, 1, 4314,
+  211, 2, 0, 4316, 213, 49, 1, 4320, 262, 4, 0, 4322,
+  266, 19, 1, 4330, 285, 2, 0, 4332, 316, 1, 0, 4336,
+  317, 48, 1, 4338, 365, 5, 0, 4340, 370, 20, 1, 4350,
+  390, 1, 0, 4352, 391, 28, 1, 4354, 5, 1, 0, 4356,
+  6, 23, 1, 4358, 29, 3, 0, 4360, 32, 24, 1, 4366,
+  56, 1, 0, 4368, 57, 50, 1, 4370, 107, 1, 0, 4372,
+  109, 1, 0, 4374, 110, 101, 1, 4376, 211, 2, 0, 4378,
+  213, 50, 1, 4382, 263, 2, 0, 4384, 265, 22, 1, 4388,
+  287, 2, 0, 4390, 316, 1, 0, 4394, 317, 50, 1, 4396,
+  367, 1, 0, 4398, 368, 23, 1, 4400, 391, 2, 0, 4402,
+  393, 26, 1, 4406, 5, 1, 0, 4408, 6, 22, 1, 4410,
+  28, 6, 0, 4412, 34, 22, 1, 4424, 56, 1, 0, 4426,
+  57, 50, 1, 4428, 107, 1, 0, 4430, 109, 1, 0, 4432,
+  110, 101, 1, 4434, 211, 2, 0, 4436, 213, 50, 1, 4440,
+  263, 2, 0, 4442, 265, 24, 1, 4446, 289, 2, 0, 4448,
+  316, 1, 0, 4452, 317, 50, 1, 4454, 367, 1, 0, 4456,
+  368, 26, 1, 4458, 394, 1, 0, 4460, 395, 23, 1, 4462,
+  418, 1, 0, 4464, 5, 1, 0, 4466, 6, 20, 1, 4468,
+  26, 2, 0, 4470, 28, 6, 1, 4474, 34, 1, 0, 4476,
+  35, 21, 1, 4478, 56, 1, 0, 4480, 57, 50, 1, 4482,
+  107, 1, 0, 4484, 109, 1, 0, 4486, 110, 101, 1, 4488,
+  212, 1, 0, 4490, 213, 50, 1, 4492, 263, 2, 0, 4494,
+  265, 26, 1, 4498, 291, 1, 0, 4500, 316, 1, 0, 4502,
+  317, 50, 1, 4504, 367, 2, 0, 4506, 369, 26, 1, 4510,
+  395, 1, 0, 4512, 396, 23, 1, 4514, 5, 1, 0, 4516,
+  6, 19, 1, 4518, 25, 1, 0, 4520, 26, 9, 1, 4522,
+  35, 2, 0, 4524, 37, 19, 1, 4528, 56, 1, 0, 4530,
+  57, 50, 1, 4532, 107, 1, 0, 4534, 109, 1, 0, 4536,
+  110, 100, 1, 4538, 210, 1, 0, 4540, 212, 1, 0, 4542,
+  213, 49, 1, 4544, 262, 3, 0, 4546, 265, 27, 1, 4552,
+  292, 2, 0, 4554, 317, 50, 1, 4558, 367, 2, 0, 4560,
+  369, 27, 1, 4564, 396, 2, 0, 4566, 398, 20, 1, 4570,
+  418, 1, 0, 4572, 5, 1, 0, 4574, 6, 17, 1, 4576,
+  23, 2, 0, 4578, 25, 12, 1, 4582, 37, 1, 0, 4584,
+  38, 18, 1, 4586, 56, 1, 0, 4588, 57, 50, 1, 4590,
+  110, 100, 1, 4592, 210, 1, 0, 4594, 212, 1, 0, 4596,
+  213, 49, 1, 4598, 262, 1, 0, 4600, 264, 1, 0, 4602,
+  265, 28, 1, 4604, 293, 2, 0, 4606, 317, 50, 1, 4610,
+  367, 2, 0, 4612, 369, 29, 1, 4616, 398, 1, 0, 4618,
+  399, 19, 1, 4620, 418, 1, 0, 4622, 5, 2, 0, 4624,
+  7, 15, 1, 4628, 22, 2, 0, 4630, 24, 14, 1, 4634,
+  38, 1, 0, 4636, 39, 17, 1, 4638, 56, 1, 0, 4640,
+  57, 49, 1, 4642, 106, 1, 0, 4644, 110, 1, 0, 4646,
+  111, 99, 1, 4648, 210, 1, 0, 4650, 212, 1, 0, 4652,
+  213, 49, 1, 4654, 262, 1, 0, 4656, 264, 1, 0, 4658,
+  265, 30, 1, 4660, 295, 1, 0, 4662, 317, 1, 0, 4664,
+  318, 49, 1, 4666, 367, 2, 0, 4668, 369, 30, 1, 4672,
+  399, 1, 0, 4674, 400, 18, 1, 4676, 418, 1, 0, 4678,
+  5, 2, 0, 4680, 7, 14, 1, 4684, 21, 1, 0, 4686,
+  22, 17, 1, 4688, 39, 1, 0, 4690, 40, 16, 1, 4692,
+  56, 1, 0, 4694, 57, 49, 1, 4696, 106, 1, 0, 4698,
+  110, 1, 0, 4700, 111, 99, 1, 4702, 210, 1, 0, 4704,
+  212, 1, 0, 4706, 213, 49, 1, 4708, 262, 1, 0, 4710,
+  264, 1, 0, 4712, 265, 31, 1, 4714, 296, 2, 0, 4716,
+  317, 1, 0, 4720, 318, 49, 1, 4722, 367, 2, 0, 4724,
+  369, 32, 1, 4728, 401, 1, 0, 4730, 402, 16, 1, 4732,
+  418, 1, 0, 4734, 5, 2, 0, 4736, 7, 13, 1, 4740,
+  20, 1, 0, 4742, 21, 19, 1, 4744, 40, 1, 0, 4746,
+  41, 15, 1, 4748, 56, 1, 0, 4750, 57, 49, 1, 4752,
+  106, 1, 0, 4754, 110, 1, 0, 4756, 111, 98, 1, 4758,
+  209, 1, 0, 4760, 212, 1, 0, 4762, 213, 49, 1, 4764,
+  264, 1, 0, 4766, 265, 33, 1, 4768, 298, 1, 0, 4770,
+  317, 1, 0, 4772, 318, 49, 1, 4774, 367, 3, 0, 4776,
+  370, 32, 1, 4782, 402, 1, 0, 4784, 403, 14, 1, 4786,
+  417, 2, 0, 4788, 5, 2, 0, 4792, 7, 12, 1, 4796,
+  19, 1, 0, 4798, 20, 21, 1, 4800, 41, 1, 0, 4802,
+  42, 14, 1, 4804, 56, 1, 0, 4806, 57, 48, 1, 4808,
+  105, 1, 0, 4810, 111, 98, 1, 4812, 209, 1, 0, 4814,
+  212, 1, 0, 4816, 213, 48, 1, 4818, 261, 1, 0, 4820,
+  264, 1, 0, 4822, 265, 34, 1, 4824, 299, 1, 0, 4826,
+  318, 1, 0, 4828, 319, 48, 1, 4830, 367, 3, 0, 4832,
+  370, 33, 1, 4838, 403, 2, 0, 4840, 405, 12, 1, 4844,
+  417, 2, 0, 4846, 5, 3, 0, 4850, 8, 10, 1, 4856,
+  18, 1, 0, 4858, 19, 23, 1, 4860, 42, 1, 0, 4862,
+  43, 13, 1, 4864, 56, 1, 0, 4866, 57, 48, 1, 4868,
+  105, 1, 0, 4870, 111, 1, 0, 4872, 112, 97, 1, 4874,
+  209, 1, 0, 4876, 212, 1, 0, 4878, 213, 48, 1, 4880,
+  261, 1, 0, 4882, 264, 1, 0, 4884, 265, 35, 1, 4886,
+  300, 1, 0, 4888, 318, 1, 0, 4890, 319, 48, 1, 4892,
+  367, 3, 0, 4894, 370, 34, 1, 4900, 404, 2, 0, 4902,
+  406, 11, 1, 4906, 417, 2, 0, 4908, 5, 3, 0, 4912,
+  8, 9, 1, 4918, 17, 1, 0, 4920, 18, 25, 1, 4922,
+  43, 1, 0, 4924, 44, 12, 1, 4926, 56, 1, 0, 4928,
+  57, 48, 1, 4930, 105, 1, 0, 4932, 111, 1, 0, 4934,
+  112, 96, 1, 4936, 208, 1, 0, 4938, 212, 1, 0, 4940,
+  213, 48, 1, 4942, 261, 1, 0, 4944, 264, 1, 0, 4946,
+  265, 36, 1, 4948, 301, 1, 0, 4950, 318, 1, 0, 4952,
+  319, 48, 1, 4954, 367, 3, 0, 4956, 370, 35, 1, 4962,
+  405, 1, 0, 4964, 406, 10, 1, 4966, 416, 3, 0, 4968,
+  5, 4, 0, 4974, 9, 8, 1, 4982, 17, 27, 1, 4984,
+  44, 1, 0, 4986, 45, 11, 1, 4988, 56, 1, 0, 4990,
+  57, 47, 1, 4992, 104, 1, 0, 4994, 112, 1, 0, 4996,
+  113, 95, 1, 4998, 208, 1, 0, 5000, 212, 1, 0, 5002,
+  213, 47, 1, 5004, 260, 1, 0, 5006, 264, 1, 0, 5008,
+  265, 36, 1, 5010, 301, 2, 0, 5012, 319, 48, 1, 5016,
+  367, 4, 0, 5018, 371, 35, 1, 5026, 406, 2, 0, 5028,
+  408, 8, 1, 5032, 416, 3, 0, 5034, 5, 4, 0, 5040,
+  9, 7, 1, 5048, 16, 1, 0, 5050, 17, 28, 1, 5052,
+  45, 1, 0, 5054, 46, 10, 1, 5056, 56, 1, 0, 5058,
+  57, 47, 1, 5060, 104, 1, 0, 5062, 112, 1, 0, 5064,
+  113, 95, 1, 5066, 212, 1, 0, 5068, 213, 47, 1, 5070,
+  260, 1, 0, 5072, 264, 1, 0, 5074, 265, 37, 1, 5076,
+  302, 2, 0, 5078, 319, 1, 0, 5082, 320, 47, 1, 5084,
+  367, 4, 0, 5086, 371, 36, 1, 5094, 407, 1, 0, 5096,
+  408, 8, 1, 5098, 416, 3, 0, 5100, 5, 4, 0, 5106,
+  9, 6, 1, 5114, 15, 1, 0, 5116, 16, 30, 1, 5118,
+  46, 1, 0, 5120, 47, 9, 1, 5122, 56, 1, 0, 5124,
+  57, 47, 1, 5126, 104, 1, 0, 5128, 112, 1, 0, 5130,
+  113, 94, 1, 5132, 207, 1, 0, 5134, 212, 1, 0, 5136,
+  213, 47, 1, 5138, 264, 1, 0, 5140, 265, 38, 1, 5142,
+  303, 1, 0, 5144, 319, 1, 0, 5146, 320, 47, 1, 5148,
+  367, 5, 0, 5150, 372, 36, 1, 5160, 408, 7, 1, 5162,
+  415, 4, 0, 5164, 5, 4, 1, 5172, 9, 1, 0, 5174,
+  10, 4, 1, 5176, 14, 1, 0, 5178, 15, 31, 1, 5180,
+  46, 1, 0, 5182, 47, 9, 1, 5184, 56, 1, 0, 5186,
+  57, 46, 1, 5188, 103, 1, 0, 5190, 113, 1, 0, 5192,
+  114, 93, 1, 5194, 207, 1, 0, 5196, 212, 1, 0, 5198,
+  213, 46, 1, 5200, 259, 1, 0, 5202, 264, 1, 0, 5204,
+  265, 39, 1, 5206, 304, 1, 0, 5208, 320, 1, 0, 5210,
+  321, 46, 1, 5212, 367, 5, 0, 5214, 372, 36, 1, 5224,
+  408, 1, 0, 5226, 409, 6, 1, 5228, 415, 4, 0, 5230,
+  5, 4, 1, 5238, 9, 5, 0, 5240, 14, 33, 1, 5250,
+  47, 1, 0, 5252, 48, 8, 1, 5254, 56, 1, 0, 5256,
+  57, 46, 1, 5258, 103, 1, 0, 5260, 113, 1, 0, 5262,
+  114, 92, 1, 5264, 206, 1, 0, 5266, 212, 1, 0, 5268,
+  213, 46, 1, 5270, 259, 1, 0, 5272, 264, 1, 0, 5274,
+  265, 40, 1, 5276, 305, 1, 0, 5278, 320, 1, 0, 5280,
+  321, 46, 1, 5282, 367, 1, 0, 5284, 368, 4, 1, 5286,
+  372, 1, 0, 5288, 373, 36, 1, 5290, 409, 1, 0, 5292,
+  410, 5, 1, 5294, 415, 4, 0, 5296, 5, 5, 1, 5304,
+  10, 4, 0, 5306, 14, 34, 1, 5314, 48, 1, 0, 5316,
+  49, 7, 1, 5318, 56, 1, 0, 5320, 57, 45, 1, 5322,
+  102, 1, 0, 5324, 114, 1, 0, 5326, 115, 91, 1, 5328,
+  206, 1, 0, 5330, 212, 1, 0, 5332, 213, 45, 1, 5334,
+  258, 1, 0, 5336, 264, 1, 0, 5338, 265, 41, 1, 5340,
+  306, 1, 0, 5342, 321, 46, 1, 5344, 367, 1, 0, 5346,
+  368, 4, 1, 5348, 372, 1, 0, 5350, 373, 37, 1, 5352,
+  410, 5, 0, 5354, 415, 4, 1, 5364, 5, 5, 1, 5366,
+  10, 3, 0, 5368, 13, 35, 1, 5374, 48, 1, 0, 5376,
+  49, 7, 1, 5378, 56, 1, 0, 5380, 57, 45, 1, 5382,
+  102, 1, 0, 5384, 114, 1, 0, 5386, 115, 90, 1, 5388,
+  205, 1, 0, 5390, 212, 1, 0, 5392, 213, 45, 1, 5394,
+  258, 1, 0, 5396, 264, 1, 0, 5398, 265, 41, 1, 5400,
+  306, 1, 0, 5402, 321, 1, 0, 5404, 322, 45, 1, 5406,
+  367, 1, 0, 5408, 368, 5, 1, 5410, 373, 1, 0, 5412,
+  374, 36, 1, 5414, 410, 5, 0, 5416, 415, 4, 1, 5426,
+  5, 6, 1, 5428, 11, 1, 0, 5430, 12, 37, 1, 5432,
+  49, 1, 0, 5434, 50, 6, 1, 5436, 56, 1, 0, 5438,
+  57, 44, 1, 5440, 101, 1, 0, 5442, 115, 1, 0, 5444,
+  116, 89, 1, 5446, 205, 1, 0, 5448, 212, 1, 0, 5450,
+  213, 44, 1, 5452, 257, 1, 0, 5454, 264, 1, 0, 5456,
+  265, 42, 1, 5458, 307, 1, 0, 5460, 322, 45, 1, 5462,
+  367, 1, 0, 5464, 368, 5, 1, 5466, 373, 1, 0, 5468,
+  374, 37, 1, 5470, 411, 3, 0, 5472, 414, 5, 1, 5478,
+  5, 6, 1, 5480, 11, 1, 0, 5482, 12, 38, 1, 5484,
+  50, 6, 1, 5486, 56, 1, 0, 5488, 57, 44, 1, 5490,
+  101, 1, 0, 5492, 115, 1, 0, 5494, 116, 88, 1, 5496,
+  204, 1, 0, 5498, 212, 1, 0, 5500, 213, 44, 1, 5502,
+  257, 1, 0, 5504, 264, 1, 0, 5506, 265, 43, 1, 5508,
+  308, 1, 0, 5510, 322, 1, 0, 5512, 323, 44, 1, 5514,
+  367, 1, 0, 5516, 368, 6, 1, 5518, 374, 38, 1, 5520,
+  412, 1, 0, 5522, 413, 6, 1, 5524, 5, 5, 1, 5526,
+  10, 3, 0, 5528, 13, 37, 1, 5534, 50, 1, 0, 5536,
+  51, 5, 1, 5538, 56, 1, 0, 5540, 57, 43, 1, 5542,
+  100, 1, 0, 5544, 116, 1, 0, 5546, 117, 86, 1, 5548,
+  203, 2, 0, 5550, 212, 1, 0, 5554, 213, 43, 1, 5556,
+  256, 1, 0, 5558, 264, 1, 0, 5560, 265, 43, 1, 5562,
+  308, 1, 0, 5564, 323, 1, 0, 5566, 324, 43, 1, 5568,
+  367, 1, 0, 5570, 368, 6, 1, 5572, 374, 1, 0, 5574,
+  375, 37, 1, 5576, 412, 1, 0, 5578, 413, 6, 1, 5580,
+  5, 5, 1, 5582, 10, 3, 0, 5584, 13, 38, 1, 5590,
+  51, 1, 0, 5592, 52, 4, 1, 5594, 56, 1, 0, 5596,
+  57, 42, 1, 5598, 99, 1, 0, 5600, 117, 1, 0, 5602,
+  118, 84, 1, 5604, 202, 2, 0, 5606, 212, 1, 0, 5610,
+  213, 42, 1, 5612, 255, 1, 0, 5614, 264, 1, 0, 5616,
+  265, 44, 1, 5618, 309, 1, 0, 5620, 323, 1, 0, 5622,
+  324, 43, 1, 5624, 367, 1, 0, 5626, 368, 7, 1, 5628,
+  375, 1, 0, 5630, 376, 36, 1, 5632, 412, 2, 0, 5634,
+  414, 5, 1, 5638, 5, 4, 1, 5640, 9, 5, 0, 5642,
+  14, 37, 1, 5652, 51, 1, 0, 5654, 52, 4, 1, 5656,
+  56, 1, 0, 5658, 57, 42, 1, 5660, 99, 1, 0, 5662,
+  117, 1, 0, 5664, 118, 84, 1, 5666, 202, 1, 0, 5668,
+  212, 1, 0, 5670, 213, 42, 1, 5672, 255, 1, 0, 5674,
+  264, 1, 0, 5676, 265, 44, 1, 5678, 309, 1, 0, 5680,
+  324, 1, 0, 5682, 325, 42, 1, 5684, 367, 1, 0, 5686,
+  368, 7, 1, 5688, 375, 1, 0, 5690, 376, 35, 1, 5692,
+  411, 3, 0, 5694, 414, 5, 1, 5700, 5, 4, 1, 5702,
+  9, 1, 0, 5704, 10, 4, 1, 5706, 14, 1, 0, 5708,
+  15, 37, 1, 5710, 52, 4, 1, 5712, 56, 1, 0, 5714,
+  57, 41, 1, 5716, 98, 1, 0, 5718, 118, 2, 0, 5720,
+  120, 81, 1, 5724, 201, 2, 0, 5726, 212, 1, 0, 5730,
+  213, 41, 1, 5732, 254, 1, 0, 5734, 264, 1, 0, 5736,
+  265, 45, 1, 5738, 310, 1, 0, 5740, 325, 1, 0, 5742,
+  326, 41, 1, 5744, 367, 1, 0, 5746, 368, 8, 1, 5748,
+  376, 1, 0, 5750, 377, 33, 1, 5752, 410, 5, 0, 5754,
+  415, 4, 1, 5764, 5, 4, 0, 5766, 9, 5, 1, 5774,
+  14, 1, 0, 5776, 15, 37, 1, 5778, 52, 5, 0, 5780,
+  57, 40, 1, 5790, 97, 1, 0, 5792, 119, 1, 0, 5794,
+  120, 81, 1, 5796, 201, 1, 0, 5798, 212, 1, 0, 5800,
+  213, 40, 1, 5802, 253, 1, 0, 5804, 264, 1, 0, 5806,
+  265, 45, 1, 5808, 310, 1, 0, 5810, 325, 1, 0, 5812,
+  326, 41, 1, 5814, 367, 1, 0, 5816, 368, 9, 1, 5818,
+  377, 1, 0, 5820, 378, 32, 1, 5822, 410, 4, 1, 5824,
+  414, 5, 0, 5826, 5, 4, 0, 5836, 9, 6, 1, 5844,
+  15, 1, 0, 5846, 16, 37, 1, 5848, 53, 4, 0, 5850,
+  57, 39, 1, 5858, 96, 1, 0, 5860, 119, 2, 0, 5862,
+  121, 78, 1, 5866, 199, 2, 0, 5868, 212, 1, 0, 5872,
+  213, 40, 1, 5874, 253, 1, 0, 5876, 264, 1, 0, 5878,
+  265, 46, 1, 5880, 311, 1, 0, 5882, 326, 1, 0, 5884,
+  327, 40, 1, 5886, 367, 1, 0, 5888, 368, 10, 1, 5890,
+  378, 31, 1, 5892, 409, 1, 0, 5894, 410, 5, 1, 5896,
+  415, 4, 0, 5898, 5, 4, 0, 5906, 9, 7, 1, 5914,
+  16, 1, 0, 5916, 17, 36, 1, 5918, 53, 4, 0, 5920,
+  57, 39, 1, 5928, 96, 1, 0, 5930, 120, 2, 0, 5932,
+  122, 77, 1, 5936, 199, 1, 0, 5938, 212, 1, 0, 5940,
+  213, 39, 1, 5942, 252, 1, 0, 5944, 264, 1, 0, 5946,
+  265, 46, 1, 5948, 311, 1, 0, 5950, 327, 1, 0, 5952,
+  328, 39, 1, 5954, 367, 1, 0, 5956, 368, 10, 1, 5958,
+  378, 1, 0, 5960, 379, 29, 1, 5962, 408, 1, 0, 5964,
+  409, 6, 1, 5966, 415, 4, 0, 5968, 5, 3, 0, 5976,
+  8, 9, 1, 5982, 17, 1, 0, 5984, 18, 35, 1, 5986,
+  53, 4, 0, 5988, 57, 38, 1, 5996, 95, 1, 0, 5998,
+  121, 1, 0, 6000, 122, 76, 1, 6002, 198, 1, 0, 6004,
+  212, 1, 0, 6006, 213, 38, 1, 6008, 251, 1, 0, 6010,
+  264, 1, 0, 6012, 265, 47, 1, 6014, 312, 1, 0, 6016,
+  328, 1, 0, 6018, 329, 38, 1, 6020, 367, 1, 0, 6022,
+  368, 11, 1, 6024, 379, 1, 0, 6026, 380, 27, 1, 6028,
+  407, 1, 0, 6030, 408, 8, 1, 6032, 416, 3, 0, 6034,
+  5, 3, 0, 6040, 8, 10, 1, 6046, 18, 1, 0, 6048,
+  19, 35, 1, 6050, 54, 3, 0, 6052, 57, 37, 1, 6058,
+  94, 1, 0, 6060, 122, 1, 0, 6062, 123, 74, 1, 6064,
+  197, 1, 0, 6066, 212, 1, 0, 6068, 213, 37, 1, 6070,
+  250, 1, 0, 6072, 264, 1, 0, 6074, 265, 47, 1, 6076,
+  312, 1, 0, 6078, 329, 1, 0, 6080, 330, 37, 1, 6082,
+  367, 1, 0, 6084, 368, 12, 1, 6086, 380, 1, 0, 6088,
+  381, 25, 1, 6090, 406, 1, 0, 6092, 407, 9, 1, 6094,
+  416, 3, 0, 6096, 5, 3, 0, 6102, 8, 11, 1, 6108,
+  19, 1, 0, 6110, 20, 34, 1, 6112, 54, 3, 0, 6114,
+  57, 36, 1, 6120, 93, 1, 0, 6122, 123, 1, 0, 6124,
+  124, 72, 1, 6126, 196, 1, 0, 6128, 212, 1, 0, 6130,
+  213, 36, 1, 6132, 249, 1, 0, 6134, 264, 1, 0, 6136,
+  265, 47, 1, 6138, 312, 1, 0, 6140, 329, 1, 0, 6142,
+  330, 37, 1, 6144, 367, 1, 0, 6146, 368, 13, 1, 6148,
+  381, 1, 0, 6150, 382, 23, 1, 6152, 405, 2, 0, 6154,
+  407, 9, 1, 6158, 416, 3, 0, 6160, 5, 2, 0, 6166,
+  7, 13, 1, 6170, 20, 1, 0, 6172, 21, 33, 1, 6174,
+  54, 3, 0, 6176, 57, 35, 1, 6182, 92, 1, 0, 6184,
+  124, 1, 0, 6186, 125, 70, 1, 6188, 195, 2, 0, 6190,
+  212, 1, 0, 6194, 213, 35, 1, 6196, 248, 1, 0, 6198,
+  264, 1, 0, 6200, 265, 47, 1, 6202, 312, 2, 0, 6204,
+  330, 1, 0, 6208, 331, 36, 1, 6210, 367, 1, 0, 6212,
+  368, 14, 1, 6214, 382, 1, 0, 6216, 383, 21, 1, 6218,
+  404, 1, 0, 6220, 405, 12, 1, 6222, 417, 2, 0, 6224,
+  5, 2, 0, 6228, 7, 14, 1, 6232, 21, 1, 0, 6234,
+  22, 32, 1, 6236, 54, 3, 0, 6238, 57, 34, 1, 6244,
+  91, 1, 0, 6246, 125, 1, 0, 6248, 126, 68, 1, 6250,
+  194, 1, 0, 6252, 212, 1, 0, 6254, 213, 34, 1, 6256,
+  247, 1, 0, 6258, 264, 1, 0, 6260, 265, 48, 1, 6262,
+  313, 1, 0, 6264, 331, 2, 0, 6266, 333, 34, 1, 6270,
+  367, 1, 0, 6272, 368, 15, 1, 6274, 383, 1, 0, 6276,
+  384, 19, 1, 6278, 403, 1, 0, 6280, 404, 13, 1, 6282,
+  417, 2, 0, 6284, 5, 2, 0, 6288, 7, 15, 1, 6292,
+  22, 1, 0, 6294, 23, 32, 1, 6296, 55, 2, 0, 6298,
+  57, 33, 1, 6302, 90, 1, 0, 6304, 126, 2, 0, 6306,
+  128, 65, 1, 6310, 193, 1, 0, 6312, 212, 1, 0, 6314,
+  213, 33, 1, 6316, 246, 1, 0, 6318, 264, 1, 0, 6320,
+  265, 48, 1, 6322, 313, 1, 0, 6324, 332, 1, 0, 6326,
+  333, 34, 1, 6328, 367, 1, 0, 6330, 368, 16, 1, 6332,
+  384, 1, 0, 6334, 385, 17, 1, 6336, 402, 1, 0, 6338,
+  403, 14, 1, 6340, 417, 2, 0, 6342, 5, 2, 0, 6346,
+  7, 16, 1, 6350, 23, 1, 0, 6352, 24, 31, 1, 6354,
+  55, 2, 0, 6356, 57, 31, 1, 6360, 88, 2, 0, 6362,
+  127, 2, 0, 6366, 129, 63, 1, 6370, 192, 1, 0, 6372,
+  212, 1, 0, 6374, 213, 31, 1, 6376, 244, 2, 0, 6378,
+  264, 1, 0, 6382, 265, 48, 1, 6384, 313, 1, 0, 6386,
+  333, 2, 0, 6388, 335, 32, 1, 6392, 367, 1, 0, 6394,
+  368, 17, 1, 6396, 385, 1, 0, 6398, 386, 15, 1, 6400,
+  401, 1, 0, 6402, 402, 15, 1, 6404, 417, 2, 0, 6406,
+  5, 1, 0, 6410, 6, 18, 1, 6412, 24, 2, 0, 6414,
+  26, 29, 1, 6418, 55, 2, 0, 6420, 57, 30, 1, 6424,
+  87, 1, 0, 6426, 129, 1, 0, 6428, 130, 61, 1, 6430,
+  191, 1, 0, 6432, 212, 1, 0, 6434, 213, 31, 1, 6436,
+  244, 1, 0, 6438, 264, 1, 0, 6440, 265, 49, 1, 6442,
+  314, 1, 0, 6444, 335, 1, 0, 6446, 336, 31, 1, 6448,
+  367, 1, 0, 6450, 368, 18, 1, 6452, 386, 1, 0, 6454,
+  387, 13, 1, 6456, 400, 1, 0, 6458, 401, 17, 1, 6460,
+  418, 1, 0, 6462, 5, 1, 0, 6464, 6, 20, 1, 6466,
+  26, 1, 0, 6468, 27, 28, 1, 6470, 55, 2, 0, 6472,
+  57, 29, 1, 6476, 86, 1, 0, 6478, 130, 1, 0, 6480,
+  131, 58, 1, 6482, 189, 1, 0, 6484, 212, 1, 0, 6486,
+  213, 30, 1, 6488, 243, 1, 0, 6490, 264, 1, 0, 6492,
+  265, 49, 1, 6494, 314, 1, 0, 6496, 336, 1, 0, 6498,
+  337, 30, 1, 6500, 367, 1, 0, 6502, 368, 19, 1, 6504,
+  387, 1, 0, 6506, 388, 11, 1, 6508, 399, 1, 0, 6510,
+  400, 18, 1, 6512, 418, 1, 0, 6514, 5, 1, 0, 6516,
+  6, 21, 1, 6518, 27, 1, 0, 6520, 28, 28, 1, 6522,
+  56, 1, 0, 6524, 57, 27, 1, 6526, 84, 2, 0, 6528,
+  131, 2, 0, 6532, 133, 55, 1, 6536, 188, 1, 0, 6538,
+  212, 1, 0, 6540, 213, 28, 1, 6542, 241, 2, 0, 6544,
+  264, 1, 0, 6548, 265, 49, 1, 6550, 314, 1, 0, 6552,
+  337, 1, 0, 6554, 338, 29, 1, 6556, 367, 1, 0, 6558,
+  368, 21, 1, 6560, 389, 1, 0, 6562, 390, 7, 1, 6564,
+  397, 2, 0, 6566, 399, 19, 1, 6570, 418, 1, 0, 6572,
+  5, 1, 0, 6574, 6, 22, 1, 6576, 28, 2, 0, 6578,
+  30, 26, 1, 6582, 56, 1, 0, 6584, 57, 26, 1, 6586,
+  83, 1, 0, 6588, 133, 1, 0, 6590, 134, 51, 1, 6592,
+  185, 3, 0, 6594, 212, 1, 0, 6600, 213, 27, 1, 6602,
+  240, 1, 0, 6604, 264, 1, 0, 6606, 265, 50, 1, 6608,
+  339, 1, 0, 6610, 340, 27, 1, 6612, 367, 1, 0, 6614,
+  368, 22, 1, 6616, 390, 1, 0, 6618, 391, 5, 1, 6620,
+  396, 1, 0, 6622, 397, 21, 1, 6624, 418, 1, 0, 6626,
+  5, 1, 0, 6628, 6, 24, 1, 6630, 30, 2, 0, 6632,
+  32, 24, 1, 6636, 56, 1, 0, 6638, 57, 24, 1, 6640,
+  81, 1, 0, 6642, 135, 1, 0, 6644, 136, 48, 1, 6646,
+  184, 2, 0, 6648, 212, 1, 0, 6652, 213, 25, 1, 6654,
+  238, 2, 0, 6656, 264, 1, 0, 6660, 265, 50, 1, 6662,
+  340, 2, 0, 6664, 342, 25, 1, 6668, 367, 1, 0, 6670,
+  368, 24, 1, 6672, 392, 4, 0, 6674, 396, 22, 1, 6682,
+  418, 1, 0, 6684, 5, 1, 0, 6686, 6, 26, 1, 6688,
+  32, 1, 0, 6690, 33, 46, 1, 6692, 79, 2, 0, 6694,
+  136, 2, 0, 6698, 138, 44, 1, 6702, 182, 2, 0, 6704,
+  212, 1, 0, 6708, 213, 23, 1, 6710, 236, 2, 0, 6712,
+  264, 1, 0, 6716, 265, 50, 1, 6718, 315, 1, 0, 6720,
+  342, 2, 0, 6722, 344, 23, 1, 6726, 367, 1, 0, 6728,
+  368, 24, 1, 6730, 392, 3, 0, 6732, 395, 24, 1, 6738,
+  5, 29, 1, 6740, 34, 2, 0, 6742, 36, 40, 1, 6746,
+  76, 3, 0, 6748, 139, 2, 0, 6754, 141, 39, 1, 6758,
+  180, 2, 0, 6760, 212, 1, 0, 6764, 213, 21, 1, 6766,
+  234, 2, 0, 6768, 264, 1, 0, 6772, 265, 50, 1, 6774,
+  315, 1, 0, 6776, 344, 2, 0, 6778, 346, 21, 1, 6782,
+  367, 1, 0, 6784, 368, 22, 1, 6786, 390, 7, 0, 6788,
+  397, 22, 1, 6802, 5, 31, 1, 6804, 36, 2, 0, 6806,
+  38, 36, 1, 6810, 74, 2, 0, 6812, 141, 3, 0, 6816,
+  144, 32, 1, 6822, 176, 4, 0, 6824, 212, 1, 0, 6832,
+  213, 19, 1, 6834, 232, 2, 0, 6836, 264, 1, 0, 6840,
+  265, 50, 1, 6842, 315, 1, 0, 6844, 346, 2, 0, 6846,
+  348, 19, 1, 6850, 367, 1, 0, 6852, 368, 20, 1, 6854,
+  388, 3, 0, 6856, 391, 6, 1, 6862, 397, 2, 0, 6864,
+  399, 20, 1, 6868, 5, 34, 1, 6870, 39, 2, 0, 6872,
+  41, 30, 1, 6876, 71, 3, 0, 6878, 144, 3, 0, 6884,
+  147, 27, 1, 6890, 174, 3, 0, 6892, 212, 1, 0, 6898,
+  213, 16, 1, 6900, 229, 3, 0, 6902, 264, 1, 0, 6908,
+  265, 50, 1, 6910, 315, 1, 0, 6912, 348, 2, 0, 6914,
+  350, 17, 1, 6918, 367, 1, 0, 6920, 368, 18, 1, 6922,
+  386, 2, 0, 6924, 388, 11, 1, 6928, 399, 2, 0, 6930,
+  401, 18, 1, 6934, 5, 37, 1, 6936, 42, 3, 0, 6938,
+  45, 22, 1, 6944, 67, 4, 0, 6946, 147, 2, 0, 6954,
+  149, 20, 1, 6958, 169, 5, 0, 6960, 212, 1, 0, 6970,
+  213, 14, 1, 6972, 227, 2, 0, 6974, 264, 1, 0, 6978,
+  265, 50, 1, 6980, 315, 1, 0, 6982, 351, 2, 0, 6984,
+  353, 14, 1, 6988, 367, 1, 0, 6990, 368, 15, 1, 6992,
+  383, 3, 0, 6994, 386, 15, 1, 7000, 401, 3, 0, 7002,
+  404, 15, 1, 7008, 5, 41, 1, 7010, 46, 4, 0, 7012,
+  50, 11, 1, 7020, 61, 5, 0, 7022, 151, 18, 0, 7032,
+  212, 1, 0, 7068, 213, 8, 1, 7070, 221, 5, 0, 7072,
+  264, 1, 0, 7082, 265, 50, 1, 7084, 315, 1, 0, 7086,
+  354, 3, 0, 7088, 357, 10, 1, 7094, 367, 1, 0, 7096,
+  368, 11, 1, 7098, 379, 4, 0, 7100, 383, 22, 1, 7108,
+  405, 3, 0, 7110, 408, 11, 1, 7116, 5, 51, 1, 7118,
+  56, 1, 0, 7120, 212, 10, 0, 7122, 264, 1, 0, 7142,
+  265, 50, 1, 7144, 315, 1, 0, 7146, 358, 10, 0, 7148,
+  368, 5, 1, 7168, 373, 7, 0, 7170, 380, 27, 1, 7184,
+  407, 8, 0, 7186, 415, 4, 1, 7202, 419, 1, 0, 7204,
+  5, 51, 1, 7206, 56, 1, 0, 7208, 367, 3, 0, 7210,
+  370, 47, 1, 7216, 417, 3, 0, 7218, 5, 51, 1, 7224,
+  56, 1, 0, 7226, 367, 1, 0, 7228, 368, 51, 1, 7230,
+  419, 1, 0, 7232, 5, 51, 1, 7234, 56, 1, 0, 7236,
+  367, 1, 0, 7238, 368, 51, 1, 7240, 419, 1, 0, 7242,
+  5, 51, 1, 7244, 56, 1, 0, 7246, 367, 1, 0, 7248,
+  368, 51, 1, 7250, 5, 51, 1, 7252, 56, 1, 0, 7254,
+  367, 1, 0, 7256, 368, 51, 1, 7258, 5, 51, 1, 7260,
+  367, 1, 0, 7262, 368, 51, 1, 7264, 5, 51, 1, 7266,
+  367, 1, 0, 7268, 368, 50, 1, 7270, 418, 1, 0, 7272,
+  5, 50, 1, 7274, 55, 1, 0, 7276, 367, 1, 0, 7278,
+  368, 50, 1, 7280, 418, 1, 0, 7282, 5, 50, 1, 7284,
+  55, 1, 0, 7286, 367, 1, 0, 7288, 368, 50, 1, 7290,
+  418, 1, 0, 7292, 5, 50, 1, 7294, 55, 1, 0, 7296,
+  367, 1, 0, 7298, 368, 50, 1, 7300, 418, 1, 0, 7302,
+  5, 50, 1, 7304, 55, 1, 0, 7306, 367, 1, 0, 7308,
+  368, 50, 1, 7310, 418, 1, 0, 7312, 5, 50, 1, 7314,
+  367, 1, 0, 7316, 368, 50, 1, 7318, 5, 49, 1, 7320,
+  54, 1, 0, 7322, 367, 1, 0, 7324, 368, 49, 1, 7326,
+  417, 1, 0, 7328, 5, 49, 1, 7330, 54, 1, 0, 7332,
+  367, 1, 0, 7334, 368, 49, 1, 7336, 417, 1, 0, 7338,
+  5, 49, 1, 7340, 54, 1, 0, 7342, 367, 1, 0, 7344,
+  368, 49, 1, 7346, 417, 1, 0, 7348, 5, 48, 1, 7350,
+  53, 1, 0, 7352, 367, 1, 0, 7354, 368, 49, 1, 7356,
+  5, 48, 1, 7358, 53, 1, 0, 7360, 367, 1, 0, 7362,
+  368, 48, 1, 7364, 416, 1, 0, 7366, 5, 48, 1, 7368,
+  53, 1, 0, 7370, 367, 1, 0, 7372, 368, 48, 1, 7374,
+  416, 1, 0, 7376, 5, 47, 1, 7378, 52, 1, 0, 7380,
+  367, 1, 0, 7382, 368, 48, 1, 7384, 5, 47, 1, 7386,
+  52, 1, 0, 7388, 367, 1, 0, 7390, 368, 47, 1, 7392,
+  415, 1, 0, 7394, 5, 46, 1, 7396, 51, 1, 0, 7398,
+  367, 1, 0, 7400, 368, 47, 1, 7402, 5, 46, 1, 7404,
+  51, 1, 0, 7406, 367, 1, 0, 7408, 368, 46, 1, 7410,
+  414, 1, 0, 7412, 5, 45, 1, 7414, 50, 1, 0, 7416,
+  367, 1, 0, 7418, 368, 46, 1, 7420, 414, 1, 0, 7422,
+  5, 45, 1, 7424, 50, 1, 0, 7426, 367, 1, 0, 7428,
+  368, 45, 1, 7430, 413, 1, 0, 7432, 5, 44, 1, 7434,
+  49, 1, 0, 7436, 367, 1, 0, 7438, 368, 45, 1, 7440,
+  413, 1, 0, 7442, 5, 44, 1, 7444, 49, 1, 0, 7446,
+  367, 1, 0, 7448, 368, 44, 1, 7450, 412, 1, 0, 7452,
+  5, 43, 1, 7454, 48, 1, 0, 7456, 367, 1, 0, 7458,
+  368, 44, 1, 7460, 5, 42, 1, 7462, 47, 1, 0, 7464,
+  367, 1, 0, 7466, 368, 43, 1, 7468, 411, 1, 0, 7470,
+  5, 42, 1, 7472, 47, 1, 0, 7474, 367, 1, 0, 7476,
+  368, 42, 1, 7478, 410, 1, 0, 7480, 5, 41, 1, 7482,
+  46, 1, 0, 7484, 367, 1, 0, 7486, 368, 41, 1, 7488,
+  409, 2, 0, 7490, 5, 40, 1, 7494, 45, 1, 0, 7496,
+  367, 1, 0, 7498, 368, 41, 1, 7500, 409, 1, 0, 7502,
+  5, 40, 1, 7504, 45, 1, 0, 7506, 367, 1, 0, 7508,
+  368, 40, 1, 7510, 408, 1, 0, 7512, 5, 39, 1, 7514,
+  44, 1, 0, 7516, 367, 1, 0, 7518, 368, 39, 1, 7520,
+  407, 1, 0, 7522, 5, 38, 1, 7524, 43, 1, 0, 7526,
+  367, 1, 0, 7528, 368, 39, 1, 7530, 407, 1, 0, 7532,
+  5, 37, 1, 7534, 42, 1, 0, 7536, 367, 1, 0, 7538,
+  368, 38, 1, 7540, 406, 1, 0, 7542, 5, 36, 1, 7544,
+  41, 1, 0, 7546, 367, 1, 0, 7548, 368, 37, 1, 7550,
+  405, 1, 0, 7552, 5, 35, 1, 7554, 40, 1, 0, 7556,
+  367, 1, 0, 7558, 368, 36, 1, 7560, 404, 1, 0, 7562,
+  5, 34, 1, 7564, 39, 1, 0, 7566, 367, 1, 0, 7568,
+  368, 35, 1, 7570, 403, 1, 0, 7572, 5, 33, 1, 7574,
+  38, 1, 0, 7576, 367, 1, 0, 7578, 368, 34, 1, 7580,
+  402, 1, 0, 7582, 5, 31, 1, 7584, 36, 2, 0, 7586,
+  367, 1, 0, 7590, 368, 32, 1, 7592, 400, 2, 0, 7594,
+  5, 30, 1, 7598, 35, 1, 0, 7600, 367, 1, 0, 7602,
+  368, 31, 1, 7604, 399, 2, 0, 7606, 5, 29, 1, 7610,
+  34, 1, 0, 7612, 367, 1, 0, 7614, 368, 30, 1, 7616,
+  398, 1, 0, 7618, 5, 27, 1, 7620, 32, 2, 0, 7622,
+  367, 1, 0, 7626, 368, 29, 1, 7628, 397, 1, 0, 7630,
+  5, 26, 1, 7632, 31, 1, 0, 7634, 367, 1, 0, 7636,
+  368, 27, 1, 7638, 395, 1, 0, 7640, 5, 24, 1, 7642,
+  29, 1, 0, 7644, 367, 1, 0, 7646, 368, 25, 1, 7648,
+  393, 2, 0, 7650, 5, 22, 1, 7654, 27, 2, 0, 7656,
+  367, 1, 0, 7660, 368, 23, 1, 7662, 391, 2, 0, 7664,
+  5, 19, 1, 7668, 24, 3, 0, 7670, 367, 1, 0, 7676,
+  368, 22, 1, 7678, 390, 1, 0, 7680, 5, 17, 1, 7682,
+  22, 2, 0, 7684, 367, 1, 0, 7688, 368, 19, 1, 7690,
+  387, 2, 0, 7692, 5, 14, 1, 7696, 19, 3, 0, 7698,
+  367, 1, 0, 7704, 368, 17, 1, 7706, 385, 2, 0, 7708,
+  5, 11, 1, 7712, 16, 3, 0, 7714, 367, 1, 0, 7720,
+  368, 14, 1, 7722, 382, 2, 0, 7724, 5, 9, 0, 7728,
+  367, 1, 0, 7746, 368, 10, 1, 7748, 378, 3, 0, 7750,
+  367, 10, 0, 7756,
+};
+
+static const int POKY_IMG_RGB565_ROW_SPANS[] = {
+  0, 0, 0, 0, 0, 4, 16, 28, 40, 52, 64, 76,
+  88, 100, 112, 124, 136, 148, 160, 172, 184, 196, 208, 220,
+  232, 244, 256, 268, 280, 292, 304, 316, 328, 340, 352, 364,
+  376, 388, 400, 412, 420, 432, 444, 456, 468, 480, 492, 504,
+  512, 524, 536, 548, 560, 572, 584, 596, 620, 684, 780, 876,
+  972, 1072, 1172, 1260, 1348, 1444, 1548, 1656, 1764, 1872, 1976, 2084,
+  2192, 2296, 2404, 2512, 2616, 2724, 2820, 2920, 3020, 3120, 3216, 3316,
+  3408, 3500, 3588, 3680, 3760, 3852, 3936, 4020, 4112, 4196, 4284, 4376,
+  4468, 4552, 4636, 4728, 4816, 4896, 4988, 5088, 5192, 5292, 5384, 5472,
+  5548, 5624, 5720, 5820, 5924, 6016, 6092, 6172, 6256, 6344, 6436, 6524,
+  6624, 6724, 6820, 6916, 7016, 7116, 7208, 7304, 7396, 7500, 7604, 7700,
+  7800, 7896, 7988, 8088, 8188, 8288, 8392, 8488, 8584, 8684, 8784, 8884,
+  8984, 9084, 9184, 9284, 9384, 9484, 9584, 9684, 9780, 9868, 9948, 10024,
+  10108, 10192, 10276, 10352, 10404, 10424, 10444, 10464, 10480, 10496, 10508, 10524,
+  10544, 10564, 10584, 10604, 10616, 10636, 10656, 10676, 10692, 10712, 10732, 10748,
+  10768, 10784, 10804, 10824, 10844, 10864, 10884, 10900, 10920, 10940, 10960, 10980,
+  11000, 11020, 11040, 11060, 11080, 11100, 11120, 11140, 11160, 11180, 11200, 11220,
+  11240, 11260, 11280, 11300, 11320, 11340, 11360, 11376, 11380, 11380, 11380,
+};
+
+static const PSplashFBImage POKY_IMG_RGB565 = {
+  .rgbmode   = RGB565,
+  .bpp       = 16,
+  .width     = 427,
+  .height    = 214,
+  .pixels    = (const char *) POKY_IMG_RGB565_PIXELS,
+  .spans     = POKY_IMG_RGB565_SPANS,
+  .row_spans = POKY_IMG_RGB565_ROW_SPANS,
+};
+
+#endif
+
+#ifdef PSPLASH_IMG_NATIVE_BGR565
+
+static const uint16_t POKY_IMG_BGR565_PIXELS[] = {
+  0x8ef9, 0x7eb8, 0x86b8, 0x8ef9, 0xa71a, 0xb75c, 0x5e76, 0x4635,
+  0x5656, 0x5e56, 0x76b8, 0x86d9, 0xaf3b, 0x5e76, 0x4635, 0x5656,
+  0x6696, 0x86d9, 0xb75b, 0x5e76, 0x4635, 0x5656, 0x86b8, 0x5e76,
+  0x4635, 0x5e76, 0x9f1a, 0x5e76, 0x4635, 0x4e55, 0x8ef9, 0x5e76,
+  0x4635, 0x4e55, 0x8ef9, 0x5e76, 0x4635, 0x5e56, 0xa73a, 0x5e76,
+  0x4635, 0x6e97, 0x5e76, 0x4635, 0x5656, 0x96fa, 0x5e76, 0x4635,
+  0x6e97, 0x5e76, 0x4635, 0x5e56, 0x5e76, 0x4635, 0x5656, 0xaf3b,
+  0x5e76, 0x4635, 0x96fa, 0x5e76, 0x4635, 0x86b8, 0x5e76, 0x4635,
+  0x7eb8, 0x5e76, 0x4635, 0x7ed8, 0x5e76, 0x4635, 0x86d9, 0x5e76,
+  0x4635, 0x4636, 0xa71a, 0x5e76, 0x4635, 0x4e55, 0xb75b, 0x5e76,
+  0x4635, 0x5656, 0x5e76, 0x4635, 0x6e97, 0x5e76, 0x4635, 0x8ef9,
+  0x5e76, 0x4635, 0x4e55, 0x5e76, 0x4635, 0x6677, 0x5e76, 0x4635,
+  0x8ef9, 0x5e76, 0x4635, 0x5656, 0x5e76, 0x4635, 0x86b8, 0x5e76,
+  0x4635, 0x5656, 0x5e76, 0x4635, 0x7eb8, 0x5e76, 0x4635, 0x5656,
+  0x5e76, 0x4635, 0x86d9, 0x5e76, 0x4635, 0x4e55, 0x5e76, 0x4635,
+  0xa71a, 0x5e76, 0x4635, 0x5e76, 0x5e76, 0x4635, 0x5e76, 0x4635,
+  0x9f1a, 0x5e76, 0x4635, 0x6696, 0x5e76, 0x4635, 0x4e55, 0x5e76,
+  0x4635, 0xb75b, 0x5e76, 0x4635, 0x96f9, 0x5e76, 0x4635, 0x6677,
+  0x5e76, 0x4635, 0x5656, 0x5e76, 0x4635, 0x5e76, 0x4635, 0xaf3b,
+  0x5e76, 0x4635, 0x96fa, 0x5e76, 0x4635, 0x86d9, 0x5e76, 0x4635,
+  0x7ed8, 0x5e76, 0x4635, 0x76b8, 0x5e76, 0x4635, 0x6677, 0x5e76,
+  0x4635, 0x5e76, 0xad9f, 0x84be, 0x741e, 0x639e, 0x535e, 0x535e,
+  0x4b1e, 0x535e, 0x535e, 0x639e, 0x6c1e, 0x849f, 0xa59f, 0xb5ff,
+  0xe737, 0xe737, 0xe737, 0xdf16, 0xceb2, 0xc691, 0xd6b1, 0xced3,
+  0xd6f4, 0xdf16, 0x5e76, 0x4635, 0x5e56, 0xb5df, 0x7c5e, 0x535e,
+  0x42de, 0x3a7d, 0x325e, 0x3a5e, 0x3a7d, 0x42de, 0x535e, 0x741e,
+  0xaddf, 0xd6d3, 0xd6f4, 0xd6f5, 0xd6f5, 0xdf16, 0xdf16, 0xd6f5,
+  0xd6f4, 0xd6f3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xbe4e, 0xc66e,
+  0xc66f, 0xceb1, 0xd6f5, 0x6e97, 0x5656, 0x5656, 0x5e56, 0x5e56,
+  0x5e76, 0x6696, 0x6696, 0x6e97, 0x76b8, 0x6e97, 0x6696, 0x6696,
+  0x5e76, 0x5e56, 0x5e56, 0x5656, 0x5656, 0x5e56, 0x6677, 0x6e97,
+  0x76b9, 0x86bf, 0x86bf, 0x8edf, 0x96df, 0xa6ff, 0xa6ff, 0x96ff,
+  0x8edf, 0x86bf, 0x86bf, 0x849f, 0x535e, 0x3a9e, 0x325e, 0x3a9e,
+  0x535e, 0x7c5e, 0xd6d3, 0xd6f3, 0xd6f5, 0xdf16, 0xdf16, 0xd6f4,
+  0xd6f3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xc64d, 0xc66f, 0xceb1,
+  0xdf16, 0x76b8, 0x5e56, 0x5e76, 0x5e76, 0x6677, 0x76b8, 0x7eb8,
+  0x86b8, 0x86d9, 0x86b8, 0x7eb8, 0x76b8, 0x6696, 0x5e76, 0x5e76,
+  0x5e56, 0x5656, 0x4636, 0x4635, 0x5658, 0x5e5f, 0x665f, 0x6e7f,
+  0x86bf, 0x96df, 0xb73f, 0x9eff, 0x86bf, 0x769f, 0x665f, 0x5e5f,
+  0xa6ff, 0x84be, 0x535e, 0x3a7d, 0x325e, 0x4b1e, 0x849e, 0xd6d3,
+  0xd6f4, 0xdf16, 0xdf15, 0xd6f3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d,
+  0xbe4e, 0xc66f, 0xd6b1, 0xdf16, 0x76b8, 0x5e56, 0x5e76, 0x6677,
+  0x76b8, 0x7eb8, 0x86d9, 0x7eb8, 0x76b8, 0x6e97, 0x5e76, 0x5e56,
+  0x5656, 0x4636, 0x4635, 0x5658, 0x5e5f, 0x665f, 0x7ebf, 0x9eff,
+  0xa6ff, 0x86bf, 0x665f, 0x5e5f, 0xa6ff, 0x6bde, 0x3a7d, 0x325e,
+  0x3a5e, 0x639e, 0xaddf, 0xd6d3, 0xd6f5, 0xdf16, 0xd6f4, 0xd6d3,
+  0xced3, 0xc66f, 0xbe4d, 0xbe4e, 0xc66f, 0xd6f4, 0x76b8, 0x5e56,
+  0x5e76, 0x6e97, 0x76b8, 0x86b8, 0x86d9, 0x86b8, 0x76b8, 0x6677,
+  0x5e76, 0x5e56, 0x5656, 0x4636, 0x4635, 0x5658, 0x5e5f, 0x6e7f,
+  0x9eff, 0xa6ff, 0x7ebf, 0x5e5f, 0xa6ff, 0xb5df, 0x5b7e, 0x325e,
+  0x4b1e, 0x9d5f, 0xd6f3, 0xd6d3, 0xd6f4, 0xe737, 0xdf15, 0xd6d3,
+  0xced3, 0xc66f, 0xbe4d, 0xbe4e, 0xced3, 0x7eb8, 0x5e56, 0x5e76,
+  0x76b8, 0x7ed8, 0x86d9, 0x86b8, 0x6e97, 0x5e76, 0x5e56, 0x5656,
+  0x4636, 0x4635, 0x5e59, 0x5e5f, 0x86bf, 0xb73f, 0x8edf, 0x665f,
+  0x5e5f, 0xa6ff, 0x5b5e, 0x325e, 0x4ade, 0xaddf, 0xd6f3, 0xd6d3,
+  0xd6f4, 0xe737, 0xd6f5, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xc64e,
+  0xced3, 0x7eb8, 0x5e56, 0x6e97, 0x7ed8, 0x86d9, 0x7eb8, 0x6e97,
+  0x5e56, 0x5656, 0x4636, 0x4635, 0x6679, 0x665e, 0x5e5f, 0x6e7f,
+  0xaf1f, 0x7ebf, 0x5e5f, 0xa6ff, 0x639e, 0x325e, 0x5b5e, 0xd6f4,
+  0xd6d3, 0xced3, 0xceb2, 0xced3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d,
+  0xbe4e, 0xd6f4, 0x86d9, 0x5e56, 0x6e97, 0x7ed8, 0x7ed8, 0x6e97,
+  0x5e56, 0x5656, 0x4636, 0x4635, 0x6e9a, 0x665e, 0x5e5f, 0x665f,
+  0xaf1f, 0x6e7f, 0x5e5f, 0xa6ff, 0x8cde, 0x3a9e, 0x325e, 0x327d,
+  0x7c5e, 0xd6f5, 0xd6d3, 0xced3, 0xc691, 0xc66f, 0xc66f, 0xc66f,
+  0xd6b1, 0xced3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xc66f, 0x86d9,
+  0x5e56, 0x5656, 0x5656, 0x5656, 0x5e56, 0x5656, 0x4636, 0x4635,
+  0x86bb, 0x665e, 0x5e5f, 0x6e7f, 0x86bf, 0x5e5f, 0xa6ff, 0x535e,
+  0x325e, 0x4b1e, 0xdf16, 0xd6d3, 0xced3, 0xceb2, 0xc66f, 0xce6f,
+  0xc691, 0xced3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xbe4f, 0xced3,
+  0x8ef9, 0x5e56, 0x5656, 0x4e55, 0x4635, 0x4635, 0x4e55, 0x5656,
+  0x5e56, 0x5656, 0x4636, 0x4635, 0xa71d, 0x665e, 0x5e5f, 0x665f,
+  0x8edf, 0xa6ff, 0x665f, 0x5e5f, 0xa6ff, 0x9d3e, 0x42de, 0x325e,
+  0x3a9e, 0x8cde, 0xd6d3, 0xced3, 0xc691, 0xc66f, 0xceb1, 0xd6d3,
+  0xced3, 0xc66f, 0xbe4d, 0xce6f, 0x96f9, 0x5e56, 0x5656, 0x5656,
+  0x4635, 0x4e55, 0x5656, 0x5e56, 0x5656, 0x4636, 0x4635, 0x5656,
+  0x665e, 0x5e5f, 0x6e7f, 0x86bf, 0x5e5f, 0xa6ff, 0x845e, 0x325e,
+  0x6bde, 0xd6f4, 0xd6d3, 0xced3, 0xc691, 0xc66f, 0xce6f, 0xc691,
+  0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xc66f, 0xdf16, 0x96fa, 0x5e76,
+  0x5e56, 0x5656, 0x5656, 0x4635, 0x5656, 0x5656, 0x5e56, 0x5656,
+  0x4636, 0x4635, 0x6696, 0x665e, 0x5e5f, 0x665f, 0x9eff, 0xaf3f,
+  0x665f, 0x5e5f, 0xa6ff, 0x639e, 0x325e, 0x4b1e, 0xd6f4, 0xd6d3,
+  0xced3, 0xc66f, 0xc691, 0xced3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d,
+  0xc64e, 0xd6f4, 0x9f1a, 0x6696, 0x5e56, 0x5656, 0x4635, 0x4636,
+  0x5656, 0x5e56, 0x5656, 0x4636, 0x4635, 0x8ef9, 0x665e, 0x5e5f,
+  0x86bf, 0x96df, 0x5e5f, 0xa6ff, 0x4b1e, 0x325e, 0x42de, 0xdf15,
+  0xd6d3, 0xced2, 0xc66f, 0xc690, 0xced3, 0xd6d3, 0xced3, 0xc66f,
+  0xbe4d, 0xceb2, 0x9f1a, 0x6e97, 0x5e56, 0x4e55, 0x4635, 0x5656,
+  0x5e56, 0x5656, 0x4636, 0x4635, 0xb75b, 0x665e, 0x5e5f, 0x6e7f,
+  0x7ebf, 0x5e5f, 0xa6ff, 0x4ade, 0x325e, 0x3a9e, 0xb5df, 0xd6d3,
+  0xceb1, 0xce6f, 0xc66f, 0xced3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d,
+  0xc691, 0x9f1a, 0x7eb8, 0x5e56, 0x5656, 0x4e55, 0x4635, 0x5656,
+  0x5656, 0x5e56, 0x5656, 0x4636, 0x4635, 0x5656, 0x665e, 0x5e5f,
+  0x665f, 0x6e7f, 0x5e5f, 0xa6ff, 0x42de, 0x325e, 0x3a7d, 0xaddf,
+  0xd6f3, 0xd6d3, 0xceb1, 0xce6f, 0xc66f, 0xced3, 0xd6d3, 0xced3,
+  0xc66f, 0xbe4d, 0xc691, 0x9f1a, 0x86b8, 0x5e76, 0x5e56, 0x4e55,
+  0x4635, 0x5656, 0x5e56, 0x5656, 0x4636, 0x4635, 0x5e56, 0x665e,
+  0x5e5f, 0xb73f, 0x665f, 0x5e5f, 0xa6ff, 0x3a9e, 0x325e, 0x3a9e,
+  0xaddf, 0xd6f5, 0xd6d3, 0xceb1, 0xc66e, 0xc66f, 0xced3, 0xd6d3,
+  0xced3, 0xc66f, 0xbe4d, 0xc690, 0x9f1a, 0x86d9, 0x6e97, 0x5e56,
+  0x4e55, 0x4635, 0x4e55, 0x5e56, 0x5656, 0x4636, 0x4635, 0x96fa,
+  0x665e, 0x5e5f, 0xaf3f, 0x665f, 0x5e5f, 0xa6ff, 0x42de, 0x325e,
+  0x42de, 0xd6d3, 0xceb2, 0xc66f, 0xc690, 0xced3, 0xd6d3, 0xced3,
+  0xc66f, 0xbe4d, 0xd6b1, 0x9f1a, 0x86d9, 0x76b8, 0x5e56, 0x5656,
+  0x4e55, 0x4635, 0x5656, 0x5e56, 0x5656, 0x4636, 0x4635, 0x5656,
+  0x665e, 0x5e5f, 0xb73f, 0x6e7f, 0x5e5f, 0xa6ff, 0x535e, 0x325e,
+  0x4b1e, 0xd6f4, 0xd6d3, 0xced3, 0xc66f, 0xc691, 0xced3, 0xd6d3,
+  0xced3, 0xc66f, 0xbe4d, 0xced3, 0x9f1a, 0x86d9, 0x86d9, 0x5e56,
+  0x4e55, 0x4635, 0x5656, 0x5e56, 0x5656, 0x4636, 0x4635, 0x5e76,
+  0x665e, 0x5e5f, 0x665f, 0x6e7f, 0x5e5f, 0xa6ff, 0x6bde, 0x325e,
+  0x535e, 0xdf16, 0xd6d3, 0xced3, 0xce6f, 0xc66f, 0xc691, 0xced3,
+  0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xd6f5, 0x9f1a, 0x86d9, 0x86d9,
+  0x6e97, 0x5e56, 0x5656, 0x4635, 0x4e55, 0x5e56, 0x5656, 0x4636,
+  0x4635, 0x9f1a, 0x665e, 0x5e5f, 0x665f, 0x769f, 0x5e5f, 0xa6ff,
+  0x8cde, 0x325e, 0x6bde, 0xd6d3, 0xced3, 0xc691, 0xc66f, 0xceb1,
+  0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xc64e, 0x9f1a, 0x86d9, 0x86d9,
+  0x7eb8, 0x5e56, 0x5655, 0x4635, 0x5656, 0x5e56, 0x5656, 0x4636,
+  0x4635, 0x5656, 0x665e, 0x5e5f, 0x6e7f, 0x86bf, 0x5e5f, 0xa6ff,
+  0x3a7d, 0x325e, 0x9d3e, 0xd6f5, 0xd6d3, 0xc691, 0xc66f, 0xced3,
+  0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xc66f, 0x9f1a, 0x86d9, 0x86d9,
+  0x86d9, 0x5e76, 0x5e56, 0x5656, 0x4635, 0x5656, 0x5e56, 0x5656,
+  0x4636, 0x4635, 0x7eb8, 0x665e, 0x5e5f, 0x86bf, 0x9eff, 0x5e5f,
+  0xa6ff, 0x4b1e, 0x325e, 0x3a7d, 0xd6d3, 0xd6d3, 0xd6d3, 0xced3,
+  0xce6f, 0xc66f, 0xc691, 0xced3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d,
+  0xceb1, 0x9f1a, 0x86d9, 0x86d9, 0x86d9, 0x76b8, 0x5e56, 0x5656,
+  0x4e55, 0x4635, 0x4e55, 0x5e56, 0x5656, 0x4636, 0x4635, 0x4e55,
+  0x665e, 0x5e5f, 0x9eff, 0x5e5f, 0xa6ff, 0x7c5e, 0x325e, 0x5b5e,
+  0xd6f4, 0xd6d3, 0xced3, 0xc66f, 0xc691, 0xd6d3, 0xced3, 0xc66f,
+  0xbe4d, 0xbe4e, 0xdf16, 0x9f1a, 0x86d9, 0x5e76, 0x5e56, 0x5e56,
+  0x5e56, 0x4e55, 0x4635, 0x4e55, 0x5e56, 0x5656, 0x4636, 0x4635,
+  0x6677, 0x665e, 0x5e5f, 0x665f, 0x665f, 0x5e5f, 0xa6ff, 0xb5df,
+  0x3a7d, 0x325e, 0x9d3e, 0xd6d3, 0xc691, 0xc66f, 0xce6f, 0xced3,
+  0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xc66f, 0x9f1a, 0x86d9, 0x6e97,
+  0x5e56, 0x5e56, 0x5656, 0x4635, 0x5656, 0x5e56, 0x5656, 0x4636,
+  0x4635, 0xb75b, 0x665e, 0x5e5f, 0x665f, 0x8edf, 0x5e5f, 0xa6ff,
+  0x4b1e, 0x325e, 0x3a9e, 0xd6f3, 0xc66f, 0xce6f, 0xd6d3, 0xced3,
+  0xc66f, 0xbe4d, 0xceb1, 0x9f1a, 0x86d9, 0x86b8, 0x5e76, 0x5656,
+  0x4635, 0x5656, 0x5656, 0x5e56, 0x5656, 0x4636, 0x4635, 0x6e97,
+  0x665e, 0x5e5f, 0x8edf, 0xb73f, 0x5e5f, 0xa6ff, 0x8cde, 0x325e,
+  0x741e, 0xd6f4, 0xc66f, 0xd6b1, 0xd6d3, 0xced3, 0xc66f, 0xbe4d,
+  0xbe4e, 0x9f1a, 0x86d9, 0x76b8, 0x5656, 0x4635, 0x4e55, 0x5e56,
+  0x5656, 0x4636, 0x4635, 0x4e55, 0x665e, 0x5e5f, 0x6e7f, 0x5e5f,
+  0xa6ff, 0x42de, 0x325e, 0x3a7d, 0xd6d3, 0xc691, 0xc66f, 0xced3,
+  0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xc66f, 0x9f1a, 0x86d9, 0x7eb8,
+  0x4e55, 0x4635, 0x5656, 0x5e56, 0x5656, 0x4636, 0x4635, 0x7eb8,
+  0x665e, 0x5e5f, 0x769f, 0x9eff, 0x5e5f, 0xa6ff, 0x7c5e, 0x325e,
+  0x6bde, 0xdf16, 0xd6d3, 0xced3, 0xce6f, 0xc66f, 0xceb1, 0xd6d3,
+  0xced3, 0xc66f, 0xbe4d, 0x9f1a, 0x86d9, 0x6677, 0x5656, 0x4635,
+  0x4e55, 0x5e56, 0x5656, 0x4636, 0x4635, 0x5656, 0x665e, 0x5e5f,
+  0x665f, 0x5e5f, 0xa6ff, 0x3a9e, 0x325e, 0x3a7d, 0xd6f3, 0xd6d3,
+  0xd6d3, 0xc691, 0xc66f, 0xced3, 0xd6d3, 0xd6d3, 0xd6d3, 0xced3,
+  0xc66f, 0xbe4d, 0xc66f, 0x9f1a, 0x86d9, 0x7eb8, 0x5e56, 0x5e56,
+  0x4e55, 0x4635, 0x5656, 0x5e56, 0x5656, 0x4636, 0x4635, 0xa71a,
+  0x665e, 0x5e5f, 0x769f, 0x96ff, 0x5e5f, 0xa6ff, 0x84be, 0x325e,
+  0x6bde, 0xdf16, 0xd6d3, 0xd6d3, 0xd6d3, 0xced3, 0xc66f, 0xceb1,
+  0xd6d3, 0xd6d3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0x9f1a, 0x86d9,
+  0x6696, 0x5e56, 0x5e56, 0x5656, 0x4635, 0x4e55, 0x5e56, 0x5656,
+  0x4636, 0x4635, 0x6677, 0x665e, 0x5e5f, 0xb73f, 0x665f, 0x5e5f,
+  0xa6ff, 0x429e, 0x325e, 0x3a7d, 0xd6f3, 0xd6d3, 0xced3, 0xce6f,
+  0xc66f, 0xce70, 0xced3, 0xd6d3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d,
+  0xc691, 0x9f1a, 0x86d9, 0x86d9, 0x86d9, 0x7eb8, 0x5e56, 0x5656,
+  0x4635, 0x5656, 0x5e56, 0x5e56, 0x5e56, 0x5656, 0x4636, 0x4635,
+  0x5656, 0x665e, 0x5e5f, 0x769f, 0x96df, 0x5e5f, 0xa6ff, 0x9d5f,
+  0x325e, 0x845e, 0xd6d3, 0xceb1, 0xce6f, 0xc66f, 0xceb1, 0xd6d3,
+  0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0x9f1a, 0x86d9, 0x86d9, 0x86d9,
+  0x6e97, 0x5e56, 0x4e55, 0x4635, 0x4e55, 0x5e56, 0x5e56, 0x5e56,
+  0x5656, 0x4636, 0x4635, 0xa73a, 0x665e, 0x5e5f, 0x665f, 0x5e5f,
+  0xa6ff, 0x4b1e, 0x325e, 0x4ade, 0xd6f5, 0xd6d3, 0xceb1, 0xc66f,
+  0xc691, 0xd6d3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xd6f4, 0x9f1a,
+  0x86d9, 0x86d9, 0x86b8, 0x5e56, 0x5656, 0x4635, 0x5656, 0x5e56,
+  0x5e56, 0x5656, 0x4636, 0x4635, 0x86d9, 0x665e, 0x5e5f, 0x8edf,
+  0xa6ff, 0x5e5f, 0xa6ff, 0x325e, 0xaddf, 0xd6d3, 0xc691, 0xc66f,
+  0xced3, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xc66f, 0x9f1a, 0x86d9,
+  0x86d9, 0x76b8, 0x5e56, 0x5656, 0x4635, 0x5656, 0x5e56, 0x5e56,
+  0x5656, 0x4636, 0x4635, 0x6e97, 0x665e, 0x5e5f, 0x665f, 0x769f,
+  0x5e5f, 0xa6ff, 0x84be, 0x325e, 0x63be, 0xdf16, 0xd6d3, 0xced3,
+  0xc691, 0xc66f, 0xceb1, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0x9f1a,
+  0x86d9, 0x86d9, 0x6696, 0x5e56, 0x5656, 0x4635, 0x5656, 0x5e56,
+  0x5e56, 0x5656, 0x4636, 0x4635, 0x6696, 0x665e, 0x5e5f, 0x9eff,
+  0x5e5f, 0xa6ff, 0x4b1e, 0x325e, 0x429e, 0xd6f4, 0xd6d3, 0xced3,
+  0xc691, 0xc66f, 0xc690, 0xd6d3, 0xced3, 0xc66f, 0xbe4d, 0xd6d3,
+  0x9f1a, 0x86d9, 0x7eb8, 0x5e56, 0x5656, 0x4635, 0x5656, 0x5e56,
+  0x5656, 0x4636, 0x4635, 0x5e56, 0x665e, 0x5e5f, 0x769f, 0x8edf,
+  0x5e5f, 0xa6ff, 0x325e, 0xaddf, 0xd6d3, 0xced3, 0xc691, 0xc66f,
+  0xced3, 0xced3, 0xc66f, 0xbe4d, 0xc66f, 0x9f1a, 0x86d9, 0x76b8,
+  0x5e56, 0x5656, 0x4635, 0x4e55, 0x5e56, 0x5656, 0x4636, 0x4635,
+  0x5e56, 0x665e, 0x5e5f, 0x665f, 0x665f, 0x5e5f, 0xa6ff, 0x9d1f,
+  0x325e, 0x741e, 0xdf16, 0xd6d3, 0xced3, 0xc691, 0xc66f, 0xceb2,
+  0xced3, 0xc66f, 0xbe4d, 0x9f1a, 0x86b8, 0x6696, 0x5e56, 0x5656,
+  0x4636, 0x4635, 0x4e55, 0x5e56, 0x5656, 0x4636, 0x4635, 0x5e56,
+  0x665e, 0x5e5f, 0xa6ff, 0x665e, 0x5e5f, 0xa6ff, 0x6bde, 0x325e,
+  0x42de, 0xd6f5, 0xd6d3, 0xced3, 0xc691, 0xc66f, 0xc691, 0xced3,
+  0xc66f, 0xbe4d, 0xd6f5, 0x9f1a, 0x7eb8, 0x5e56, 0x5656, 0x4635,
+  0x5656, 0x5656, 0x4636, 0x4635, 0x5e76, 0x665e, 0x5e5f, 0x86bf,
+  0xa6ff, 0x5e5f, 0xa6ff, 0x42de, 0x325e, 0x3a7d, 0xd6f4, 0xd6d3,
+  0xc691, 0xce6f, 0xc66f, 0xced3, 0xc66f, 0xbe4d, 0xceb2, 0x9f1a,
+  0x76b8, 0x5e56, 0x5656, 0x4635, 0x5656, 0x5656, 0x4636, 0x4635,
+  0x6696, 0x665e, 0x5e5f, 0x665f, 0x769f, 0x5e5f, 0xa6ff, 0x325e,
+  0xad9f, 0xd6d3, 0xceb2, 0xce6f, 0xc66f, 0xced3, 0xc66f, 0xbe4d,
+  0xc66f, 0x9f1a, 0x6e97, 0x5e56, 0x5656, 0x4e55, 0x4635, 0x4e55,
+  0x5656, 0x4636, 0x4635, 0x76b8, 0x665e, 0x5e5f, 0x665e, 0x665f,
+  0x5e5f, 0xa6ff, 0x9d5f, 0x325e, 0x8cde, 0xd6d3, 0xced3, 0xc691,
+  0xc66f, 0xce6f, 0xceb1, 0xc66f, 0xbe4d, 0xc64e, 0x96fa, 0x5e76,
+  0x5e56, 0x4e55, 0x4635, 0x5656, 0x4636, 0x4635, 0x8ef9, 0x665e,
+  0x5e5f, 0xa6ff, 0x5e5f, 0xa6ff, 0x845e, 0x325e, 0x639e, 0xd6f5,
+  0xd6d3, 0xced3, 0xceb1, 0xc66f, 0xc691, 0xc66f, 0xbe4d, 0xbe4e,
+  0x96fa, 0x5e56, 0x5656, 0x4635, 0x5656, 0x4636, 0x4635, 0x5e56,
+  0x665e, 0x5e5f, 0x86bf, 0xaf1f, 0x5e5f, 0xa6ff, 0x6bde, 0x325e,
+  0x429e, 0xd6f4, 0xd6d3, 0xced3, 0xc691, 0xc66f, 0xc691, 0xc66f,
+  0xbe4d, 0xced3, 0x96f9, 0x5e56, 0x5656, 0x4e55, 0x4635, 0x5656,
+  0x4636, 0x4635, 0x4e55, 0x86d9, 0x665e, 0x5e5f, 0x769f, 0x96df,
+  0x5e5f, 0xa6ff, 0x535e, 0x325e, 0xd6f3, 0xd6d3, 0xced2, 0xc691,
+  0xc66f, 0xbe4d, 0xc6b2, 0x86d9, 0x5e56, 0x4e55, 0x5656, 0x4635,
+  0x5656, 0x4636, 0x4635, 0x6677, 0xb75c, 0x665e, 0x5e5f, 0x665f,
+  0x6e7f, 0x5e5f, 0xa6ff, 0x42de, 0x325e, 0x3a7d, 0x3a9e, 0x3a7d,
+  0x325e, 0xd6f3, 0xd6d3, 0xced3, 0xceb1, 0xce70, 0xce6f, 0xc66f,
+  0xce6f, 0xc691, 0xce70, 0xbe4e, 0xbe4d, 0xc690, 0x86d9, 0x5e56,
+  0x5656, 0x4e55, 0x4635, 0x5656, 0x4636, 0x4635, 0x5e56, 0x9f1a,
+  0x665e, 0x5e5f, 0x665f, 0x665f, 0x5e5f, 0xa6ff, 0x3a9e, 0x325e,
+  0x42de, 0x849f, 0x9d1f, 0x4ade, 0x325e, 0xadbb, 0xd6f3, 0xd6d3,
+  0xced3, 0xceb2, 0xc691, 0xc66f, 0xce6f, 0xced2, 0xd6f3, 0xc66e,
+  0xc64d, 0xbe4d, 0xc66f, 0x7eb7, 0x5e56, 0x5656, 0x4e55, 0x4635,
+  0x4636, 0x5656, 0x5656, 0x4636, 0x4635, 0x5656, 0x86d9, 0x665e,
+  0x5e5f, 0x665f, 0x665f, 0x5e5f, 0xa6ff, 0x327d, 0x325e, 0x42de,
+  0x5b7e, 0x325e, 0x9d39, 0xd6d3, 0xced3, 0xced2, 0xc691, 0xc66f,
+  0xd6f4, 0xc66f, 0xbe4d, 0xc66f, 0x7e96, 0x5e56, 0x5656, 0x4e55,
+  0x4635, 0x4636, 0x76b8, 0xb75b, 0x6e97, 0x4635, 0x4e55, 0x5e56,
+  0x8ef9, 0x665e, 0x5e5f, 0x665f, 0x9eff, 0xaf1f, 0x6e7f, 0x5e5f,
+  0xa6ff, 0x325e, 0x3a7d, 0x3a9e, 0x325e, 0x8cf8, 0xd6d3, 0xced3,
+  0xceb1, 0xc691, 0xce6f, 0xc66f, 0xceb2, 0xe737, 0xbe4d, 0xbe4f,
+  0x7675, 0x5e56, 0x5656, 0x4e55, 0x4636, 0x4635, 0x9f1a, 0x8ef9,
+  0x4635, 0x5e76, 0xa71a, 0x665e, 0x5e5f, 0x6e7f, 0x769f, 0x5e5f,
+  0xa6ff, 0x325e, 0x5b7e, 0x849f, 0x325e, 0x8cf8, 0xd6d3, 0xced3,
+  0xceb2, 0xc691, 0xc66f, 0xce6f, 0xc66f, 0xc691, 0xbe4d, 0xbe4e,
+  0x6e75, 0x5e56, 0x5656, 0x5656, 0x4635, 0x86d9, 0x7eb8, 0x4635,
+  0x5e56, 0x96fa, 0x665e, 0x5e5f, 0x6e7f, 0x5e5f, 0xa6ff, 0x325e,
+  0x8cde, 0xad9f, 0x325e, 0x8cf8, 0xd6d3, 0xced3, 0xced3, 0xceb1,
+  0xc691, 0xc691, 0xc66f, 0xced3, 0xbe4d, 0xbe4e, 0x6e75, 0x5e56,
+  0x5656, 0x5656, 0x5656, 0x4636, 0x4635, 0x4e55, 0x4635, 0x5656,
+  0x7eb8, 0xa73a, 0x665e, 0x5e5f, 0x86bf, 0x9eff, 0x5e5f, 0xa6ff,
+  0x429e, 0x429e, 0x42de, 0x42de, 0x4ade, 0x4b1e, 0x4b1e, 0x535e,
+  0x5b7e, 0x639e, 0x5b5e, 0x533e, 0x4b1e, 0xad9f, 0xaddf, 0x325e,
+  0x84b5, 0xc66e, 0xc66f, 0xc66f, 0xc66f, 0xced3, 0xbe4d, 0xbe4e,
+  0x6e75, 0x5e56, 0x5656, 0x5656, 0x5656, 0x4e55, 0x5656, 0x4e55,
+  0x5e76, 0x5e56, 0x6696, 0x7eb8, 0x96fa, 0xaf3b, 0x665e, 0x5e5f,
+  0xa6ff, 0x5e5f, 0xa6ff, 0x42de, 0x4ade, 0x535e, 0x639e, 0x6bde,
+  0x6c1e, 0x741e, 0x6c1e, 0x6bde, 0x639e, 0x535e, 0x4b1e, 0x4ade,
+  0x42de, 0x42de, 0x42de, 0x849f, 0x9d1f, 0x325e, 0x84b5, 0xbe4d,
+  0xceb1, 0xbe4d, 0xbe4e, 0x6654, 0x4e55, 0x5656, 0x6696, 0x96fa,
+  0xb75b, 0x665e, 0x5e5f, 0xa6ff, 0x665f, 0xb73f, 0x42de, 0x4b1e,
+  0x535e, 0x639e, 0x6bde, 0x741e, 0x6c1e, 0x6bde, 0x5b5e, 0x4b1e,
+  0x42de, 0x535e, 0x5b5e, 0x325e, 0x84b5, 0xbe4d, 0xced3, 0xc66f,
+  0xbe4d, 0xbe4e, 0x6654, 0x4635, 0x5e56, 0x4635, 0x4635, 0x4e55,
+  0x5656, 0x6696, 0x7eb8, 0xa71a, 0x5e5f, 0x96ff, 0xb73f, 0x5e5f,
+  0x665f, 0x665f, 0x665f, 0x6e7f, 0xb73f, 0x42de, 0x4b1e, 0x535e,
+  0x63be, 0x6c1e, 0x741e, 0x6c1e, 0x6bde, 0x5b7e, 0x4b1e, 0x42de,
+  0x849f, 0x951e, 0x325e, 0x8cd6, 0xbe4d, 0xbe4f, 0xceb1, 0xbe4d,
+  0xbe4e, 0x5e55, 0x4635, 0x4e55, 0xb75b, 0xa71a, 0x4635, 0x4e55,
+  0x5e76, 0x7ed8, 0xaf3b, 0x5e5f, 0x6e7f, 0x86bf, 0x5e5f, 0x665f,
+  0x665f, 0x665f, 0x6e7f, 0x42de, 0x4b1e, 0x639e, 0x6bde, 0x741e,
+  0x6c1e, 0x639e, 0x4b1e, 0x42de, 0x849e, 0x849e, 0x3a7d, 0x325e,
+  0x9537, 0xbe4d, 0xc66f, 0xdf16, 0xd6b1, 0xbe4d, 0xbe4e, 0x6656,
+  0x4635, 0x5e76, 0x5656, 0x4635, 0x5656, 0x7eb8, 0xb75b, 0x665f,
+  0x5e5f, 0x96ff, 0xaf1f, 0x665f, 0x5e5f, 0x665f, 0x665f, 0x6e7f,
+  0x4ade, 0x42de, 0x5b7e, 0x6bde, 0x741e, 0x741e, 0x741e, 0x6c1e,
+  0x639e, 0x4b1e, 0x42de, 0x4b1e, 0x741e, 0x849f, 0x6bde, 0x3ade,
+  0x325e, 0xb5d8, 0xbe4d, 0xc66f, 0xced3, 0xd6f4, 0xceb1, 0xc64e,
+  0xbe4d, 0xb66f, 0x6656, 0x4635, 0x6696, 0xb75c, 0x5e56, 0x4635,
+  0x4636, 0x5e56, 0x96fa, 0x665f, 0x5e5f, 0x96df, 0xa6ff, 0x665f,
+  0x5e5f, 0x665f, 0x6e7f, 0x4b1e, 0x42de, 0x5b7e, 0x6c1e, 0x63be,
+  0x4b1e, 0x42de, 0x3a9e, 0x325e, 0xbe4e, 0xbe4d, 0xbe70, 0x5e76,
+  0x4635, 0x6696, 0x9f19, 0x8ef9, 0x6696, 0x4635, 0x5656, 0x86d9,
+  0x665f, 0x5e5f, 0x665f, 0x86bf, 0xa6ff, 0x96df, 0x665f, 0x5e5f,
+  0x665f, 0x6e7f, 0x4b1e, 0x42de, 0x3ade, 0x3a9e, 0x3a9e, 0x42de,
+  0x3a9e, 0x325e, 0x3a7d, 0xbe6e, 0xbe4d, 0xbe92, 0x5e76, 0x4635,
+  0x6696, 0x5656, 0x4635, 0x5656, 0x8ef9, 0x6e7f, 0x5e5f, 0x665f,
+  0x5e5f, 0x665e, 0x665f, 0x6e7f, 0x535e, 0x42de, 0x3a7d, 0x325e,
+  0x325e, 0x325e, 0x3a5e, 0x3a9e, 0x42de, 0x3a9e, 0x325e, 0x4b1e,
+  0xc66f, 0xbe4d, 0xc6f4, 0x5e76, 0x4635, 0x76b8, 0x5656, 0x4635,
+  0x5655, 0xa73a, 0x7ebf, 0x5e5f, 0x665f, 0x5e5f, 0x665f, 0x6e7f,
+  0x769f, 0x639e, 0x42de, 0x3a9e, 0x327d, 0x325e, 0x3a9e, 0x42de,
+  0x3a9e, 0x325e, 0x7c5e, 0xc691, 0xbe4d, 0x5e76, 0x4635, 0x96fa,
+  0x5656, 0x4635, 0x6e97, 0x96ff, 0x5e5f, 0x665f, 0x665f, 0x5e5f,
+  0x665f, 0x6e7f, 0x6bde, 0x42de, 0x3a9e, 0x325e, 0x3a5e, 0x429e,
+  0x42de, 0x3a9e, 0x325e, 0x9d5f, 0xd6f3, 0xbe4d, 0xc66e, 0x5e76,
+  0x4635, 0x4e55, 0xb75c, 0x5656, 0x4635, 0x5656, 0x96fa, 0x5e5f,
+  0x665f, 0x665f, 0x5e5f, 0x665e, 0x665f, 0x6e7f, 0x7ebf, 0x6bde,
+  0x42de, 0x3ade, 0x3a7d, 0x325e, 0x3a9e, 0x42de, 0x3a9e, 0x325e,
+  0xbe4d, 0xc691, 0x5e76, 0x4635, 0x5e56, 0x5656, 0x4635, 0x4636,
+  0x76b8, 0x5e5f, 0x665f, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x86bf,
+  0x741e, 0x4b1e, 0x42de, 0x3a9e, 0x327d, 0x325e, 0x3a9e, 0x42de,
+  0x3a9e, 0x325e, 0x3a9e, 0xc66e, 0xbe4d, 0xd6d3, 0x5e76, 0x4635,
+  0x7eb8, 0x5656, 0x4635, 0x5e56, 0x6e7f, 0x5e5f, 0x665f, 0x665f,
+  0x5e5f, 0x665f, 0x6e7f, 0x8edf, 0x741e, 0x5b5e, 0x42de, 0x3a9e,
+  0x325e, 0x3a9e, 0x42de, 0x3a9e, 0x325e, 0x5b5e, 0xce6f, 0xbe4d,
+  0xe737, 0x5e76, 0x4635, 0xa71a, 0x5656, 0x4635, 0x5656, 0xaf3b,
+  0x7ebf, 0x5e5f, 0x665f, 0x6e7f, 0x5e5f, 0x665f, 0x6e7f, 0x8edf,
+  0x741e, 0x63be, 0x42de, 0x3a9e, 0x325e, 0x3a9e, 0x42de, 0x3a9e,
+  0x325e, 0x9d3e, 0xced3, 0xbe4d, 0xbe4f, 0x5e76, 0x4635, 0x5656,
+  0x4635, 0x9f1a, 0x9eff, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f,
+  0x665f, 0x6e7f, 0x769f, 0x96df, 0x741e, 0x6c1e, 0x42de, 0x429e,
+  0x325e, 0x3a9e, 0x42de, 0x3a9e, 0x325e, 0x3a7d, 0xbe4d, 0xc691,
+  0x5e76, 0x4635, 0x5656, 0x5656, 0x4635, 0x8ef9, 0x665e, 0x5e5f,
+  0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x665f, 0x6e7f, 0x86bf,
+  0x96ff, 0x741e, 0x741e, 0x535e, 0x42de, 0x3a9e, 0x325e, 0x3a9e,
+  0x42de, 0x3a9e, 0x325e, 0x4b1e, 0xce6f, 0xbe4d, 0xdf16, 0x5e76,
+  0x4635, 0x7ed8, 0x5656, 0x4635, 0x86b8, 0x769f, 0x5e5f, 0x665f,
+  0x6e7f, 0x6e7f, 0x5e5f, 0x665f, 0x665f, 0x6e7f, 0x8edf, 0x96ff,
+  0x741e, 0x741e, 0x63be, 0x42de, 0x3ade, 0x325e, 0x3a9e, 0x42de,
+  0x3a9e, 0x325e, 0x951e, 0xced3, 0xbe4d, 0xc64e, 0x5e76, 0x4635,
+  0xaf3b, 0x5656, 0x4635, 0x86d9, 0x96df, 0x5e5f, 0x665f, 0x6e7f,
+  0x6e7f, 0x5e5f, 0x665f, 0x6e7f, 0x769f, 0x96df, 0x96ff, 0x741e,
+  0x741e, 0x741e, 0x4ade, 0x42de, 0x325e, 0x3a9e, 0x42de, 0x3a9e,
+  0x325e, 0x3a9e, 0xc64e, 0xbe4d, 0xceb1, 0x5e76, 0x4635, 0x5656,
+  0x5656, 0x4635, 0x4636, 0x96fa, 0x5e5f, 0x665f, 0x6e7f, 0x6e7f,
+  0x665f, 0x5e5f, 0x665f, 0x665f, 0x6e7f, 0x86bf, 0x96ff, 0x96ff,
+  0x741e, 0x741e, 0x741e, 0x5b5e, 0x42de, 0x3a7d, 0x325e, 0x3a9e,
+  0x42de, 0x3a9e, 0x325e, 0x639e, 0xc691, 0xbe4d, 0x5e76, 0x4635,
+  0x86b8, 0x5656, 0x4635, 0x4e55, 0xaf3b, 0x769f, 0x5e5f, 0x665f,
+  0x6e7f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x8edf, 0x96ff,
+  0x96ff, 0x741e, 0x741e, 0x741e, 0x6bde, 0x42de, 0x3a9e, 0x325e,
+  0x429e, 0x42de, 0x3a9e, 0x325e, 0xaddf, 0xdf16, 0xbe4d, 0xc66e,
+  0x5e76, 0x4635, 0x5656, 0x4635, 0x5656, 0xa6ff, 0x5e5f, 0x665f,
+  0x6e7f, 0x6e7f, 0x6e7f, 0x665f, 0x5e5f, 0x6e7f, 0x769f, 0x96df,
+  0x96ff, 0x96ff, 0x741e, 0x4b1e, 0x42de, 0x3a9e, 0x325e, 0x3a7d,
+  0x42de, 0x3a9e, 0x325e, 0x4b1e, 0xc66f, 0xbe4d, 0xd6f5, 0x5e76,
+  0x4635, 0x5e76, 0x5656, 0x4635, 0x5e56, 0x665f, 0x5e5f, 0x665f,
+  0x6e7f, 0x6e7f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x86bf,
+  0x96ff, 0x96ff, 0x96ff, 0x741e, 0x63be, 0x42de, 0x42de, 0x42de,
+  0x429e, 0x325e, 0x3a9e, 0x42de, 0x3a9e, 0x325e, 0x951e, 0xd6f3,
+  0xbe4d, 0xbe4e, 0x5e76, 0x4635, 0xa71b, 0x5656, 0x4635, 0x76b8,
+  0x8edf, 0x5e5f, 0x665f, 0x6e7f, 0x665e, 0x5e5f, 0x665f, 0x6e7f,
+  0x96df, 0x96ff, 0x96ff, 0x96ff, 0x741e, 0x4b1e, 0x42de, 0x42de,
+  0x3a7d, 0x325e, 0x429e, 0x42de, 0x3a9e, 0x325e, 0x4b1e, 0xc66f,
+  0xbe4d, 0xd6f3, 0x5e76, 0x4635, 0x5e56, 0x5656, 0x4635, 0x9f19,
+  0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x6e7f,
+  0x6e7f, 0x86bf, 0x96ff, 0x741e, 0x63be, 0x42de, 0x3a9e, 0x325e,
+  0x3a7d, 0x42de, 0x3a9e, 0x325e, 0x951e, 0xd6f4, 0xbe4d, 0xbe4f,
+  0x5e76, 0x4635, 0xa71a, 0x5656, 0x4635, 0x4e55, 0x86bf, 0x5e5f,
+  0x665f, 0x6e7f, 0x665e, 0x5e5f, 0x665f, 0x6e7f, 0x6e7f, 0x6e7f,
+  0x96df, 0x96ff, 0x741e, 0x4b1e, 0x325e, 0x3a9e, 0x42de, 0x3a9e,
+  0x325e, 0x533e, 0xc66e, 0xbe4d, 0xd6f5, 0x5e76, 0x4635, 0x5e76,
+  0x5656, 0x4635, 0x6e97, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f,
+  0x665f, 0x6e7f, 0x86bf, 0x96ff, 0x741e, 0x535e, 0x325e, 0x42de,
+  0x3a9e, 0x325e, 0xb5df, 0xdf16, 0xbe4d, 0xc66f, 0x5e76, 0x4635,
+  0xaf3b, 0x5656, 0x4635, 0xaf3b, 0x8edf, 0x5e5f, 0x665f, 0x6e7f,
+  0x5e5f, 0x6e7f, 0x96ff, 0x741e, 0x6bde, 0x42de, 0x3a7d, 0x325e,
+  0x3a9e, 0x42de, 0x3a9e, 0x325e, 0x6bde, 0xc690, 0xbe4d, 0xbe4e,
+  0xe737, 0x5e76, 0x4635, 0x6e97, 0x5656, 0x4635, 0x5e56, 0x665f,
+  0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x6e7f, 0x96ff, 0x741e,
+  0x535e, 0x42de, 0x429e, 0x325e, 0x429e, 0x42de, 0x3a9e, 0x325e,
+  0x3a9e, 0xbe4e, 0xbe4d, 0xc64d, 0xced3, 0x5e76, 0x4635, 0x4e55,
+  0x5656, 0x4635, 0x8ef9, 0xa6ff, 0x5e5f, 0x665f, 0x6e7f, 0x665f,
+  0x5e5f, 0x6e7f, 0x8edf, 0x96ff, 0x741e, 0x6bde, 0x42de, 0x42de,
+  0x42de, 0x3a9e, 0x325e, 0x3a9e, 0x42de, 0x3a9e, 0x325e, 0x9d3e,
+  0xd6f4, 0xbe4d, 0xc66f, 0x5e76, 0x4635, 0x8ef9, 0x5656, 0x4635,
+  0x5656, 0x769f, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f,
+  0x6e7f, 0x769f, 0x96ff, 0x741e, 0x5b5e, 0x42de, 0x3a7d, 0x325e,
+  0x42de, 0x3a9e, 0x325e, 0x639e, 0xc691, 0xbe4e, 0xbe4d, 0xbe4e,
+  0xe737, 0x5e76, 0x4635, 0x6696, 0x5656, 0x4635, 0x86d9, 0x665f,
+  0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x6e7f,
+  0x6e7f, 0x8edf, 0x96ff, 0x741e, 0x741e, 0x741e, 0x6c1e, 0x42de,
+  0x429e, 0x325e, 0x3a9e, 0x42de, 0x42de, 0x42de, 0x3a9e, 0x325e,
+  0x42de, 0xc66f, 0xbe4d, 0xced3, 0x5e76, 0x4635, 0x5656, 0x5656,
+  0x4635, 0x5656, 0x9eff, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f,
+  0x6e7f, 0x7ebf, 0x96df, 0x96ff, 0x96ff, 0x96ff, 0x741e, 0x741e,
+  0x741e, 0x639e, 0x42de, 0x3a9e, 0x325e, 0x42de, 0x42de, 0x42de,
+  0x3a9e, 0x325e, 0x3a9e, 0xdf16, 0xbe4e, 0xbe4d, 0xc64d, 0xc691,
+  0x5e76, 0x4635, 0x96fa, 0x5656, 0x4635, 0x9f1a, 0x86bf, 0x5e5f,
+  0x665f, 0x6e7f, 0x5e5f, 0x665f, 0x6e7f, 0x8edf, 0x96ff, 0x96ff,
+  0x96ff, 0x741e, 0x741e, 0x741e, 0x4b1e, 0x42de, 0x3a9e, 0x325e,
+  0x429e, 0x42de, 0x42de, 0x3a9e, 0x325e, 0x9d1f, 0xd6f5, 0xbe4e,
+  0xbe4d, 0xc66f, 0x5e76, 0x4635, 0x76b8, 0x5656, 0x4635, 0x5e76,
+  0x6e7f, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x6e7f,
+  0x86bf, 0x96ff, 0x96ff, 0x96ff, 0x741e, 0x741e, 0x6bde, 0x42de,
+  0x3a9e, 0x325e, 0x3a7d, 0x42de, 0x42de, 0x3a9e, 0x325e, 0x849f,
+  0xced3, 0xbe4d, 0xbe4e, 0x5e76, 0x4635, 0x5e56, 0x5656, 0x4635,
+  0xb75c, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f,
+  0x6e7f, 0x96df, 0x96ff, 0x96ff, 0x741e, 0x741e, 0x5b5e, 0x42de,
+  0x3a9e, 0x325e, 0x42de, 0x42de, 0x3a9e, 0x325e, 0x7c5e, 0xceb1,
+  0xbe4d, 0xbe4e, 0x5e76, 0x4635, 0x5e56, 0x5656, 0x4635, 0x76b8,
+  0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x6e7f,
+  0x8edf, 0x96ff, 0x96ff, 0x741e, 0x6c1e, 0x4b1e, 0x42de, 0x3a7d,
+  0x325e, 0x3a9e, 0x42de, 0x3a9e, 0x325e, 0x741e, 0xc691, 0xbe4d,
+  0xbe4e, 0x5e76, 0x4635, 0x5656, 0x5656, 0x4635, 0x5656, 0xaf1f,
+  0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x665f, 0x6e7f,
+  0x769f, 0x96ff, 0x96ff, 0x741e, 0x6bde, 0x42de, 0x3a7d, 0x325e,
+  0x3a7d, 0x42de, 0x3a9e, 0x325e, 0x741e, 0xceb1, 0xbe4d, 0xbe4f,
+  0xe737, 0x5e76, 0x4635, 0x5656, 0x5656, 0x4635, 0x4636, 0xaf3b,
+  0xa6ff, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x6e7f,
+  0x8edf, 0x96ff, 0x741e, 0x639e, 0x42de, 0x3a7d, 0x325e, 0x3a5e,
+  0x42de, 0x3a9e, 0x325e, 0x845e, 0xceb1, 0xbe4d, 0xc66f, 0x5e76,
+  0x4635, 0x5656, 0x5656, 0x4635, 0x76b8, 0xa6ff, 0x665e, 0x5e5f,
+  0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x86bf, 0x96ff,
+  0x741e, 0x533e, 0x42de, 0x3a9e, 0x325e, 0x429e, 0x3a9e, 0x325e,
+  0x849f, 0xd6d3, 0xbe4e, 0xbe4d, 0xce6f, 0x5e76, 0x4635, 0x5e56,
+  0x5656, 0x4635, 0x5656, 0xa6ff, 0x5e5f, 0x665f, 0x6e7f, 0x665f,
+  0x5e5f, 0x665f, 0x6e7f, 0x7ebf, 0x96ff, 0x6c1e, 0x4ade, 0x42de,
+  0x3a9e, 0x325e, 0x3a9e, 0x3a9e, 0x325e, 0x3a7d, 0x9d3e, 0xd6f5,
+  0xc64e, 0xbe4d, 0xc691, 0x5e76, 0x4635, 0x4636, 0x5e76, 0x5656,
+  0x4635, 0x4e55, 0xb73f, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x665f,
+  0x5e5f, 0x665f, 0x6e7f, 0x769f, 0x96df, 0x6bde, 0x42de, 0x3ade,
+  0x327d, 0x325e, 0x3a9e, 0x3a9e, 0x325e, 0x4b1e, 0xc66f, 0xbe4d,
+  0xced3, 0x5e76, 0x4635, 0x6e97, 0x5656, 0x4635, 0xa73a, 0x6e7f,
+  0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x8edf,
+  0x639e, 0x42de, 0x3a7d, 0x325e, 0x3a7d, 0x3a9e, 0x325e, 0x741e,
+  0xceb1, 0xbe4d, 0xc64e, 0x5e76, 0x4635, 0x86d9, 0x5656, 0x4635,
+  0x76b8, 0x86bf, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f,
+  0x6e7f, 0x86bf, 0x5b5e, 0x42de, 0x3a9e, 0x325e, 0x3a7d, 0x325e,
+  0x42de, 0xa59f, 0xdf16, 0xc66e, 0xbe4d, 0xd6b1, 0x5e76, 0x4635,
+  0x5656, 0xb75c, 0x5656, 0x4635, 0x5656, 0xa6ff, 0x5e5f, 0x665f,
+  0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x665f, 0x6e7f, 0x86bf, 0x4b1e,
+  0x42de, 0x429e, 0x3a7d, 0x325e, 0x3a9e, 0x325e, 0x7c5e, 0xced3,
+  0xbe4d, 0xbe4e, 0xc66f, 0xdf16, 0x5e76, 0x4635, 0x7eb8, 0x5656,
+  0x4635, 0x769f, 0x5e5f, 0x665f, 0x6e7f, 0x665f, 0x5e5f, 0x665f,
+  0x6e7f, 0x769f, 0x4b1e, 0x42de, 0x3a9e, 0x3a7d, 0x325e, 0x3a7d,
+  0x325e, 0x639e, 0xc691, 0xbe4d, 0xc66f, 0xd6f4, 0x5e76, 0x4635,
+  0x5e76, 0xb75b, 0x5656, 0x4635, 0xa6ff, 0x665f, 0x5e5f, 0x665f,
+  0x6e7f, 0x665f, 0x5e5f, 0x665f, 0x665f, 0x6e7f, 0x769f, 0x4ade,
+  0x42de, 0x3a9e, 0x325e, 0x535e, 0xad9f, 0xdf16, 0xc691, 0xbe4d,
+  0xc66f, 0xced3, 0x5e76, 0x4635, 0x5656, 0x8ef9, 0x5656, 0x4635,
+  0xaf3b, 0x8edf, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x769f, 0x86bf,
+  0x769f, 0x6e7f, 0x42de, 0x3a9e, 0x3a7d, 0x325e, 0x3a7d, 0x639e,
+  0xb5df, 0xc691, 0xbe6e, 0xbe4d, 0xc66f, 0xd6f3, 0x5e76, 0x4635,
+  0x5656, 0x8ef9, 0x5656, 0x4635, 0xa71a, 0x86bf, 0x665f, 0x5e5f,
+  0x665f, 0x6e7f, 0x769f, 0x86bf, 0x96ff, 0x96ff, 0x96ff, 0x8edf,
+  0x769f, 0x6e7f, 0x42de, 0x3a9e, 0x3a9e, 0x325e, 0x42de, 0x7c5e,
+  0xced3, 0xc66f, 0xbe4e, 0xbe4d, 0xbe4e, 0xc64e, 0xc691, 0xdf16,
+  0x5e76, 0x4635, 0x5e56, 0x8ef9, 0x5656, 0x4635, 0x96f9, 0x8edf,
+  0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x769f, 0x86bf, 0x96df, 0x96ff,
+  0x8edf, 0x769f, 0x6e7f, 0x42de, 0x3a9e, 0x3a7d, 0x325e, 0x3a9e,
+  0x63be, 0xaddf, 0xc691, 0xc66f, 0xc64e, 0xbe4d, 0xc64e, 0xc66f,
+  0xd6f5, 0x5e76, 0x4635, 0x5656, 0x6696, 0xa73a, 0x5656, 0x4635,
+  0x86b8, 0x9eff, 0x6e7f, 0x5e5f, 0x665f, 0x6e7f, 0x7ebf, 0x8edf,
+  0x96ff, 0x8edf, 0x7e9f, 0x6e7f, 0x42de, 0x3a9e, 0x3a7d, 0x327d,
+  0x325e, 0x3a5e, 0x4b1e, 0x849f, 0xb5df, 0xd6f3, 0xc66f, 0xbe4d,
+  0xbe4e, 0xbe4d, 0xbe4f, 0xd6b1, 0xdf16, 0x5e76, 0x4635, 0x5e56,
+  0x96fa, 0x5656, 0x4635, 0x76b8, 0x96df, 0x665f, 0x5e5f, 0x665f,
+  0x6e7f, 0x769f, 0x86bf, 0x96df, 0x96ff, 0x96df, 0x86bf, 0x769f,
+  0x6e7f, 0x42de, 0x3a9e, 0x3a9e, 0x3a7d, 0x3a5e, 0x325e, 0x3a9e,
+  0x4ade, 0x639e, 0x849f, 0x9d5f, 0xe737, 0xd6f4, 0xceb1, 0xce6f,
+  0xc64e, 0xbe4d, 0xbe4d, 0xbe4e, 0xbe4d, 0xbe4d, 0xbe4d, 0xbe4e,
+  0xbe4e, 0xbe4e, 0xc66e, 0xc690, 0xced3, 0xdf16, 0x5e76, 0x4635,
+  0x4636, 0x4635, 0x5656, 0x76b8, 0xa73a, 0x5656, 0x4635, 0x6e97,
+  0xa6ff, 0x7e9f, 0x665f, 0x5e5f, 0x665f, 0x6e7f, 0x769f, 0x86bf,
+  0x86bf, 0x96df, 0x96ff, 0x8edf, 0x86bf, 0x769f, 0x6e7f, 0x325e,
+  0x6bde, 0x5e76, 0x4635, 0x4635, 0x4636, 0x5656, 0x5e56, 0x6677,
+  0x86b8, 0x96fa, 0xaf3b, 0x5656, 0x4635, 0x6677, 0xaf1f, 0xa6ff,
+  0x8edf, 0x7ebf, 0x665f, 0x665f, 0x5e5f, 0x5e5f, 0x5e5f, 0x665f,
+  0x6e7f, 0x769f, 0x7ebf, 0x7ebf, 0x86bf, 0x8edf, 0x96df, 0x96df,
+  0x96ff, 0x96df, 0x96df, 0x8edf, 0x86bf, 0x7e9f, 0x7ebf, 0x769f,
+  0x769f, 0x6e7f, 0xb73f, 0x325e, 0x849e, 0x9eff, 0x5e5f, 0x5e5f,
+  0x665f, 0x5e5f, 0x665e, 0xaf1f, 0x325e, 0x849f, 0xb73f, 0x5e5f,
+  0xaf1f, 0x325e, 0x8cde, 0xb73f, 0x5e5f, 0xb73f, 0x325e, 0x9d1f,
+  0xb73f, 0x5e5f, 0x325e, 0xad9f, 0xb73f, 0x5e5f, 0x325e, 0xb73f,
+  0x5e5f, 0x325e, 0xb73f, 0x5e5f, 0x665f, 0x325e, 0x42de, 0xb73f,
+  0x5e5f, 0x6e7f, 0x325e, 0x639e, 0xb73f, 0x5e5f, 0x86bf, 0x325e,
+  0x849f, 0xb73f, 0x5e5f, 0x8edf, 0x325e, 0xad9f, 0xb73f, 0x5e5f,
+  0xa6ff, 0x325e, 0xb73f, 0x5e5f, 0x325e, 0x42de, 0xb73f, 0x5e5f,
+  0x665f, 0x325e, 0x849e, 0xb73f, 0x5e5f, 0x8edf, 0x325e, 0xaddf,
+  0xb73f, 0x5e5f, 0xa6ff, 0x325e, 0x3a7d, 0xb73f, 0x5e5f, 0x325e,
+  0x741e, 0xb73f, 0x5e5f, 0x7ebf, 0x325e, 0xb5ff, 0xb73f, 0x5e5f,
+  0xa6ff, 0x325e, 0x42de, 0xb73f, 0x5e5f, 0x325e, 0x951e, 0xb73f,
+  0x5e5f, 0x86bf, 0x325e, 0x42de, 0xb73f, 0x5e5f, 0x325e, 0x845e,
+  0xb73f, 0x5e5f, 0x6e7f, 0x325e, 0x429e, 0xb73f, 0x5e5f, 0xaf1f,
+  0x325e, 0x849e, 0xb73f, 0x5e5f, 0x665f, 0x325e, 0x42de, 0xb73f,
+  0x5e5f, 0xaf1f, 0x325e, 0x951e, 0xb73f, 0x5e5f, 0x6e7f, 0x325e,
+  0x5b5e, 0xb73f, 0x5e5f, 0x325e, 0x3a9e, 0xb73f, 0x5e5f, 0x8edf,
+  0x325e, 0x84be, 0xb73f, 0x5e5f, 0x665f, 0x325e, 0x5b5e, 0xb73f,
+  0x5e5f, 0x665e, 0xaf1f, 0x325e, 0x3a9e, 0xb73f, 0x5e5f, 0x86bf,
+  0x325e, 0xad9f, 0xb73f, 0x5e5f, 0x6e7f, 0x325e, 0x849f, 0xb73f,
+  0x5e5f, 0x665f, 0x325e, 0x6c1e, 0xb73f, 0x5e5f, 0xb73f, 0x325e,
+  0x6bde, 0xb73f, 0x5e5f, 0xa6ff, 0x325e, 0x63de, 0xb73f, 0x5e5f,
+  0x96df, 0x325e, 0x6bde, 0xb73f, 0x5e5f, 0x8edf, 0x325e, 0x6bde,
+  0xb73f, 0x5e5f, 0x8edf, 0x325e, 0x845e, 0xb73f, 0x5e5f, 0x96ff,
+  0x325e, 0x3a7d, 0x9d1f, 0xb73f, 0x5e5f, 0x665f, 0xa6ff, 0x325e,
+  0x3a9e, 0xb73f, 0x5e5f, 0x665f, 0xb73f, 0x325e, 0x639e, 0xb73f,
+  0x5e5f, 0x6e7f, 0x325e, 0x42de, 0x9d3e, 0xb73f, 0x5e5f, 0x96df,
+  0x325e, 0x6bde, 0xb73f, 0x5e5f, 0x665f, 0x325e, 0x639e, 0xb73f,
+  0x5e5f, 0x665f, 0x96ff, 0x325e, 0x535e, 0xaddf, 0xb73f, 0x5e5f,
+  0x665e, 0x86bf, 0x325e, 0x3a7d, 0x5b7e, 0xaddf, 0xb73f, 0x5e5f,
+  0x86bf, 0x325e, 0x42de, 0x741e, 0xb73f, 0x5e5f, 0x665f, 0x86bf,
+  0x325e, 0x429e, 0x63be, 0xad9f, 0xb73f, 0x5e5f, 0x665f, 0x96ff,
+  0x325e, 0x4b1e, 0x849f, 0xb5df, 0xb73f, 0x5e5f, 0x665f, 0x8edf,
+  0x325e, 0x325e, 0x325e, 0x327d, 0x3a9e, 0x4b1e, 0x6bde, 0x8cde,
+  0xad9f, 0xb73f, 0x5e5f, 0x665f, 0x7ebf, 0xa6ff, 0xb73f, 0x5e5f,
+  0x5e5f, 0x5e5f, 0x665f, 0x665f, 0x769f, 0x96df, 0xa6ff, 0xb73f,
+};
+
+static const int POKY_IMG_BGR565_SPANS[] = {
+  212, 6, 0, 0, 212, 1, 0, 12, 213, 6, 1, 14,
+  219, 5, 0, 16, 212, 1, 0, 26, 213, 11, 1, 28,
+  224, 4, 0, 30, 212, 1, 0, 38, 213, 15, 1, 40,
+  228, 2, 0, 42, 212, 1, 0, 46, 213, 18, 1, 48,
+  231, 2, 0, 50, 212, 1, 0, 54, 213, 20, 1, 56,
+  233, 2, 0, 58, 212, 1, 0, 62, 213, 22, 1, 64,
+  235, 2, 0, 66, 212, 1, 0, 70, 213, 24, 1, 72,
+  237, 2, 0, 74, 212, 1, 0, 78, 213, 26, 1, 80,
+  239, 1, 0, 82, 212, 1, 0, 84, 213, 27, 1, 86,
+  240, 2, 0, 88, 212, 1, 0, 92, 213, 29, 1, 94,
+  242, 1, 0, 96, 212, 1, 0, 98, 213, 30, 1, 100,
+  243, 1, 0, 102, 212, 1, 0, 104, 213, 31, 1, 106,
+  244, 2, 0, 108, 212, 1, 0, 112, 213, 33, 1, 114,
+  246, 1, 0, 116, 212, 1, 0, 118, 213, 34, 1, 120,
+  247, 1, 0, 122, 212, 1, 0, 124, 213, 35, 1, 126,
+  248, 1, 0, 128, 212, 1, 0, 130, 213, 36, 1, 132,
+  249, 1, 0, 134, 212, 1, 0, 136, 213, 37, 1, 138,
+  250, 1, 0, 140, 212, 1, 0, 142, 213, 37, 1, 144,
+  250, 2, 0, 146, 212, 1, 0, 150, 213, 38, 1, 152,
+  251, 2, 0, 154, 212, 1, 0, 158, 213, 39, 1, 160,
+  252, 1, 0, 162, 212, 1, 0, 164, 213, 40, 1, 166,
+  253, 1, 0, 168, 212, 1, 0, 170, 213, 41, 1, 172,
+  254, 1, 0, 174, 212, 1, 0, 176, 213, 41, 1, 178,
+  254, 1, 0, 180, 212, 1, 0, 182, 213, 42, 1, 184,
+  255, 1, 0, 186, 212, 1, 0, 188, 213, 43, 1, 190,
+  256, 1, 0, 192, 212, 1, 0, 194, 213, 43, 1, 196,
+  256, 1, 0, 198, 212, 1, 0, 200, 213, 44, 1, 202,
+  257, 1, 0, 204, 212, 1, 0, 206, 213, 44, 1, 208,
+  257, 1, 0, 210, 212, 1, 0, 212, 213, 45, 1, 214,
+  258, 1, 0, 216, 212, 1, 0, 218, 213, 45, 1, 220,
+  258, 1, 0, 222, 212, 1, 0, 224, 213, 46, 1, 226,
+  259, 1, 0, 228, 212, 1, 0, 230, 213, 46, 1, 232,
+  259, 1, 0, 234, 212, 1, 0, 236, 213, 47, 1, 238,
+  260, 1, 0, 240, 212, 1, 0, 242, 213, 47, 1, 244,
+  260, 1, 0, 246, 212, 1, 0, 248, 213, 48, 1, 250,
+  212, 1, 0, 252, 213, 48, 1, 254, 261, 1, 0, 256,
+  212, 1, 0, 258, 213, 48, 1, 260, 261, 1, 0, 262,
+  212, 1, 0, 264, 213, 48, 1, 266, 261, 1, 0, 268,
+  212, 1, 0, 270, 213, 49, 1, 272, 262, 1, 0, 274,
+  212, 1, 0, 276, 213, 49, 1, 278, 262, 1, 0, 280,
+  212, 1, 0, 282, 213, 49, 1, 284, 262, 1, 0, 286,
+  212, 1, 0, 288, 213, 49, 1, 290, 262, 1, 0, 292,
+  212, 1, 0, 294, 213, 50, 1, 296, 212, 1, 0, 298,
+  213, 50, 1, 300, 263, 1, 0, 302, 212, 1, 0, 304,
+  213, 50, 1, 306, 263, 1, 0, 308, 212, 1, 0, 310,
+  213, 50, 1, 312, 263, 1, 0, 314, 212, 1, 0, 316,
+  213, 50, 1, 318, 263, 1, 0, 320, 212, 1, 0, 322,
+  213, 50, 1, 324, 263, 1, 0, 326, 212, 1, 0, 328,
+  213, 50, 1, 330, 263, 1, 0, 332, 212, 1, 0, 334,
+  213, 50, 1, 336, 263, 1, 0, 338, 50, 14, 0, 340,
+  109, 2, 0, 368, 158, 8, 0, 372, 212, 1, 0, 388,
+  213, 50, 1, 390, 263, 1, 0, 392, 44, 5, 0, 394,
+  49, 14, 1, 404, 63, 6, 0, 406, 109, 6, 1, 418,
+  115, 4, 0, 420, 150, 4, 0, 428, 154, 5, 1, 436,
+  159, 2, 0, 438, 161, 6, 1, 442, 167, 5, 0, 444,
+  212, 9, 0, 454, 221, 34, 1, 472, 255, 10, 0, 474,
+  265, 50, 1, 494, 315, 6, 0, 496, 414, 5, 0, 508,
+  41, 3, 0, 518, 44, 25, 1, 524, 69, 3, 0, 526,
+  109, 11, 1, 532, 120, 3, 0, 534, 146, 3, 0, 540,
+  149, 10, 1, 546, 159, 2, 0, 548, 161, 11, 1, 552,
+  172, 4, 0, 554, 212, 1, 0, 562, 213, 7, 1, 564,
+  220, 6, 0, 566, 226, 24, 1, 578, 250, 6, 0, 580,
+  256, 7, 1, 592, 263, 2, 0, 594, 265, 50, 1, 598,
+  315, 1, 0, 600, 316, 7, 1, 602, 323, 5, 0, 604,
+  408, 4, 0, 614, 412, 7, 1, 622, 419, 1, 0, 624,
+  38, 3, 0, 626, 41, 32, 1, 632, 73, 2, 0, 634,
+  109, 15, 1, 638, 124, 2, 0, 640, 143, 2, 0, 644,
+  145, 14, 1, 648, 159, 2, 0, 650, 161, 14, 1, 654,
+  175, 4, 0, 656, 212, 1, 0, 664, 213, 12, 1, 666,
+  225, 4, 0, 668, 229, 18, 1, 676, 247, 4, 0, 678,
+  251, 12, 1, 686, 263, 2, 0, 688, 265, 50, 1, 692,
+  315, 1, 0, 694, 316, 12, 1, 696, 328, 3, 0, 698,
+  404, 3, 0, 704, 407, 12, 1, 710, 419, 1, 0, 712,
+  36, 2, 0, 714, 38, 37, 1, 718, 75, 3, 0, 720,
+  109, 18, 1, 726, 127, 1, 0, 728, 140, 2, 0, 730,
+  142, 17, 1, 734, 159, 2, 0, 736, 161, 17, 1, 740,
+  178, 3, 0, 742, 212, 1, 0, 748, 213, 15, 1, 750,
+  228, 4, 0, 752, 232, 12, 1, 760, 244, 4, 0, 762,
+  248, 15, 1, 770, 263, 2, 0, 772, 265, 50, 1, 776,
+  315, 1, 0, 778, 316, 16, 1, 780, 332, 2, 0, 782,
+  401, 2, 0, 786, 403, 16, 1, 790, 419, 1, 0, 792,
+  33, 2, 0, 794, 35, 43, 1, 798, 78, 2, 0, 800,
+  109, 1, 0, 804, 110, 19, 1, 806, 129, 2, 0, 808,
+  138, 1, 0, 812, 139, 20, 1, 814, 159, 2, 0, 816,
+  161, 20, 1, 820, 181, 2, 0, 822, 212, 1, 0, 826,
+  213, 18, 1, 828, 231, 3, 0, 830, 234, 8, 1, 836,
+  242, 3, 0, 838, 245, 18, 1, 844, 263, 2, 0, 846,
+  265, 50, 1, 850, 315, 1, 0, 852, 316, 19, 1, 854,
+  335, 2, 0, 856, 399, 2, 0, 860, 401, 18, 1, 864,
+  419, 1, 0, 866, 32, 1, 0, 868, 33, 47, 1, 870,
+  80, 2, 0, 872, 109, 1, 0, 876, 110, 21, 1, 878,
+  131, 2, 0, 880, 136, 1, 0, 884, 137, 22, 1, 886,
+  159, 2, 0, 888, 161, 22, 1, 892, 183, 2, 0, 894,
+  212, 1, 0, 898, 213, 21, 1, 900, 234, 2, 0, 902,
+  236, 4, 1, 906, 240, 2, 0, 908, 242, 21, 1, 912,
+  263, 2, 0, 914, 265, 50, 1, 918, 315, 2, 0, 920,
+  317, 20, 1, 924, 337, 2, 0, 926, 397, 1, 0, 930,
+  398, 21, 1, 932, 419, 1, 0, 934, 30, 1, 0, 936,
+  31, 51, 1, 938, 82, 1, 0, 940, 109, 1, 0, 942,
+  110, 23, 1, 944, 133, 3, 0, 946, 136, 23, 1, 952,
+  159, 2, 0, 954, 161, 24, 1, 958, 185, 2, 0, 960,
+  212, 1, 0, 964, 213, 23, 1, 966, 236, 4, 0, 968,
+  240, 23, 1, 976, 263, 2, 0, 978, 265, 50, 1, 982,
+  315, 2, 0, 984, 317, 22, 1, 988, 339, 2, 0, 990,
+  395, 1, 0, 994, 396, 23, 1, 996, 419, 1, 0, 998,
+  28, 2, 0, 1000, 30, 53, 1, 1004, 83, 2, 0, 1006,
+  109, 1, 0, 1010, 110, 21, 1, 1012, 131, 7, 0, 1014,
+  138, 21, 1, 1028, 159, 2, 0, 1030, 161, 26, 1, 1034,
+  187, 1, 0, 1036, 212, 1, 0, 1038, 213, 23, 1, 1040,
+  236, 3, 0, 1042, 239, 24, 1, 1048, 263, 2, 0, 1050,
+  265, 50, 1, 1054, 315, 2, 0, 1056, 317, 24, 1, 1060,
+  341, 1, 0, 1062, 393, 1, 0, 1064, 394, 25, 1, 1066,
+  419, 1, 0, 1068, 27, 1, 0, 1070, 28, 57, 1, 1072,
+  85, 1, 0, 1074, 109, 1, 0, 1076, 110, 19, 1, 1078,
+  129, 2, 0, 1080, 131, 5, 1, 1084, 136, 3, 0, 1086,
+  139, 20, 1, 1092, 159, 2, 0, 1094, 161, 27, 1, 1098,
+  188, 2, 0, 1100, 212, 1, 0, 1104, 213, 22, 1, 1106,
+  235, 6, 0, 1108, 241, 22, 1, 1120, 263, 2, 0, 1122,
+  265, 50, 1, 1126, 315, 2, 0, 1128, 317, 25, 1, 1132,
+  342, 2, 0, 1134, 391, 2, 0, 1138, 393, 26, 1, 1142,
+  419, 1, 0, 1144, 25, 2, 0, 1146, 27, 59, 1, 1150,
+  86, 2, 0, 1152, 110, 18, 1, 1156, 128, 2, 0, 1158,
+  130, 9, 1, 1162, 139, 1, 0, 1164, 140, 19, 1, 1166,
+  159, 2, 0, 1168, 161, 29, 1, 1172, 190, 1, 0, 1174,
+  212, 1, 0, 1176, 213, 20, 1, 1178, 233, 2, 0, 1180,
+  235, 6, 1, 1184, 241, 2, 0, 1186, 243, 20, 1, 1190,
+  263, 2, 0, 1192, 265, 49, 1, 1196, 314, 1, 0, 1198,
+  316, 1, 0, 1200, 317, 27, 1, 1202, 344, 1, 0, 1204,
+  390, 1, 0, 1206, 391, 28, 1, 1208, 419, 1, 0, 1210,
+  24, 1, 0, 1212, 25, 63, 1, 1214, 88, 1, 0, 1216,
+  110, 1, 0, 1218, 111, 16, 1, 1220, 127, 2, 0, 1222,
+  129, 10, 1, 1226, 139, 2, 0, 1228, 141, 18, 1, 1232,
+  159, 2, 0, 1234, 161, 30, 1, 1238, 191, 2, 0, 1240,
+  212, 2, 0, 1244, 214, 18, 1, 1248, 232, 2, 0, 1250,
+  234, 8, 1, 1254, 242, 2, 0, 1256, 244, 19, 1, 1260,
+  263, 2, 0, 1262, 265, 49, 1, 1266, 314, 1, 0, 1268,
+  316, 1, 0, 1270, 317, 28, 1, 1272, 345, 2, 0, 1274,
+  388, 2, 0, 1278, 390, 29, 1, 1282, 419, 1, 0, 1284,
+  23, 1, 0, 1286, 24, 65, 1, 1288, 89, 1, 0, 1290,
+  110, 1, 0, 1292, 111, 15, 1, 1294, 126, 1, 0, 1296,
+  127, 14, 1, 1298, 141, 2, 0, 1300, 143, 16, 1, 1304,
+  159, 2, 0, 1306, 161, 31, 1, 1310, 192, 2, 0, 1312,
+  212, 2, 0, 1316, 214, 17, 1, 1320, 231, 1, 0, 1322,
+  232, 11, 1, 1324, 243, 2, 0, 1326, 245, 18, 1, 1330,
+  263, 2, 0, 1332, 265, 49, 1, 1336, 314, 1, 0, 1338,
+  316, 1, 0, 1340, 317, 30, 1, 1342, 347, 1, 0, 1344,
+  387, 1, 0, 1346, 388, 31, 1, 1348, 419, 1, 0, 1350,
+  22, 1, 0, 1352, 23, 67, 1, 1354, 90, 1, 0, 1356,
+  110, 1, 0, 1358, 111, 14, 1, 1360, 125, 1, 0, 1362,
+  126, 16, 1, 1364, 142, 2, 0, 1366, 144, 15, 1, 1370,
+  159, 2, 0, 1372, 161, 33, 1, 1376, 194, 1, 0, 1378,
+  212, 2, 0, 1380, 214, 16, 1, 1384, 230, 1, 0, 1386,
+  231, 14, 1, 1388, 245, 1, 0, 1390, 246, 17, 1, 1392,
+  263, 2, 0, 1394, 265, 49, 1, 1398, 314, 1, 0, 1400,
+  316, 1, 0, 1402, 317, 31, 1, 1404, 348, 1, 0, 1406,
+  386, 1, 0, 1408, 387, 32, 1, 1410, 419, 1, 0, 1412,
+  21, 1, 0, 1414, 22, 69, 1, 1416, 91, 2, 0, 1418,
+  111, 13, 1, 1422, 124, 2, 0, 1424, 126, 18, 1, 1428,
+  144, 1, 0, 1430, 145, 14, 1, 1432, 159, 2, 0, 1434,
+  161, 34, 1, 1438, 195, 1, 0, 1440, 212, 2, 0, 1442,
+  214, 14, 1, 1446, 228, 2, 0, 1448, 230, 16, 1, 1452,
+  246, 2, 0, 1454, 248, 15, 1, 1458, 263, 2, 0, 1460,
+  265, 48, 1, 1464, 313, 1, 0, 1466, 316, 1, 0, 1468,
+  317, 32, 1, 1470, 349, 1, 0, 1472, 385, 1, 0, 1474,
+  386, 33, 1, 1476, 419, 1, 0, 1478, 20, 1, 0, 1480,
+  21, 71, 1, 1482, 92, 2, 0, 1484, 111, 1, 0, 1488,
+  112, 11, 1, 1490, 123, 2, 0, 1492, 125, 20, 1, 1496,
+  145, 1, 0, 1498, 146, 13, 1, 1500, 159, 2, 0, 1502,
+  161, 35, 1, 1506, 196, 1, 0, 1508, 212, 3, 0, 1510,
+  215, 13, 1, 1516, 228, 1, 0, 1518, 229, 18, 1, 1520,
+  247, 1, 0, 1522, 248, 15, 1, 1524, 263, 2, 0, 1526,
+  265, 48, 1, 1530, 313, 1, 0, 1532, 316, 1, 0, 1534,
+  317, 34, 1, 1536, 351, 1, 0, 1538, 384, 1, 0, 1540,
+  385, 34, 1, 1542, 419, 1, 0, 1544, 19, 1, 0, 1546,
+  20, 73, 1, 1548, 93, 2, 0, 1550, 111, 1, 0, 1554,
+  112, 10, 1, 1556, 122, 2, 0, 1558, 124, 22, 1, 1562,
+  146, 1, 0, 1564, 147, 12, 1, 1566, 159, 2, 0, 1568,
+  161, 36, 1, 1572, 197, 1, 0, 1574, 212, 3, 0, 1576,
+  215, 12, 1, 1582, 227, 1, 0, 1584, 228, 20, 1, 1586,
+  248, 1, 0, 1588, 249, 14, 1, 1590, 263, 2, 0, 1592,
+  265, 48, 1, 1596, 313, 1, 0, 1598, 316, 1, 0, 1600,
+  317, 35, 1, 1602, 352, 1, 0, 1604, 383, 1, 0, 1606,
+  384, 35, 1, 1608, 419, 1, 0, 1610, 18, 1, 0, 1612,
+  19, 75, 1, 1614, 94, 1, 0, 1616, 112, 9, 1, 1618,
+  121, 1, 0, 1620, 122, 24, 1, 1622, 146, 2, 0, 1624,
+  148, 11, 1, 1628, 159, 2, 0, 1630, 161, 37, 1, 1634,
+  198, 1, 0, 1636, 212, 3, 0, 1638, 215, 10, 1, 1644,
+  225, 2, 0, 1646, 227, 22, 1, 1650, 249, 1, 0, 1652,
+  250, 13, 1, 1654, 263, 2, 0, 1656, 265, 47, 1, 1660,
+  312, 1, 0, 1662, 316, 1, 0, 1664, 317, 36, 1, 1666,
+  353, 1, 0, 1668, 382, 1, 0, 1670, 383, 36, 1, 1672,
+  419, 1, 0, 1674, 17, 1, 0, 1676, 18, 77, 1, 1678,
+  95, 1, 0, 1680, 112, 1, 0, 1682, 113, 7, 1, 1684,
+  120, 1, 0, 1686, 121, 26, 1, 1688, 147, 2, 0, 1690,
+  149, 10, 1, 1694, 159, 2, 0, 1696, 161, 38, 1, 1700,
+  199, 1, 0, 1702, 212, 3, 0, 1704, 215, 10, 1, 1710,
+  225, 1, 0, 1712, 226, 24, 1, 1714, 250, 1, 0, 1716,
+  251, 12, 1, 1718, 263, 2, 0, 1720, 265, 47, 1, 1724,
+  312, 1, 0, 1726, 316, 1, 0, 1728, 317, 36, 1, 1730,
+  353, 1, 0, 1732, 381, 1, 0, 1734, 382, 37, 1, 1736,
+  419, 1, 0, 1738, 16, 1, 0, 1740, 17, 79, 1, 1742,
+  96, 1, 0, 1744, 112, 1, 0, 1746, 113, 6, 1, 1748,
+  119, 2, 0, 1750, 121, 27, 1, 1754, 148, 2, 0, 1756,
+  150, 9, 1, 1760, 159, 2, 0, 1762, 161, 39, 1, 1766,
+  200, 1, 0, 1768, 212, 4, 0, 1770, 216, 8, 1, 1778,
+  224, 1, 0, 1780, 225, 26, 1, 1782, 251, 1, 0, 1784,
+  252, 11, 1, 1786, 263, 2, 0, 1788, 265, 47, 1, 1792,
+  312, 1, 0, 1794, 316, 1, 0, 1796, 317, 37, 1, 1798,
+  354, 1, 0, 1800, 380, 1, 0, 1802, 381, 38, 1, 1804,
+  419, 1, 0, 1806, 15, 1, 0, 1808, 16, 81, 1, 1810,
+  97, 1, 0, 1812, 113, 5, 1, 1814, 118, 2, 0, 1816,
+  120, 29, 1, 1820, 149, 1, 0, 1822, 150, 9, 1, 1824,
+  159, 2, 0, 1826, 161, 39, 1, 1830, 200, 1, 0, 1832,
+  212, 4, 0, 1834, 216, 7, 1, 1842, 223, 1, 0, 1844,
+  224, 28, 1, 1846, 252, 1, 0, 1848, 253, 10, 1, 1850,
+  263, 2, 0, 1852, 265, 46, 1, 1856, 311, 1, 0, 1858,
+  316, 1, 0, 1860, 317, 38, 1, 1862, 355, 1, 0, 1864,
+  379, 1, 0, 1866, 380, 39, 1, 1868, 419, 1, 0, 1870,
+  15, 1, 0, 1872, 16, 82, 1, 1874, 98, 1, 0, 1876,
+  113, 1, 0, 1878, 114, 4, 1, 1880, 118, 1, 0, 1882,
+  119, 31, 1, 1884, 150, 1, 0, 1886, 151, 8, 1, 1888,
+  159, 2, 0, 1890, 161, 40, 1, 1894, 201, 1, 0, 1896,
+  212, 5, 0, 1898, 217, 5, 1, 1908, 222, 1, 0, 1910,
+  223, 30, 1, 1912, 253, 1, 0, 1914, 254, 9, 1, 1916,
+  263, 2, 0, 1918, 265, 46, 1, 1922, 311, 1, 0, 1924,
+  316, 1, 0, 1926, 317, 39, 1, 1928, 356, 1, 0, 1930,
+  378, 1, 0, 1932, 379, 40, 1, 1934, 419, 1, 0, 1936,
+  14, 1, 0, 1938, 15, 83, 1, 1940, 98, 1, 0, 1942,
+  114, 5, 0, 1944, 119, 31, 1, 1954, 150, 2, 0, 1956,
+  152, 7, 1, 1960, 159, 2, 0, 1962, 161, 41, 1, 1966,
+  202, 1, 0, 1968, 212, 5, 0, 1970, 217, 4, 1, 1980,
+  221, 2, 0, 1982, 223, 30, 1, 1986, 253, 1, 0, 1988,
+  254, 9, 1, 1990, 263, 2, 0, 1992, 265, 45, 1, 1996,
+  310, 1, 0, 1998, 316, 1, 0, 2000, 317, 40, 1, 2002,
+  357, 1, 0, 2004, 378, 41, 1, 2006, 419, 1, 0, 2008,
+  13, 1, 0, 2010, 14, 85, 1, 2012, 99, 1, 0, 2014,
+  114, 3, 0, 2016, 117, 34, 1, 2022, 151, 1, 0, 2024,
+  152, 7, 1, 2026, 159, 2, 0, 2028, 161, 41, 1, 2032,
+  202, 2, 0, 2034, 212, 1, 0, 2038, 213, 4, 1, 2040,
+  217, 5, 0, 2042, 222, 32, 1, 2052, 254, 1, 0, 2054,
+  255, 8, 1, 2056, 263, 2, 0, 2058, 265, 45, 1, 2062,
+  310, 1, 0, 2064, 316, 1, 0, 2066, 317, 40, 1, 2068,
+  357, 1, 0, 2070, 377, 1, 0, 2072, 378, 41, 1, 2074,
+  419, 1, 0, 2076, 12, 2, 0, 2078, 14, 86, 1, 2082,
+  100, 1, 0, 2084, 115, 2, 0, 2086, 117, 34, 1, 2090,
+  151, 2, 0, 2092, 153, 6, 1, 2096, 159, 2, 0, 2098,
+  161, 42, 1, 2102, 203, 1, 0, 2104, 212, 1, 0, 2106,
+  213, 4, 1, 2108, 217, 4, 0, 2110, 221, 34, 1, 2118,
+  255, 1, 0, 2120, 256, 7, 1, 2122, 263, 2, 0, 2124,
+  265, 45, 1, 2128, 310, 1, 0, 2130, 316, 1, 0, 2132,
+  317, 41, 1, 2134, 358, 1, 0, 2136, 376, 1, 0, 2138,
+  377, 42, 1, 2140, 419, 1, 0, 2142, 12, 1, 0, 2144,
+  13, 87, 1, 2146, 100, 1, 0, 2148, 115, 1, 0, 2150,
+  116, 36, 1, 2152, 152, 1, 0, 2154, 153, 6, 1, 2156,
+  159, 2, 0, 2158, 161, 43, 1, 2162, 204, 1, 0, 2164,
+  212, 1, 0, 2166, 213, 4, 1, 2168, 217, 3, 0, 2170,
+  220, 35, 1, 2176, 255, 2, 0, 2178, 257, 6, 1, 2182,
+  263, 2, 0, 2184, 265, 44, 1, 2188, 309, 1, 0, 2190,
+  316, 1, 0, 2192, 317, 42, 1, 2194, 359, 1, 0, 2196,
+  375, 1, 0, 2198, 376, 43, 1, 2200, 419, 1, 0, 2202,
+  11, 1, 0, 2204, 12, 89, 1, 2206, 101, 1, 0, 2208,
+  115, 1, 0, 2210, 116, 37, 1, 2212, 153, 1, 0, 2214,
+  154, 5, 1, 2216, 159, 2, 0, 2218, 161, 43, 1, 2222,
+  204, 1, 0, 2224, 212, 1, 0, 2226, 213, 5, 1, 2228,
+  218, 2, 0, 2230, 220, 36, 1, 2234, 256, 1, 0, 2236,
+  257, 6, 1, 2238, 263, 2, 0, 2240, 265, 43, 1, 2244,
+  308, 1, 0, 2246, 316, 1, 0, 2248, 317, 43, 1, 2250,
+  375, 1, 0, 2252, 376, 43, 1, 2254, 419, 1, 0, 2256,
+  11, 1, 0, 2258, 12, 89, 1, 2260, 101, 1, 0, 2262,
+  115, 2, 0, 2264, 117, 37, 1, 2268, 154, 1, 0, 2270,
+  155, 4, 1, 2272, 159, 2, 0, 2274, 161, 44, 1, 2278,
+  205, 1, 0, 2280, 212, 1, 0, 2282, 213, 5, 1, 2284,
+  218, 2, 0, 2286, 220, 37, 1, 2290, 257, 1, 0, 2292,
+  258, 5, 1, 2294, 263, 2, 0, 2296, 265, 43, 1, 2300,
+  308, 1, 0, 2302, 316, 1, 0, 2304, 317, 43, 1, 2306,
+  360, 1, 0, 2308, 374, 1, 0, 2310, 375, 44, 1, 2312,
+  419, 1, 0, 2314, 10, 1, 0, 2316, 11, 91, 1, 2318,
+  102, 1, 0, 2320, 114, 4, 0, 2322, 118, 36, 1, 2330,
+  154, 1, 0, 2332, 155, 4, 1, 2334, 159, 2, 0, 2336,
+  161, 45, 1, 2340, 212, 1, 0, 2342, 213, 5, 1, 2344,
+  218, 2, 0, 2346, 220, 37, 1, 2350, 257, 1, 0, 2352,
+  258, 5, 1, 2354, 263, 2, 0, 2356, 265, 42, 1, 2360,
+  307, 1, 0, 2362, 316, 1, 0, 2364, 317, 44, 1, 2366,
+  374, 1, 0, 2368, 375, 44, 1, 2370, 419, 1, 0, 2372,
+  10, 1, 0, 2374, 11, 91, 1, 2376, 102, 1, 0, 2378,
+  114, 4, 0, 2380, 118, 37, 1, 2388, 155, 6, 0, 2390,
+  161, 45, 1, 2402, 206, 1, 0, 2404, 212, 1, 0, 2406,
+  213, 4, 1, 2408, 217, 4, 0, 2410, 221, 37, 1, 2418,
+  258, 1, 0, 2420, 259, 4, 1, 2422, 263, 2, 0, 2424,
+  265, 42, 1, 2428, 307, 1, 0, 2430, 316, 1, 0, 2432,
+  317, 44, 1, 2434, 361, 1, 0, 2436, 373, 1, 0, 2438,
+  374, 45, 1, 2440, 419, 1, 0, 2442, 9, 1, 0, 2444,
+  10, 93, 1, 2446, 103, 1, 0, 2448, 113, 5, 0, 2450,
+  118, 37, 1, 2460, 155, 6, 0, 2462, 161, 46, 1, 2474,
+  212, 1, 0, 2476, 213, 4, 1, 2478, 217, 4, 0, 2480,
+  221, 37, 1, 2488, 258, 1, 0, 2490, 259, 4, 1, 2492,
+  263, 2, 0, 2494, 265, 41, 1, 2498, 306, 1, 0, 2500,
+  316, 1, 0, 2502, 317, 45, 1, 2504, 362, 1, 0, 2506,
+  373, 1, 0, 2508, 374, 45, 1, 2510, 419, 1, 0, 2512,
+  9, 1, 0, 2514, 10, 93, 1, 2516, 103, 1, 0, 2518,
+  113, 1, 0, 2520, 114, 4, 1, 2522, 118, 2, 0, 2524,
+  120, 35, 1, 2528, 155, 6, 0, 2530, 161, 46, 1, 2542,
+  207, 1, 0, 2544, 212, 5, 0, 2546, 217, 4, 1, 2556,
+  221, 1, 0, 2558, 222, 37, 1, 2560, 259, 6, 0, 2562,
+  265, 40, 1, 2574, 305, 1, 0, 2576, 316, 1, 0, 2578,
+  317, 45, 1, 2580, 362, 1, 0, 2582, 372, 1, 0, 2584,
+  373, 46, 1, 2586, 419, 1, 0, 2588, 8, 1, 0, 2590,
+  9, 95, 1, 2592, 104, 1, 0, 2594, 113, 6, 1, 2596,
+  119, 2, 0, 2598, 121, 35, 1, 2602, 156, 5, 0, 2604,
+  161, 47, 1, 2614, 212, 5, 0, 2616, 217, 5, 1, 2626,
+  222, 1, 0, 2628, 223, 36, 1, 2630, 259, 6, 0, 2632,
+  265, 40, 1, 2644, 305, 1, 0, 2646, 316, 1, 0, 2648,
+  317, 46, 1, 2650, 372, 1, 0, 2652, 373, 46, 1, 2654,
+  419, 1, 0, 2656, 8, 1, 0, 2658, 9, 95, 1, 2660,
+  104, 1, 0, 2662, 112, 1, 0, 2664, 113, 7, 1, 2666,
+  120, 1, 0, 2668, 121, 35, 1, 2670, 156, 5, 0, 2672,
+  161, 47, 1, 2682, 208, 1, 0, 2684, 212, 4, 0, 2686,
+  216, 7, 1, 2694, 223, 1, 0, 2696, 224, 36, 1, 2698,
+  260, 5, 0, 2700, 265, 39, 1, 2710, 304, 1, 0, 2712,
+  316, 1, 0, 2714, 317, 46, 1, 2716, 363, 1, 0, 2718,
+  371, 1, 0, 2720, 372, 47, 1, 2722, 419, 1, 0, 2724,
+  8, 97, 1, 2726, 105, 1, 0, 2728, 112, 9, 1, 2730,
+  121, 1, 0, 2732, 122, 35, 1, 2734, 157, 4, 0, 2736,
+  161, 47, 1, 2744, 208, 1, 0, 2746, 212, 4, 0, 2748,
+  216, 8, 1, 2756, 224, 1, 0, 2758, 225, 35, 1, 2760,
+  260, 5, 0, 2762, 265, 38, 1, 2772, 303, 1, 0, 2774,
+  316, 1, 0, 2776, 317, 46, 1, 2778, 363, 1, 0, 2780,
+  371, 1, 0, 2782, 372, 47, 1, 2784, 419, 1, 0, 2786,
+  7, 1, 0, 2788, 8, 97, 1, 2790, 105, 1, 0, 2792,
+  111, 1, 0, 2794, 112, 9, 1, 2796, 121, 2, 0, 2798,
+  123, 34, 1, 2802, 157, 4, 0, 2804, 161, 48, 1, 2812,
+  212, 4, 0, 2814, 216, 8, 1, 2822, 224, 1, 0, 2824,
+  225, 35, 1, 2826, 260, 5, 0, 2828, 265, 37, 1, 2838,
+  302, 1, 0, 2840, 316, 1, 0, 2842, 317, 47, 1, 2844,
+  364, 1, 0, 2846, 371, 48, 1, 2848, 419, 1, 0, 2850,
+  7, 1, 0, 2852, 8, 97, 1, 2854, 105, 1, 0, 2856,
+  111, 1, 0, 2858, 112, 10, 1, 2860, 122, 2, 0, 2862,
+  124, 33, 1, 2866, 157, 4, 0, 2868, 161, 48, 1, 2876,
+  209, 1, 0, 2878, 212, 3, 0, 2880, 215, 10, 1, 2886,
+  225, 1, 0, 2888, 226, 35, 1, 2890, 261, 4, 0, 2892,
+  265, 36, 1, 2900, 301, 1, 0, 2902, 316, 1, 0, 2904,
+  317, 47, 1, 2906, 364, 1, 0, 2908, 370, 1, 0, 2910,
+  371, 48, 1, 2912, 419, 1, 0, 2914, 7, 99, 1, 2916,
+  106, 1, 0, 2918, 111, 12, 1, 2920, 123, 2, 0, 2922,
+  125, 33, 1, 2926, 158, 3, 0, 2928, 161, 48, 1, 2934,
+  209, 1, 0, 2936, 212, 3, 0, 2938, 215, 11, 1, 2944,
+  226, 1, 0, 2946, 227, 34, 1, 2948, 261, 4, 0, 2950,
+  265, 35, 1, 2958, 300, 1, 0, 2960, 316, 1, 0, 2962,
+  317, 47, 1, 2964, 364, 1, 0, 2966, 370, 1, 0, 2968,
+  371, 48, 1, 2970, 419, 1, 0, 2972, 6, 1, 0, 2974,
+  7, 99, 1, 2976, 106, 1, 0, 2978, 110, 1, 0, 2980,
+  111, 13, 1, 2982, 124, 2, 0, 2984, 126, 32, 1, 2988,
+  158, 3, 0, 2990, 161, 49, 1, 2996, 212, 3, 0, 2998,
+  215, 12, 1, 3004, 227, 2, 0, 3006, 229, 32, 1, 3010,
+  261, 4, 0, 3012, 265, 34, 1, 3020, 299, 1, 0, 3022,
+  316, 1, 0, 3024, 317, 48, 1, 3026, 365, 1, 0, 3028,
+  370, 1, 0, 3030, 371, 48, 1, 3032, 419, 1, 0, 3034,
+  6, 1, 0, 3036, 7, 99, 1, 3038, 106, 1, 0, 3040,
+  110, 1, 0, 3042, 111, 14, 1, 3044, 125, 2, 0, 3046,
+  127, 31, 1, 3050, 158, 3, 0, 3052, 161, 49, 1, 3058,
+  210, 1, 0, 3060, 212, 2, 0, 3062, 214, 14, 1, 3066,
+  228, 1, 0, 3068, 229, 33, 1, 3070, 262, 3, 0, 3072,
+  265, 33, 1, 3078, 298, 1, 0, 3080, 316, 1, 0, 3082,
+  317, 48, 1, 3084, 365, 1, 0, 3086, 369, 1, 0, 3088,
+  370, 49, 1, 3090, 419, 1, 0, 3092, 6, 1, 0, 3094,
+  7, 99, 1, 3096, 106, 1, 0, 3098, 110, 1, 0, 3100,
+  111, 16, 1, 3102, 127, 2, 0, 3104, 129, 30, 1, 3108,
+  159, 2, 0, 3110, 161, 49, 1, 3114, 210, 1, 0, 3116,
+  212, 2, 0, 3118, 214, 15, 1, 3122, 229, 1, 0, 3124,
+  230, 32, 1, 3126, 262, 3, 0, 3128, 265, 32, 1, 3134,
+  297, 1, 0, 3136, 316, 1, 0, 3138, 317, 48, 1, 3140,
+  365, 1, 0, 3142, 369, 1, 0, 3144, 370, 49, 1, 3146,
+  419, 1, 0, 3148, 6, 101, 1, 3150, 107, 1, 0, 3152,
+  110, 18, 1, 3154, 128, 2, 0, 3156, 130, 29, 1, 3160,
+  159, 2, 0, 3162, 161, 49, 1, 3166, 210, 1, 0, 3168,
+  212, 2, 0, 3170, 214, 16, 1, 3174, 230, 2, 0, 3176,
+  232, 30, 1, 3180, 262, 3, 0, 3182, 265, 31, 1, 3188,
+  296, 1, 0, 3190, 316, 1, 0, 3192, 317, 48, 1, 3194,
+  365, 1, 0, 3196, 369, 1, 0, 3198, 370, 49, 1, 3200,
+  419, 1, 0, 3202, 5, 1, 0, 3204, 6, 101, 1, 3206,
+  107, 1, 0, 3208, 110, 19, 1, 3210, 129, 2, 0, 3212,
+  131, 27, 1, 3216, 158, 3, 0, 3218, 161, 49, 1, 3224,
+  210, 1, 0, 3226, 212, 2, 0, 3228, 214, 18, 1, 3232,
+  232, 1, 0, 3234, 233, 30, 1, 3236, 263, 2, 0, 3238,
+  265, 30, 1, 3242, 295, 1, 0, 3244, 316, 1, 0, 3246,
+  317, 49, 1, 3248, 366, 1, 0, 3250, 369, 50, 1, 3252,
+  419, 1, 0, 3254, 5, 1, 0, 3256, 6, 101, 1, 3258,
+  107, 1, 0, 3260, 109, 1, 0, 3262, 110, 20, 1, 3264,
+  130, 2, 0, 3266, 132, 27, 1, 3270, 159, 2, 0, 3272,
+  161, 49, 1, 3276, 210, 1, 0, 3278, 212, 1, 0, 3280,
+  213, 20, 1, 3282, 233, 1, 0, 3284, 234, 29, 1, 3286,
+  263, 2, 0, 3288, 265, 28, 1, 3292, 293, 1, 0, 3294,
+  316, 1, 0, 3296, 317, 49, 1, 3298, 366, 1, 0, 3300,
+  368, 1, 0, 3302, 369, 50, 1, 3304, 419, 1, 0, 3306,
+  5, 1, 0, 3308, 6, 101, 1, 3310, 107, 1, 0, 3312,
+  109, 1, 0, 3314, 110, 22, 1, 3316, 132, 2, 0, 3318,
+  134, 25, 1, 3322, 159, 2, 0, 3324, 161, 50, 1, 3328,
+  211, 2, 0, 3330, 213, 21, 1, 3334, 234, 2, 0, 3336,
+  236, 27, 1, 3340, 263, 2, 0, 3342, 265, 26, 1, 3346,
+  291, 2, 0, 3348, 316, 1, 0, 3352, 317, 49, 1, 3354,
+  366, 1, 0, 3356, 368, 1, 0, 3358, 369, 50, 1, 3360,
+  419, 1, 0, 3362, 5, 1, 0, 3364, 6, 102, 1, 3366,
+  109, 1, 0, 3368, 110, 24, 1, 3370, 134, 2, 0, 3372,
+  136, 25, 1, 3376, 161, 50, 1, 3378, 211, 2, 0, 3380,
+  213, 23, 1, 3384, 236, 2, 0, 3386, 238, 25, 1, 3390,
+  263, 2, 0, 3392, 265, 25, 1, 3396, 290, 2, 0, 3398,
+  316, 1, 0, 3402, 317, 49, 1, 3404, 366, 1, 0, 3406,
+  368, 1, 0, 3408, 369, 50, 1, 3410, 419, 1, 0, 3412,
+  5, 1, 0, 3414, 6, 49, 1, 3416, 55, 3, 0, 3418,
+  58, 50, 1, 3424, 109, 1, 0, 3426, 110, 25, 1, 3428,
+  135, 4, 0, 3430, 139, 19, 1, 3438, 158, 4, 0, 3440,
+  162, 49, 1, 3448, 211, 2, 0, 3450, 213, 24, 1, 3454,
+  237, 2, 0, 3456, 239, 24, 1, 3460, 263, 2, 0, 3462,
+  265, 23, 1, 3466, 288, 2, 0, 3468, 316, 1, 0, 3472,
+  317, 49, 1, 3474, 366, 1, 0, 3476, 368, 1, 0, 3478,
+  369, 50, 1, 3480, 419, 1, 0, 3482, 5, 1, 0, 3484,
+  6, 47, 1, 3486, 53, 2, 0, 3488, 58, 2, 0, 3492,
+  60, 48, 1, 3496, 108, 2, 0, 3498, 110, 27, 1, 3502,
+  137, 3, 0, 3504, 140, 16, 1, 3510, 156, 2, 0, 3512,
+  162, 3, 0, 3516, 165, 46, 1, 3522, 211, 2, 0, 3524,
+  213, 26, 1, 3528, 239, 2, 0, 3530, 241, 21, 1, 3534,
+  262, 4, 0, 3536, 266, 20, 1, 3544, 286, 2, 0, 3546,
+  316, 1, 0, 3550, 317, 49, 1, 3552, 366, 1, 0, 3554,
+  368, 1, 0, 3556, 369, 50, 1, 3558, 419, 1, 0, 3560,
+  5, 1, 0, 3562, 6, 46, 1, 3564, 52, 1, 0, 3566,
+  60, 1, 0, 3568, 61, 47, 1, 3570, 108, 1, 0, 3572,
+  109, 30, 1, 3574, 139, 3, 0, 3576, 142, 14, 1, 3582,
+  156, 1, 0, 3584, 164, 1, 0, 3586, 165, 46, 1, 3588,
+  211, 2, 0, 3590, 213, 28, 1, 3594, 241, 2, 0, 3596,
+  243, 17, 1, 3600, 260, 2, 0, 3602, 265, 2, 0, 3606,
+  267, 16, 1, 3610, 283, 3, 0, 3612, 316, 1, 0, 3618,
+  317, 47, 1, 3620, 364, 2, 0, 3622, 369, 2, 0, 3626,
+  371, 48, 1, 3630, 419, 1, 0, 3632, 5, 46, 1, 3634,
+  51, 1, 0, 3636, 61, 1, 0, 3638, 62, 46, 1, 3640,
+  108, 1, 0, 3642, 109, 33, 1, 3644, 142, 4, 0, 3646,
+  146, 9, 1, 3654, 155, 1, 0, 3656, 164, 1, 0, 3658,
+  165, 46, 1, 3660, 211, 2, 0, 3662, 213, 30, 1, 3666,
+  243, 3, 0, 3668, 246, 14, 1, 3674, 260, 1, 0, 3676,
+  267, 1, 0, 3678, 268, 14, 1, 3680, 282, 2, 0, 3682,
+  316, 1, 0, 3686, 317, 46, 1, 3688, 363, 1, 0, 3690,
+  371, 1, 0, 3692, 372, 47, 1, 3694, 419, 1, 0, 3696,
+  5, 46, 1, 3698, 51, 1, 0, 3700, 61, 1, 0, 3702,
+  62, 46, 1, 3704, 108, 1, 0, 3706, 109, 36, 1, 3708,
+  145, 5, 0, 3710, 150, 5, 1, 3720, 165, 1, 0, 3722,
+  166, 45, 1, 3724, 211, 2, 0, 3726, 213, 33, 1, 3730,
+  246, 2, 0, 3732, 248, 11, 1, 3736, 259, 1, 0, 3738,
+  268, 1, 0, 3740, 269, 10, 1, 3742, 279, 2, 0, 3744,
+  316, 1, 0, 3748, 317, 46, 1, 3750, 372, 1, 0, 3752,
+  373, 46, 1, 3754, 419, 1, 0, 3756, 5, 46, 1, 3758,
+  51, 1, 0, 3760, 61, 1, 0, 3762, 62, 46, 1, 3764,
+  108, 1, 0, 3766, 109, 40, 1, 3768, 149, 6, 0, 3770,
+  165, 1, 0, 3782, 166, 45, 1, 3784, 211, 2, 0, 3786,
+  213, 36, 1, 3790, 249, 4, 0, 3792, 253, 5, 1, 3800,
+  258, 1, 0, 3802, 269, 6, 1, 3804, 275, 3, 0, 3806,
+  316, 1, 0, 3812, 317, 45, 1, 3814, 362, 1, 0, 3816,
+  372, 1, 0, 3818, 373, 46, 1, 3820, 419, 1, 0, 3822,
+  5, 9, 0, 3824, 14, 34, 1, 3842, 48, 4, 0, 3844,
+  61, 1, 0, 3852, 62, 46, 1, 3854, 108, 1, 0, 3856,
+  109, 43, 1, 3858, 152, 3, 0, 3860, 165, 1, 0, 3866,
+  166, 45, 1, 3868, 211, 2, 0, 3870, 213, 39, 1, 3874,
+  252, 7, 0, 3876, 269, 5, 0, 3890, 316, 1, 0, 3900,
+  317, 45, 1, 3902, 362, 1, 0, 3904, 373, 46, 1, 3906,
+  419, 1, 0, 3908, 5, 9, 1, 3910, 14, 5, 0, 3912,
+  19, 23, 1, 3922, 42, 10, 0, 3924, 61, 1, 0, 3944,
+  62, 46, 1, 3946, 108, 1, 0, 3948, 109, 46, 1, 3950,
+  165, 1, 0, 3952, 166, 45, 1, 3954, 211, 2, 0, 3956,
+  213, 44, 1, 3960, 257, 2, 0, 3962, 269, 2, 0, 3966,
+  316, 1, 0, 3970, 317, 45, 1, 3972, 362, 1, 0, 3974,
+  373, 46, 1, 3976, 419, 1, 0, 3978, 5, 13, 1, 3980,
+  18, 4, 0, 3982, 22, 17, 1, 3990, 39, 4, 0, 3992,
+  43, 8, 1, 4000, 51, 1, 0, 4002, 61, 1, 0, 4004,
+  62, 46, 1, 4006, 108, 1, 0, 4008, 109, 46, 1, 4010,
+  155, 1, 0, 4012, 165, 1, 0, 4014, 166, 45, 1, 4016,
+  211, 2, 0, 4018, 213, 45, 1, 4022, 258, 1, 0, 4024,
+  269, 7, 0, 4026, 316, 46, 1, 4040, 362, 1, 0, 4042,
+  372, 1, 0, 4044, 373, 5, 1, 4046, 378, 3, 0, 4048,
+  381, 38, 1, 4054, 419, 1, 0, 4056, 5, 16, 1, 4058,
+  21, 4, 0, 4060, 25, 11, 1, 4068, 36, 4, 0, 4070,
+  40, 12, 1, 4078, 52, 1, 0, 4080, 60, 1, 0, 4082,
+  61, 47, 1, 4084, 108, 1, 0, 4086, 109, 46, 1, 4088,
+  155, 1, 0, 4090, 164, 1, 0, 4092, 165, 46, 1, 4094,
+  211, 2, 0, 4096, 213, 45, 1, 4100, 258, 2, 0, 4102,
+  268, 1, 0, 4106, 269, 7, 1, 4108, 276, 4, 0, 4110,
+  316, 46, 1, 4118, 362, 1, 0, 4120, 372, 1, 0, 4122,
+  373, 9, 1, 4124, 382, 3, 0, 4126, 385, 34, 1, 4132,
+  5, 19, 1, 4134, 24, 3, 0, 4136, 27, 7, 1, 4142,
+  34, 3, 0, 4144, 37, 16, 1, 4150, 53, 1, 0, 4152,
+  59, 2, 0, 4154, 61, 47, 1, 4158, 108, 1, 0, 4160,
+  109, 47, 1, 4162, 156, 2, 0, 4164, 163, 1, 0, 4168,
+  164, 47, 1, 4170, 211, 2, 0, 4172, 213, 46, 1, 4176,
+  259, 1, 0, 4178, 268, 1, 0, 4180, 269, 11, 1, 4182,
+  280, 3, 0, 4184, 316, 1, 0, 4190, 317, 46, 1, 4192,
+  363, 1, 0, 4194, 371, 2, 0, 4196, 373, 12, 1, 4200,
+  385, 2, 0, 4202, 387, 32, 1, 4206, 5, 1, 0, 4208,
+  6, 21, 1, 4210, 27, 8, 0, 4212, 35, 19, 1, 4228,
+  54, 5, 0, 4230, 59, 49, 1, 4240, 108, 1, 0, 4242,
+  109, 49, 1, 4244, 158, 5, 0, 4246, 163, 48, 1, 4256,
+  211, 2, 0, 4258, 213, 47, 1, 4262, 260, 1, 0, 4264,
+  266, 2, 0, 4266, 268, 14, 1, 4270, 282, 3, 0, 4272,
+  316, 1, 0, 4278, 317, 47, 1, 4280, 364, 1, 0, 4282,
+  370, 2, 0, 4284, 372, 15, 1, 4288, 387, 4, 1, 4290,
+  391, 28, 1, 4292, 5, 1, 0, 4294, 6, 23, 1, 4296,
+  29, 4, 0, 4298, 33, 23, 1, 4306, 56, 1, 0, 4308,
+  57, 51, 1, 4310, 109, 1, 0, 4312, 110, 101, 1, 4314,
+  211, 2, 0, 4316, 213, 49, 1, 4320, 262, 4, 0, 4322,
+  266, 19, 1, 4330, 285, 2, 0, 4332, 316, 1, 0, 4336,
+  317, 48, 1, 4338, 365, 5, 0, 4340, 370, 20, 1, 4350,
+  390, 1, 0, 4352, 391, 28, 1, 4354, 5, 1, 0, 4356,
+  6, 23, 1, 4358, 29, 3, 0, 4360, 32, 24, 1, 4366,
+  56, 1, 0, 4368, 57, 50, 1, 4370, 107, 1, 0, 4372,
+  109, 1, 0, 4374, 110, 101, 1, 4376, 211, 2, 0, 4378,
+  213, 50, 1, 4382, 263, 2, 0, 4384, 265, 22, 1, 4388,
+  287, 2, 0, 4390, 316, 1, 0, 4394, 317, 50, 1, 4396,
+  367, 1, 0, 4398, 368, 23, 1, 4400, 391, 2, 0, 4402,
+  393, 26, 1, 4406, 5, 1, 0, 4408, 6, 22, 1, 4410,
+  28, 6, 0, 4412, 34, 22, 1, 4424, 56, 1, 0, 4426,
+  57, 50, 1, 4428, 107, 1, 0, 4430, 109, 1, 0, 4432,
+  110, 101, 1, 4434, 211, 2, 0, 4436, 213, 50, 1, 4440,
+  263, 2, 0, 4442, 265, 24, 1, 4446, 289, 2, 0, 4448,
+  316, 1, 0, 4452, 317, 50, 1, 4454, 367, 1, 0, 4456,
+  368, 26, 1, 4458, 394, 1, 0, 4460, 395, 23, 1, 4462,
+  418, 1, 0, 4464, 5, 1, 0, 4466, 6, 20, 1, 4468,
+  26, 2, 0, 4470, 28, 6, 1, 4474, 34, 1, 0, 4476,
+  35, 21, 1, 4478, 56, 1, 0, 4480, 57, 50, 1, 4482,
+  107, 1, 0, 4484, 109, 1, 0, 4486, 110, 101, 1, 4488,
+  212, 1, 0, 4490, 213, 50, 1, 4492, 263, 2, 0, 4494,
+  265, 26, 1, 4498, 291, 1, 0, 4500, 316, 1, 0, 4502,
+  317, 50, 1, 4504, 367, 2, 0, 4506, 369, 26, 1, 4510,
+  395, 1, 0, 4512, 396, 23, 1, 4514, 5, 1, 0, 4516,
+  6, 19, 1, 4518, 25, 1, 0, 4520, 26, 9, 1, 4522,
+  35, 2, 0, 4524, 37, 19, 1, 4528, 56, 1, 0, 4530,
+  57, 50, 1, 4532, 107, 1, 0, 4534, 109, 1, 0, 4536,
+  110, 100, 1, 4538, 210, 1, 0, 4540, 212, 1, 0, 4542,
+  213, 49, 1, 4544, 262, 3, 0, 4546, 265, 27, 1, 4552,
+  292, 2, 0, 4554, 317, 50, 1, 4558, 367, 2, 0, 4560,
+  369, 27, 1, 4564, 396, 2, 0, 4566, 398, 20, 1, 4570,
+  418, 1, 0, 4572, 5, 1, 0, 4574, 6, 17, 1, 4576,
+  23, 2, 0, 4578, 25, 12, 1, 4582, 37, 1, 0, 4584,
+  38, 18, 1, 4586, 56, 1, 0, 4588, 57, 50, 1, 4590,
+  110, 100, 1, 4592, 210, 1, 0, 4594, 212, 1, 0, 4596,
+  213, 49, 1, 4598, 262, 1, 0, 4600, 264, 1, 0, 4602,
+  265, 28, 1, 4604, 293, 2, 0, 4606, 317, 50, 1, 4610,
+  367, 2, 0, 4612, 369, 29, 1, 4616, 398, 1, 0, 4618,
+  399, 19, 1, 4620, 418, 1, 0, 4622, 5, 2, 0, 4624,
+  7, 15, 1, 4628, 22, 2, 0, 4630, 24, 14, 1, 4634,
+  38, 1, 0, 4636, 39, 17, 1, 4638, 56, 1, 0, 4640,
+  57, 49, 1, 4642, 106, 1, 0, 4644, 110, 1, 0, 4646,
+  111, 99, 1, 4648, 210, 1, 0, 4650, 212, 1, 0, 4652,
+  213, 49, 1, 4654, 262, 1, 0, 4656, 264, 1, 0, 4658,
+  265, 30, 1, 4660, 295, 1, 0, 4662, 317, 1, 0, 4664,
+  318, 49, 1, 4666, 367, 2, 0, 4668, 369, 30, 1, 4672,
+  399, 1, 0, 4674, 400, 18, 1, 4676, 418, 1, 0, 4678,
+  5, 2, 0, 4680, 7, 14, 1, 4684, 21, 1, 0, 4686,
+  22, 17, 1, 4688, 39, 1, 0, 4690, 40, 16, 1, 4692,
+  56, 1, 0, 4694, 57, 49, 1, 4696, 106, 1, 0, 4698,
+  110, 1, 0, 4700, 111, 99, 1, 4702, 210, 1, 0, 4704,
+  212, 1, 0, 4706, 213, 49, 1, 4708, 262, 1, 0, 4710,
+  264, 1, 0, 4712, 265, 31, 1, 4714, 296, 2, 0, 4716,
+  317, 1, 0, 4720, 318, 49, 1, 4722, 367, 2, 0, 4724,
+  369, 32, 1, 4728, 401, 1, 0, 4730, 402, 16, 1, 4732,
+  418, 1, 0, 4734, 5, 2, 0, 4736, 7, 13, 1, 4740,
+  20, 1, 0, 4742, 21, 19, 1, 4744, 40, 1, 0, 4746,
+  41, 15, 1, 4748, 56, 1, 0, 4750, 57, 49, 1, 4752,
+  106, 1, 0, 4754, 110, 1, 0, 4756, 111, 98, 1, 4758,
+  209, 1, 0, 4760, 212, 1, 0, 4762, 213, 49, 1, 4764,
+  264, 1, 0, 4766, 265, 33, 1, 4768, 298, 1, 0, 4770,
+  317, 1, 0, 4772, 318, 49, 1, 4774, 367, 3, 0, 4776,
+  370, 32, 1, 4782, 402, 1, 0, 4784, 403, 14, 1, 4786,
+  417, 2, 0, 4788, 5, 2, 0, 4792, 7, 12, 1, 4796,
+  19, 1, 0, 4798, 20, 21, 1, 4800, 41, 1, 0, 4802,
+  42, 14, 1, 4804, 56, 1, 0, 4806, 57, 48, 1, 4808,
+  105, 1, 0, 4810, 111, 98, 1, 4812, 209, 1, 0, 4814,
+  212, 1, 0, 4816, 213, 48, 1, 4818, 261, 1, 0, 4820,
+  264, 1, 0, 4822, 265, 34, 1, 4824, 299, 1, 0, 4826,
+  318, 1, 0, 4828, 319, 48, 1, 4830, 367, 3, 0, 4832,
+  370, 33, 1, 4838, 403, 2, 0, 4840, 405, 12, 1, 4844,
+  417, 2, 0, 4846, 5, 3, 0, 4850, 8, 10, 1, 4856,
+  18, 1, 0, 4858, 19, 23, 1, 4860, 42, 1, 0, 4862,
+  43, 13, 1, 4864, 56, 1, 0, 4866, 57, 48, 1, 4868,
+  105, 1, 0, 4870, 111, 1, 0, 4872, 112, 97, 1, 4874,
+  209, 1, 0, 4876, 212, 1, 0, 4878, 213, 48, 1, 4880,
+  261, 1, 0, 4882, 264, 1, 0, 4884, 265, 35, 1, 4886,
+  300, 1, 0, 4888, 318, 1, 0, 4890, 319, 48, 1, 4892,
+  367, 3, 0, 4894, 370, 34, 1, 4900, 404, 2, 0, 4902,
+  406, 11, 1, 4906, 417, 2, 0, 4908, 5, 3, 0, 4912,
+  8, 9, 1, 4918, 17, 1, 0, 4920, 18, 25, 1, 4922,
+  43, 1, 0, 4924, 44, 12, 1, 4926, 56, 1, 0, 4928,
+  57, 48, 1, 4930, 105, 1, 0, 4932, 111, 1, 0, 4934,
+  112, 96, 1, 4936, 208, 1, 0, 4938, 212, 1, 0, 4940,
+  213, 48, 1, 4942, 261, 1, 0, 4944, 264, 1, 0, 4946,
+  265, 36, 1, 4948, 301, 1, 0, 4950, 318, 1, 0, 4952,
+  319, 48, 1, 4954, 367, 3, 0, 4956, 370, 35, 1, 4962,
+  405, 1, 0, 4964, 406, 10, 1, 4966, 416, 3, 0, 4968,
+  5, 4, 0, 4974, 9, 8, 1, 4982, 17, 27, 1, 4984,
+  44, 1, 0, 4986, 45, 11, 1, 4988, 56, 1, 0, 4990,
+  57, 47, 1, 4992, 104, 1, 0, 4994, 112, 1, 0, 4996,
+  113, 95, 1, 4998, 208, 1, 0, 5000, 212, 1, 0, 5002,
+  213, 47, 1, 5004, 260, 1, 0, 5006, 264, 1, 0, 5008,
+  265, 36, 1, 5010, 301, 2, 0, 5012, 319, 48, 1, 5016,
+  367, 4, 0, 5018, 371, 35, 1, 5026, 406, 2, 0, 5028,
+  408, 8, 1, 5032, 416, 3, 0, 5034, 5, 4, 0, 5040,
+  9, 7, 1, 5048, 16, 1, 0, 5050, 17, 28, 1, 5052,
+  45, 1, 0, 5054, 46, 10, 1, 5056, 56, 1, 0, 5058,
+  57, 47, 1, 5060, 104, 1, 0, 5062, 112, 1, 0, 5064,
+  113, 95, 1, 5066, 212, 1, 0, 5068, 213, 47, 1, 5070,
+  260, 1, 0, 5072, 264, 1, 0, 5074, 265, 37, 1, 5076,
+  302, 2, 0, 5078, 319, 1, 0, 5082, 320, 47, 1, 5084,
+  367, 4, 0, 5086, 371, 36, 1, 5094, 407, 1, 0, 5096,
+  408, 8, 1, 5098, 416, 3, 0, 5100, 5, 4, 0, 5106,
+  9, 6, 1, 5114, 15, 1, 0, 5116, 16, 30, 1, 5118,
+  46, 1, 0, 5120, 47, 9, 1, 5122, 56, 1, 0, 5124,
+  57, 47, 1, 5126, 104, 1, 0, 5128, 112, 1, 0, 5130,
+  113, 94, 1, 5132, 207, 1, 0, 5134, 212, 1, 0, 5136,
+  213, 47, 1, 5138, 264, 1, 0, 5140, 265, 38, 1, 5142,
+  303, 1, 0, 5144, 319, 1, 0, 5146, 320, 47, 1, 5148,
+  367, 5, 0, 5150, 372, 36, 1, 5160, 408, 7, 1, 5162,
+  415, 4, 0, 5164, 5, 4, 1, 5172, 9, 1, 0, 5174,
+  10, 4, 1, 5176, 14, 1, 0, 5178, 15, 31, 1, 5180,
+  46, 1, 0, 5182, 47, 9, 1, 5184, 56, 1, 0, 5186,
+  57, 46, 1, 5188, 103, 1, 0, 5190, 113, 1, 0, 5192,
+  114, 93, 1, 5194, 207, 1, 0, 5196, 212, 1, 0, 5198,
+  213, 46, 1, 5200, 259, 1, 0, 5202, 264, 1, 0, 5204,
+  265, 39, 1, 5206, 304, 1, 0, 5208, 320, 1, 0, 5210,
+  321, 46, 1, 5212, 367, 5, 0, 5214, 372, 36, 1, 5224,
+  408, 1, 0, 5226, 409, 6, 1, 5228, 415, 4, 0, 5230,
+  5, 4, 1, 5238, 9, 5, 0, 5240, 14, 33, 1, 5250,
+  47, 1, 0, 5252, 48, 8, 1, 5254, 56, 1, 0, 5256,
+  57, 46, 1, 5258, 103, 1, 0, 5260, 113, 1, 0, 5262,
+  114, 92, 1, 5264, 206, 1, 0, 5266, 212, 1, 0, 5268,
+  213, 46, 1, 5270, 259, 1, 0, 5272, 264, 1, 0, 5274,
+  265, 40, 1, 5276, 305, 1, 0, 5278, 320, 1, 0, 5280,
+  321, 46, 1, 5282, 367, 1, 0, 5284, 368, 4, 1, 5286,
+  372, 1, 0, 5288, 373, 36, 1, 5290, 409, 1, 0, 5292,
+  410, 5, 1, 5294, 415, 4, 0, 5296, 5, 5, 1, 5304,
+  10, 4, 0, 5306, 14, 34, 1, 5314, 48, 1, 0, 5316,
+  49, 7, 1, 5318, 56, 1, 0, 5320, 57, 45, 1, 5322,
+  102, 1, 0, 5324, 114, 1, 0, 5326, 115, 91, 1, 5328,
+  206, 1, 0, 5330, 212, 1, 0, 5332, 213, 45, 1, 5334,
+  258, 1, 0, 5336, 264, 1, 0, 5338, 265, 41, 1, 5340,
+  306, 1, 0, 5342, 321, 46, 1, 5344, 367, 1, 0, 5346,
+  368, 4, 1, 5348, 372, 1, 0, 5350, 373, 37, 1, 5352,
+  410, 5, 0, 5354, 415, 4, 1, 5364, 5, 5, 1, 5366,
+  10, 3, 0, 5368, 13, 35, 1, 5374, 48, 1, 0, 5376,
+  49, 7, 1, 5378, 56, 1, 0, 5380, 57, 45, 1, 5382,
+  102, 1, 0, 5384, 114, 1, 0, 5386, 115, 90, 1, 5388,
+  205, 1, 0, 5390, 212, 1, 0, 5392, 213, 45, 1, 5394,
+  258, 1, 0, 5396, 264, 1, 0, 5398, 265, 41, 1, 5400,
+  306, 1, 0, 5402, 321, 1, 0, 5404, 322, 45, 1, 5406,
+  367, 1, 0, 5408, 368, 5, 1, 5410, 373, 1, 0, 5412,
+  374, 36, 1, 5414, 410, 5, 0, 5416, 415, 4, 1, 5426,
+  5, 6, 1, 5428, 11, 1, 0, 5430, 12, 37, 1, 5432,
+  49, 1, 0, 5434, 50, 6, 1, 5436, 56, 1, 0, 5438,
+  57, 44, 1, 5440, 101, 1, 0, 5442, 115, 1, 0, 5444,
+  116, 89, 1, 5446, 205, 1, 0, 5448, 212, 1, 0, 5450,
+  213, 44, 1, 5452, 257, 1, 0, 5454, 264, 1, 0, 5456,
+  265, 42, 1, 5458, 307, 1, 0, 5460, 322, 45, 1, 5462,
+  367, 1, 0, 5464, 368, 5, 1, 5466, 373, 1, 0, 5468,
+  374, 37, 1, 5470, 411, 3, 0, 5472, 414, 5, 1, 5478,
+  5, 6, 1, 5480, 11, 1, 0, 5482, 12, 38, 1, 5484,
+  50, 6, 1, 5486, 56, 1, 0, 5488, 57, 44, 1, 5490,
+  101, 1, 0, 5492, 115, 1, 0, 5494, 116, 88, 1, 5496,
+  204, 1, 0, 5498, 212, 1, 0, 5500, 213, 44, 1, 5502,
+  257, 1, 0, 5504, 264, 1, 0, 5506, 265, 43, 1, 5508,
+  308, 1, 0, 5510, 322, 1, 0, 5512, 323, 44, 1, 5514,
+  367, 1, 0, 5516, 368, 6, 1, 5518, 374, 38, 1, 5520,
+  412, 1, 0, 5522, 413, 6, 1, 5524, 5, 5, 1, 5526,
+  10, 3, 0, 5528, 13, 37, 1, 5534, 50, 1, 0, 5536,
+  51, 5, 1, 5538, 56, 1, 0, 5540, 57, 43, 1, 5542,
+  100, 1, 0, 5544, 116, 1, 0, 5546, 117, 86, 1, 5548,
+  203, 2, 0, 5550, 212, 1, 0, 5554, 213, 43, 1, 5556,
+  256, 1, 0, 5558, 264, 1, 0, 5560, 265, 43, 1, 5562,
+  308, 1, 0, 5564, 323, 1, 0, 5566, 324, 43, 1, 5568,
+  367, 1, 0, 5570, 368, 6, 1, 5572, 374, 1, 0, 5574,
+  375, 37, 1, 5576, 412, 1, 0, 5578, 413, 6, 1, 5580,
+  5, 5, 1, 5582, 10, 3, 0, 5584, 13, 38, 1, 5590,
+  51, 1, 0, 5592, 52, 4, 1, 5594, 56, 1, 0, 5596,
+  57, 42, 1, 5598, 99, 1, 0, 5600, 117, 1, 0, 5602,
+  118, 84, 1, 5604, 202, 2, 0, 5606, 212, 1, 0, 5610,
+  213, 42, 1, 5612, 255, 1, 0, 5614, 264, 1, 0, 5616,
+  265, 44, 1, 5618, 309, 1, 0, 5620, 323, 1, 0, 5622,
+  324, 43, 1, 5624, 367, 1, 0, 5626, 368, 7, 1, 5628,
+  375, 1, 0, 5630, 376, 36, 1, 5632, 412, 2, 0, 5634,
+  414, 5, 1, 5638, 5, 4, 1, 5640, 9, 5, 0, 5642,
+  14, 37, 1, 5652, 51, 1, 0, 5654, 52, 4, 1, 5656,
+  56, 1, 0, 5658, 57, 42, 1, 5660, 99, 1, 0, 5662,
+  117, 1, 0, 5664, 118, 84, 1, 5666, 202, 1, 0, 5668,
+  212, 1, 0, 5670, 213, 42, 1, 5672, 255, 1, 0, 5674,
+  264, 1, 0, 5676, 265, 44, 1, 5678, 309, 1, 0, 5680,
+  324, 1, 0, 5682, 325, 42, 1, 5684, 367, 1, 0, 5686,
+  368, 7, 1, 5688, 375, 1, 0, 5690, 376, 35, 1, 5692,
+  411, 3, 0, 5694, 414, 5, 1, 5700, 5, 4, 1, 5702,
+  9, 1, 0, 5704, 10, 4, 1, 5706, 14, 1, 0, 5708,
+  15, 37, 1, 5710, 52, 4, 1, 5712, 56, 1, 0, 5714,
+  57, 41, 1, 5716, 98, 1, 0, 5718, 118, 2, 0, 5720,
+  120, 81, 1, 5724, 201, 2, 0, 5726, 212, 1, 0, 5730,
+  213, 41, 1, 5732, 254, 1, 0, 5734, 264, 1, 0, 5736,
+  265, 45, 1, 5738, 310, 1, 0, 5740, 325, 1, 0, 5742,
+  326, 41, 1, 5744, 367, 1, 0, 5746, 368, 8, 1, 5748,
+  376, 1, 0, 5750, 377, 33, 1, 5752, 410, 5, 0, 5754,
+  415, 4, 1, 5764, 5, 4, 0, 5766, 9, 5, 1, 5774,
+  14, 1, 0, 5776, 15, 37, 1, 5778, 52, 5, 0, 5780,
+  57, 40, 1, 5790, 97, 1, 0, 5792, 119, 1, 0, 5794,
+  120, 81, 1, 5796, 201, 1, 0, 5798, 212, 1, 0, 5800,
+  213, 40, 1, 5802, 253, 1, 0, 5804, 264, 1, 0, 5806,
+  265, 45, 1, 5808, 310, 1, 0, 5810, 325, 1, 0, 5812,
+  326, 41, 1, 5814, 367, 1, 0, 5816, 368, 9, 1, 5818,
+  377, 1, 0, 5820, 378, 32, 1, 5822, 410, 4, 1, 5824,
+  414, 5, 0, 5826, 5, 4, 0, 5836, 9, 6, 1, 5844,
+  15, 1, 0, 5846, 16, 37, 1, 5848, 53, 4, 0, 5850,
+  57, 39, 1, 5858, 96, 1, 0, 5860, 119, 2, 0, 5862,
+  121, 78, 1, 5866, 199, 2, 0, 5868, 212, 1, 0, 5872,
+  213, 40, 1, 5874, 253, 1, 0, 5876, 264, 1, 0, 5878,
+  265, 46, 1, 5880, 311, 1, 0, 5882, 326, 1, 0, 5884,
+  327, 40, 1, 5886, 367, 1, 0, 5888, 368, 10, 1, 5890,
+  378, 31, 1, 5892, 409, 1, 0, 5894, 410, 5, 1, 5896,
+  415, 4, 0, 5898, 5, 4, 0, 5906, 9, 7, 1, 5914,
+  16, 1, 0, 5916, 17, 36, 1, 5918, 53, 4, 0, 5920,
+  57, 39, 1, 5928, 96, 1, 0, 5930, 120, 2, 0, 5932,
+  122, 77, 1, 5936, 199, 1, 0, 5938, 212, 1, 0, 5940,
+  213, 39, 1, 5942, 252, 1, 0, 5944, 264, 1, 0, 5946,
+  265, 46, 1, 5948, 311, 1, 0, 5950, 327, 1, 0, 5952,
+  328, 39, 1, 5954, 367, 1, 0, 5956, 368, 10, 1, 5958,
+  378, 1, 0, 5960, 379, 29, 1, 5962, 408, 1, 0, 5964,
+  409, 6, 1, 5966, 415, 4, 0, 5968, 5, 3, 0, 5976,
+  8, 9, 1, 5982, 17, 1, 0, 5984, 18, 35, 1, 5986,
+  53, 4, 0, 5988, 57, 38, 1, 5996, 95, 1, 0, 5998,
+  121, 1, 0, 6000, 122, 76, 1, 6002, 198, 1, 0, 6004,
+  212, 1, 0, 6006, 213, 38, 1, 6008, 251, 1, 0, 6010,
+  264, 1, 0, 6012, 265, 47, 1, 6014, 312, 1, 0, 6016,
+  328, 1, 0, 6018, 329, 38, 1, 6020, 367, 1, 0, 6022,
+  368, 11, 1, 6024, 379, 1, 0, 6026, 380, 27, 1, 6028,
+  407, 1, 0, 6030, 408, 8, 1, 6032, 416, 3, 0, 6034,
+  5, 3, 0, 6040, 8, 10, 1, 6046, 18, 1, 0, 6048,
+  19, 35, 1, 6050, 54, 3, 0, 6052, 57, 37, 1, 6058,
+  94, 1, 0, 6060, 122, 1, 0, 6062, 123, 74, 1, 6064,
+  197, 1, 0, 6066, 212, 1, 0, 6068, 213, 37, 1, 6070,
+  250, 1, 0, 6072, 264, 1, 0, 6074, 265, 47, 1, 6076,
+  312, 1, 0, 6078, 329, 1, 0, 6080, 330, 37, 1, 6082,
+  367, 1, 0, 6084, 368, 12, 1, 6086, 380, 1, 0, 6088,
+  381, 25, 1, 6090, 406, 1, 0, 6092, 407, 9, 1, 6094,
+  416, 3, 0, 6096, 5, 3, 0, 6102, 8, 11, 1, 6108,
+  19, 1, 0, 6110, 20, 34, 1, 6112, 54, 3, 0, 6114,
+  57, 36, 1, 6120, 93, 1, 0, 6122, 123, 1, 0, 6124,
+  124, 72, 1, 6126, 196, 1, 0, 6128, 212, 1, 0, 6130,
+  213, 36, 1, 6132, 249, 1, 0, 6134, 264, 1, 0, 6136,
+  265, 47, 1, 6138, 312, 1, 0, 6140, 329, 1, 0, 6142,
+  330, 37, 1, 6144, 367, 1, 0, 6146, 368, 13, 1, 6148,
+  381, 1, 0, 6150, 382, 23, 1, 6152, 405, 2, 0, 6154,
+  407, 9, 1, 6158, 416, 3, 0, 6160, 5, 2, 0, 6166,
+  7, 13, 1, 6170, 20, 1, 0, 6172, 21, 33, 1, 6174,
+  54, 3, 0, 6176, 57, 35, 1, 6182, 92, 1, 0, 6184,
+  124, 1, 0, 6186, 125, 70, 1, 6188, 195, 2, 0, 6190,
+  212, 1, 0, 6194, 213, 35, 1, 6196, 248, 1, 0, 6198,
+  264, 1, 0, 6200, 265, 47, 1, 6202, 312, 2, 0, 6204,
+  330, 1, 0, 6208, 331, 36, 1, 6210, 367, 1, 0, 6212,
+  368, 14, 1, 6214, 382, 1, 0, 6216, 383, 21, 1, 6218,
+  404, 1, 0, 6220, 405, 12, 1, 6222, 417, 2, 0, 6224,
+  5, 2, 0, 6228, 7, 14, 1, 6232, 21, 1, 0, 6234,
+  22, 32, 1, 6236, 54, 3, 0, 6238, 57, 34, 1, 6244,
+  91, 1, 0, 6246, 125, 1, 0, 6248, 126, 68, 1, 6250,
+  194, 1, 0, 6252, 212, 1, 0, 6254, 213, 34, 1, 6256,
+  247, 1, 0, 6258, 264, 1, 0, 6260, 265, 48, 1, 6262,
+  313, 1, 0, 6264, 331, 2, 0, 6266, 333, 34, 1, 6270,
+  367, 1, 0, 6272, 368, 15, 1, 6274, 383, 1, 0, 6276,
+  384, 19, 1, 6278, 403, 1, 0, 6280, 404, 13, 1, 6282,
+  417, 2, 0, 6284, 5, 2, 0, 6288, 7, 15, 1, 6292,
+  22, 1, 0, 6294, 23, 32, 1, 6296, 55, 2, 0, 6298,
+  57, 33, 1, 6302, 90, 1, 0, 6304, 126, 2, 0, 6306,
+  128, 65, 1, 6310, 193, 1, 0, 6312, 212, 1, 0, 6314,
+  213, 33, 1, 6316, 246, 1, 0, 6318, 264, 1, 0, 6320,
+  265, 48, 1, 6322, 313, 1, 0, 6324, 332, 1, 0, 6326,
+  333, 34, 1, 6328, 367, 1, 0, 6330, 368, 16, 1, 6332,
+  384, 1, 0, 6334, 385, 17, 1, 6336, 402, 1, 0, 6338,
+  403, 14, 1, 6340, 417, 2, 0, 6342, 5, 2, 0, 6346,
+  7, 16, 1, 6350, 23, 1, 0, 6352, 24, 31, 1, 6354,
+  55, 2, 0, 6356, 57, 31, 1, 6360, 88, 2, 0, 6362,
+  127, 2, 0, 6366, 129, 63, 1, 6370, 192, 1, 0, 6372,
+  212, 1, 0, 6374, 213, 31, 1, 6376, 244, 2, 0, 6378,
+  264, 1, 0, 6382, 265, 48, 1, 6384, 313, 1, 0, 6386,
+  333, 2, 0, 6388, 335, 32, 1, 6392, 367, 1, 0, 6394,
+  368, 17, 1, 6396, 385, 1, 0, 6398, 386, 15, 1, 6400,
+  401, 1, 0, 6402, 402, 15, 1, 6404, 417, 2, 0, 6406,
+  5, 1, 0, 6410, 6, 18, 1, 6412, 24, 2, 0, 6414,
+  26, 29, 1, 6418, 55, 2, 0, 6420, 57, 30, 1, 6424,
+  87, 1, 0, 6426, 129, 1, 0, 6428, 130, 61, 1, 6430,
+  191, 1, 0, 6432, 212, 1, 0, 6434, 213, 31, 1, 6436,
+  244, 1, 0, 6438, 264, 1, 0, 6440, 265, 49, 1, 6442,
+  314, 1, 0, 6444, 335, 1, 0, 6446, 336, 31, 1, 6448,
+  367, 1, 0, 6450, 368, 18, 1, 6452, 386, 1, 0, 6454,
+  387, 13, 1, 6456, 400, 1, 0, 6458, 401, 17, 1, 6460,
+  418, 1, 0, 6462, 5, 1, 0, 6464, 6, 20, 1, 6466,
+  26, 1, 0, 6468, 27, 28, 1, 6470, 55, 2, 0, 6472,
+  57, 29, 1, 6476, 86, 1, 0, 6478, 130, 1, 0, 6480,
+  131, 58, 1, 6482, 189, 1, 0, 6484, 212, 1, 0, 6486,
+  213, 30, 1, 6488, 243, 1, 0, 6490, 264, 1, 0, 6492,
+  265, 49, 1, 6494, 314, 1, 0, 6496, 336, 1, 0, 6498,
+  337, 30, 1, 6500, 367, 1, 0, 6502, 368, 19, 1, 6504,
+  387, 1, 0, 6506, 388, 11, 1, 6508, 399, 1, 0, 6510,
+  400, 18, 1, 6512, 418, 1, 0, 6514, 5, 1, 0, 6516,
+  6, 21, 1, 6518, 27, 1, 0, 6520, 28, 28, 1, 6522,
+  56, 1, 0, 6524, 57, 27, 1, 6526, 84, 2, 0, 6528,
+  131, 2, 0, 6532, 133, 55, 1, 6536, 188, 1, 0, 6538,
+  212, 1, 0, 6540, 213, 28, 1, 6542, 241, 2, 0, 6544,
+  264, 1, 0, 6548, 265, 49, 1, 6550, 314, 1, 0, 6552,
+  337, 1, 0, 6554, 338, 29, 1, 6556, 367, 1, 0, 6558,
+  368, 21, 1, 6560, 389, 1, 0, 6562, 390, 7, 1, 6564,
+  397, 2, 0, 6566, 399, 19, 1, 6570, 418, 1, 0, 6572,
+  5, 1, 0, 6574, 6, 22, 1, 6576, 28, 2, 0, 6578,
+  30, 26, 1, 6582, 56, 1, 0, 6584, 57, 26, 1, 6586,
+  83, 1, 0, 6588, 133, 1, 0, 6590, 134, 51, 1, 6592,
+  185, 3, 0, 6594, 212, 1, 0, 6600, 213, 27, 1, 6602,
+  240, 1, 0, 6604, 264, 1, 0, 6606, 265, 50, 1, 6608,
+  339, 1, 0, 6610, 340, 27, 1, 6612, 367, 1, 0, 6614,
+  368, 22, 1, 6616, 390, 1, 0, 6618, 391, 5, 1, 6620,
+  396, 1, 0, 6622, 397, 21, 1, 6624, 418, 1, 0, 6626,
+  5, 1, 0, 6628, 6, 24, 1, 6630, 30, 2, 0, 6632,
+  32, 24, 1, 6636, 56, 1, 0, 6638, 57, 24, 1, 6640,
+  81, 1, 0, 6642, 135, 1, 0, 6644, 136, 48, 1, 6646,
+  184, 2, 0, 6648, 212, 1, 0, 6652, 213, 25, 1, 6654,
+  238, 2, 0, 6656, 264, 1, 0, 6660, 265, 50, 1, 6662,
+  340, 2, 0, 6664, 342, 25, 1, 6668, 367, 1, 0, 6670,
+  368, 24, 1, 6672, 392, 4, 0, 6674, 396, 22, 1, 6682,
+  418, 1, 0, 6684, 5, 1, 0, 6686, 6, 26, 1, 6688,
+  32, 1, 0, 6690, 33, 46, 1, 6692, 79, 2, 0, 6694,
+  136, 2, 0, 6698, 138, 44, 1, 6702, 182, 2, 0, 6704,
+  212, 1, 0, 6708, 213, 23, 1, 6710, 236, 2, 0, 6712,
+  264, 1, 0, 6716, 265, 50, 1, 6718, 315, 1, 0, 6720,
+  342, 2, 0, 6722, 344, 23, 1, 6726, 367, 1, 0, 6728,
+  368, 24, 1, 6730, 392, 3, 0, 6732, 395, 24, 1, 6738,
+  5, 29, 1, 6740, 34, 2, 0, 6742, 36, 40, 1, 6746,
+  76, 3, 0, 6748, 139, 2, 0, 6754, 141, 39, 1, 6758,
+  180, 2, 0, 6760, 212, 1, 0, 6764, 213, 21, 1, 6766,
+  234, 2, 0, 6768, 264, 1, 0, 6772, 265, 50, 1, 6774,
+  315, 1, 0, 6776, 344, 2, 0, 6778, 346, 21, 1, 6782,
+  367, 1, 0, 6784, 368, 22, 1, 6786, 390, 7, 0, 6788,
+  397, 22, 1, 6802, 5, 31, 1, 6804, 36, 2, 0, 6806,
+  38, 36, 1, 6810, 74, 2, 0, 6812, 141, 3, 0, 6816,
+  144, 32, 1, 6822, 176, 4, 0, 6824, 212, 1, 0, 6832,
+  213, 19, 1, 6834, 232, 2, 0, 6836, 264, 1, 0, 6840,
+  265, 50, 1, 6842, 315, 1, 0, 6844, 346, 2, 0, 6846,
+  348, 19, 1, 6850, 367, 1, 0, 6852, 368, 20, 1, 6854,
+  388, 3, 0, 6856, 391, 6, 1, 6862, 397, 2, 0, 6864,
+  399, 20, 1, 6868, 5, 34, 1, 6870, 39, 2, 0, 6872,
+  41, 30, 1, 6876, 71, 3, 0, 6878, 144, 3, 0, 6884,
+  147, 27, 1, 6890, 174, 3, 0, 6892, 212, 1, 0, 6898,
+  213, 16, 1, 6900, 229, 3, 0, 6902, 264, 1, 0, 6908,
+  265, 50, 1, 6910, 315, 1, 0, 6912, 348, 2, 0, 6914,
+  350, 17, 1, 6918, 367, 1, 0, 6920, 368, 18, 1, 6922,
+  386, 2, 0, 6924, 388, 11, 1, 6928, 399, 2, 0, 6930,
+  401, 18, 1, 6934, 5, 37, 1, 6936, 42, 3, 0, 6938,
+  45, 22, 1, 6944, 67, 4, 0, 6946, 147, 2, 0, 6954,
+  149, 20, 1, 6958, 169, 5, 0, 6960, 212, 1, 0, 6970,
+  213, 14, 1, 6972, 227, 2, 0, 6974, 264, 1, 0, 6978,
+  265, 50, 1, 6980, 315, 1, 0, 6982, 351, 2, 0, 6984,
+  353, 14, 1, 6988, 367, 1, 0, 6990, 368, 15, 1, 6992,
+  383, 3, 0, 6994, 386, 15, 1, 7000, 401, 3, 0, 7002,
+  404, 15, 1, 7008, 5, 41, 1, 7010, 46, 4, 0, 7012,
+  50, 11, 1, 7020, 61, 5, 0, 7022, 151, 18, 0, 7032,
+  212, 1, 0, 7068, 213, 8, 1, 7070, 221, 5, 0, 7072,
+  264, 1, 0, 7082, 265, 50, 1, 7084, 315, 1, 0, 7086,
+  354, 3, 0, 7088, 357, 10, 1, 7094, 367, 1, 0, 7096,
+  368, 11, 1, 7098, 379, 4, 0, 7100, 383, 22, 1, 7108,
+  405, 3, 0, 7110, 408, 11, 1, 7116, 5, 51, 1, 7118,
+  56, 1, 0, 7120, 212, 10, 0, 7122, 264, 1, 0, 7142,
+  265, 50, 1, 7144, 315, 1, 0, 7146, 358, 10, 0, 7148,
+  368, 5, 1, 7168, 373, 7, 0, 7170, 380, 27, 1, 7184,
+  407, 8, 0, 7186, 415, 4, 1, 7202, 419, 1, 0, 7204,
+  5, 51, 1, 7206, 56, 1, 0, 7208, 367, 3, 0, 7210,
+  370, 47, 1, 7216, 417, 3, 0, 7218, 5, 51, 1, 7224,
+  56, 1, 0, 7226, 367, 1, 0, 7228, 368, 51, 1, 7230,
+  419, 1, 0, 7232, 5, 51, 1, 7234, 56, 1, 0, 7236,
+  367, 1, 0, 7238, 368, 51, 1, 7240, 419, 1, 0, 7242,
+  5, 51, 1, 7244, 56, 1, 0, 7246, 367, 1, 0, 7248,
+  368, 51, 1, 7250, 5, 51, 1, 7252, 56, 1, 0, 7254,
+  367, 1, 0, 7256, 368, 51, 1, 7258, 5, 51, 1, 7260,
+  367, 1, 0, 7262, 368, 51, 1, 7264, 5, 51, 1, 7266,
+  367, 1, 0, 7268, 368, 50, 1, 7270, 418, 1, 0, 7272,
+  5, 50, 1, 7274, 55, 1, 0, 7276, 367, 1, 0, 7278,
+  368, 50, 1, 7280, 418, 1, 0, 7282, 5, 50, 1, 7284,
+  55, 1, 0, 7286, 367, 1, 0, 7288, 368, 50, 1, 7290,
+  418, 1, 0, 7292, 5, 50, 1, 7294, 55, 1, 0, 7296,
+  367, 1, 0, 7298, 368, 50, 1, 7300, 418, 1, 0, 7302,
+  5, 50, 1, 7304, 55, 1, 0, 7306, 367, 1, 0, 7308,
+  368, 50, 1, 7310, 418, 1, 0, 7312, 5, 50, 1, 7314,
+  367, 1, 0, 7316, 368, 50, 1, 7318, 5, 49, 1, 7320,
+  54, 1, 0, 7322, 367, 1, 0, 7324, 368, 49, 1, 7326,
+  417, 1, 0, 7328, 5, 49, 1, 7330, 54, 1, 0, 7332,
+  367, 1, 0, 7334, 368, 49, 1, 7336, 417, 1, 0, 7338,
+  5, 49, 1, 7340, 54, 1, 0, 7342, 367, 1, 0, 7344,
+  368, 49, 1, 7346, 417, 1, 0, 7348, 5, 48, 1, 7350,
+  53, 1, 0, 7352, 367, 1, 0, 7354, 368, 49, 1, 7356,
+  5, 48, 1, 7358, 53, 1, 0, 7360, 367, 1, 0, 7362,
+  368, 48, 1, 7364, 416, 1, 0, 7366, 5, 48, 1, 7368,
+  53, 1, 0, 7370, 367, 1, 0, 7372, 368, 48, 1, 7374,
+  416, 1, 0, 7376, 5, 47, 1, 7378, 52, 1, 0, 7380,
+  367, 1, 0, 7382, 368, 48, 1, 7384, 5, 47, 1, 7386,
+  52, 1, 0, 7388, 367, 1, 0, 7390, 368, 47, 1, 7392,
+  415, 1, 0, 7394, 5, 46, 1, 7396, 51, 1, 0, 7398,
+  367, 1, 0, 7400, 368, 47, 1, 7402, 5, 46, 1, 7404,
+  51, 1, 0, 7406, 367, 1, 0, 7408, 368, 46, 1, 7410,
+  414, 1, 0, 7412, 5, 45, 1, 7414, 50, 1, 0, 7416,
+  367, 1, 0, 7418, 368, 46, 1, 7420, 414, 1, 0, 7422,
+  5, 45, 1, 7424, 50, 1, 0, 7426, 367, 1, 0, 7428,
+  368, 45, 1, 7430, 413, 1, 0, 7432, 5, 44, 1, 7434,
+  49, 1, 0, 7436, 367, 1, 0, 7438, 368, 45, 1, 7440,
+  413, 1, 0, 7442, 5, 44, 1, 7444, 49, 1, 0, 7446,
+  367, 1, 0, 7448, 368, 44, 1, 7450, 412, 1, 0, 7452,
+  5, 43, 1, 7454, 48, 1, 0, 7456, 367, 1, 0, 7458,
+  368, 44, 1, 7460, 5, 42, 1, 7462, 47, 1, 0, 7464,
+  367, 1, 0, 7466, 368, 43, 1, 7468, 411, 1, 0, 7470,
+  5, 42, 1, 7472, 47, 1, 0, 7474, 367, 1, 0, 7476,
+  368, 42, 1, 7478, 410, 1, 0, 7480, 5, 41, 1, 7482,
+  46, 1, 0, 7484, 367, 1, 0, 7486, 368, 41, 1, 7488,
+  409, 2, 0, 7490, 5, 40, 1, 7494, 45, 1, 0, 7496,
+  367, 1, 0, 7498, 368, 41, 1, 7500, 409, 1, 0, 7502,
+  5, 40, 1, 7504, 45, 1, 0, 7506, 367, 1, 0, 7508,
+  368, 40, 1, 7510, 408, 1, 0, 7512, 5, 39, 1, 7514,
+  44, 1, 0, 7516, 367, 1, 0, 7518, 368, 39, 1, 7520,
+  407, 1, 0, 7522, 5, 38, 1, 7524, 43, 1, 0, 7526,
+  367, 1, 0, 7528, 368, 39, 1, 7530, 407, 1, 0, 7532,
+  5, 37, 1, 7534, 42, 1, 0, 7536, 367, 1, 0, 7538,
+  368, 38, 1, 7540, 406, 1, 0, 7542, 5, 36, 1, 7544,
+  41, 1, 0, 7546, 367, 1, 0, 7548, 368, 37, 1, 7550,
+  405, 1, 0, 7552, 5, 35, 1, 7554, 40, 1, 0, 7556,
+  367, 1, 0, 7558, 368, 36, 1, 7560, 404, 1, 0, 7562,
+  5, 34, 1, 7564, 39, 1, 0, 7566, 367, 1, 0, 7568,
+  368, 35, 1, 7570, 403, 1, 0, 7572, 5, 33, 1, 7574,
+  38, 1, 0, 7576, 367, 1, 0, 7578, 368, 34, 1, 7580,
+  402, 1, 0, 7582, 5, 31, 1, 7584, 36, 2, 0, 7586,
+  367, 1, 0, 7590, 368, 32, 1, 7592, 400, 2, 0, 7594,
+  5, 30, 1, 7598, 35, 1, 0, 7600, 367, 1, 0, 7602,
+  368, 31, 1, 7604, 399, 2, 0, 7606, 5, 29, 1, 7610,
+  34, 1, 0, 7612, 367, 1, 0, 7614, 368, 30, 1, 7616,
+  398, 1, 0, 7618, 5, 27, 1, 7620, 32, 2, 0, 7622,
+  367, 1, 0, 7626, 368, 29, 1, 7628, 397, 1, 0, 7630,
+  5, 26, 1, 7632, 31, 1, 0, 7634, 367, 1, 0, 7636,
+  368, 27, 1, 7638, 395, 1, 0, 7640, 5, 24, 1, 7642,
+  29, 1, 0, 7644, 367, 1, 0, 7646, 368, 25, 1, 7648,
+  393, 2, 0, 7650, 5, 22, 1, 7654, 27, 2, 0, 7656,
+  367, 1, 0, 7660, 368, 23, 1, 7662, 391, 2, 0, 7664,
+  5, 19, 1, 7668, 24, 3, 0, 7670, 367, 1, 0, 7676,
+  368, 22, 1, 7678, 390, 1, 0, 7680, 5, 17, 1, 7682,
+  22, 2, 0, 7684, 367, 1, 0, 7688, 368, 19, 1, 7690,
+  387, 2, 0, 7692, 5, 14, 1, 7696, 19, 3, 0, 7698,
+  367, 1, 0, 7704, 368, 17, 1, 7706, 385, 2, 0, 7708,
+  5, 11, 1, 7712, 16, 3, 0, 7714, 367, 1, 0, 7720,
+  368, 14, 1, 7722, 382, 2, 0, 7724, 5, 9, 0, 7728,
+  367, 1, 0, 7746, 368, 10, 1, 7748, 378, 3, 0, 7750,
+  367, 10, 0, 7756,
+};
+
+static const int POKY_IMG_BGR565_ROW_SPANS[] = {
+  0, 0, 0, 0, 0, 4, 16, 28, 40, 52, 64, 76,
+  88, 100, 112, 124, 136, 148, 160, 172, 184, 196, 208, 220,
+  232, 244, 256, 268, 280, 292, 304, 316, 328, 340, 352, 364,
+  376, 388, 400, 412, 420, 432, 444, 456, 468, 480, 492, 504,
+  512, 524, 536, 548, 560, 572, 584, 596, 620, 684, 780, 876,
+  972, 1072, 1172, 1260, 1348, 1444, 1548, 1656, 1764, 1872, 1976, 2084,
+  2192, 2296, 2404, 2512, 2616, 2724, 2820, 2920, 3020, 3120, 3216, 3316,
+  3408, 3500, 3588, 3680, 3760, 3852, 3936, 4020, 4112, 4196, 4284, 4376,
+  4468, 4552, 4636, 4728, 4816, 4896, 4988, 5088, 5192, 5292, 5384, 5472,
+  5548, 5624, 5720, 5820, 5924, 6016, 6092, 6172, 6256, 6344, 6436, 6524,
+  6624, 6724, 6820, 6916, 7016, 7116, 7208, 7304, 7396, 7500, 7604, 7700,
+  7800, 7896, 7988, 8088, 8188, 8288, 8392, 8488, 8584, 8684, 8784, 8884,
+  8984, 9084, 9184, 9284, 9384, 9484, 9584, 9684, 9780, 9868, 9948, 10024,
+  10108, 10192, 10276, 10352, 10404, 10424, 10444, 10464, 10480, 10496, 10508, 10524,
+  10544, 10564, 10584, 10604, 10616, 10636, 10656, 10676, 10692, 10712, 10732, 10748,
+  10768, 10784, 10804, 10824, 10844, 10864, 10884, 10900, 10920, 10940, 10960, 10980,
+  11000, 11020, 11040, 11060, 11080, 11100, 11120, 11140, 11160, 11180, 11200, 11220,
+  11240, 11260, 11280, 11300, 11320, 11340, 11360, 11376, 11380, 11380, 11380,
+};
+
+static const PSplashFBImage POKY_IMG_BGR565 = {
+  .rgbmode   = BGR565,
+  .bpp       = 16,
+  .width     = 427,
+  .height    = 214,
+  .pixels    = (const char *) POKY_IMG_BGR565_PIXELS,
+  .spans     = POKY_IMG_BGR565_SPANS,
+  .row_spans = POKY_IMG_BGR565_ROW_SPANS,
+};
+
+#endif
+
+#ifdef PSPLASH_IMG_NATIVE_XRGB8888
+
+static const uint32_t POKY_IMG_XRGB8888_PIXELS[] = {
+  0x00cadd8e, 0x00c0d77a, 0x00c6d782, 0x00cadd8e, 0x00d2e1a0, 0x00e2e8b6, 0x00b7cf5e, 0x00abc746,
+  0x00b1c850, 0x00b3cb5a, 0x00c0d471, 0x00c9d985, 0x00dae4ab, 0x00b7cf5e, 0x00abc746, 0x00b1c850,
+  0x00b6d066, 0x00c9d985, 0x00dbe8b4, 0x00b7cf5e, 0x00abc746, 0x00b3ca52, 0x00c6d782, 0x00b7cf5e,
+  0x00abc746, 0x00b7cf5e, 0x00d2e099, 0x00b7cf5e, 0x00abc746, 0x00aac84f, 0x00cadd8e, 0x00b7cf5e,
+  0x00abc746, 0x00aac84f, 0x00cadd8e, 0x00b7cf5e, 0x00abc746, 0x00b3cb5a, 0x00d4e4a3, 0x00b7cf5e,
+  0x00abc746, 0x00bed168, 0x00b7cf5e, 0x00abc746, 0x00b2c951, 0x00d1de97, 0x00b7cf5e, 0x00abc746,
+  0x00bcd16e, 0x00b7cf5e, 0x00abc746, 0x00b3cb5a, 0x00b7cf5e, 0x00abc746, 0x00b1c850, 0x00dae4ab,
+  0x00b7cf5e, 0x00abc746, 0x00d1de97, 0x00b7cf5e, 0x00abc746, 0x00c6d782, 0x00b7cf5e, 0x00abc746,
+  0x00c0d77a, 0x00b7cf5e, 0x00abc746, 0x00c3d97c, 0x00b7cf5e, 0x00abc746, 0x00c9d985, 0x00b7cf5e,
+  0x00abc746, 0x00b1c747, 0x00d2e1a0, 0x00b7cf5e, 0x00abc746, 0x00aac84f, 0x00dbe8b4, 0x00b7cf5e,
+  0x00abc746, 0x00b2c951, 0x00b7cf5e, 0x00abc746, 0x00bed168, 0x00b7cf5e, 0x00abc746, 0x00cadd8e,
+  0x00b7cf5e, 0x00abc746, 0x00aac84f, 0x00b7cf5e, 0x00abc746, 0x00bccf66, 0x00b7cf5e, 0x00abc746,
+  0x00cadd8e, 0x00b7cf5e, 0x00abc746, 0x00b3ca52, 0x00b7cf5e, 0x00abc746, 0x00c6d782, 0x00b7cf5e,
+  0x00abc746, 0x00b2c951, 0x00b7cf5e, 0x00abc746, 0x00c0d77a, 0x00b7cf5e, 0x00abc746, 0x00b1c850,
+  0x00b7cf5e, 0x00abc746, 0x00c9d985, 0x00b7cf5e, 0x00abc746, 0x00aac84f, 0x00b7cf5e, 0x00abc746,
+  0x00d2e1a0, 0x00b7cf5e, 0x00abc746, 0x00b7cf5e, 0x00b7cf5e, 0x00abc746, 0x00b7cf5e, 0x00abc746,
+  0x00d2e099, 0x00b7cf5e, 0x00abc746, 0x00b6d066, 0x00b7cf5e, 0x00abc746, 0x00aac84f, 0x00b7cf5e,
+  0x00abc746, 0x00dbe8b4, 0x00b7cf5e, 0x00abc746, 0x00ccdf90, 0x00b7cf5e, 0x00abc746, 0x00bccf66,
+  0x00b7cf5e, 0x00abc746, 0x00b1c850, 0x00b7cf5e, 0x00abc746, 0x00b7cf5e, 0x00abc746, 0x00dce7ad,
+  0x00b7cf5e, 0x00abc746, 0x00d1de97, 0x00b7cf5e, 0x00abc746, 0x00c9d985, 0x00b7cf5e, 0x00abc746,
+  0x00c3d97c, 0x00b7cf5e, 0x00abc746, 0x00c0d471, 0x00b7cf5e, 0x00abc746, 0x00bccf66, 0x00b7cf5e,
+  0x00abc746, 0x00b7cf5e, 0x00fab2ab, 0x00f69786, 0x00f58275, 0x00f37160, 0x00f26956, 0x00f26956,
+  0x00f4634f, 0x00f26956, 0x00f26956, 0x00f37160, 0x00f4806e, 0x00f89385, 0x00f9b0a3, 0x00f8beb2,
+  0x00b9e7e0, 0x00b9e7e0, 0x00b9e7e0, 0x00b4e2db, 0x0097d6cd, 0x0089d1c6, 0x0089d5d0, 0x009ad8cf,
+  0x00a6dcd4, 0x00b4e2db, 0x00b7cf5e, 0x00abc746, 0x00b3cb5a, 0x00fbbab0, 0x00f58878, 0x00f26956,
+  0x00f15944, 0x00ef4f3a, 0x00f14832, 0x00f24939, 0x00ef4f3a, 0x00f15944, 0x00f26956, 0x00f58275,
+  0x00f9b8ae, 0x009cdbd2, 0x00a6dcd4, 0x00a8ded6, 0x00a8ded6, 0x00b4e2db, 0x00b4e2db, 0x00a8ded6,
+  0x00a6dcd4, 0x009ddcd3, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0070cbbe, 0x0077cdc7,
+  0x007dcec2, 0x008ed6cb, 0x00a8ded6, 0x00bed168, 0x00b3ca52, 0x00b3ca52, 0x00b3cb5a, 0x00b3cb5a,
+  0x00b7cf5e, 0x00b6d066, 0x00b6d066, 0x00b9d368, 0x00c0d471, 0x00b9d368, 0x00b6d066, 0x00b6d066,
+  0x00b7cf5e, 0x00b3cb5a, 0x00b3cb5a, 0x00b3ca52, 0x00b3ca52, 0x00b3cb5a, 0x00bccf66, 0x00bcd16e,
+  0x00ced475, 0x00fad681, 0x00fad681, 0x00fad889, 0x00fada91, 0x00fddfa3, 0x00fddfa3, 0x00fddc93,
+  0x00fad889, 0x00fad681, 0x00fad681, 0x00f89385, 0x00f26956, 0x00f2523c, 0x00f24933, 0x00f14832,
+  0x00f1513b, 0x00f26956, 0x00f58878, 0x009cdbd2, 0x009eddd4, 0x00a8ded6, 0x00b4e2db, 0x00b4e2db,
+  0x00a6dcd4, 0x009ddcd3, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0068cac2, 0x007dcec2,
+  0x008ed6cb, 0x00b4e2db, 0x00c0d471, 0x00b3cb5a, 0x00b7cf5e, 0x00b7cf5e, 0x00bccf66, 0x00c0d471,
+  0x00c0d77a, 0x00c6d782, 0x00c9d985, 0x00c6d782, 0x00c0d77a, 0x00c0d471, 0x00b6d066, 0x00b7cf5e,
+  0x00b7cf5e, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00c7c956, 0x00f9cb5e, 0x00f8cb65,
+  0x00fbcf6f, 0x00fad681, 0x00fada91, 0x00f9e6b4, 0x00fcdd9a, 0x00fad681, 0x00fcd070, 0x00f8cb65,
+  0x00f9cb5e, 0x00fddfa3, 0x00f69786, 0x00f26956, 0x00ef4f3a, 0x00f14832, 0x00f24933, 0x00f4634f,
+  0x00f59083, 0x009cdbd2, 0x00a6dcd4, 0x00b4e2db, 0x00aae0d9, 0x009ddcd3, 0x009cdbd2, 0x009ad8cf,
+  0x007dcec2, 0x006fcabd, 0x0070cbbe, 0x007bcdc1, 0x0089d5d0, 0x00b4e2db, 0x00c0d471, 0x00b3cb5a,
+  0x00b7cf5e, 0x00bccf66, 0x00c0d471, 0x00c0d77a, 0x00c9d985, 0x00c0d77a, 0x00c0d471, 0x00bed168,
+  0x00b7cf5e, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00c7c956, 0x00f9cb5e, 0x00f8cb65,
+  0x00f8d478, 0x00fcdd9a, 0x00fddfa3, 0x00fad681, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3, 0x00f67b6c,
+  0x00ef4f3a, 0x00f14832, 0x00f24939, 0x00f37160, 0x00f9b8ae, 0x009cdbd2, 0x00a8ded6, 0x00b4e2db,
+  0x00a6dcd4, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0070cbbe, 0x007bcdc1, 0x00a6dcd4,
+  0x00c0d471, 0x00b3cb5a, 0x00b7cf5e, 0x00b9d368, 0x00c0d471, 0x00c6d782, 0x00c9d985, 0x00c6d782,
+  0x00c0d471, 0x00bccf66, 0x00b7cf5e, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00c7c956,
+  0x00f9cb5e, 0x00fbcf6f, 0x00fcdd9a, 0x00fddfa3, 0x00f8d478, 0x00f9cb5e, 0x00fddfa3, 0x00fbbab0,
+  0x00f56c5f, 0x00f14832, 0x00f4634f, 0x00f9aa9f, 0x009ddcd3, 0x009cdbd2, 0x00a6dcd4, 0x00b9e7e0,
+  0x00aae0d9, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0070cbbe, 0x009ad8cf, 0x00c0d77a,
+  0x00b3cb5a, 0x00b7cf5e, 0x00c0d471, 0x00c3d97c, 0x00c9d985, 0x00c6d782, 0x00bcd16e, 0x00b7cf5e,
+  0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00c8cb5f, 0x00f9cb5e, 0x00fad681, 0x00f9e6b4,
+  0x00fad889, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3, 0x00f46b58, 0x00f14832, 0x00f35b4c, 0x00f9b8ae,
+  0x009eddd4, 0x009cdbd2, 0x00a6dcd4, 0x00b9e7e0, 0x00a8ded6, 0x009cdbd2, 0x009ad8cf, 0x007dcec2,
+  0x006fcabd, 0x0074cac4, 0x009ad8cf, 0x00c0d77a, 0x00b3cb5a, 0x00bed168, 0x00c3d97c, 0x00c9d985,
+  0x00c0d77a, 0x00bed168, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00cfcc61, 0x00f7ca64,
+  0x00f9cb5e, 0x00face6e, 0x00fee3ac, 0x00f8d478, 0x00f9cb5e, 0x00fddfa3, 0x00f37160, 0x00f14832,
+  0x00f46b58, 0x00a6dcd4, 0x009cdbd2, 0x009ad8cf, 0x0097d6cd, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf,
+  0x007dcec2, 0x006fcabd, 0x0070cbbe, 0x00a6dcd4, 0x00c9d985, 0x00b3cb5a, 0x00b9d368, 0x00c3d97c,
+  0x00c3d97c, 0x00bed168, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00d4d26d, 0x00f7ca64,
+  0x00f9cb5e, 0x00f8cb65, 0x00fee3ac, 0x00fbcf6f, 0x00f9cb5e, 0x00fddfa3, 0x00f7998e, 0x00f1513b,
+  0x00f14832, 0x00ef4f33, 0x00f58878, 0x00a8ded6, 0x009cdbd2, 0x009ad8cf, 0x0089d1c6, 0x007bcdc1,
+  0x007dcec2, 0x007dcec2, 0x0089d5d0, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd,
+  0x007bcdc1, 0x00c9d985, 0x00b3cb5a, 0x00b3ca52, 0x00b3ca52, 0x00b2c951, 0x00b3cb5a, 0x00b3ca52,
+  0x00b1c747, 0x00abc746, 0x00dcd680, 0x00f7ca64, 0x00f9cb5e, 0x00fbcf6f, 0x00fad681, 0x00f9cb5e,
+  0x00fddfa3, 0x00f26956, 0x00f24933, 0x00f14832, 0x00f4634f, 0x00b4e2db, 0x009cdbd2, 0x009ad8cf,
+  0x0097d6cd, 0x007dcec2, 0x0078cfc9, 0x0089d1c6, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2,
+  0x006fcabd, 0x0079cabe, 0x009ad8cf, 0x00cadd8e, 0x00b3cb5a, 0x00b3ca52, 0x00aac84f, 0x00abc746,
+  0x00abc746, 0x00aac84f, 0x00b2c951, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00ede0a6,
+  0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00fcda8b, 0x00fddfa3, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3,
+  0x00f6a79c, 0x00f05843, 0x00f14832, 0x00f2523c, 0x00f7998e, 0x009cdbd2, 0x009ad8cf, 0x0089d1c6,
+  0x007dcec2, 0x008ed6cb, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0078cfc9, 0x00ccdf90,
+  0x00b3cb5a, 0x00b3ca52, 0x00b1c850, 0x00abc746, 0x00aac84f, 0x00b3ca52, 0x00b3cb5a, 0x00b3ca52,
+  0x00b1c747, 0x00abc746, 0x00b1c850, 0x00f7ca64, 0x00f9cb5e, 0x00fbcf6f, 0x00fad681, 0x00f9cb5e,
+  0x00fddfa3, 0x00f78b81, 0x00f24933, 0x00f14832, 0x00f24933, 0x00f3796a, 0x00a6dcd4, 0x009cdbd2,
+  0x009ad8cf, 0x0089d1c6, 0x007dcec2, 0x0078cfc9, 0x0089d1c6, 0x009cdbd2, 0x009ad8cf, 0x007dcec2,
+  0x006fcabd, 0x007bcdc1, 0x00b4e2db, 0x00d1de97, 0x00b7cf5e, 0x00b3cb5a, 0x00b3ca52, 0x00b1c850,
+  0x00abc746, 0x00b1c850, 0x00b3ca52, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b6d066,
+  0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00fcdd9a, 0x00fae6ad, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3,
+  0x00f37160, 0x00f14832, 0x00f4634f, 0x00a6dcd4, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x0089d1c6,
+  0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0074cac4, 0x00a6dcd4, 0x00d2e099,
+  0x00b6d066, 0x00b3cb5a, 0x00b3ca52, 0x00abc746, 0x00b1c747, 0x00b2c951, 0x00b3cb5a, 0x00b3ca52,
+  0x00b1c747, 0x00abc746, 0x00cadd8e, 0x00f7ca64, 0x00f9cb5e, 0x00fad681, 0x00fada91, 0x00f9cb5e,
+  0x00fddfa3, 0x00f4634f, 0x00f14832, 0x00f05843, 0x00aae0d9, 0x009cdbd2, 0x0090d8cd, 0x007dcec2,
+  0x0080d2c6, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0097d6cd, 0x00d2e099,
+  0x00bcd16e, 0x00b3cb5a, 0x00aac84f, 0x00abc746, 0x00b1c850, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747,
+  0x00abc746, 0x00dbe8b4, 0x00f7ca64, 0x00f9cb5e, 0x00face6e, 0x00f8d478, 0x00f9cb5e, 0x00fddfa3,
+  0x00f35b4c, 0x00f14832, 0x00f2523c, 0x00fbbab0, 0x009cdbd2, 0x008ed6cb, 0x0078cfc9, 0x007dcec2,
+  0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0089d1c6, 0x00d2e099, 0x00c0d77a,
+  0x00b3cb5a, 0x00b3ca52, 0x00aac84f, 0x00abc746, 0x00b1c850, 0x00b3ca52, 0x00b3cb5a, 0x00b3ca52,
+  0x00b1c747, 0x00abc746, 0x00b1c850, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00fbcf6f, 0x00f9cb5e,
+  0x00fddfa3, 0x00f05843, 0x00f14832, 0x00ef4f3a, 0x00f9b8ae, 0x009ddcd3, 0x009cdbd2, 0x008ed6cb,
+  0x0078cfc9, 0x007dcec2, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0089d1c6,
+  0x00d2e099, 0x00c6d782, 0x00b7cf5e, 0x00b3cb5a, 0x00aac84f, 0x00abc746, 0x00b1c850, 0x00b3cb5a,
+  0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b3cb5a, 0x00f7ca64, 0x00f9cb5e, 0x00f9e6b4, 0x00f8cb65,
+  0x00f9cb5e, 0x00fddfa3, 0x00f2523c, 0x00f14832, 0x00f1513b, 0x00f9b8ae, 0x00a8ded6, 0x009cdbd2,
+  0x008ed6cb, 0x0077cdc7, 0x007dcec2, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd,
+  0x0080d2c6, 0x00d2e099, 0x00c9d985, 0x00b9d368, 0x00b3cb5a, 0x00aac84f, 0x00abc746, 0x00aac84f,
+  0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00d1de97, 0x00f7ca64, 0x00f9cb5e, 0x00fae6ad,
+  0x00f8cb65, 0x00f9cb5e, 0x00fddfa3, 0x00f15944, 0x00f14832, 0x00f05843, 0x009cdbd2, 0x0097d6cd,
+  0x007dcec2, 0x0080d2c6, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0089d5d0,
+  0x00d2e099, 0x00c9d985, 0x00c0d471, 0x00b3cb5a, 0x00b3ca52, 0x00aac84f, 0x00abc746, 0x00b1c850,
+  0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b1c850, 0x00f7ca64, 0x00f9cb5e, 0x00ffe5b4,
+  0x00face6e, 0x00f9cb5e, 0x00fddfa3, 0x00f26956, 0x00f14832, 0x00f1604c, 0x00a6dcd4, 0x009cdbd2,
+  0x009ad8cf, 0x007dcec2, 0x0089d1c6, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd,
+  0x009ad8cf, 0x00d2e099, 0x00c9d985, 0x00c9d985, 0x00b3cb5a, 0x00aac84f, 0x00abc746, 0x00b1c850,
+  0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b7cf5e, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65,
+  0x00fbcf6f, 0x00f9cb5e, 0x00fddfa3, 0x00f67b6c, 0x00f14832, 0x00f26956, 0x00b4e2db, 0x009cdbd2,
+  0x009ad8cf, 0x0078cfc9, 0x007dcec2, 0x0089d1c6, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2,
+  0x006fcabd, 0x00a8ded6, 0x00d2e099, 0x00c9d985, 0x00c9d985, 0x00bed168, 0x00b3cb5a, 0x00b1c850,
+  0x00abc746, 0x00aac84f, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00d2e099, 0x00f7ca64,
+  0x00f9cb5e, 0x00f8cb65, 0x00fcd070, 0x00f9cb5e, 0x00fddfa3, 0x00f7998e, 0x00f24933, 0x00f14832,
+  0x00f67b6c, 0x009cdbd2, 0x009ad8cf, 0x0089d1c6, 0x007dcec2, 0x008ed6cb, 0x009cdbd2, 0x009ad8cf,
+  0x007dcec2, 0x006fcabd, 0x0074cac4, 0x00d2e099, 0x00c9d985, 0x00c9d985, 0x00c0d77a, 0x00b3cb5a,
+  0x00adcb51, 0x00abc746, 0x00b2c951, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b3ca52,
+  0x00f7ca64, 0x00f9cb5e, 0x00fbcf6f, 0x00fad681, 0x00f9cb5e, 0x00fddfa3, 0x00ef4f3a, 0x00f14832,
+  0x00f6a79c, 0x00a8ded6, 0x009cdbd2, 0x0089d1c6, 0x007dcec2, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf,
+  0x007dcec2, 0x006fcabd, 0x007dcec2, 0x00d2e099, 0x00c9d985, 0x00c9d985, 0x00c9d985, 0x00b7cf5e,
+  0x00b3cb5a, 0x00b3ca52, 0x00abc746, 0x00b3ca52, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746,
+  0x00c0d77a, 0x00f7ca64, 0x00f9cb5e, 0x00fad681, 0x00fcdd9a, 0x00f9cb5e, 0x00fddfa3, 0x00f1604c,
+  0x00f14832, 0x00ef4f3a, 0x009cdbd2, 0x009cdbd2, 0x009cdbd2, 0x009ad8cf, 0x0078cfc9, 0x007dcec2,
+  0x0089d1c6, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x008ed6cb, 0x00d2e099,
+  0x00c9d985, 0x00c9d985, 0x00c9d985, 0x00c0d471, 0x00b3cb5a, 0x00b3ca52, 0x00aac84f, 0x00abc746,
+  0x00aac84f, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00aac84f, 0x00f7ca64, 0x00f9cb5e,
+  0x00fcdd9a, 0x00f9cb5e, 0x00fddfa3, 0x00f58878, 0x00f14832, 0x00f46b58, 0x00a6dcd4, 0x009cdbd2,
+  0x009ad8cf, 0x007dcec2, 0x0089d1c6, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0070cbbe,
+  0x00b4e2db, 0x00d2e099, 0x00c9d985, 0x00b7cf5e, 0x00b3cb5a, 0x00b3cb5a, 0x00b3cb5a, 0x00aac84f,
+  0x00abc746, 0x00aac84f, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00bccf66, 0x00f7ca64,
+  0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3, 0x00fbbab0, 0x00ef4f3a, 0x00f14832,
+  0x00f6a79c, 0x009cdbd2, 0x0089d1c6, 0x007dcec2, 0x0078cfc9, 0x009ad8cf, 0x009cdbd2, 0x009ad8cf,
+  0x007dcec2, 0x006fcabd, 0x007bcdc1, 0x00d2e099, 0x00c9d985, 0x00bcd16e, 0x00b3cb5a, 0x00b3cb5a,
+  0x00b3ca52, 0x00abc746, 0x00b3ca52, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00dbe8b4,
+  0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00fad889, 0x00f9cb5e, 0x00fddfa3, 0x00f4634f, 0x00f14832,
+  0x00f1513b, 0x009ddcd3, 0x007dcec2, 0x0078cfc9, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd,
+  0x008ed6cb, 0x00d2e099, 0x00c9d985, 0x00c6d782, 0x00b7cf5e, 0x00b3ca52, 0x00abc746, 0x00b1c850,
+  0x00b3ca52, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00bcd16e, 0x00f7ca64, 0x00f9cb5e,
+  0x00fad889, 0x00ffe5b4, 0x00f9cb5e, 0x00fddfa3, 0x00f7998e, 0x00f24933, 0x00f14832, 0x00f58275,
+  0x00a6dcd4, 0x007dcec2, 0x0089d5d0, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0070cbbe,
+  0x00d2e099, 0x00c9d985, 0x00c0d471, 0x00b1c850, 0x00abc746, 0x00aac84f, 0x00b3cb5a, 0x00b3ca52,
+  0x00b1c747, 0x00abc746, 0x00aac84f, 0x00f7ca64, 0x00f9cb5e, 0x00face6e, 0x00f9cb5e, 0x00fddfa3,
+  0x00f05843, 0x00f14832, 0x00ef4f3a, 0x009cdbd2, 0x0089d1c6, 0x007dcec2, 0x009ad8cf, 0x009cdbd2,
+  0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x007dcec2, 0x00d2e099, 0x00c9d985, 0x00c0d77a, 0x00aac84f,
+  0x00abc746, 0x00b2c951, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00c0d77a, 0x00f7ca64,
+  0x00f9cb5e, 0x00fbd077, 0x00fcdd9a, 0x00f9cb5e, 0x00fddfa3, 0x00f58878, 0x00f14832, 0x00f3796a,
+  0x00b4e2db, 0x009cdbd2, 0x009ad8cf, 0x0078cfc9, 0x007dcec2, 0x008ed6cb, 0x009cdbd2, 0x009ad8cf,
+  0x007dcec2, 0x006fcabd, 0x00d2e099, 0x00c9d985, 0x00bccf66, 0x00b2c951, 0x00abc746, 0x00aac84f,
+  0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b2c951, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65,
+  0x00f9cb5e, 0x00fddfa3, 0x00f2523c, 0x00f14832, 0x00ef4f3a, 0x009ddcd3, 0x009cdbd2, 0x009cdbd2,
+  0x0089d1c6, 0x007dcec2, 0x009ad8cf, 0x009cdbd2, 0x009cdbd2, 0x009cdbd2, 0x009ad8cf, 0x007dcec2,
+  0x006fcabd, 0x007dcec2, 0x00d2e099, 0x00c9d985, 0x00c0d77a, 0x00b3cb5a, 0x00b3cb5a, 0x00aac84f,
+  0x00abc746, 0x00b2c951, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00d2e1a0, 0x00f7ca64,
+  0x00f9cb5e, 0x00fbd077, 0x00fddc93, 0x00f9cb5e, 0x00fddfa3, 0x00f69786, 0x00f14832, 0x00f3796a,
+  0x00b4e2db, 0x009cdbd2, 0x009cdbd2, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x008ed6cb, 0x009cdbd2,
+  0x009cdbd2, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x00d2e099, 0x00c9d985, 0x00b6d066,
+  0x00b3cb5a, 0x00b3cb5a, 0x00b3ca52, 0x00abc746, 0x00aac84f, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747,
+  0x00abc746, 0x00bccf66, 0x00f7ca64, 0x00f9cb5e, 0x00f9e6b4, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3,
+  0x00f35343, 0x00f14832, 0x00ef4f3a, 0x009ddcd3, 0x009cdbd2, 0x009ad8cf, 0x0078cfc9, 0x007dcec2,
+  0x0083cfcb, 0x009ad8cf, 0x009cdbd2, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0089d1c6,
+  0x00d2e099, 0x00c9d985, 0x00c9d985, 0x00c9d985, 0x00c0d77a, 0x00b3cb5a, 0x00b2c951, 0x00abc746,
+  0x00b2c951, 0x00b3cb5a, 0x00b3cb5a, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b1c850,
+  0x00f7ca64, 0x00f9cb5e, 0x00fbd077, 0x00fada91, 0x00f9cb5e, 0x00fddfa3, 0x00f9aa9f, 0x00f14832,
+  0x00f78b81, 0x009cdbd2, 0x008ed6cb, 0x0078cfc9, 0x007dcec2, 0x008ed6cb, 0x009cdbd2, 0x009cdbd2,
+  0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x00d2e099, 0x00c9d985, 0x00c9d985, 0x00c9d985, 0x00bed168,
+  0x00b3cb5a, 0x00aac84f, 0x00abc746, 0x00aac84f, 0x00b3cb5a, 0x00b3cb5a, 0x00b3cb5a, 0x00b3ca52,
+  0x00b1c747, 0x00abc746, 0x00d4e4a3, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3,
+  0x00f4634f, 0x00f14832, 0x00f35b4c, 0x00a8ded6, 0x009cdbd2, 0x008ed6cb, 0x007dcec2, 0x0089d1c6,
+  0x009cdbd2, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x00a6dcd4, 0x00d2e099, 0x00c9d985,
+  0x00c9d985, 0x00c6d782, 0x00b3cb5a, 0x00b1c850, 0x00abc746, 0x00b3ca52, 0x00b3cb5a, 0x00b3cb5a,
+  0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00c9d985, 0x00f7ca64, 0x00f9cb5e, 0x00fad889, 0x00fddfa3,
+  0x00f9cb5e, 0x00fddfa3, 0x00f14832, 0x00f9b8ae, 0x009cdbd2, 0x0089d1c6, 0x007dcec2, 0x009ad8cf,
+  0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x007bcdc1, 0x00d2e099, 0x00c9d985, 0x00c9d985,
+  0x00c0d471, 0x00b3cb5a, 0x00b1c850, 0x00abc746, 0x00b1c850, 0x00b3cb5a, 0x00b3cb5a, 0x00b3ca52,
+  0x00b1c747, 0x00abc746, 0x00bcd16e, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00fcd070, 0x00f9cb5e,
+  0x00fddfa3, 0x00f69786, 0x00f14832, 0x00f67462, 0x00b4e2db, 0x009cdbd2, 0x009ad8cf, 0x0089d1c6,
+  0x007dcec2, 0x008ed6cb, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x00d2e099, 0x00c9d985,
+  0x00c9d985, 0x00b6d066, 0x00b3cb5a, 0x00b3ca52, 0x00abc746, 0x00b1c850, 0x00b3cb5a, 0x00b3cb5a,
+  0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b6d066, 0x00f7ca64, 0x00f9cb5e, 0x00fcdd9a, 0x00f9cb5e,
+  0x00fddfa3, 0x00f4634f, 0x00f14832, 0x00f35343, 0x00a6dcd4, 0x009cdbd2, 0x009ad8cf, 0x0089d1c6,
+  0x007dcec2, 0x0080d2c6, 0x009cdbd2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x009cdbd2, 0x00d2e099,
+  0x00c9d985, 0x00c0d77a, 0x00b3cb5a, 0x00b2c951, 0x00abc746, 0x00b3ca52, 0x00b3cb5a, 0x00b3ca52,
+  0x00b1c747, 0x00abc746, 0x00b3cb5a, 0x00f7ca64, 0x00f9cb5e, 0x00fbd077, 0x00fad889, 0x00f9cb5e,
+  0x00fddfa3, 0x00f24933, 0x00f14832, 0x00f9b8ae, 0x009cdbd2, 0x009ad8cf, 0x0089d1c6, 0x007dcec2,
+  0x009ad8cf, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x007dcec2, 0x00d2e099, 0x00c9d985, 0x00c0d471,
+  0x00b3cb5a, 0x00b2c951, 0x00abc746, 0x00aac84f, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746,
+  0x00b3cb5a, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3, 0x00f8a29a,
+  0x00f14832, 0x00f58275, 0x00b4e2db, 0x009cdbd2, 0x009ad8cf, 0x0089d1c6, 0x007dcec2, 0x0097d6cd,
+  0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x00d2e099, 0x00c6d782, 0x00b6d066, 0x00b3cb5a, 0x00b2c951,
+  0x00b1c747, 0x00abc746, 0x00aac84f, 0x00b3cb5a, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b3cb5a,
+  0x00f7ca64, 0x00f9cb5e, 0x00fddfa3, 0x00f7ca64, 0x00f9cb5e, 0x00fddfa3, 0x00f3796a, 0x00f14832,
+  0x00f05843, 0x00a8ded6, 0x009cdbd2, 0x009ad8cf, 0x0089d1c6, 0x007dcec2, 0x0089d1c6, 0x009ad8cf,
+  0x007dcec2, 0x006fcabd, 0x00a8ded6, 0x00d2e099, 0x00c0d77a, 0x00b3cb5a, 0x00b2c951, 0x00abc746,
+  0x00b3ca52, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00b7cf5e, 0x00f7ca64, 0x00f9cb5e, 0x00fad681,
+  0x00fddfa3, 0x00f9cb5e, 0x00fddfa3, 0x00f05843, 0x00f14832, 0x00ef4f3a, 0x00a6dcd4, 0x009cdbd2,
+  0x0089d1c6, 0x0078cfc9, 0x007dcec2, 0x009ad8cf, 0x007dcec2, 0x006fcabd, 0x0097d6cd, 0x00d2e099,
+  0x00c0d471, 0x00b3cb5a, 0x00b2c951, 0x00abc746, 0x00b2c951, 0x00b3ca52, 0x00b1c747, 0x00abc746,
+  0x00b6d066, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00fcd070, 0x00f9cb5e, 0x00fddfa3, 0x00f24933,
+  0x00f14832, 0x00fab2ab, 0x009cdbd2, 0x0097d6cd, 0x0078cfc9, 0x007dcec2, 0x009ad8cf, 0x007dcec2,
+  0x006fcabd, 0x007dcec2, 0x00d2e099, 0x00bed168, 0x00b3cb5a, 0x00b3ca52, 0x00aac84f, 0x00abc746,
+  0x00aac84f, 0x00b3ca52, 0x00b1c747, 0x00abc746, 0x00c0d471, 0x00f7ca64, 0x00f9cb5e, 0x00f7ca64,
+  0x00f8cb65, 0x00f9cb5e, 0x00fddfa3, 0x00f9aa9f, 0x00f14832, 0x00f7998e, 0x009cdbd2, 0x009ad8cf,
+  0x0089d1c6, 0x007dcec2, 0x0078cfc9, 0x008ed6cb, 0x007dcec2, 0x006fcabd, 0x0074cac4, 0x00d1de97,
+  0x00b7cf5e, 0x00b3cb5a, 0x00aac84f, 0x00abc746, 0x00b2c951, 0x00b1c747, 0x00abc746, 0x00cadd8e,
+  0x00f7ca64, 0x00f9cb5e, 0x00fddfa3, 0x00f9cb5e, 0x00fddfa3, 0x00f78b81, 0x00f14832, 0x00f37160,
+  0x00a8ded6, 0x009cdbd2, 0x009ad8cf, 0x008ed6cb, 0x007dcec2, 0x0089d1c6, 0x007dcec2, 0x006fcabd,
+  0x0070cbbe, 0x00d1de97, 0x00b3cb5a, 0x00b2c951, 0x00abc746, 0x00b2c951, 0x00b1c747, 0x00abc746,
+  0x00b3cb5a, 0x00f7ca64, 0x00f9cb5e, 0x00fad681, 0x00fee3ac, 0x00f9cb5e, 0x00fddfa3, 0x00f67b6c,
+  0x00f14832, 0x00f35343, 0x00a6dcd4, 0x009cdbd2, 0x009ad8cf, 0x0089d1c6, 0x007dcec2, 0x0089d1c6,
+  0x007dcec2, 0x006fcabd, 0x009fdacb, 0x00ccdf90, 0x00b3cb5a, 0x00b3ca52, 0x00aac84f, 0x00abc746,
+  0x00b2c951, 0x00b1c747, 0x00abc746, 0x00aac84f, 0x00c9d985, 0x00f7ca64, 0x00f9cb5e, 0x00fcd070,
+  0x00fada91, 0x00f9cb5e, 0x00fddfa3, 0x00f26956, 0x00f14832, 0x009eddd4, 0x009cdbd2, 0x0090d8cd,
+  0x0089d1c6, 0x007dcec2, 0x006fcabd, 0x0091d5c4, 0x00c9d985, 0x00b3cb5a, 0x00aac84f, 0x00b1c850,
+  0x00abc746, 0x00b1c850, 0x00b1c747, 0x00abc746, 0x00bccf66, 0x00e2e8b6, 0x00f7ca64, 0x00f9cb5e,
+  0x00f8cb65, 0x00fbcf6f, 0x00f9cb5e, 0x00fddfa3, 0x00f15944, 0x00f14832, 0x00ef4f3a, 0x00f2523c,
+  0x00ef4f3a, 0x00f14832, 0x009ddcd3, 0x009cdbd2, 0x009ad8cf, 0x008ed6cb, 0x0083cfcb, 0x0078cfc9,
+  0x007dcec2, 0x0078cfc9, 0x0089d1c6, 0x0083cfcb, 0x0070cbbe, 0x006fcabd, 0x0086d3c1, 0x00c9d985,
+  0x00b3cb5a, 0x00b3ca52, 0x00aac84f, 0x00abc746, 0x00b1c850, 0x00b1c747, 0x00abc746, 0x00b3cb5a,
+  0x00d2e099, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3, 0x00f1513b,
+  0x00f14832, 0x00f05843, 0x00f89385, 0x00f8a29a, 0x00f35b4c, 0x00f14832, 0x00d9b7aa, 0x009ddcd3,
+  0x009cdbd2, 0x009ad8cf, 0x0097d6cd, 0x0089d1c6, 0x007dcec2, 0x0078cfc9, 0x0090d8cd, 0x009eddd4,
+  0x0077cdc7, 0x0068cac2, 0x006fcabd, 0x007dcec2, 0x00bcd47e, 0x00b3cb5a, 0x00b2c951, 0x00aac84f,
+  0x00abc746, 0x00b1c747, 0x00b3ca52, 0x00b2c951, 0x00b1c747, 0x00abc746, 0x00b3ca52, 0x00c9d985,
+  0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00f9cb5e, 0x00fddfa3, 0x00ef4f33, 0x00f14832,
+  0x00f15944, 0x00f56c59, 0x00f14832, 0x00cea69b, 0x009cdbd2, 0x009ad8cf, 0x0090d8cd, 0x0089d1c6,
+  0x007dcec2, 0x00a6dcd4, 0x007bcdc1, 0x006fcabd, 0x007bcdc1, 0x00b2d17a, 0x00b3cb5a, 0x00b2c951,
+  0x00aac84f, 0x00abc746, 0x00b1c747, 0x00c0d471, 0x00dbe8b4, 0x00bed168, 0x00abc746, 0x00aac84f,
+  0x00b3cb5a, 0x00cadd8e, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00fcdd9a, 0x00fee3ac, 0x00face6e,
+  0x00f9cb5e, 0x00fddfa3, 0x00f24933, 0x00f14832, 0x00ef4f3a, 0x00f1513b, 0x00f14832, 0x00c69c8c,
+  0x009cdbd2, 0x009ad8cf, 0x008ed6cb, 0x0089d1c6, 0x0078cfc9, 0x007dcec2, 0x0097d6cd, 0x00b9e7e0,
+  0x006fcabd, 0x0079cabe, 0x00a8ce76, 0x00b3cb5a, 0x00b3ca52, 0x00aac84f, 0x00b1c747, 0x00abc746,
+  0x00d2e099, 0x00cadd8e, 0x00abc746, 0x00b7cf5e, 0x00d2e1a0, 0x00f7ca64, 0x00f9cb5e, 0x00face6e,
+  0x00fbd077, 0x00f9cb5e, 0x00fddfa3, 0x00f14832, 0x00f56c5f, 0x00f89385, 0x00f14832, 0x00c69c8c,
+  0x009cdbd2, 0x009ad8cf, 0x0097d6cd, 0x0089d1c6, 0x007dcec2, 0x0078cfc9, 0x007dcec2, 0x0089d1c6,
+  0x006fcabd, 0x0070cbbe, 0x00a9cd6e, 0x00b3cb5a, 0x00b2c951, 0x00b1c850, 0x00abc746, 0x00c9d985,
+  0x00c0d77a, 0x00abc746, 0x00b3cb5a, 0x00d1de97, 0x00f7ca64, 0x00f9cb5e, 0x00face6e, 0x00f9cb5e,
+  0x00fddfa3, 0x00f14832, 0x00f7998e, 0x00fab2ab, 0x00f14832, 0x00c69c8c, 0x009cdbd2, 0x009ad8cf,
+  0x009ad8cf, 0x008ed6cb, 0x0089d1c6, 0x0089d1c6, 0x007dcec2, 0x009ad8cf, 0x006fcabd, 0x0075cbb8,
+  0x00a9cd6e, 0x00b3cb5a, 0x00b3ca52, 0x00b1c850, 0x00b1c850, 0x00b1c747, 0x00abc746, 0x00aac84f,
+  0x00abc746, 0x00b2c951, 0x00c0d77a, 0x00d4e4a3, 0x00f7ca64, 0x00f9cb5e, 0x00fad681, 0x00fcdd9a,
+  0x00f9cb5e, 0x00fddfa3, 0x00f35343, 0x00f35343, 0x00f15944, 0x00f15944, 0x00f35b4c, 0x00f4634f,
+  0x00f4634f, 0x00f26956, 0x00f56c59, 0x00f37160, 0x00f46b58, 0x00f46455, 0x00f4634f, 0x00fab2ab,
+  0x00f9b8ae, 0x00f14832, 0x00aa9687, 0x0077cdc7, 0x007bcdc1, 0x007bcdc1, 0x007bcdc1, 0x009ad8cf,
+  0x006fcabd, 0x0075cbb8, 0x00a9cd6e, 0x00b3cb5a, 0x00b3ca52, 0x00b3ca52, 0x00b2c951, 0x00aac84f,
+  0x00b1c850, 0x00aac84f, 0x00b7cf5e, 0x00b3cb5a, 0x00b6d066, 0x00c7d67b, 0x00d1de97, 0x00dae4ab,
+  0x00f7ca64, 0x00f9cb5e, 0x00fddfa3, 0x00f9cb5e, 0x00fddfa3, 0x00f05843, 0x00f15944, 0x00f15944,
+  0x00f15944, 0x00f35b4c, 0x00f26956, 0x00f37160, 0x00f3796a, 0x00f4806e, 0x00f58275, 0x00f4806e,
+  0x00f67b6c, 0x00f37160, 0x00f26956, 0x00f4634f, 0x00f35b4c, 0x00f15944, 0x00f15944, 0x00f05843,
+  0x00f89385, 0x00f8a29a, 0x00f14832, 0x00aa9687, 0x006fcabd, 0x008ed6cb, 0x006fcabd, 0x0075cbb8,
+  0x00a6c964, 0x00aac84f, 0x00b1c850, 0x00b6d066, 0x00d1de97, 0x00dbe8b4, 0x00f7ca64, 0x00f9cb5e,
+  0x00fddfa3, 0x00f8cb65, 0x00ffe5b4, 0x00f05843, 0x00f15944, 0x00f1604c, 0x00f26956, 0x00f37160,
+  0x00f67b6c, 0x00f58275, 0x00f4806e, 0x00f3796a, 0x00f46b58, 0x00f1604c, 0x00f15944, 0x00f05843,
+  0x00f26956, 0x00f46b58, 0x00f14832, 0x00aa9687, 0x006fcabd, 0x009ad8cf, 0x007bcdc1, 0x006fcabd,
+  0x0075cbb8, 0x00a6c964, 0x00abc746, 0x00b3cb5a, 0x00abc746, 0x00abc746, 0x00aac84f, 0x00b3ca52,
+  0x00b6d066, 0x00c0d77a, 0x00d2e1a0, 0x00f9cb5e, 0x00fddc93, 0x00ffe5b4, 0x00f9cb5e, 0x00f8cb65,
+  0x00f8cb65, 0x00f8cb65, 0x00face6e, 0x00f9e6b4, 0x00f15944, 0x00f05843, 0x00f1604c, 0x00f26956,
+  0x00f67462, 0x00f4806e, 0x00f58275, 0x00f4806e, 0x00f3796a, 0x00f56c59, 0x00f1604c, 0x00f15944,
+  0x00f05843, 0x00f15944, 0x00f89385, 0x00f7a092, 0x00f24933, 0x00f14832, 0x00b49a8c, 0x006fcabd,
+  0x0079cabe, 0x008ed6cb, 0x006fcabd, 0x0075cbb8, 0x00a9ca5e, 0x00abc746, 0x00aac84f, 0x00dbe8b4,
+  0x00d2e1a0, 0x00abc746, 0x00aac84f, 0x00b7cf5e, 0x00c3d97c, 0x00dce7ad, 0x00f9cb5e, 0x00fbcf6f,
+  0x00fad681, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00f8cb65, 0x00face6e, 0x00f15944, 0x00f05843,
+  0x00f15944, 0x00f1604c, 0x00f37160, 0x00f67b6c, 0x00f58275, 0x00f4806e, 0x00f37160, 0x00f4634f,
+  0x00f15944, 0x00f05843, 0x00f15944, 0x00f59083, 0x00f59083, 0x00ef4f3a, 0x00f14832, 0x00bfa496,
+  0x006fcabd, 0x007bcdc1, 0x00b4e2db, 0x0089d5d0, 0x006fcabd, 0x0075cbb8, 0x00b1cb61, 0x00abc746,
+  0x00b7cf5e, 0x00b3ca52, 0x00abc746, 0x00b2c951, 0x00c0d77a, 0x00dbe8b4, 0x00f8cb65, 0x00f9cb5e,
+  0x00fddc93, 0x00fee3ac, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00face6e, 0x00f35b4c,
+  0x00f05843, 0x00f15944, 0x00f15944, 0x00f56c59, 0x00f67b6c, 0x00f58275, 0x00f58275, 0x00f58275,
+  0x00f4806e, 0x00f37160, 0x00f4634f, 0x00f15944, 0x00f05843, 0x00f4634f, 0x00f58275, 0x00f89385,
+  0x00f67b6c, 0x00f0583d, 0x00f14832, 0x00c1b9b2, 0x006fcabd, 0x007dcec2, 0x009ad8cf, 0x00a6dcd4,
+  0x008ed6cb, 0x0074cac4, 0x006fcabd, 0x007dceb5, 0x00b1cb61, 0x00abc746, 0x00b6d066, 0x00e2e8b6,
+  0x00b3cb5a, 0x00abc746, 0x00b1c747, 0x00b3cb5a, 0x00d1de97, 0x00f8cb65, 0x00f9cb5e, 0x00fada91,
+  0x00fddfa3, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f1604c, 0x00f05843, 0x00f15944,
+  0x00f56c5f, 0x00f4806e, 0x00f67462, 0x00f4634f, 0x00f05843, 0x00f1513b, 0x00f14832, 0x0070cbbe,
+  0x006fcabd, 0x0087cfb8, 0x00b7cf5e, 0x00abc746, 0x00b6d066, 0x00cce198, 0x00cadd8e, 0x00b6d066,
+  0x00abc746, 0x00b1c850, 0x00c9d985, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00fbd782, 0x00fddfa3,
+  0x00fada91, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f4634f, 0x00f05843, 0x00f0583d,
+  0x00f1513b, 0x00f2523c, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00ef4f3a, 0x0071ccbf, 0x006fcabd,
+  0x0093d2bc, 0x00b7cf5e, 0x00abc746, 0x00b6d066, 0x00b3ca52, 0x00abc746, 0x00b1c850, 0x00cadd8e,
+  0x00fbcf6f, 0x00f9cb5e, 0x00f8cb65, 0x00f9cb5e, 0x00f7ca64, 0x00f8cb65, 0x00face6e, 0x00fbcf6f,
+  0x00f26956, 0x00f05843, 0x00ef4f3a, 0x00f24933, 0x00f14832, 0x00f14832, 0x00f24939, 0x00f3533d,
+  0x00f05843, 0x00f1513b, 0x00f14832, 0x00f4634f, 0x007bcdc1, 0x006fcabd, 0x00a5dcc7, 0x00b7cf5e,
+  0x00abc746, 0x00c0d471, 0x00b3ca52, 0x00abc746, 0x00adcb51, 0x00d4e4a3, 0x00f8d478, 0x00f9cb5e,
+  0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fcd070, 0x00f37160, 0x00f05843, 0x00f3533d,
+  0x00ef4f33, 0x00f14832, 0x00f2523c, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f58878, 0x0089d1c6,
+  0x006fcabd, 0x00b7cf5e, 0x00abc746, 0x00d2de90, 0x00b3ca52, 0x00abc746, 0x00bcd16e, 0x00fddc93,
+  0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fbcf6f, 0x00f3796a,
+  0x00f15944, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f24939, 0x00f35343, 0x00f05843, 0x00f1513b,
+  0x00f14832, 0x00f9aa9f, 0x009ddcd3, 0x006fcabd, 0x0077cdc7, 0x00b7cf5e, 0x00abc746, 0x00aac84f,
+  0x00e2e8b6, 0x00b3ca52, 0x00abc746, 0x00b1c850, 0x00d1de97, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65,
+  0x00f9cb5e, 0x00f7ca64, 0x00f8cb65, 0x00face6e, 0x00f8d478, 0x00f67b6c, 0x00f15944, 0x00f05843,
+  0x00f0583d, 0x00ef4f3a, 0x00f14832, 0x00f24933, 0x00f3533d, 0x00f05843, 0x00f1513b, 0x00f14832,
+  0x00f24933, 0x006fcabd, 0x0089d1c6, 0x00b7cf5e, 0x00abc746, 0x00b3cb5a, 0x00b3ca52, 0x00abc746,
+  0x00b1c747, 0x00c0d471, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e,
+  0x00fad681, 0x00f58275, 0x00f4634f, 0x00f05843, 0x00f3533d, 0x00ef4f33, 0x00f14832, 0x00f2523c,
+  0x00f05843, 0x00f1513b, 0x00f14832, 0x00f2523c, 0x0077cdc7, 0x006fcabd, 0x009cdbd2, 0x00b7cf5e,
+  0x00abc746, 0x00c0d77a, 0x00b3ca52, 0x00abc746, 0x00b3cb5a, 0x00face6e, 0x00f9cb5e, 0x00f8cb65,
+  0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fad889, 0x00f58275, 0x00f46b58, 0x00f05843,
+  0x00f3533d, 0x00f14832, 0x00f24933, 0x00f2523c, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f46b58,
+  0x0078cfc9, 0x006fcabd, 0x00b9e7e0, 0x00b7cf5e, 0x00abc746, 0x00d2e1a0, 0x00b3ca52, 0x00abc746,
+  0x00b1c850, 0x00dae4ab, 0x00f8d478, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00fbcf6f, 0x00fad889, 0x00f58275, 0x00f67462, 0x00f15944, 0x00f05843, 0x00f3533d,
+  0x00f24933, 0x00f14832, 0x00f1513b, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f6a79c, 0x009ad8cf,
+  0x006fcabd, 0x0079cabe, 0x00b7cf5e, 0x00abc746, 0x00b3ca52, 0x00abc746, 0x00d2e099, 0x00fcdd9a,
+  0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fbd077,
+  0x00fada91, 0x00f58275, 0x00f4806e, 0x00f15944, 0x00f05843, 0x00f35343, 0x00f24933, 0x00f14832,
+  0x00f1513b, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00ef4f3a, 0x006fcabd, 0x0089d1c6, 0x00b7cf5e,
+  0x00abc746, 0x00b1c850, 0x00b3ca52, 0x00abc746, 0x00cadd8e, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00face6e, 0x00fad681, 0x00fddc93,
+  0x00f58275, 0x00f58275, 0x00f26956, 0x00f05843, 0x00f3533d, 0x00f24933, 0x00f14832, 0x00f1513b,
+  0x00f05843, 0x00f1513b, 0x00f14832, 0x00f4634f, 0x0078cfc9, 0x006fcabd, 0x00b4e2db, 0x00b7cf5e,
+  0x00abc746, 0x00c3d97c, 0x00b3ca52, 0x00abc746, 0x00c6d782, 0x00fcd070, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00face6e, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00face6e, 0x00fad889, 0x00fddc93,
+  0x00f58275, 0x00f58275, 0x00f67462, 0x00f05843, 0x00f0583d, 0x00f24933, 0x00f14832, 0x00f1513b,
+  0x00f05843, 0x00f1513b, 0x00f14832, 0x00f7a092, 0x009ad8cf, 0x006fcabd, 0x0074cac4, 0x00b7cf5e,
+  0x00abc746, 0x00dce7ad, 0x00b3ca52, 0x00abc746, 0x00c9d985, 0x00fada91, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00face6e, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fbd077, 0x00fada91, 0x00fddc93,
+  0x00f58275, 0x00f58275, 0x00f58275, 0x00f35b4c, 0x00f05843, 0x00f24933, 0x00f14832, 0x00f24933,
+  0x00f2523c, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f2523c, 0x0074cac4, 0x006fcabd, 0x008ed6cb,
+  0x00b7cf5e, 0x00abc746, 0x00b1c850, 0x00b3ca52, 0x00abc746, 0x00b1c747, 0x00d1de97, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00face6e,
+  0x00fad681, 0x00fddc93, 0x00fddc93, 0x00f58275, 0x00f58275, 0x00f58275, 0x00f46b58, 0x00f15944,
+  0x00f05843, 0x00ef4f3a, 0x00f14832, 0x00f3533d, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f37160,
+  0x0089d1c6, 0x006fcabd, 0x00b7cf5e, 0x00abc746, 0x00c6d782, 0x00b3ca52, 0x00abc746, 0x00aac84f,
+  0x00dae4ab, 0x00fbd077, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00face6e, 0x00f8cb65, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00fad889, 0x00fddc93, 0x00fddc93, 0x00f58275, 0x00f58275, 0x00f58275,
+  0x00f67b6c, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f24933, 0x00f35343, 0x00f05843, 0x00f1513b,
+  0x00f14832, 0x00f9b8ae, 0x00b4e2db, 0x006fcabd, 0x0077cdc7, 0x00b7cf5e, 0x00abc746, 0x00b3ca52,
+  0x00abc746, 0x00b1c850, 0x00fddfa3, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00face6e, 0x00face6e,
+  0x00f8cb65, 0x00f9cb5e, 0x00face6e, 0x00fbd077, 0x00fada91, 0x00fddc93, 0x00fddc93, 0x00f58275,
+  0x00f4634f, 0x00f15944, 0x00f05843, 0x00f05843, 0x00f05843, 0x00f3533d, 0x00f14832, 0x00ef4f3a,
+  0x00f05843, 0x00f1513b, 0x00f14832, 0x00f4634f, 0x007bcdc1, 0x006fcabd, 0x00a8ded6, 0x00b7cf5e,
+  0x00abc746, 0x00b7cf5e, 0x00b3ca52, 0x00abc746, 0x00b3cb5a, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00face6e, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fad681,
+  0x00fddc93, 0x00fddc93, 0x00fddc93, 0x00f58275, 0x00f67462, 0x00f15944, 0x00f05843, 0x00f05843,
+  0x00f35343, 0x00f24933, 0x00f14832, 0x00f2523c, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f7a092,
+  0x009ddcd3, 0x006fcabd, 0x0070cbbe, 0x00b7cf5e, 0x00abc746, 0x00d9e2a2, 0x00b3ca52, 0x00abc746,
+  0x00c0d471, 0x00fad889, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00fbcf6f, 0x00fada91, 0x00fddc93, 0x00fddc93, 0x00fddc93, 0x00f58275, 0x00f4634f,
+  0x00f15944, 0x00f05843, 0x00ef4f3a, 0x00f14832, 0x00f24933, 0x00f35343, 0x00f05843, 0x00f1513b,
+  0x00f14832, 0x00f4634f, 0x007bcdc1, 0x006fcabd, 0x009ddcd3, 0x00b7cf5e, 0x00abc746, 0x00b3cb5a,
+  0x00b3ca52, 0x00abc746, 0x00cce198, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00face6e, 0x00face6e, 0x00fad681, 0x00fddc93, 0x00f58275, 0x00f67462,
+  0x00f15944, 0x00f2523c, 0x00f14832, 0x00ef4f3a, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f7a092,
+  0x00a6dcd4, 0x006fcabd, 0x0079cabe, 0x00b7cf5e, 0x00abc746, 0x00d2e1a0, 0x00b3ca52, 0x00abc746,
+  0x00aac84f, 0x00fad681, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f7ca64, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00face6e, 0x00face6e, 0x00fada91, 0x00fddc93, 0x00f58275, 0x00f4634f, 0x00f14832,
+  0x00f2523c, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f46455, 0x0077cdc7, 0x006fcabd, 0x00a8ded6,
+  0x00b7cf5e, 0x00abc746, 0x00b7cf5e, 0x00b3ca52, 0x00abc746, 0x00bcd16e, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fad681, 0x00fddc93, 0x00f58275,
+  0x00f26956, 0x00f14832, 0x00f24933, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f24933, 0x00fbbab0,
+  0x00b4e2db, 0x006fcabd, 0x007dcec2, 0x00b7cf5e, 0x00abc746, 0x00dae4ab, 0x00b3ca52, 0x00abc746,
+  0x00dae4ab, 0x00fad889, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f9cb5e, 0x00fbcf6f, 0x00fddc93,
+  0x00f58275, 0x00f67b6c, 0x00f15944, 0x00ef4f3a, 0x00f14832, 0x00f2523c, 0x00f05843, 0x00f1513b,
+  0x00f14832, 0x00f3796a, 0x0080d2c6, 0x006fcabd, 0x0070cbbe, 0x00b9e7e0, 0x00b7cf5e, 0x00abc746,
+  0x00bed168, 0x00b3ca52, 0x00abc746, 0x00b3cb5a, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e,
+  0x00f8cb65, 0x00f9cb5e, 0x00fbcf6f, 0x00fddc93, 0x00f58275, 0x00f26956, 0x00f05843, 0x00f35343,
+  0x00f24933, 0x00f14832, 0x00f24933, 0x00f35343, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f2523c,
+  0x0070cbbe, 0x006fcabd, 0x0068cac2, 0x009ad8cf, 0x00b7cf5e, 0x00abc746, 0x00aac84f, 0x00b3ca52,
+  0x00abc746, 0x00cadd8e, 0x00fddfa3, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e,
+  0x00face6e, 0x00fad889, 0x00fddc93, 0x00f58275, 0x00f67b6c, 0x00f15944, 0x00f05843, 0x00f05843,
+  0x00f2523c, 0x00f14832, 0x00f1513b, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f6a79c, 0x00a6dcd4,
+  0x006fcabd, 0x007dcec2, 0x00b7cf5e, 0x00abc746, 0x00cadd8e, 0x00b3ca52, 0x00abc746, 0x00b3ca52,
+  0x00fbd077, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e,
+  0x00fbd077, 0x00fddc93, 0x00f58275, 0x00f46b58, 0x00f05843, 0x00ef4f3a, 0x00f14832, 0x00f24933,
+  0x00f05843, 0x00f1513b, 0x00f14832, 0x00f37160, 0x0089d1c6, 0x0070cbbe, 0x006fcabd, 0x0070cbbe,
+  0x00b9e7e0, 0x00b7cf5e, 0x00abc746, 0x00b6d066, 0x00b3ca52, 0x00abc746, 0x00c9d985, 0x00f8cb65,
+  0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00face6e,
+  0x00face6e, 0x00fad889, 0x00fddc93, 0x00f58275, 0x00f58275, 0x00f58275, 0x00f4806e, 0x00f15944,
+  0x00f05843, 0x00f35343, 0x00f24933, 0x00f14832, 0x00f2523c, 0x00f05843, 0x00f05843, 0x00f05843,
+  0x00f1513b, 0x00f14832, 0x00f15944, 0x007bcdc1, 0x006fcabd, 0x009ad8cf, 0x00b7cf5e, 0x00abc746,
+  0x00b1c850, 0x00b3ca52, 0x00abc746, 0x00b3ca52, 0x00fcdd9a, 0x00f9cb5e, 0x00f8cb65, 0x00face6e,
+  0x00f8cb65, 0x00f9cb5e, 0x00face6e, 0x00f8d478, 0x00fada91, 0x00fddc93, 0x00fddc93, 0x00fddc93,
+  0x00f58275, 0x00f58275, 0x00f58275, 0x00f37160, 0x00f15944, 0x00f05843, 0x00f3533d, 0x00f14832,
+  0x00f24933, 0x00f05843, 0x00f05843, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f1513b, 0x00b4e2db,
+  0x0070cbbe, 0x006fcabd, 0x0068cac2, 0x0089d1c6, 0x00b7cf5e, 0x00abc746, 0x00d1de97, 0x00b3ca52,
+  0x00abc746, 0x00d2e099, 0x00fad681, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00fad889, 0x00fddc93, 0x00fddc93, 0x00fddc93, 0x00f58275, 0x00f58275, 0x00f58275,
+  0x00f4634f, 0x00f05843, 0x00f3533d, 0x00f14832, 0x00f35343, 0x00f05843, 0x00f05843, 0x00f1513b,
+  0x00f14832, 0x00f24933, 0x00f8a29a, 0x00a8ded6, 0x0070cbbe, 0x006fcabd, 0x007dcec2, 0x00b7cf5e,
+  0x00abc746, 0x00c0d471, 0x00b3ca52, 0x00abc746, 0x00b7cf5e, 0x00fbcf6f, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fad681, 0x00fddc93, 0x00fddc93,
+  0x00fddc93, 0x00f58275, 0x00f58275, 0x00f67b6c, 0x00f05843, 0x00f2523c, 0x00f14832, 0x00ef4f3a,
+  0x00f05843, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f89385, 0x009ad8cf, 0x006fcabd, 0x0070cbbe,
+  0x00b7cf5e, 0x00abc746, 0x00b3cb5a, 0x00b3ca52, 0x00abc746, 0x00e2e8b6, 0x00f8cb65, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fbcf6f, 0x00fada91,
+  0x00fddc93, 0x00fddc93, 0x00f58275, 0x00f58275, 0x00f46b58, 0x00f05843, 0x00f1513b, 0x00f14832,
+  0x00f24933, 0x00f05843, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f58878, 0x008ed6cb, 0x006fcabd,
+  0x0070cbbe, 0x00b7cf5e, 0x00abc746, 0x00b3cb5a, 0x00b3ca52, 0x00abc746, 0x00c0d471, 0x00f8cb65,
+  0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fad889,
+  0x00fddc93, 0x00fddc93, 0x00f58275, 0x00f4806e, 0x00f4634f, 0x00f05843, 0x00ef4f3a, 0x00f14832,
+  0x00f3533d, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f58275, 0x0089d1c6, 0x006fcabd, 0x0070cbbe,
+  0x00b7cf5e, 0x00abc746, 0x00b3ca52, 0x00b3ca52, 0x00abc746, 0x00b2c951, 0x00fee3ac, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00face6e, 0x00fbd077,
+  0x00fddc93, 0x00fddc93, 0x00f58275, 0x00f67b6c, 0x00f15944, 0x00f05843, 0x00ef4f3a, 0x00f14832,
+  0x00ef4f3a, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f58275, 0x008ed6cb, 0x006fcabd, 0x0079cabe,
+  0x00b9e7e0, 0x00b7cf5e, 0x00abc746, 0x00b3ca52, 0x00b3ca52, 0x00abc746, 0x00b1c747, 0x00dce7ad,
+  0x00fddfa3, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e,
+  0x00fbcf6f, 0x00fad889, 0x00fddc93, 0x00f58275, 0x00f37160, 0x00f05843, 0x00ef4f3a, 0x00f14832,
+  0x00f24939, 0x00f05843, 0x00f1513b, 0x00f14832, 0x00f24933, 0x00f78b81, 0x008ed6cb, 0x006fcabd,
+  0x007bcdc1, 0x00b7cf5e, 0x00abc746, 0x00b3ca52, 0x00b3ca52, 0x00abc746, 0x00c0d471, 0x00fddfa3,
+  0x00f7ca64, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e,
+  0x00fad681, 0x00fddc93, 0x00f58275, 0x00f46455, 0x00f05843, 0x00f2523c, 0x00f14832, 0x00f35343,
+  0x00f1513b, 0x00f14832, 0x00f24933, 0x00f89385, 0x009cdbd2, 0x0070cbbe, 0x006fcabd, 0x0078cfc9,
+  0x00b7cf5e, 0x00abc746, 0x00b3cb5a, 0x00b3ca52, 0x00abc746, 0x00b2c951, 0x00fddfa3, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8d478, 0x00fddc93,
+  0x00f4806e, 0x00f35b4c, 0x00f05843, 0x00f2523c, 0x00f14832, 0x00f3533d, 0x00f1513b, 0x00f14832,
+  0x00ef4f3a, 0x00f6a79c, 0x00a8ded6, 0x0074cac4, 0x006fcabd, 0x0089d1c6, 0x00b7cf5e, 0x00abc746,
+  0x00b1c747, 0x00b7cf5e, 0x00b3ca52, 0x00abc746, 0x00aac84f, 0x00ffe5b4, 0x00f8cb65, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fbd077, 0x00fada91,
+  0x00f67b6c, 0x00f05843, 0x00f0583d, 0x00ef4f33, 0x00f14832, 0x00f1513b, 0x00f1513b, 0x00f14832,
+  0x00f1604c, 0x007dcec2, 0x006fcabd, 0x009ad8cf, 0x00b7cf5e, 0x00abc746, 0x00bcd16e, 0x00b3ca52,
+  0x00abc746, 0x00d4e4a3, 0x00face6e, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00fbcf6f, 0x00fad889, 0x00f37160, 0x00f05843, 0x00ef4f3a, 0x00f14832,
+  0x00ef4f3a, 0x00f1513b, 0x00f14832, 0x00f58275, 0x008ed6cb, 0x006fcabd, 0x0074cac4, 0x00b7cf5e,
+  0x00abc746, 0x00c9d985, 0x00b3ca52, 0x00abc746, 0x00c0d471, 0x00fad681, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fad681, 0x00f46b58, 0x00f05843,
+  0x00f3533d, 0x00f24933, 0x00f14832, 0x00f24933, 0x00ef4f3a, 0x00f14832, 0x00f15944, 0x00f9b0a3,
+  0x00b4e2db, 0x0077cdc7, 0x006fcabd, 0x0089d5d0, 0x00b7cf5e, 0x00abc746, 0x00b2c951, 0x00e2e8b6,
+  0x00b3ca52, 0x00abc746, 0x00b3ca52, 0x00fddfa3, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65,
+  0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00face6e, 0x00fad681, 0x00f4634f, 0x00f05843, 0x00f35343,
+  0x00ef4f3a, 0x00f14832, 0x00f1513b, 0x00f14832, 0x00f24933, 0x00f58878, 0x009ad8cf, 0x006fcabd,
+  0x0070cbbe, 0x007dcec2, 0x00b4e2db, 0x00b7cf5e, 0x00abc746, 0x00c0d77a, 0x00b3ca52, 0x00abc746,
+  0x00fbd077, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e,
+  0x00fbd077, 0x00f1604c, 0x00f05843, 0x00f3533d, 0x00ef4f3a, 0x00f14832, 0x00ef4f3a, 0x00f14832,
+  0x00f24933, 0x00f37160, 0x0089d1c6, 0x006fcabd, 0x007bcdc1, 0x00a6dcd4, 0x00b7cf5e, 0x00abc746,
+  0x00b7cf5e, 0x00dbe8b4, 0x00b3ca52, 0x00abc746, 0x00fddfa3, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65,
+  0x00face6e, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00face6e, 0x00fcd070, 0x00f35b4c,
+  0x00f05843, 0x00f2523c, 0x00f24933, 0x00f14832, 0x00f24933, 0x00f14832, 0x00f24933, 0x00f26956,
+  0x00fab2ab, 0x00b4e2db, 0x0089d1c6, 0x006fcabd, 0x007bcdc1, 0x009ad8cf, 0x00b7cf5e, 0x00abc746,
+  0x00b3ca52, 0x00cadd8e, 0x00b3ca52, 0x00abc746, 0x00dae4ab, 0x00fad889, 0x00f8cb65, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00fbd077, 0x00fad681, 0x00fbd077, 0x00face6e, 0x00fbcf6f, 0x00f15944,
+  0x00f05843, 0x00f2523c, 0x00ef4f3a, 0x00f14832, 0x00f24933, 0x00f14832, 0x00ef4f3a, 0x00f37160,
+  0x00fbbab0, 0x0089d1c6, 0x0071ccbf, 0x006fcabd, 0x007dcec2, 0x009ddcd3, 0x00b7cf5e, 0x00abc746,
+  0x00b3ca52, 0x00cadd8e, 0x00b3ca52, 0x00abc746, 0x00d2e1a0, 0x00fad681, 0x00f8cb65, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00fbd077, 0x00fad681, 0x00fddc93, 0x00fddc93, 0x00fddc93, 0x00fad889,
+  0x00fbd077, 0x00face6e, 0x00fbcf6f, 0x00f15944, 0x00f05843, 0x00f3533d, 0x00f1513b, 0x00f24933,
+  0x00f14832, 0x00f15944, 0x00f58878, 0x009ad8cf, 0x007dcec2, 0x0070cbbe, 0x006fcabd, 0x0070cbbe,
+  0x0074cac4, 0x0089d1c6, 0x00b4e2db, 0x00b7cf5e, 0x00abc746, 0x00b3cb5a, 0x00cadd8e, 0x00b3ca52,
+  0x00abc746, 0x00ccdf90, 0x00fad889, 0x00f8cb65, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fbd077,
+  0x00fad681, 0x00fada91, 0x00fddc93, 0x00fad889, 0x00fbd077, 0x00fbcf6f, 0x00face6e, 0x00f15944,
+  0x00f05843, 0x00f2523c, 0x00ef4f3a, 0x00f14832, 0x00f24933, 0x00f14832, 0x00f24933, 0x00f3533d,
+  0x00f67462, 0x00f9b8ae, 0x0089d1c6, 0x007bcdc1, 0x0074cac4, 0x006fcabd, 0x0074cac4, 0x007dcec2,
+  0x00a8ded6, 0x00b7cf5e, 0x00abc746, 0x00b1c850, 0x00b6d066, 0x00d4e4a3, 0x00b3ca52, 0x00abc746,
+  0x00c6d782, 0x00fcdd9a, 0x00face6e, 0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fbcf6f, 0x00f8d478,
+  0x00fad889, 0x00fddc93, 0x00fad889, 0x00fdd279, 0x00fbcf6f, 0x00face6e, 0x00f05843, 0x00f3533d,
+  0x00ef4f3a, 0x00ef4f33, 0x00f14832, 0x00f24939, 0x00f4634f, 0x00f89385, 0x00fbbab0, 0x009eddd4,
+  0x007dcec2, 0x006fcabd, 0x0070cbbe, 0x006fcabd, 0x0079cabe, 0x0089d5d0, 0x00b4e2db, 0x00b7cf5e,
+  0x00abc746, 0x00b3cb5a, 0x00d1de97, 0x00b3ca52, 0x00abc746, 0x00c0d471, 0x00fada91, 0x00f8cb65,
+  0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fbd077, 0x00fad681, 0x00fada91, 0x00fddc93, 0x00fada91,
+  0x00fad681, 0x00fbd077, 0x00face6e, 0x00f05843, 0x00f3533d, 0x00f2523c, 0x00ef4f3a, 0x00f24939,
+  0x00f24933, 0x00f14832, 0x00f24933, 0x00f1513b, 0x00f35b4c, 0x00f37160, 0x00f89385, 0x00f9aa9f,
+  0x00b9e7e0, 0x00a6dcd4, 0x008ed6cb, 0x0078cfc9, 0x0074cac4, 0x006fcabd, 0x006fcabd, 0x0070cbbe,
+  0x006fcabd, 0x006fcabd, 0x006fcabd, 0x0070cbbe, 0x0070cbbe, 0x0070cbbe, 0x0077cdc7, 0x0080d2c6,
+  0x009ad8cf, 0x00b4e2db, 0x00b7cf5e, 0x00abc746, 0x00b1c747, 0x00abc746, 0x00b2c951, 0x00c0d471,
+  0x00d4e4a3, 0x00b3ca52, 0x00abc746, 0x00bed168, 0x00fddfa3, 0x00fdd279, 0x00f8cb65, 0x00f9cb5e,
+  0x00f8cb65, 0x00face6e, 0x00fbd077, 0x00fad681, 0x00fbd782, 0x00fada91, 0x00fddc93, 0x00fad889,
+  0x00fad681, 0x00fbd077, 0x00face6e, 0x00f24933, 0x00f14832, 0x00f14832, 0x00f14832, 0x00f24933,
+  0x00f14832, 0x00f14832, 0x00f3796a, 0x00b7cf5e, 0x00abc746, 0x00abc746, 0x00b1c747, 0x00b1c850,
+  0x00b3cb5a, 0x00bccf66, 0x00c6d782, 0x00d1de97, 0x00dae4ab, 0x00b3ca52, 0x00abc746, 0x00bccf66,
+  0x00fee3ac, 0x00fddfa3, 0x00fad889, 0x00f8d478, 0x00f8cb65, 0x00f8cb65, 0x00f9cb5e, 0x00f9cb5e,
+  0x00f9cb5e, 0x00f8cb65, 0x00face6e, 0x00fbcf6f, 0x00fbd077, 0x00f8d478, 0x00f8d478, 0x00fad681,
+  0x00fad889, 0x00fada91, 0x00fada91, 0x00fddc93, 0x00fada91, 0x00fada91, 0x00fad889, 0x00fad681,
+  0x00fdd279, 0x00f8d478, 0x00fbd077, 0x00fcd070, 0x00face6e, 0x00ffe5b4, 0x00f14832, 0x00f59083,
+  0x00fcdd9a, 0x00f9cb5e, 0x00f9cb5e, 0x00f8cb65, 0x00f9cb5e, 0x00f7ca64, 0x00fee3ac, 0x00f14832,
+  0x00f89385, 0x00f9e6b4, 0x00f9cb5e, 0x00fee3ac, 0x00f14832, 0x00f7998e, 0x00f9e6b4, 0x00f9cb5e,
+  0x00ffe5b4, 0x00f14832, 0x00f8a29a, 0x00f9e6b4, 0x00f9cb5e, 0x00f14832, 0x00fab2ab, 0x00f9e6b4,
+  0x00f9cb5e, 0x00f14832, 0x00f9e6b4, 0x00f9cb5e, 0x00f14832, 0x00f24933, 0x00f9e6b4, 0x00f9cb5e,
+  0x00f8cb65, 0x00f14832, 0x00f15944, 0x00f9e6b4, 0x00f9cb5e, 0x00fbcf6f, 0x00f14832, 0x00f37160,
+  0x00f9e6b4, 0x00f9cb5e, 0x00fad681, 0x00f14832, 0x00f89385, 0x00f9e6b4, 0x00f9cb5e, 0x00fad889,
+  0x00f14832, 0x00fab2ab, 0x00f9e6b4, 0x00f9cb5e, 0x00fddfa3, 0x00f14832, 0x00f9e6b4, 0x00f9cb5e,
+  0x00f14832, 0x00f15944, 0x00f9e6b4, 0x00f9cb5e, 0x00f8cb65, 0x00f14832, 0x00f59083, 0x00f9e6b4,
+  0x00f9cb5e, 0x00fad889, 0x00f14832, 0x00f9b8ae, 0x00f9e6b4, 0x00f9cb5e, 0x00fddfa3, 0x00f14832,
+  0x00ef4f3a, 0x00f9e6b4, 0x00f9cb5e, 0x00f14832, 0x00f58275, 0x00f9e6b4, 0x00f9cb5e, 0x00f8d478,
+  0x00f14832, 0x00f8beb2, 0x00f9e6b4, 0x00f9cb5e, 0x00fddfa3, 0x00f14832, 0x00f15944, 0x00f9e6b4,
+  0x00f9cb5e, 0x00f14832, 0x00f7a092, 0x00f9e6b4, 0x00f9cb5e, 0x00fad681, 0x00f14832, 0x00f05843,
+  0x00f9e6b4, 0x00f9cb5e, 0x00f14832, 0x00f78b81, 0x00f9e6b4, 0x00f9cb5e, 0x00fbcf6f, 0x00f14832,
+  0x00f35343, 0x00f9e6b4, 0x00f9cb5e, 0x00fee3ac, 0x00f14832, 0x00f59083, 0x00f9e6b4, 0x00f9cb5e,
+  0x00f8cb65, 0x00f14832, 0x00f15944, 0x00f9e6b4, 0x00f9cb5e, 0x00fee3ac, 0x00f14832, 0x00f7a092,
+  0x00f9e6b4, 0x00f9cb5e, 0x00fbcf6f, 0x00f14832, 0x00f46b58, 0x00f9e6b4, 0x00f9cb5e, 0x00f14832,
+  0x00f1513b, 0x00f9e6b4, 0x00f9cb5e, 0x00fad889, 0x00f14832, 0x00f69786, 0x00f9e6b4, 0x00f9cb5e,
+  0x00f8cb65, 0x00f14832, 0x00f46b58, 0x00f9e6b4, 0x00f9cb5e, 0x00f7ca64, 0x00fee3ac, 0x00f14832,
+  0x00f2523c, 0x00f9e6b4, 0x00f9cb5e, 0x00fad681, 0x00f14832, 0x00fab2ab, 0x00f9e6b4, 0x00f9cb5e,
+  0x00fbcf6f, 0x00f14832, 0x00f89385, 0x00f9e6b4, 0x00f9cb5e, 0x00f8cb65, 0x00f14832, 0x00f4806e,
+  0x00f9e6b4, 0x00f9cb5e, 0x00ffe5b4, 0x00f14832, 0x00f3796a, 0x00f9e6b4, 0x00f9cb5e, 0x00fddfa3,
+  0x00f14832, 0x00f47964, 0x00f9e6b4, 0x00f9cb5e, 0x00fada91, 0x00f14832, 0x00f3796a, 0x00f9e6b4,
+  0x00f9cb5e, 0x00fad889, 0x00f14832, 0x00f24933, 0x00f67b6c, 0x00f9e6b4, 0x00f9cb5e, 0x00fad889,
+  0x00f14832, 0x00f24933, 0x00f78b81, 0x00f9e6b4, 0x00f9cb5e, 0x00fddc93, 0x00f14832, 0x00ef4f3a,
+  0x00f8a29a, 0x00f9e6b4, 0x00f9cb5e, 0x00f8cb65, 0x00fddfa3, 0x00f14832, 0x00f3533d, 0x00f9e6b4,
+  0x00f9cb5e, 0x00f8cb65, 0x00f9e6b4, 0x00f14832, 0x00f37160, 0x00f9e6b4, 0x00f9cb5e, 0x00fbcf6f,
+  0x00f14832, 0x00f05843, 0x00f6a79c, 0x00f9e6b4, 0x00f9cb5e, 0x00fada91, 0x00f14832, 0x00f24933,
+  0x00f67b6c, 0x00f9e6b4, 0x00f9cb5e, 0x00f8cb65, 0x00f14832, 0x00f24933, 0x00f37160, 0x00f9e6b4,
+  0x00f9cb5e, 0x00f8cb65, 0x00fddc93, 0x00f14832, 0x00f26956, 0x00f9b8ae, 0x00f9e6b4, 0x00f9cb5e,
+  0x00f7ca64, 0x00fad681, 0x00f14832, 0x00ef4f3a, 0x00f56c59, 0x00f9b8ae, 0x00f9e6b4, 0x00f9cb5e,
+  0x00fad681, 0x00f14832, 0x00f24933, 0x00f15944, 0x00f58275, 0x00f9e6b4, 0x00f9cb5e, 0x00f8cb65,
+  0x00fad681, 0x00f14832, 0x00f24933, 0x00f35343, 0x00f67462, 0x00fab2ab, 0x00f9e6b4, 0x00f9cb5e,
+  0x00f8cb65, 0x00fddc93, 0x00f14832, 0x00f24933, 0x00f1604c, 0x00f89385, 0x00fbbab0, 0x00f9e6b4,
+  0x00f9cb5e, 0x00f8cb65, 0x00fad889, 0x00f14832, 0x00f14832, 0x00f14832, 0x00ef4f33, 0x00f3533d,
+  0x00f4634f, 0x00f3796a, 0x00f7998e, 0x00fab2ab, 0x00f9e6b4, 0x00f9cb5e, 0x00f8cb65, 0x00f8d478,
+  0x00fddfa3, 0x00f9e6b4, 0x00f9cb5e, 0x00f9cb5e, 0x00f9cb5e, 0x00f8cb65, 0x00f8cb65, 0x00fbd077,
+  0x00fada91, 0x00fddfa3, 0x00f9e6b4,
+};
+
+static const int POKY_IMG_XRGB8888_SPANS[] = {
+  212, 6, 0, 0, 212, 1, 0, 24, 213, 6, 1, 28,
+  219, 5, 0, 32, 212, 1, 0, 52, 213, 11, 1, 56,
+  224, 4, 0, 60, 212, 1, 0, 76, 213, 15, 1, 80,
+  228, 2, 0, 84, 212, 1, 0, 92, 213, 18, 1, 96,
+  231, 2, 0, 100, 212, 1, 0, 108, 213, 20, 1, 112,
+  233, 2, 0, 116, 212, 1, 0, 124, 213, 22, 1, 128,
+  235, 2, 0, 132, 212, 1, 0, 140, 213, 24, 1, 144,
+  237, 2, 0, 148, 212, 1, 0, 156, 213, 26, 1, 160,
+  239, 1, 0, 164, 212, 1, 0, 168, 213, 27, 1, 172,
+  240, 2, 0, 176, 212, 1, 0, 184, 213, 29, 1, 188,
+  242, 1, 0, 192, 212, 1, 0, 196, 213, 30, 1, 200,
+  243, 1, 0, 204, 212, 1, 0, 208, 213, 31, 1, 212,
+  244, 2, 0, 216, 212, 1, 0, 224, 213, 33, 1, 228,
+  246, 1, 0, 232, 212, 1, 0, 236, 213, 34, 1, 240,
+  247, 1, 0, 244, 212, 1, 0, 248, 213, 35, 1, 252,
+  248, 1, 0, 256, 212, 1, 0, 260, 213, 36, 1, 264,
+  249, 1, 0, 268, 212, 1, 0, 272, 213, 37, 1, 276,
+  250, 1, 0, 280, 212, 1, 0, 284, 213, 37, 1, 288,
+  250, 2, 0, 292, 212, 1, 0, 300, 213, 38, 1, 304,
+  251, 2, 0, 308, 212, 1, 0, 316, 213, 39, 1, 320,
+  252, 1, 0, 324, 212, 1, 0, 328, 213, 40, 1, 332,
+  253, 1, 0, 336, 212, 1, 0, 340, 213, 41, 1, 344,
+  254, 1, 0, 348, 212, 1, 0, 352, 213, 41, 1, 356,
+  254, 1, 0, 360, 212, 1, 0, 364, 213, 42, 1, 368,
+  255, 1, 0, 372, 212, 1, 0, 376, 213, 43, 1, 380,
+  256, 1, 0, 384, 212, 1, 0, 388, 213, 43, 1, 392,
+  256, 1, 0, 396, 212, 1, 0, 400, 213, 44, 1, 404,
+  257, 1, 0, 408, 212, 1, 0, 412, 213, 44, 1, 416,
+  257, 1, 0, 420, 212, 1, 0, 424, 213, 45, 1, 428,
+  258, 1, 0, 432, 212, 1, 0, 436, 213, 45, 1, 440,
+  258, 1, 0, 444, 212, 1, 0, 448, 213, 46, 1, 452,
+  259, 1, 0, 456, 212, 1, 0, 460, 213, 46, 1, 464,
+  259, 1, 0, 468, 212, 1, 0, 472, 213, 47, 1, 476,
+  260, 1, 0, 480, 212, 1, 0, 484, 213, 47, 1, 488,
+  260, 1, 0, 492, 212, 1, 0, 496, 213, 48, 1, 500,
+  212, 1, 0, 504, 213, 48, 1, 508, 261, 1, 0, 512,
+  212, 1, 0, 516, 213, 48, 1, 520, 261, 1, 0, 524,
+  212, 1, 0, 528, 213, 48, 1, 532, 261, 1, 0, 536,
+  212, 1, 0, 540, 213, 49, 1, 544, 262, 1, 0, 548,
+  212, 1, 0, 552, 213, 49, 1, 556, 262, 1, 0, 560,
+  212, 1, 0, 564, 213, 49, 1, 568, 262, 1, 0, 572,
+  212, 1, 0, 576, 213, 49, 1, 580, 262, 1, 0, 584,
+  212, 1, 0, 588, 213, 50, 1, 592, 212, 1, 0, 596,
+  213, 50, 1, 600, 263, 1, 0, 604, 212, 1, 0, 608,
+  213, 50, 1, 612, 263, 1, 0, 616, 212, 1, 0, 620,
+  213, 50, 1, 624, 263, 1, 0, 628, 212, 1, 0, 632,
+  213, 50, 1, 636, 263, 1, 0, 640, 212, 1, 0, 644,
+  213, 50, 1, 648, 263, 1, 0, 652, 212, 1, 0, 656,
+  213, 50, 1, 660, 263, 1, 0, 664, 212, 1, 0, 668,
+  213, 50, 1, 672, 263, 1, 0, 676, 50, 14, 0, 680,
+  109, 2, 0, 736, 158, 8, 0, 744, 212, 1, 0, 776,
+  213, 50, 1, 780, 263, 1, 0, 784, 44, 5, 0, 788,
+  49, 14, 1, 808, 63, 6, 0, 812, 109, 6, 1, 836,
+  115, 4, 0, 840, 150, 4, 0, 856, 154, 5, 1, 872,
+  159, 2, 0, 876, 161, 6, 1, 884, 167, 5, 0, 888,
+  212, 9, 0, 908, 221, 34, 1, 944, 255, 10, 0, 948,
+  265, 50, 1, 988, 315, 6, 0, 992, 414, 5, 0, 1016,
+  41, 4, 0, 1036, 45, 24, 1, 1052, 69, 3, 0, 1056,
+  109, 11, 1, 1068, 120, 3, 0, 1072, 146, 3, 0, 1084,
+  149, 10, 1, 1096, 159, 2, 0, 1100, 161, 11, 1, 1108,
+  172, 4, 0, 1112, 212, 1, 0, 1128, 213, 7, 1, 1132,
+  220, 6, 0, 1136, 226, 24, 1, 1160, 250, 6, 0, 1164,
+  256, 7, 1, 1188, 263, 2, 0, 1192, 265, 50, 1, 1200,
+  315, 1, 0, 1204, 316, 7, 1, 1208, 323, 5, 0, 1212,
+  408, 4, 0, 1232, 412, 7, 1, 1248, 419, 1, 0, 1252,
+  38, 3, 0, 1256, 41, 31, 1, 1268, 72, 3, 0, 1272,
+  109, 15, 1, 1284, 124, 2, 0, 1288, 143, 2, 0, 1296,
+  145, 14, 1, 1304, 159, 2, 0, 1308, 161, 14, 1, 1316,
+  175, 4, 0, 1320, 212, 1, 0, 1336, 213, 12, 1, 1340,
+  225, 4, 0, 1344, 229, 18, 1, 1360, 247, 4, 0, 1364,
+  251, 12, 1, 1380, 263, 2, 0, 1384, 265, 50, 1, 1392,
+  315, 1, 0, 1396, 316, 12, 1, 1400, 328, 3, 0, 1404,
+  404, 3, 0, 1416, 407, 12, 1, 1428, 419, 1, 0, 1432,
+  36, 2, 0, 1436, 38, 37, 1, 1444, 75, 3, 0, 1448,
+  109, 18, 1, 1460, 127, 1, 0, 1464, 140, 2, 0, 1468,
+  142, 17, 1, 1476, 159, 2, 0, 1480, 161, 17, 1, 1488,
+  178, 3, 0, 1492, 212, 1, 0, 1504, 213, 15, 1, 1508,
+  228, 4, 0, 1512, 232, 12, 1, 1528, 244, 4, 0, 1532,
+  248, 15, 1, 1548, 263, 2, 0, 1552, 265, 50, 1, 1560,
+  315, 1, 0, 1564, 316, 16, 1, 1568, 332, 2, 0, 1572,
+  401, 2, 0, 1580, 403, 16, 1, 1588, 419, 1, 0, 1592,
+  33, 2, 0, 1596, 35, 43, 1, 1604, 78, 2, 0, 1608,
+  109, 1, 0, 1616, 110, 19, 1, 1620, 129, 2, 0, 1624,
+  138, 1, 0, 1632, 139, 20, 1, 1636, 159, 2, 0, 1640,
+  161, 20, 1, 1648, 181, 2, 0, 1652, 212, 1, 0, 1660,
+  213, 18, 1, 1664, 231, 3, 0, 1668, 234, 8, 1, 1680,
+  242, 3, 0, 1684, 245, 18, 1, 1696, 263, 2, 0, 1700,
+  265, 50, 1, 1708, 315, 1, 0, 1712, 316, 19, 1, 1716,
+  335, 2, 0, 1720, 399, 2, 0, 1728, 401, 18, 1, 1736,
+  419, 1, 0, 1740, 32, 1, 0, 1744, 33, 47, 1, 1748,
+  80, 2, 0, 1752, 109, 1, 0, 1760, 110, 21, 1, 1764,
+  131, 2, 0, 1768, 136, 1, 0, 1776, 137, 22, 1, 1780,
+  159, 2, 0, 1784, 161, 22, 1, 1792, 183, 2, 0, 1796,
+  212, 1, 0, 1804, 213, 21, 1, 1808, 234, 2, 0, 1812,
+  236, 4, 1, 1820, 240, 2, 0, 1824, 242, 21, 1, 1832,
+  263, 2, 0, 1836, 265, 50, 1, 1844, 315, 2, 0, 1848,
+  317, 20, 1, 1856, 337, 2, 0, 1860, 397, 1, 0, 1868,
+  398, 21, 1, 1872, 419, 1, 0, 1876, 30, 1, 0, 1880,
+  31, 51, 1, 1884, 82, 1, 0, 1888, 109, 1, 0, 1892,
+  110, 23, 1, 1896, 133, 3, 0, 1900, 136, 23, 1, 1912,
+  159, 2, 0, 1916, 161, 24, 1, 1924, 185, 2, 0, 1928,
+  212, 1, 0, 1936, 213, 23, 1, 1940, 236, 4, 0, 1944,
+  240, 23, 1, 1960, 263, 2, 0, 1964, 265, 50, 1, 1972,
+  315, 2, 0, 1976, 317, 22, 1, 1984, 339, 2, 0, 1988,
+  395, 1, 0, 1996, 396, 23, 1, 2000, 419, 1, 0, 2004,
+  28, 2, 0, 2008, 30, 53, 1, 2016, 83, 2, 0, 2020,
+  109, 1, 0, 2028, 110, 21, 1, 2032, 131, 7, 0, 2036,
+  138, 21, 1, 2064, 159, 2, 0, 2068, 161, 26, 1, 2076,
+  187, 1, 0, 2080, 212, 1, 0, 2084, 213, 23, 1, 2088,
+  236, 3, 0, 2092, 239, 24, 1, 2104, 263, 2, 0, 2108,
+  265, 50, 1, 2116, 315, 2, 0, 2120, 317, 24, 1, 2128,
+  341, 1, 0, 2132, 393, 1, 0, 2136, 394, 25, 1, 2140,
+  419, 1, 0, 2144, 27, 2, 0, 2148, 29, 56, 1, 2156,
+  85, 1, 0, 2160, 109, 1, 0, 2164, 110, 19, 1, 2168,
+  129, 2, 0, 2172, 131, 5, 1, 2180, 136, 3, 0, 2184,
+  139, 20, 1, 2196, 159, 2, 0, 2200, 161, 27, 1, 2208,
+  188, 2, 0, 2212, 212, 1, 0, 2220, 213, 22, 1, 2224,
+  235, 6, 0, 2228, 241, 22, 1, 2252, 263, 2, 0, 2256,
+  265, 50, 1, 2264, 315, 2, 0, 2268, 317, 25, 1, 2276,
+  342, 2, 0, 2280, 391, 2, 0, 2288, 393, 26, 1, 2296,
+  419, 1, 0, 2300, 25, 2, 0, 2304, 27, 59, 1, 2312,
+  86, 2, 0, 2316, 110, 18, 1, 2324, 128, 2, 0, 2328,
+  130, 9, 1, 2336, 139, 1, 0, 2340, 140, 19, 1, 2344,
+  159, 2, 0, 2348, 161, 29, 1, 2356, 190, 1, 0, 2360,
+  212, 1, 0, 2364, 213, 20, 1, 2368, 233, 2, 0, 2372,
+  235, 6, 1, 2380, 241, 2, 0, 2384, 243, 20, 1, 2392,
+  263, 2, 0, 2396, 265, 49, 1, 2404, 314, 1, 0, 2408,
+  316, 1, 0, 2412, 317, 27, 1, 2416, 344, 1, 0, 2420,
+  390, 1, 0, 2424, 391, 28, 1, 2428, 419, 1, 0, 2432,
+  24, 2, 0, 2436, 26, 61, 1, 2444, 87, 2, 0, 2448,
+  110, 1, 0, 2456, 111, 16, 1, 2460, 127, 2, 0, 2464,
+  129, 10, 1, 2472, 139, 2, 0, 2476, 141, 18, 1, 2484,
+  159, 2, 0, 2488, 161, 30, 1, 2496, 191, 2, 0, 2500,
+  212, 2, 0, 2508, 214, 18, 1, 2516, 232, 2, 0, 2520,
+  234, 8, 1, 2528, 242, 2, 0, 2532, 244, 19, 1, 2540,
+  263, 2, 0, 2544, 265, 49, 1, 2552, 314, 1, 0, 2556,
+  316, 1, 0, 2560, 317, 28, 1, 2564, 345, 2, 0, 2568,
+  388, 2, 0, 2576, 390, 29, 1, 2584, 419, 1, 0, 2588,
+  23, 1, 0, 2592, 24, 65, 1, 2596, 89, 1, 0, 2600,
+  110, 1, 0, 2604, 111, 15, 1, 2608, 126, 1, 0, 2612,
+  127, 14, 1, 2616, 141, 2, 0, 2620, 143, 16, 1, 2628,
+  159, 2, 0, 2632, 161, 31, 1, 2640, 192, 2, 0, 2644,
+  212, 2, 0, 2652, 214, 17, 1, 2660, 231, 1, 0, 2664,
+  232, 11, 1, 2668, 243, 2, 0, 2672, 245, 18, 1, 2680,
+  263, 2, 0, 2684, 265, 49, 1, 2692, 314, 1, 0, 2696,
+  316, 1, 0, 2700, 317, 30, 1, 2704, 347, 1, 0, 2708,
+  387, 1, 0, 2712, 388, 31, 1, 2716, 419, 1, 0, 2720,
+  22, 1, 0, 2724, 23, 67, 1, 2728, 90, 1, 0, 2732,
+  110, 1, 0, 2736, 111, 14, 1, 2740, 125, 1, 0, 2744,
+  126, 16, 1, 2748, 142, 2, 0, 2752, 144, 15, 1, 2760,
+  159, 2, 0, 2764, 161, 33, 1, 2772, 194, 1, 0, 2776,
+  212, 2, 0, 2780, 214, 16, 1, 2788, 230, 1, 0, 2792,
+  231, 14, 1, 2796, 245, 1, 0, 2800, 246, 17, 1, 2804,
+  263, 2, 0, 2808, 265, 49, 1, 2816, 314, 1, 0, 2820,
+  316, 1, 0, 2824, 317, 31, 1, 2828, 348, 1, 0, 2832,
+  386, 1, 0, 2836, 387, 32, 1, 2840, 419, 1, 0, 2844,
+  21, 1, 0, 2848, 22, 69, 1, 2852, 91, 2, 0, 2856,
+  111, 13, 1, 2864, 124, 2, 0, 2868, 126, 18, 1, 2876,
+  144, 1, 0, 2880, 145, 14, 1, 2884, 159, 2, 0, 2888,
+  161, 34, 1, 2896, 195, 1, 0, 2900, 212, 2, 0, 2904,
+  214, 14, 1, 2912, 228, 2, 0, 2916, 230, 16, 1, 2924,
+  246, 2, 0, 2928, 248, 15, 1, 2936, 263, 2, 0, 2940,
+  265, 48, 1, 2948, 313, 1, 0, 2952, 316, 1, 0, 2956,
+  317, 32, 1, 2960, 349, 1, 0, 2964, 385, 1, 0, 2968,
+  386, 33, 1, 2972, 419, 1, 0, 2976, 20, 1, 0, 2980,
+  21, 71, 1, 2984, 92, 2, 0, 2988, 111, 1, 0, 2996,
+  112, 11, 1, 3000, 123, 2, 0, 3004, 125, 20, 1, 3012,
+  145, 1, 0, 3016, 146, 13, 1, 3020, 159, 2, 0, 3024,
+  161, 35, 1, 3032, 196, 1, 0, 3036, 212, 3, 0, 3040,
+  215, 13, 1, 3052, 228, 1, 0, 3056, 229, 18, 1, 3060,
+  247, 1, 0, 3064, 248, 15, 1, 3068, 263, 2, 0, 3072,
+  265, 48, 1, 3080, 313, 1, 0, 3084, 316, 1, 0, 3088,
+  317, 34, 1, 3092, 351, 1, 0, 3096, 384, 1, 0, 3100,
+  385, 34, 1, 3104, 419, 1, 0, 3108, 19, 1, 0, 3112,
+  20, 73, 1, 3116, 93, 2, 0, 3120, 111, 1, 0, 3128,
+  112, 10, 1, 3132, 122, 2, 0, 3136, 124, 22, 1, 3144,
+  146, 1, 0, 3148, 147, 12, 1, 3152, 159, 2, 0, 3156,
+  161, 36, 1, 3164, 197, 1, 0, 3168, 212, 3, 0, 3172,
+  215, 12, 1, 3184, 227, 1, 0, 3188, 228, 20, 1, 3192,
+  248, 1, 0, 3196, 249, 14, 1, 3200, 263, 2, 0, 3204,
+  265, 48, 1, 3212, 313, 1, 0, 3216, 316, 1, 0, 3220,
+  317, 35, 1, 3224, 352, 1, 0, 3228, 383, 1, 0, 3232,
+  384, 35, 1, 3236, 419, 1, 0, 3240, 18, 1, 0, 3244,
+  19, 75, 1, 3248, 94, 1, 0, 3252, 112, 9, 1, 3256,
+  121, 1, 0, 3260, 122, 24, 1, 3264, 146, 2, 0, 3268,
+  148, 11, 1, 3276, 159, 2, 0, 3280, 161, 37, 1, 3288,
+  198, 1, 0, 3292, 212, 3, 0, 3296, 215, 10, 1, 3308,
+  225, 2, 0, 3312, 227, 22, 1, 3320, 249, 1, 0, 3324,
+  250, 13, 1, 3328, 263, 2, 0, 3332, 265, 47, 1, 3340,
+  312, 1, 0, 3344, 316, 1, 0, 3348, 317, 36, 1, 3352,
+  353, 1, 0, 3356, 382, 1, 0, 3360, 383, 36, 1, 3364,
+  419, 1, 0, 3368, 17, 1, 0, 3372, 18, 77, 1, 3376,
+  95, 1, 0, 3380, 112, 1, 0, 3384, 113, 7, 1, 3388,
+  120, 1, 0, 3392, 121, 26, 1, 3396, 147, 2, 0, 3400,
+  149, 10, 1, 3408, 159, 2, 0, 3412, 161, 38, 1, 3420,
+  199, 1, 0, 3424, 212, 3, 0, 3428, 215, 10, 1, 3440,
+  225, 1, 0, 3444, 226, 24, 1, 3448, 250, 1, 0, 3452,
+  251, 12, 1, 3456, 263, 2, 0, 3460, 265, 47, 1, 3468,
+  312, 1, 0, 3472, 316, 1, 0, 3476, 317, 36, 1, 3480,
+  353, 1, 0, 3484, 381, 1, 0, 3488, 382, 37, 1, 3492,
+  419, 1, 0, 3496, 16, 1, 0, 3500, 17, 79, 1, 3504,
+  96, 1, 0, 3508, 112, 1, 0, 3512, 113, 6, 1, 3516,
+  119, 2, 0, 3520, 121, 27, 1, 3528, 148, 2, 0, 3532,
+  150, 9, 1, 3540, 159, 2, 0, 3544, 161, 39, 1, 3552,
+  200, 1, 0, 3556, 212, 4, 0, 3560, 216, 8, 1, 3576,
+  224, 1, 0, 3580, 225, 26, 1, 3584, 251, 1, 0, 3588,
+  252, 11, 1, 3592, 263, 2, 0, 3596, 265, 47, 1, 3604,
+  312, 1, 0, 3608, 316, 1, 0, 3612, 317, 37, 1, 3616,
+  354, 1, 0, 3620, 380, 1, 0, 3624, 381, 38, 1, 3628,
+  419, 1, 0, 3632, 15, 2, 0, 3636, 17, 80, 1, 3644,
+  97, 1, 0, 3648, 113, 5, 1, 3652, 118, 2, 0, 3656,
+  120, 29, 1, 3664, 149, 1, 0, 3668, 150, 9, 1, 3672,
+  159, 2, 0, 3676, 161, 39, 1, 3684, 200, 1, 0, 3688,
+  212, 4, 0, 3692, 216, 7, 1, 3708, 223, 1, 0, 3712,
+  224, 28, 1, 3716, 252, 1, 0, 3720, 253, 10, 1, 3724,
+  263, 2, 0, 3728, 265, 46, 1, 3736, 311, 1, 0, 3740,
+  316, 1, 0, 3744, 317, 38, 1, 3748, 355, 1, 0, 3752,
+  379, 1, 0, 3756, 380, 39, 1, 3760, 419, 1, 0, 3764,
+  15, 1, 0, 3768, 16, 82, 1, 3772, 98, 1, 0, 3776,
+  113, 1, 0, 3780, 114, 4, 1, 3784, 118, 1, 0, 3788,
+  119, 31, 1, 3792, 150, 1, 0, 3796, 151, 8, 1, 3800,
+  159, 2, 0, 3804, 161, 40, 1, 3812, 201, 1, 0, 3816,
+  212, 5, 0, 3820, 217, 5, 1, 3840, 222, 1, 0, 3844,
+  223, 30, 1, 3848, 253, 1, 0, 3852, 254, 9, 1, 3856,
+  263, 2, 0, 3860, 265, 46, 1, 3868, 311, 1, 0, 3872,
+  316, 1, 0, 3876, 317, 39, 1, 3880, 356, 1, 0, 3884,
+  378, 1, 0, 3888, 379, 40, 1, 3892, 419, 1, 0, 3896,
+  14, 1, 0, 3900, 15, 83, 1, 3904, 98, 1, 0, 3908,
+  114, 5, 0, 3912, 119, 31, 1, 3932, 150, 2, 0, 3936,
+  152, 7, 1, 3944, 159, 2, 0, 3948, 161, 41, 1, 3956,
+  202, 1, 0, 3960, 212, 5, 0, 3964, 217, 4, 1, 3984,
+  221, 2, 0, 3988, 223, 30, 1, 3996, 253, 1, 0, 4000,
+  254, 9, 1, 4004, 263, 2, 0, 4008, 265, 45, 1, 4016,
+  310, 1, 0, 4020, 316, 1, 0, 4024, 317, 40, 1, 4028,
+  357, 1, 0, 4032, 378, 41, 1, 4036, 419, 1, 0, 4040,
+  13, 1, 0, 4044, 14, 85, 1, 4048, 99, 1, 0, 4052,
+  114, 3, 0, 4056, 117, 34, 1, 4068, 151, 1, 0, 4072,
+  152, 7, 1, 4076, 159, 2, 0, 4080, 161, 41, 1, 4088,
+  202, 2, 0, 4092, 212, 1, 0, 4100, 213, 4, 1, 4104,
+  217, 5, 0, 4108, 222, 32, 1, 4128, 254, 1, 0, 4132,
+  255, 8, 1, 4136, 263, 2, 0, 4140, 265, 45, 1, 4148,
+  310, 1, 0, 4152, 316, 1, 0, 4156, 317, 40, 1, 4160,
+  357, 1, 0, 4164, 377, 1, 0, 4168, 378, 41, 1, 4172,
+  419, 1, 0, 4176, 12, 2, 0, 4180, 14, 86, 1, 4188,
+  100, 1, 0, 4192, 115, 2, 0, 4196, 117, 34, 1, 4204,
+  151, 2, 0, 4208, 153, 6, 1, 4216, 159, 2, 0, 4220,
+  161, 42, 1, 4228, 203, 1, 0, 4232, 212, 1, 0, 4236,
+  213, 4, 1, 4240, 217, 4, 0, 4244, 221, 34, 1, 4260,
+  255, 1, 0, 4264, 256, 7, 1, 4268, 263, 2, 0, 4272,
+  265, 45, 1, 4280, 310, 1, 0, 4284, 316, 1, 0, 4288,
+  317, 41, 1, 4292, 358, 1, 0, 4296, 376, 1, 0, 4300,
+  377, 42, 1, 4304, 419, 1, 0, 4308, 12, 1, 0, 4312,
+  13, 87, 1, 4316, 100, 1, 0, 4320, 115, 1, 0, 4324,
+  116, 36, 1, 4328, 152, 1, 0, 4332, 153, 6, 1, 4336,
+  159, 2, 0, 4340, 161, 43, 1, 4348, 204, 1, 0, 4352,
+  212, 1, 0, 4356, 213, 4, 1, 4360, 217, 3, 0, 4364,
+  220, 35, 1, 4376, 255, 2, 0, 4380, 257, 6, 1, 4388,
+  263, 2, 0, 4392, 265, 44, 1, 4400, 309, 1, 0, 4404,
+  316, 1, 0, 4408, 317, 42, 1, 4412, 359, 1, 0, 4416,
+  375, 1, 0, 4420, 376, 43, 1, 4424, 419, 1, 0, 4428,
+  11, 2, 0, 4432, 13, 88, 1, 4440, 101, 1, 0, 4444,
+  115, 1, 0, 4448, 116, 37, 1, 4452, 153, 1, 0, 4456,
+  154, 5, 1, 4460, 159, 2, 0, 4464, 161, 43, 1, 4472,
+  204, 1, 0, 4476, 212, 1, 0, 4480, 213, 5, 1, 4484,
+  218, 2, 0, 4488, 220, 36, 1, 4496, 256, 1, 0, 4500,
+  257, 6, 1, 4504, 263, 2, 0, 4508, 265, 43, 1, 4516,
+  308, 1, 0, 4520, 316, 1, 0, 4524, 317, 43, 1, 4528,
+  375, 1, 0, 4532, 376, 43, 1, 4536, 419, 1, 0, 4540,
+  11, 1, 0, 4544, 12, 89, 1, 4548, 101, 1, 0, 4552,
+  115, 2, 0, 4556, 117, 37, 1, 4564, 154, 1, 0, 4568,
+  155, 4, 1, 4572, 159, 2, 0, 4576, 161, 44, 1, 4584,
+  205, 1, 0, 4588, 212, 1, 0, 4592, 213, 5, 1, 4596,
+  218, 2, 0, 4600, 220, 37, 1, 4608, 257, 1, 0, 4612,
+  258, 5, 1, 4616, 263, 2, 0, 4620, 265, 43, 1, 4628,
+  308, 1, 0, 4632, 316, 1, 0, 4636, 317, 43, 1, 4640,
+  360, 1, 0, 4644, 374, 1, 0, 4648, 375, 44, 1, 4652,
+  419, 1, 0, 4656, 10, 1, 0, 4660, 11, 91, 1, 4664,
+  102, 1, 0, 4668, 114, 4, 0, 4672, 118, 36, 1, 4688,
+  154, 1, 0, 4692, 155, 4, 1, 4696, 159, 2, 0, 4700,
+  161, 45, 1, 4708, 212, 1, 0, 4712, 213, 5, 1, 4716,
+  218, 2, 0, 4720, 220, 37, 1, 4728, 257, 1, 0, 4732,
+  258, 5, 1, 4736, 263, 2, 0, 4740, 265, 42, 1, 4748,
+  307, 1, 0, 4752, 316, 1, 0, 4756, 317, 44, 1, 4760,
+  374, 1, 0, 4764, 375, 44, 1, 4768, 419, 1, 0, 4772,
+  10, 1, 0, 4776, 11, 91, 1, 4780, 102, 1, 0, 4784,
+  114, 4, 0, 4788, 118, 37, 1, 4804, 155, 6, 0, 4808,
+  161, 45, 1, 4832, 206, 1, 0, 4836, 212, 1, 0, 4840,
+  213, 4, 1, 4844, 217, 4, 0, 4848, 221, 37, 1, 4864,
+  258, 1, 0, 4868, 259, 4, 1, 4872, 263, 2, 0, 4876,
+  265, 42, 1, 4884, 307, 1, 0, 4888, 316, 1, 0, 4892,
+  317, 44, 1, 4896, 361, 1, 0, 4900, 373, 1, 0, 4904,
+  374, 45, 1, 4908, 419, 1, 0, 4912, 9, 1, 0, 4916,
+  10, 93, 1, 4920, 103, 1, 0, 4924, 113, 5, 0, 4928,
+  118, 37, 1, 4948, 155, 6, 0, 4952, 161, 46, 1, 4976,
+  212, 1, 0, 4980, 213, 4, 1, 4984, 217, 4, 0, 4988,
+  221, 37, 1, 5004, 258, 1, 0, 5008, 259, 4, 1, 5012,
+  263, 2, 0, 5016, 265, 41, 1, 5024, 306, 1, 0, 5028,
+  316, 1, 0, 5032, 317, 45, 1, 5036, 362, 1, 0, 5040,
+  373, 1, 0, 5044, 374, 45, 1, 5048, 419, 1, 0, 5052,
+  9, 1, 0, 5056, 10, 93, 1, 5060, 103, 1, 0, 5064,
+  113, 1, 0, 5068, 114, 4, 1, 5072, 118, 2, 0, 5076,
+  120, 35, 1, 5084, 155, 6, 0, 5088, 161, 46, 1, 5112,
+  207, 1, 0, 5116, 212, 5, 0, 5120, 217, 4, 1, 5140,
+  221, 1, 0, 5144, 222, 37, 1, 5148, 259, 6, 0, 5152,
+  265, 40, 1, 5176, 305, 1, 0, 5180, 316, 1, 0, 5184,
+  317, 45, 1, 5188, 362, 1, 0, 5192, 372, 1, 0, 5196,
+  373, 46, 1, 5200, 419, 1, 0, 5204, 8, 1, 0, 5208,
+  9, 95, 1, 5212, 104, 1, 0, 5216, 113, 6, 1, 5220,
+  119, 2, 0, 5224, 121, 35, 1, 5232, 156, 5, 0, 5236,
+  161, 47, 1, 5256, 212, 5, 0, 5260, 217, 5, 1, 5280,
+  222, 1, 0, 5284, 223, 36, 1, 5288, 259, 6, 0, 5292,
+  265, 40, 1, 5316, 305, 1, 0, 5320, 316, 1, 0, 5324,
+  317, 46, 1, 5328, 372, 1, 0, 5332, 373, 46, 1, 5336,
+  419, 1, 0, 5340, 8, 1, 0, 5344, 9, 95, 1, 5348,
+  104, 1, 0, 5352, 112, 1, 0, 5356, 113, 7, 1, 5360,
+  120, 1, 0, 5364, 121, 35, 1, 5368, 156, 5, 0, 5372,
+  161, 47, 1, 5392, 208, 1, 0, 5396, 212, 4, 0, 5400,
+  216, 7, 1, 5416, 223, 1, 0, 5420, 224, 36, 1, 5424,
+  260, 5, 0, 5428, 265, 39, 1, 5448, 304, 1, 0, 5452,
+  316, 1, 0, 5456, 317, 46, 1, 5460, 363, 1, 0, 5464,
+  371, 1, 0, 5468, 372, 47, 1, 5472, 419, 1, 0, 5476,
+  8, 97, 1, 5480, 105, 1, 0, 5484, 112, 9, 1, 5488,
+  121, 1, 0, 5492, 122, 35, 1, 5496, 157, 4, 0, 5500,
+  161, 47, 1, 5516, 208, 1, 0, 5520, 212, 4, 0, 5524,
+  216, 8, 1, 5540, 224, 1, 0, 5544, 225, 35, 1, 5548,
+  260, 5, 0, 5552, 265, 38, 1, 5572, 303, 1, 0, 5576,
+  316, 1, 0, 5580, 317, 46, 1, 5584, 363, 1, 0, 5588,
+  371, 1, 0, 5592, 372, 47, 1, 5596, 419, 1, 0, 5600,
+  7, 1, 0, 5604, 8, 97, 1, 5608, 105, 1, 0, 5612,
+  111, 1, 0, 5616, 112, 9, 1, 5620, 121, 2, 0, 5624,
+  123, 34, 1, 5632, 157, 4, 0, 5636, 161, 48, 1, 5652,
+  212, 4, 0, 5656, 216, 8, 1, 5672, 224, 1, 0, 5676,
+  225, 35, 1, 5680, 260, 5, 0, 5684, 265, 37, 1, 5704,
+  302, 1, 0, 5708, 316, 1, 0, 5712, 317, 47, 1, 5716,
+  364, 1, 0, 5720, 371, 48, 1, 5724, 419, 1, 0, 5728,
+  7, 1, 0, 5732, 8, 97, 1, 5736, 105, 1, 0, 5740,
+  111, 1, 0, 5744, 112, 10, 1, 5748, 122, 2, 0, 5752,
+  124, 33, 1, 5760, 157, 4, 0, 5764, 161, 48, 1, 5780,
+  209, 1, 0, 5784, 212, 3, 0, 5788, 215, 10, 1, 5800,
+  225, 1, 0, 5804, 226, 35, 1, 5808, 261, 4, 0, 5812,
+  265, 36, 1, 5828, 301, 1, 0, 5832, 316, 1, 0, 5836,
+  317, 47, 1, 5840, 364, 1, 0, 5844, 370, 1, 0, 5848,
+  371, 48, 1, 5852, 419, 1, 0, 5856, 7, 1, 0, 5860,
+  8, 98, 1, 5864, 106, 1, 0, 5868, 111, 12, 1, 5872,
+  123, 2, 0, 5876, 125, 33, 1, 5884, 158, 3, 0, 5888,
+  161, 48, 1, 5900, 209, 1, 0, 5904, 212, 3, 0, 5908,
+  215, 11, 1, 5920, 226, 1, 0, 5924, 227, 34, 1, 5928,
+  261, 4, 0, 5932, 265, 35, 1, 5948, 300, 1, 0, 5952,
+  316, 1, 0, 5956, 317, 47, 1, 5960, 364, 1, 0, 5964,
+  370, 1, 0, 5968, 371, 48, 1, 5972, 419, 1, 0, 5976,
+  6, 1, 0, 5980, 7, 99, 1, 5984, 106, 1, 0, 5988,
+  110, 1, 0, 5992, 111, 13, 1, 5996, 124, 2, 0, 6000,
+  126, 32, 1, 6008, 158, 3, 0, 6012, 161, 49, 1, 6024,
+  212, 3, 0, 6028, 215, 12, 1, 6040, 227, 2, 0, 6044,
+  229, 32, 1, 6052, 261, 4, 0, 6056, 265, 34, 1, 6072,
+  299, 1, 0, 6076, 316, 1, 0, 6080, 317, 48, 1, 6084,
+  365, 1, 0, 6088, 370, 1, 0, 6092, 371, 48, 1, 6096,
+  419, 1, 0, 6100, 6, 1, 0, 6104, 7, 99, 1, 6108,
+  106, 1, 0, 6112, 110, 1, 0, 6116, 111, 14, 1, 6120,
+  125, 2, 0, 6124, 127, 31, 1, 6132, 158, 3, 0, 6136,
+  161, 49, 1, 6148, 210, 1, 0, 6152, 212, 2, 0, 6156,
+  214, 14, 1, 6164, 228, 1, 0, 6168, 229, 33, 1, 6172,
+  262, 3, 0, 6176, 265, 33, 1, 6188, 298, 1, 0, 6192,
+  316, 1, 0, 6196, 317, 48, 1, 6200, 365, 1, 0, 6204,
+  369, 1, 0, 6208, 370, 49, 1, 6212, 419, 1, 0, 6216,
+  6, 1, 0, 6220, 7, 99, 1, 6224, 106, 1, 0, 6228,
+  110, 1, 0, 6232, 111, 16, 1, 6236, 127, 2, 0, 6240,
+  129, 30, 1, 6248, 159, 2, 0, 6252, 161, 49, 1, 6260,
+  210, 1, 0, 6264, 212, 2, 0, 6268, 214, 15, 1, 6276,
+  229, 1, 0, 6280, 230, 32, 1, 6284, 262, 3, 0, 6288,
+  265, 32, 1, 6300, 297, 1, 0, 6304, 316, 1, 0, 6308,
+  317, 48, 1, 6312, 365, 1, 0, 6316, 369, 1, 0, 6320,
+  370, 49, 1, 6324, 419, 1, 0, 6328, 6, 1, 0, 6332,
+  7, 100, 1, 6336, 107, 1, 0, 6340, 110, 18, 1, 6344,
+  128, 2, 0, 6348, 130, 29, 1, 6356, 159, 2, 0, 6360,
+  161, 49, 1, 6368, 210, 1, 0, 6372, 212, 2, 0, 6376,
+  214, 16, 1, 6384, 230, 2, 0, 6388, 232, 30, 1, 6396,
+  262, 3, 0, 6400, 265, 31, 1, 6412, 296, 1, 0, 6416,
+  316, 1, 0, 6420, 317, 48, 1, 6424, 365, 1, 0, 6428,
+  369, 1, 0, 6432, 370, 49, 1, 6436, 419, 1, 0, 6440,
+  5, 1, 0, 6444, 6, 101, 1, 6448, 107, 1, 0, 6452,
+  110, 19, 1, 6456, 129, 2, 0, 6460, 131, 27, 1, 6468,
+  158, 3, 0, 6472, 161, 49, 1, 6484, 210, 1, 0, 6488,
+  212, 2, 0, 6492, 214, 18, 1, 6500, 232, 1, 0, 6504,
+  233, 30, 1, 6508, 263, 2, 0, 6512, 265, 30, 1, 6520,
+  295, 1, 0, 6524, 316, 1, 0, 6528, 317, 49, 1, 6532,
+  366, 1, 0, 6536, 369, 50, 1, 6540, 419, 1, 0, 6544,
+  5, 1, 0, 6548, 6, 101, 1, 6552, 107, 1, 0, 6556,
+  109, 1, 0, 6560, 110, 20, 1, 6564, 130, 2, 0, 6568,
+  132, 27, 1, 6576, 159, 2, 0, 6580, 161, 49, 1, 6588,
+  210, 1, 0, 6592, 212, 1, 0, 6596, 213, 20, 1, 6600,
+  233, 1, 0, 6604, 234, 29, 1, 6608, 263, 2, 0, 6612,
+  265, 28, 1, 6620, 293, 1, 0, 6624, 316, 1, 0, 6628,
+  317, 49, 1, 6632, 366, 1, 0, 6636, 368, 1, 0, 6640,
+  369, 50, 1, 6644, 419, 1, 0, 6648, 5, 1, 0, 6652,
+  6, 101, 1, 6656, 107, 1, 0, 6660, 109, 1, 0, 6664,
+  110, 22, 1, 6668, 132, 2, 0, 6672, 134, 25, 1, 6680,
+  159, 2, 0, 6684, 161, 50, 1, 6692, 211, 2, 0, 6696,
+  213, 21, 1, 6704, 234, 2, 0, 6708, 236, 27, 1, 6716,
+  263, 2, 0, 6720, 265, 26, 1, 6728, 291, 2, 0, 6732,
+  316, 1, 0, 6740, 317, 49, 1, 6744, 366, 1, 0, 6748,
+  368, 1, 0, 6752, 369, 50, 1, 6756, 419, 1, 0, 6760,
+  5, 1, 0, 6764, 6, 102, 1, 6768, 109, 1, 0, 6772,
+  110, 24, 1, 6776, 134, 2, 0, 6780, 136, 25, 1, 6788,
+  161, 50, 1, 6792, 211, 2, 0, 6796, 213, 23, 1, 6804,
+  236, 2, 0, 6808, 238, 25, 1, 6816, 263, 2, 0, 6820,
+  265, 25, 1, 6828, 290, 2, 0, 6832, 316, 1, 0, 6840,
+  317, 49, 1, 6844, 366, 1, 0, 6848, 368, 1, 0, 6852,
+  369, 50, 1, 6856, 419, 1, 0, 6860, 5, 1, 0, 6864,
+  6, 49, 1, 6868, 55, 3, 0, 6872, 58, 50, 1, 6884,
+  109, 1, 0, 6888, 110, 25, 1, 6892, 135, 4, 0, 6896,
+  139, 19, 1, 6912, 158, 4, 0, 6916, 162, 49, 1, 6932,
+  211, 2, 0, 6936, 213, 24, 1, 6944, 237, 2, 0, 6948,
+  239, 24, 1, 6956, 263, 2, 0, 6960, 265, 23, 1, 6968,
+  288, 2, 0, 6972, 316, 1, 0, 6980, 317, 49, 1, 6984,
+  366, 1, 0, 6988, 368, 1, 0, 6992, 369, 50, 1, 6996,
+  419, 1, 0, 7000, 5, 1, 0, 7004, 6, 47, 1, 7008,
+  53, 2, 0, 7012, 58, 2, 0, 7020, 60, 48, 1, 7028,
+  108, 2, 0, 7032, 110, 27, 1, 7040, 137, 3, 0, 7044,
+  140, 16, 1, 7056, 156, 2, 0, 7060, 162, 3, 0, 7068,
+  165, 46, 1, 7080, 211, 2, 0, 7084, 213, 26, 1, 7092,
+  239, 2, 0, 7096, 241, 21, 1, 7104, 262, 4, 0, 7108,
+  266, 20, 1, 7124, 286, 2, 0, 7128, 316, 1, 0, 7136,
+  317, 49, 1, 7140, 366, 1, 0, 7144, 368, 1, 0, 7148,
+  369, 50, 1, 7152, 419, 1, 0, 7156, 5, 1, 0, 7160,
+  6, 46, 1, 7164, 52, 1, 0, 7168, 60, 1, 0, 7172,
+  61, 47, 1, 7176, 108, 1, 0, 7180, 109, 30, 1, 7184,
+  139, 3, 0, 7188, 142, 14, 1, 7200, 156, 1, 0, 7204,
+  164, 1, 0, 7208, 165, 46, 1, 7212, 211, 2, 0, 7216,
+  213, 28, 1, 7224, 241, 2, 0, 7228, 243, 17, 1, 7236,
+  260, 2, 0, 7240, 265, 2, 0, 7248, 267, 16, 1, 7256,
+  283, 3, 0, 7260, 316, 1, 0, 7272, 317, 47, 1, 7276,
+  364, 2, 0, 7280, 369, 2, 0, 7288, 371, 48, 1, 7296,
+  419, 1, 0, 7300, 5, 1, 0, 7304, 6, 45, 1, 7308,
+  51, 1, 0, 7312, 61, 1, 0, 7316, 62, 46, 1, 7320,
+  108, 1, 0, 7324, 109, 33, 1, 7328, 142, 4, 0, 7332,
+  146, 9, 1, 7348, 155, 1, 0, 7352, 164, 1, 0, 7356,
+  165, 46, 1, 7360, 211, 2, 0, 7364, 213, 30, 1, 7372,
+  243, 3, 0, 7376, 246, 14, 1, 7388, 260, 1, 0, 7392,
+  267, 1, 0, 7396, 268, 14, 1, 7400, 282, 2, 0, 7404,
+  316, 1, 0, 7412, 317, 46, 1, 7416, 363, 1, 0, 7420,
+  371, 1, 0, 7424, 372, 47, 1, 7428, 419, 1, 0, 7432,
+  5, 46, 1, 7436, 51, 1, 0, 7440, 61, 1, 0, 7444,
+  62, 46, 1, 7448, 108, 1, 0, 7452, 109, 36, 1, 7456,
+  145, 5, 0, 7460, 150, 5, 1, 7480, 165, 1, 0, 7484,
+  166, 45, 1, 7488, 211, 2, 0, 7492, 213, 33, 1, 7500,
+  246, 2, 0, 7504, 248, 11, 1, 7512, 259, 1, 0, 7516,
+  268, 1, 0, 7520, 269, 10, 1, 7524, 279, 2, 0, 7528,
+  316, 1, 0, 7536, 317, 46, 1, 7540, 372, 1, 0, 7544,
+  373, 46, 1, 7548, 419, 1, 0, 7552, 5, 46, 1, 7556,
+  51, 1, 0, 7560, 61, 1, 0, 7564, 62, 46, 1, 7568,
+  108, 1, 0, 7572, 109, 40, 1, 7576, 149, 6, 0, 7580,
+  165, 1, 0, 7604, 166, 45, 1, 7608, 211, 2, 0, 7612,
+  213, 36, 1, 7620, 249, 4, 0, 7624, 253, 5, 1, 7640,
+  258, 1, 0, 7644, 269, 6, 1, 7648, 275, 3, 0, 7652,
+  316, 1, 0, 7664, 317, 45, 1, 7668, 362, 1, 0, 7672,
+  372, 1, 0, 7676, 373, 46, 1, 7680, 419, 1, 0, 7684,
+  5, 9, 0, 7688, 14, 34, 1, 7724, 48, 4, 0, 7728,
+  61, 1, 0, 7744, 62, 46, 1, 7748, 108, 1, 0, 7752,
+  109, 43, 1, 7756, 152, 3, 0, 7760, 165, 1, 0, 7772,
+  166, 45, 1, 7776, 211, 2, 0, 7780, 213, 39, 1, 7788,
+  252, 7, 0, 7792, 269, 5, 0, 7820, 316, 1, 0, 7840,
+  317, 45, 1, 7844, 362, 1, 0, 7848, 373, 46, 1, 7852,
+  419, 1, 0, 7856, 5, 6, 1, 7860, 11, 8, 0, 7864,
+  19, 23, 1, 7896, 42, 10, 0, 7900, 61, 1, 0, 7940,
+  62, 46, 1, 7944, 108, 1, 0, 7948, 109, 46, 1, 7952,
+  165, 1, 0, 7956, 166, 45, 1, 7960, 211, 2, 0, 7964,
+  213, 44, 1, 7972, 257, 2, 0, 7976, 269, 2, 0, 7984,
+  316, 1, 0, 7992, 317, 45, 1, 7996, 362, 1, 0, 8000,
+  373, 46, 1, 8004, 419, 1, 0, 8008, 5, 12, 1, 8012,
+  17, 5, 0, 8016, 22, 17, 1, 8036, 39, 5, 0, 8040,
+  44, 7, 1, 8060, 51, 1, 0, 8064, 61, 1, 0, 8068,
+  62, 46, 1, 8072, 108, 1, 0, 8076, 109, 46, 1, 8080,
+  155, 1, 0, 8084, 165, 1, 0, 8088, 166, 45, 1, 8092,
+  211, 2, 0, 8096, 213, 45, 1, 8104, 258, 1, 0, 8108,
+  269, 7, 0, 8112, 316, 46, 1, 8140, 362, 1, 0, 8144,
+  372, 1, 0, 8148, 373, 5, 1, 8152, 378, 3, 0, 8156,
+  381, 38, 1, 8168, 419, 1, 0, 8172, 5, 1, 0, 8176,
+  6, 15, 1, 8180, 21, 4, 0, 8184, 25, 11, 1, 8200,
+  36, 5, 0, 8204, 41, 10, 1, 8224, 51, 2, 0, 8228,
+  60, 2, 0, 8236, 62, 46, 1, 8244, 108, 1, 0, 8248,
+  109, 46, 1, 8252, 155, 1, 0, 8256, 164, 1, 0, 8260,
+  165, 46, 1, 8264, 211, 2, 0, 8268, 213, 45, 1, 8276,
+  258, 2, 0, 8280, 268, 1, 0, 8288, 269, 7, 1, 8292,
+  276, 4, 0, 8296, 316, 46, 1, 8312, 362, 1, 0, 8316,
+  372, 1, 0, 8320, 373, 9, 1, 8324, 382, 3, 0, 8328,
+  385, 34, 1, 8340, 5, 1, 0, 8344, 6, 17, 1, 8348,
+  23, 4, 0, 8352, 27, 7, 1, 8368, 34, 4, 0, 8372,
+  38, 14, 1, 8388, 52, 2, 0, 8392, 59, 2, 0, 8400,
+  61, 47, 1, 8408, 108, 1, 0, 8412, 109, 47, 1, 8416,
+  156, 2, 0, 8420, 163, 1, 0, 8428, 164, 47, 1, 8432,
+  211, 2, 0, 8436, 213, 46, 1, 8444, 259, 1, 0, 8448,
+  268, 1, 0, 8452, 269, 11, 1, 8456, 280, 3, 0, 8460,
+  316, 1, 0, 8472, 317, 46, 1, 8476, 363, 1, 0, 8480,
+  371, 2, 0, 8484, 373, 12, 1, 8492, 385, 2, 0, 8496,
+  387, 32, 1, 8504, 5, 1, 0, 8508, 6, 19, 1, 8512,
+  25, 11, 0, 8516, 36, 18, 1, 8560, 54, 5, 0, 8564,
+  59, 49, 1, 8584, 108, 1, 0, 8588, 109, 49, 1, 8592,
+  158, 5, 0, 8596, 163, 48, 1, 8616, 211, 2, 0, 8620,
+  213, 47, 1, 8628, 260, 1, 0, 8632, 266, 2, 0, 8636,
+  268, 14, 1, 8644, 282, 3, 0, 8648, 316, 1, 0, 8660,
+  317, 47, 1, 8664, 364, 1, 0, 8668, 370, 2, 0, 8672,
+  372, 15, 1, 8680, 387, 4, 1, 8684, 391, 28, 1, 8688,
+  5, 1, 0, 8692, 6, 22, 1, 8696, 28, 5, 0, 8700,
+  33, 23, 1, 8720, 56, 1, 0, 8724, 57, 51, 1, 8728,
+  109, 1, 0, 8732, 110, 101, 1, 8736, 211, 2, 0, 8740,
+  213, 49, 1, 8748, 262, 4, 0, 8752, 266, 19, 1, 8768,
+  285, 2, 0, 8772, 316, 1, 0, 8780, 317, 48, 1, 8784,
+  365, 5, 0, 8788, 370, 20, 1, 8808, 390, 1, 0, 8812,
+  391, 28, 1, 8816, 5, 1, 0, 8820, 6, 23, 1, 8824,
+  29, 3, 0, 8828, 32, 24, 1, 8840, 56, 1, 0, 8844,
+  57, 50, 1, 8848, 107, 1, 0, 8852, 109, 1, 0, 8856,
+  110, 101, 1, 8860, 211, 2, 0, 8864, 213, 50, 1, 8872,
+  263, 2, 0, 8876, 265, 22, 1, 8884, 287, 2, 0, 8888,
+  316, 1, 0, 8896, 317, 50, 1, 8900, 367, 1, 0, 8904,
+  368, 23, 1, 8908, 391, 2, 0, 8912, 393, 25, 1, 8920,
+  418, 1, 0, 8924, 5, 1, 0, 8928, 6, 22, 1, 8932,
+  28, 6, 0, 8936, 34, 22, 1, 8960, 56, 1, 0, 8964,
+  57, 50, 1, 8968, 107, 1, 0, 8972, 109, 1, 0, 8976,
+  110, 101, 1, 8980, 211, 2, 0, 8984, 213, 50, 1, 8992,
+  263, 2, 0, 8996, 265, 24, 1, 9004, 289, 2, 0, 9008,
+  316, 1, 0, 9016, 317, 50, 1, 9020, 367, 1, 0, 9024,
+  368, 26, 1, 9028, 394, 1, 0, 9032, 395, 23, 1, 9036,
+  418, 1, 0, 9040, 5, 1, 0, 9044, 6, 20, 1, 9048,
+  26, 2, 0, 9052, 28, 6, 1, 9060, 34, 1, 0, 9064,
+  35, 21, 1, 9068, 56, 1, 0, 9072, 57, 50, 1, 9076,
+  107, 1, 0, 9080, 109, 1, 0, 9084, 110, 101, 1, 9088,
+  212, 1, 0, 9092, 213, 50, 1, 9096, 263, 2, 0, 9100,
+  265, 26, 1, 9108, 291, 1, 0, 9112, 316, 1, 0, 9116,
+  317, 50, 1, 9120, 367, 2, 0, 9124, 369, 26, 1, 9132,
+  395, 1, 0, 9136, 396, 22, 1, 9140, 418, 1, 0, 9144,
+  5, 2, 0, 9148, 7, 18, 1, 9156, 25, 1, 0, 9160,
+  26, 9, 1, 9164, 35, 2, 0, 9168, 37, 19, 1, 9176,
+  56, 1, 0, 9180, 57, 50, 1, 9184, 107, 1, 0, 9188,
+  109, 1, 0, 9192, 110, 100, 1, 9196, 210, 1, 0, 9200,
+  212, 1, 0, 9204, 213, 49, 1, 9208, 262, 3, 0, 9212,
+  265, 27, 1, 9224, 292, 2, 0, 9228, 317, 50, 1, 9236,
+  367, 2, 0, 9240, 369, 27, 1, 9248, 396, 2, 0, 9252,
+  398, 20, 1, 9260, 418, 1, 0, 9264, 5, 2, 0, 9268,
+  7, 16, 1, 9276, 23, 2, 0, 9280, 25, 11, 1, 9288,
+  36, 2, 0, 9292, 38, 18, 1, 9300, 56, 1, 0, 9304,
+  57, 49, 1, 9308, 106, 1, 0, 9312, 110, 100, 1, 9316,
+  210, 1, 0, 9320, 212, 1, 0, 9324, 213, 49, 1, 9328,
+  262, 1, 0, 9332, 264, 1, 0, 9336, 265, 28, 1, 9340,
+  293, 2, 0, 9344, 317, 50, 1, 9352, 367, 2, 0, 9356,
+  369, 29, 1, 9364, 398, 1, 0, 9368, 399, 19, 1, 9372,
+  418, 1, 0, 9376, 5, 2, 0, 9380, 7, 15, 1, 9388,
+  22, 2, 0, 9392, 24, 14, 1, 9400, 38, 1, 0, 9404,
+  39, 17, 1, 9408, 56, 1, 0, 9412, 57, 49, 1, 9416,
+  106, 1, 0, 9420, 110, 1, 0, 9424, 111, 99, 1, 9428,
+  210, 1, 0, 9432, 212, 1, 0, 9436, 213, 49, 1, 9440,
+  262, 1, 0, 9444, 264, 1, 0, 9448, 265, 30, 1, 9452,
+  295, 1, 0, 9456, 317, 1, 0, 9460, 318, 49, 1, 9464,
+  367, 2, 0, 9468, 369, 30, 1, 9476, 399, 1, 0, 9480,
+  400, 18, 1, 9484, 418, 1, 0, 9488, 5, 2, 0, 9492,
+  7, 14, 1, 9500, 21, 1, 0, 9504, 22, 16, 1, 9508,
+  38, 2, 0, 9512, 40, 16, 1, 9520, 56, 1, 0, 9524,
+  57, 49, 1, 9528, 106, 1, 0, 9532, 110, 1, 0, 9536,
+  111, 99, 1, 9540, 210, 1, 0, 9544, 212, 1, 0, 9548,
+  213, 49, 1, 9552, 262, 1, 0, 9556, 264, 1, 0, 9560,
+  265, 31, 1, 9564, 296, 2, 0, 9568, 317, 1, 0, 9576,
+  318, 49, 1, 9580, 367, 2, 0, 9584, 369, 32, 1, 9592,
+  401, 1, 0, 9596, 402, 15, 1, 9600, 417, 2, 0, 9604,
+  5, 3, 0, 9612, 8, 12, 1, 9624, 20, 2, 0, 9628,
+  22, 18, 1, 9636, 40, 1, 0, 9640, 41, 15, 1, 9644,
+  56, 1, 0, 9648, 57, 49, 1, 9652, 106, 1, 0, 9656,
+  110, 1, 0, 9660, 111, 98, 1, 9664, 209, 1, 0, 9668,
+  212, 1, 0, 9672, 213, 49, 1, 9676, 264, 1, 0, 9680,
+  265, 33, 1, 9684, 298, 1, 0, 9688, 317, 1, 0, 9692,
+  318, 49, 1, 9696, 367, 3, 0, 9700, 370, 32, 1, 9712,
+  402, 1, 0, 9716, 403, 14, 1, 9720, 417, 2, 0, 9724,
+  5, 3, 0, 9732, 8, 11, 1, 9744, 19, 2, 0, 9748,
+  21, 20, 1, 9756, 41, 1, 0, 9760, 42, 14, 1, 9764,
+  56, 1, 0, 9768, 57, 48, 1, 9772, 105, 1, 0, 9776,
+  111, 98, 1, 9780, 209, 1, 0, 9784, 212, 1, 0, 9788,
+  213, 48, 1, 9792, 261, 1, 0, 9796, 264, 1, 0, 9800,
+  265, 34, 1, 9804, 299, 1, 0, 9808, 318, 1, 0, 9812,
+  319, 48, 1, 9816, 367, 3, 0, 9820, 370, 33, 1, 9832,
+  403, 2, 0, 9836, 405, 12, 1, 9844, 417, 2, 0, 9848,
+  5, 3, 0, 9856, 8, 10, 1, 9868, 18, 2, 0, 9872,
+  20, 22, 1, 9880, 42, 1, 0, 9884, 43, 13, 1, 9888,
+  56, 1, 0, 9892, 57, 48, 1, 9896, 105, 1, 0, 9900,
+  111, 1, 0, 9904, 112, 97, 1, 9908, 209, 1, 0, 9912,
+  212, 1, 0, 9916, 213, 48, 1, 9920, 261, 1, 0, 9924,
+  264, 1, 0, 9928, 265, 35, 1, 9932, 300, 1, 0, 9936,
+  318, 1, 0, 9940, 319, 48, 1, 9944, 367, 3, 0, 9948,
+  370, 34, 1, 9960, 404, 2, 0, 9964, 406, 11, 1, 9972,
+  417, 2, 0, 9976, 5, 3, 0, 9984, 8, 9, 1, 9996,
+  17, 2, 0, 10000, 19, 24, 1, 10008, 43, 1, 0, 10012,
+  44, 12, 1, 10016, 56, 1, 0, 10020, 57, 48, 1, 10024,
+  105, 1, 0, 10028, 111, 1, 0, 10032, 112, 96, 1, 10036,
+  208, 1, 0, 10040, 212, 1, 0, 10044, 213, 48, 1, 10048,
+  261, 1, 0, 10052, 264, 1, 0, 10056, 265, 36, 1, 10060,
+  301, 1, 0, 10064, 318, 1, 0, 10068, 319, 48, 1, 10072,
+  367, 3, 0, 10076, 370, 35, 1, 10088, 405, 1, 0, 10092,
+  406, 10, 1, 10096, 416, 3, 0, 10100, 5, 4, 0, 10112,
+  9, 8, 1, 10128, 17, 1, 0, 10132, 18, 25, 1, 10136,
+  43, 2, 0, 10140, 45, 11, 1, 10148, 56, 1, 0, 10152,
+  57, 47, 1, 10156, 104, 1, 0, 10160, 112, 1, 0, 10164,
+  113, 95, 1, 10168, 208, 1, 0, 10172, 212, 1, 0, 10176,
+  213, 47, 1, 10180, 260, 1, 0, 10184, 264, 1, 0, 10188,
+  265, 36, 1, 10192, 301, 2, 0, 10196, 319, 48, 1, 10204,
+  367, 4, 0, 10208, 371, 35, 1, 10224, 406, 2, 0, 10228,
+  408, 8, 1, 10236, 416, 3, 0, 10240, 5, 5, 0, 10252,
+  10, 6, 1, 10272, 16, 1, 0, 10276, 17, 28, 1, 10280,
+  45, 1, 0, 10284, 46, 10, 1, 10288, 56, 1, 0, 10292,
+  57, 47, 1, 10296, 104, 1, 0, 10300, 112, 1, 0, 10304,
+  113, 95, 1, 10308, 212, 1, 0, 10312, 213, 47, 1, 10316,
+  260, 1, 0, 10320, 264, 1, 0, 10324, 265, 37, 1, 10328,
+  302, 2, 0, 10332, 319, 1, 0, 10340, 320, 47, 1, 10344,
+  367, 4, 0, 10348, 371, 36, 1, 10364, 407, 1, 0, 10368,
+  408, 8, 1, 10372, 416, 3, 0, 10376, 5, 4, 0, 10388,
+  9, 6, 1, 10404, 15, 1, 0, 10408, 16, 29, 1, 10412,
+  45, 2, 0, 10416, 47, 9, 1, 10424, 56, 1, 0, 10428,
+  57, 47, 1, 10432, 104, 1, 0, 10436, 112, 1, 0, 10440,
+  113, 94, 1, 10444, 207, 1, 0, 10448, 212, 1, 0, 10452,
+  213, 47, 1, 10456, 264, 1, 0, 10460, 265, 38, 1, 10464,
+  303, 1, 0, 10468, 319, 1, 0, 10472, 320, 47, 1, 10476,
+  367, 5, 0, 10480, 372, 36, 1, 10500, 408, 7, 1, 10504,
+  415, 4, 0, 10508, 5, 4, 1, 10524, 9, 6, 0, 10528,
+  15, 31, 1, 10552, 46, 1, 0, 10556, 47, 9, 1, 10560,
+  56, 1, 0, 10564, 57, 46, 1, 10568, 103, 1, 0, 10572,
+  113, 1, 0, 10576, 114, 93, 1, 10580, 207, 1, 0, 10584,
+  212, 1, 0, 10588, 213, 46, 1, 10592, 259, 1, 0, 10596,
+  264, 1, 0, 10600, 265, 39, 1, 10604, 304, 1, 0, 10608,
+  320, 1, 0, 10612, 321, 46, 1, 10616, 367, 5, 0, 10620,
+  372, 36, 1, 10640, 408, 1, 0, 10644, 409, 6, 1, 10648,
+  415, 4, 0, 10652, 5, 4, 1, 10668, 9, 6, 0, 10672,
+  15, 32, 1, 10696, 47, 1, 0, 10700, 48, 8, 1, 10704,
+  56, 1, 0, 10708, 57, 46, 1, 10712, 103, 1, 0, 10716,
+  113, 1, 0, 10720, 114, 92, 1, 10724, 206, 1, 0, 10728,
+  212, 1, 0, 10732, 213, 46, 1, 10736, 259, 1, 0, 10740,
+  264, 1, 0, 10744, 265, 40, 1, 10748, 305, 1, 0, 10752,
+  320, 1, 0, 10756, 321, 46, 1, 10760, 367, 1, 0, 10764,
+  368, 4, 1, 10768, 372, 1, 0, 10772, 373, 36, 1, 10776,
+  409, 1, 0, 10780, 410, 4, 1, 10784, 414, 5, 0, 10788,
+  5, 5, 1, 10808, 10, 4, 0, 10812, 14, 33, 1, 10828,
+  47, 2, 0, 10832, 49, 7, 1, 10840, 56, 1, 0, 10844,
+  57, 45, 1, 10848, 102, 1, 0, 10852, 114, 1, 0, 10856,
+  115, 91, 1, 10860, 206, 1, 0, 10864, 212, 1, 0, 10868,
+  213, 45, 1, 10872, 258, 1, 0, 10876, 264, 1, 0, 10880,
+  265, 41, 1, 10884, 306, 1, 0, 10888, 321, 46, 1, 10892,
+  367, 1, 0, 10896, 368, 4, 1, 10900, 372, 1, 0, 10904,
+  373, 37, 1, 10908, 410, 5, 0, 10912, 415, 4, 1, 10932,
+  5, 5, 1, 10936, 10, 3, 0, 10940, 13, 35, 1, 10952,
+  48, 1, 0, 10956, 49, 7, 1, 10960, 56, 1, 0, 10964,
+  57, 45, 1, 10968, 102, 1, 0, 10972, 114, 1, 0, 10976,
+  115, 90, 1, 10980, 205, 1, 0, 10984, 212, 1, 0, 10988,
+  213, 45, 1, 10992, 258, 1, 0, 10996, 264, 1, 0, 11000,
+  265, 41, 1, 11004, 306, 1, 0, 11008, 321, 1, 0, 11012,
+  322, 45, 1, 11016, 367, 1, 0, 11020, 368, 5, 1, 11024,
+  373, 1, 0, 11028, 374, 36, 1, 11032, 410, 5, 0, 11036,
+  415, 4, 1, 11056, 5, 6, 1, 11060, 11, 1, 0, 11064,
+  12, 37, 1, 11068, 49, 1, 0, 11072, 50, 6, 1, 11076,
+  56, 1, 0, 11080, 57, 44, 1, 11084, 101, 1, 0, 11088,
+  115, 1, 0, 11092, 116, 89, 1, 11096, 205, 1, 0, 11100,
+  212, 1, 0, 11104, 213, 44, 1, 11108, 257, 1, 0, 11112,
+  264, 1, 0, 11116, 265, 42, 1, 11120, 307, 1, 0, 11124,
+  322, 45, 1, 11128, 367, 1, 0, 11132, 368, 5, 1, 11136,
+  373, 1, 0, 11140, 374, 37, 1, 11144, 411, 3, 0, 11148,
+  414, 5, 1, 11160, 5, 6, 1, 11164, 11, 1, 0, 11168,
+  12, 37, 1, 11172, 49, 1, 0, 11176, 50, 6, 1, 11180,
+  56, 1, 0, 11184, 57, 43, 1, 11188, 100, 2, 0, 11192,
+  115, 1, 0, 11200, 116, 88, 1, 11204, 204, 1, 0, 11208,
+  212, 1, 0, 11212, 213, 44, 1, 11216, 257, 1, 0, 11220,
+  264, 1, 0, 11224, 265, 43, 1, 11228, 308, 1, 0, 11232,
+  322, 1, 0, 11236, 323, 44, 1, 11240, 367, 1, 0, 11244,
+  368, 6, 1, 11248, 374, 38, 1, 11252, 412, 1, 0, 11256,
+  413, 6, 1, 11260, 5, 5, 1, 11264, 10, 3, 0, 11268,
+  13, 37, 1, 11280, 50, 1, 0, 11284, 51, 5, 1, 11288,
+  56, 1, 0, 11292, 57, 43, 1, 11296, 100, 1, 0, 11300,
+  116, 1, 0, 11304, 117, 86, 1, 11308, 203, 2, 0, 11312,
+  212, 1, 0, 11320, 213, 43, 1, 11324, 256, 1, 0, 11328,
+  264, 1, 0, 11332, 265, 43, 1, 11336, 308, 1, 0, 11340,
+  323, 1, 0, 11344, 324, 43, 1, 11348, 367, 1, 0, 11352,
+  368, 6, 1, 11356, 374, 1, 0, 11360, 375, 37, 1, 11364,
+  412, 1, 0, 11368, 413, 6, 1, 11372, 5, 5, 1, 11376,
+  10, 4, 0, 11380, 14, 36, 1, 11396, 50, 2, 0, 11400,
+  52, 4, 1, 11408, 56, 1, 0, 11412, 57, 42, 1, 11416,
+  99, 1, 0, 11420, 117, 1, 0, 11424, 118, 84, 1, 11428,
+  202, 2, 0, 11432, 212, 1, 0, 11440, 213, 42, 1, 11444,
+  255, 1, 0, 11448, 264, 1, 0, 11452, 265, 44, 1, 11456,
+  309, 1, 0, 11460, 323, 1, 0, 11464, 324, 43, 1, 11468,
+  367, 1, 0, 11472, 368, 7, 1, 11476, 375, 1, 0, 11480,
+  376, 36, 1, 11484, 412, 2, 0, 11488, 414, 5, 1, 11496,
+  5, 4, 1, 11500, 9, 5, 0, 11504, 14, 37, 1, 11524,
+  51, 1, 0, 11528, 52, 4, 1, 11532, 56, 1, 0, 11536,
+  57, 42, 1, 11540, 99, 1, 0, 11544, 117, 1, 0, 11548,
+  118, 84, 1, 11552, 202, 1, 0, 11556, 212, 1, 0, 11560,
+  213, 42, 1, 11564, 255, 1, 0, 11568, 264, 1, 0, 11572,
+  265, 44, 1, 11576, 309, 1, 0, 11580, 324, 1, 0, 11584,
+  325, 42, 1, 11588, 367, 1, 0, 11592, 368, 7, 1, 11596,
+  375, 1, 0, 11600, 376, 35, 1, 11604, 411, 3, 0, 11608,
+  414, 5, 1, 11620, 5, 4, 1, 11624, 9, 1, 0, 11628,
+  10, 4, 1, 11632, 14, 1, 0, 11636, 15, 36, 1, 11640,
+  51, 1, 0, 11644, 52, 4, 1, 11648, 56, 1, 0, 11652,
+  57, 41, 1, 11656, 98, 1, 0, 11660, 118, 2, 0, 11664,
+  120, 81, 1, 11672, 201, 2, 0, 11676, 212, 1, 0, 11684,
+  213, 41, 1, 11688, 254, 1, 0, 11692, 264, 1, 0, 11696,
+  265, 45, 1, 11700, 310, 1, 0, 11704, 325, 1, 0, 11708,
+  326, 41, 1, 11712, 367, 1, 0, 11716, 368, 8, 1, 11720,
+  376, 1, 0, 11724, 377, 33, 1, 11728, 410, 5, 0, 11732,
+  415, 4, 1, 11752, 5, 5, 0, 11756, 10, 4, 1, 11776,
+  14, 2, 0, 11780, 16, 36, 1, 11788, 52, 5, 0, 11792,
+  57, 40, 1, 11812, 97, 1, 0, 11816, 119, 1, 0, 11820,
+  120, 81, 1, 11824, 201, 1, 0, 11828, 212, 1, 0, 11832,
+  213, 40, 1, 11836, 253, 1, 0, 11840, 264, 1, 0, 11844,
+  265, 45, 1, 11848, 310, 1, 0, 11852, 325, 1, 0, 11856,
+  326, 41, 1, 11860, 367, 1, 0, 11864, 368, 9, 1, 11868,
+  377, 1, 0, 11872, 378, 32, 1, 11876, 410, 4, 1, 11880,
+  414, 5, 0, 11884, 5, 5, 0, 11904, 10, 5, 1, 11924,
+  15, 1, 0, 11928, 16, 36, 1, 11932, 52, 5, 0, 11936,
+  57, 39, 1, 11956, 96, 1, 0, 11960, 119, 2, 0, 11964,
+  121, 78, 1, 11972, 199, 2, 0, 11976, 212, 1, 0, 11984,
+  213, 40, 1, 11988, 253, 1, 0, 11992, 264, 1, 0, 11996,
+  265, 46, 1, 12000, 311, 1, 0, 12004, 326, 1, 0, 12008,
+  327, 40, 1, 12012, 367, 1, 0, 12016, 368, 10, 1, 12020,
+  378, 31, 1, 12024, 409, 1, 0, 12028, 410, 5, 1, 12032,
+  415, 4, 0, 12036, 5, 4, 0, 12052, 9, 7, 1, 12068,
+  16, 1, 0, 12072, 17, 36, 1, 12076, 53, 4, 0, 12080,
+  57, 38, 1, 12096, 95, 2, 0, 12100, 120, 2, 0, 12108,
+  122, 77, 1, 12116, 199, 1, 0, 12120, 212, 1, 0, 12124,
+  213, 39, 1, 12128, 252, 1, 0, 12132, 264, 1, 0, 12136,
+  265, 46, 1, 12140, 311, 1, 0, 12144, 327, 1, 0, 12148,
+  328, 39, 1, 12152, 367, 1, 0, 12156, 368, 10, 1, 12160,
+  378, 1, 0, 12164, 379, 29, 1, 12168, 408, 1, 0, 12172,
+  409, 6, 1, 12176, 415, 4, 0, 12180, 5, 3, 0, 12196,
+  8, 9, 1, 12208, 17, 1, 0, 12212, 18, 35, 1, 12216,
+  53, 4, 0, 12220, 57, 38, 1, 12236, 95, 1, 0, 12240,
+  121, 1, 0, 12244, 122, 76, 1, 12248, 198, 1, 0, 12252,
+  212, 1, 0, 12256, 213, 38, 1, 12260, 251, 1, 0, 12264,
+  264, 1, 0, 12268, 265, 47, 1, 12272, 312, 1, 0, 12276,
+  328, 1, 0, 12280, 329, 38, 1, 12284, 367, 1, 0, 12288,
+  368, 11, 1, 12292, 379, 1, 0, 12296, 380, 27, 1, 12300,
+  407, 1, 0, 12304, 408, 7, 1, 12308, 415, 4, 0, 12312,
+  5, 3, 0, 12328, 8, 10, 1, 12340, 18, 1, 0, 12344,
+  19, 34, 1, 12348, 53, 4, 0, 12352, 57, 37, 1, 12368,
+  94, 1, 0, 12372, 122, 1, 0, 12376, 123, 74, 1, 12380,
+  197, 1, 0, 12384, 212, 1, 0, 12388, 213, 37, 1, 12392,
+  250, 1, 0, 12396, 264, 1, 0, 12400, 265, 47, 1, 12404,
+  312, 1, 0, 12408, 329, 1, 0, 12412, 330, 37, 1, 12416,
+  367, 1, 0, 12420, 368, 12, 1, 12424, 380, 1, 0, 12428,
+  381, 25, 1, 12432, 406, 1, 0, 12436, 407, 9, 1, 12440,
+  416, 3, 0, 12444, 5, 3, 0, 12456, 8, 11, 1, 12468,
+  19, 1, 0, 12472, 20, 34, 1, 12476, 54, 3, 0, 12480,
+  57, 36, 1, 12492, 93, 1, 0, 12496, 123, 1, 0, 12500,
+  124, 72, 1, 12504, 196, 1, 0, 12508, 212, 1, 0, 12512,
+  213, 36, 1, 12516, 249, 1, 0, 12520, 264, 1, 0, 12524,
+  265, 47, 1, 12528, 312, 1, 0, 12532, 329, 1, 0, 12536,
+  330, 37, 1, 12540, 367, 1, 0, 12544, 368, 13, 1, 12548,
+  381, 1, 0, 12552, 382, 23, 1, 12556, 405, 2, 0, 12560,
+  407, 9, 1, 12568, 416, 3, 0, 12572, 5, 3, 0, 12584,
+  8, 12, 1, 12596, 20, 1, 0, 12600, 21, 33, 1, 12604,
+  54, 3, 0, 12608, 57, 35, 1, 12620, 92, 1, 0, 12624,
+  124, 1, 0, 12628, 125, 70, 1, 12632, 195, 2, 0, 12636,
+  212, 1, 0, 12644, 213, 35, 1, 12648, 248, 1, 0, 12652,
+  264, 1, 0, 12656, 265, 47, 1, 12660, 312, 2, 0, 12664,
+  330, 1, 0, 12672, 331, 36, 1, 12676, 367, 1, 0, 12680,
+  368, 14, 1, 12684, 382, 1, 0, 12688, 383, 21, 1, 12692,
+  404, 1, 0, 12696, 405, 11, 1, 12700, 416, 3, 0, 12704,
+  5, 2, 0, 12716, 7, 14, 1, 12724, 21, 1, 0, 12728,
+  22, 32, 1, 12732, 54, 3, 0, 12736, 57, 33, 1, 12748,
+  90, 2, 0, 12752, 125, 1, 0, 12760, 126, 68, 1, 12764,
+  194, 1, 0, 12768, 212, 1, 0, 12772, 213, 34, 1, 12776,
+  247, 1, 0, 12780, 264, 1, 0, 12784, 265, 48, 1, 12788,
+  313, 1, 0, 12792, 331, 2, 0, 12796, 333, 34, 1, 12804,
+  367, 1, 0, 12808, 368, 15, 1, 12812, 383, 1, 0, 12816,
+  384, 19, 1, 12820, 403, 1, 0, 12824, 404, 13, 1, 12828,
+  417, 2, 0, 12832, 5, 2, 0, 12840, 7, 15, 1, 12848,
+  22, 1, 0, 12852, 23, 32, 1, 12856, 55, 2, 0, 12860,
+  57, 32, 1, 12868, 89, 2, 0, 12872, 126, 2, 0, 12880,
+  128, 65, 1, 12888, 193, 1, 0, 12892, 212, 1, 0, 12896,
+  213, 33, 1, 12900, 246, 1, 0, 12904, 264, 1, 0, 12908,
+  265, 48, 1, 12912, 313, 1, 0, 12916, 332, 1, 0, 12920,
+  333, 34, 1, 12924, 367, 1, 0, 12928, 368, 16, 1, 12932,
+  384, 1, 0, 12936, 385, 17, 1, 12940, 402, 1, 0, 12944,
+  403, 14, 1, 12948, 417, 2, 0, 12952, 5, 2, 0, 12960,
+  7, 16, 1, 12968, 23, 1, 0, 12972, 24, 31, 1, 12976,
+  55, 2, 0, 12980, 57, 31, 1, 12988, 88, 2, 0, 12992,
+  127, 2, 0, 13000, 129, 63, 1, 13008, 192, 1, 0, 13012,
+  212, 1, 0, 13016, 213, 31, 1, 13020, 244, 2, 0, 13024,
+  264, 1, 0, 13032, 265, 48, 1, 13036, 313, 1, 0, 13040,
+  333, 2, 0, 13044, 335, 32, 1, 13052, 367, 1, 0, 13056,
+  368, 17, 1, 13060, 385, 1, 0, 13064, 386, 15, 1, 13068,
+  401, 1, 0, 13072, 402, 15, 1, 13076, 417, 2, 0, 13080,
+  5, 1, 0, 13088, 6, 18, 1, 13092, 24, 2, 0, 13096,
+  26, 29, 1, 13104, 55, 2, 0, 13108, 57, 30, 1, 13116,
+  87, 1, 0, 13120, 129, 1, 0, 13124, 130, 61, 1, 13128,
+  191, 1, 0, 13132, 212, 1, 0, 13136, 213, 31, 1, 13140,
+  244, 1, 0, 13144, 264, 1, 0, 13148, 265, 49, 1, 13152,
+  314, 1, 0, 13156, 335, 1, 0, 13160, 336, 31, 1, 13164,
+  367, 1, 0, 13168, 368, 18, 1, 13172, 386, 1, 0, 13176,
+  387, 13, 1, 13180, 400, 1, 0, 13184, 401, 16, 1, 13188,
+  417, 2, 0, 13192, 5, 1, 0, 13200, 6, 20, 1, 13204,
+  26, 1, 0, 13208, 27, 28, 1, 13212, 55, 2, 0, 13216,
+  57, 29, 1, 13224, 86, 1, 0, 13228, 130, 1, 0, 13232,
+  131, 58, 1, 13236, 189, 1, 0, 13240, 212, 1, 0, 13244,
+  213, 30, 1, 13248, 243, 1, 0, 13252, 264, 1, 0, 13256,
+  265, 49, 1, 13260, 314, 1, 0, 13264, 336, 1, 0, 13268,
+  337, 30, 1, 13272, 367, 1, 0, 13276, 368, 19, 1, 13280,
+  387, 1, 0, 13284, 388, 11, 1, 13288, 399, 1, 0, 13292,
+  400, 18, 1, 13296, 418, 1, 0, 13300, 5, 1, 0, 13304,
+  6, 21, 1, 13308, 27, 2, 0, 13312, 29, 26, 1, 13320,
+  55, 2, 0, 13324, 57, 27, 1, 13332, 84, 2, 0, 13336,
+  131, 2, 0, 13344, 133, 55, 1, 13352, 188, 1, 0, 13356,
+  212, 1, 0, 13360, 213, 28, 1, 13364, 241, 2, 0, 13368,
+  264, 1, 0, 13376, 265, 49, 1, 13380, 314, 1, 0, 13384,
+  337, 1, 0, 13388, 338, 29, 1, 13392, 367, 1, 0, 13396,
+  368, 21, 1, 13400, 389, 1, 0, 13404, 390, 7, 1, 13408,
+  397, 2, 0, 13412, 399, 19, 1, 13420, 418, 1, 0, 13424,
+  5, 1, 0, 13428, 6, 22, 1, 13432, 28, 2, 0, 13436,
+  30, 26, 1, 13444, 56, 1, 0, 13448, 57, 25, 1, 13452,
+  82, 2, 0, 13456, 133, 1, 0, 13464, 134, 51, 1, 13468,
+  185, 3, 0, 13472, 212, 1, 0, 13484, 213, 27, 1, 13488,
+  240, 1, 0, 13492, 264, 1, 0, 13496, 265, 50, 1, 13500,
+  339, 1, 0, 13504, 340, 27, 1, 13508, 367, 1, 0, 13512,
+  368, 22, 1, 13516, 390, 1, 0, 13520, 391, 5, 1, 13524,
+  396, 1, 0, 13528, 397, 21, 1, 13532, 418, 1, 0, 13536,
+  5, 1, 0, 13540, 6, 24, 1, 13544, 30, 2, 0, 13548,
+  32, 24, 1, 13556, 56, 1, 0, 13560, 57, 23, 1, 13564,
+  80, 2, 0, 13568, 135, 1, 0, 13576, 136, 48, 1, 13580,
+  184, 2, 0, 13584, 212, 1, 0, 13592, 213, 25, 1, 13596,
+  238, 2, 0, 13600, 264, 1, 0, 13608, 265, 50, 1, 13612,
+  340, 2, 0, 13616, 342, 25, 1, 13624, 367, 1, 0, 13628,
+  368, 24, 1, 13632, 392, 4, 0, 13636, 396, 22, 1, 13652,
+  418, 1, 0, 13656, 5, 1, 0, 13660, 6, 26, 1, 13664,
+  32, 2, 0, 13668, 34, 22, 1, 13676, 56, 1, 0, 13680,
+  57, 21, 1, 13684, 78, 3, 0, 13688, 136, 2, 0, 13700,
+  138, 44, 1, 13708, 182, 2, 0, 13712, 212, 1, 0, 13720,
+  213, 23, 1, 13724, 236, 2, 0, 13728, 264, 1, 0, 13736,
+  265, 50, 1, 13740, 315, 1, 0, 13744, 342, 2, 0, 13748,
+  344, 23, 1, 13756, 367, 1, 0, 13760, 368, 24, 1, 13764,
+  392, 3, 0, 13768, 395, 23, 1, 13780, 418, 1, 0, 13784,
+  5, 1, 0, 13788, 6, 28, 1, 13792, 34, 2, 0, 13796,
+  36, 20, 1, 13804, 56, 1, 0, 13808, 57, 19, 1, 13812,
+  76, 3, 0, 13816, 139, 2, 0, 13828, 141, 39, 1, 13836,
+  180, 2, 0, 13840, 212, 1, 0, 13848, 213, 21, 1, 13852,
+  234, 2, 0, 13856, 264, 1, 0, 13864, 265, 50, 1, 13868,
+  315, 1, 0, 13872, 344, 2, 0, 13876, 346, 21, 1, 13884,
+  367, 1, 0, 13888, 368, 22, 1, 13892, 390, 7, 0, 13896,
+  397, 21, 1, 13924, 418, 1, 0, 13928, 5, 1, 0, 13932,
+  6, 30, 1, 13936, 36, 3, 0, 13940, 39, 35, 1, 13952,
+  74, 2, 0, 13956, 141, 3, 0, 13964, 144, 32, 1, 13976,
+  176, 4, 0, 13980, 212, 1, 0, 13996, 213, 19, 1, 14000,
+  232, 2, 0, 14004, 264, 1, 0, 14012, 265, 50, 1, 14016,
+  315, 1, 0, 14020, 346, 2, 0, 14024, 348, 19, 1, 14032,
+  367, 1, 0, 14036, 368, 20, 1, 14040, 388, 3, 0, 14044,
+  391, 6, 1, 14056, 397, 3, 0, 14060, 400, 19, 1, 14072,
+  5, 1, 0, 14076, 6, 33, 1, 14080, 39, 2, 0, 14084,
+  41, 15, 1, 14092, 56, 1, 0, 14096, 57, 13, 1, 14100,
+  70, 4, 0, 14104, 144, 3, 0, 14120, 147, 27, 1, 14132,
+  174, 3, 0, 14136, 212, 1, 0, 14148, 213, 16, 1, 14152,
+  229, 3, 0, 14156, 264, 1, 0, 14168, 265, 50, 1, 14172,
+  315, 1, 0, 14176, 348, 2, 0, 14180, 350, 17, 1, 14188,
+  367, 1, 0, 14192, 368, 17, 1, 14196, 385, 3, 0, 14200,
+  388, 11, 1, 14212, 399, 3, 0, 14216, 402, 17, 1, 14228,
+  5, 37, 1, 14232, 42, 3, 0, 14236, 45, 22, 1, 14248,
+  67, 4, 0, 14252, 147, 2, 0, 14268, 149, 20, 1, 14276,
+  169, 5, 0, 14280, 212, 1, 0, 14300, 213, 14, 1, 14304,
+  227, 2, 0, 14308, 264, 1, 0, 14316, 265, 50, 1, 14320,
+  315, 1, 0, 14324, 351, 2, 0, 14328, 353, 14, 1, 14336,
+  367, 1, 0, 14340, 368, 15, 1, 14344, 383, 3, 0, 14348,
+  386, 15, 1, 14360, 401, 3, 0, 14364, 404, 15, 1, 14376,
+  5, 41, 1, 14380, 46, 5, 0, 14384, 51, 9, 1, 14404,
+  60, 6, 0, 14408, 151, 18, 0, 14432, 212, 1, 0, 14504,
+  213, 8, 1, 14508, 221, 5, 0, 14512, 264, 1, 0, 14532,
+  265, 50, 1, 14536, 315, 1, 0, 14540, 354, 3, 0, 14544,
+  357, 10, 1, 14556, 367, 1, 0, 14560, 368, 11, 1, 14564,
+  379, 4, 0, 14568, 383, 22, 1, 14584, 405, 3, 0, 14588,
+  408, 11, 1, 14600, 5, 45, 1, 14604, 50, 7, 0, 14608,
+  212, 10, 0, 14636, 264, 1, 0, 14676, 265, 50, 1, 14680,
+  315, 1, 0, 14684, 358, 10, 0, 14688, 368, 4, 1, 14728,
+  372, 8, 0, 14732, 380, 27, 1, 14764, 407, 8, 0, 14768,
+  415, 4, 1, 14800, 419, 1, 0, 14804, 5, 51, 1, 14808,
+  56, 1, 0, 14812, 367, 3, 0, 14816, 370, 47, 1, 14828,
+  417, 3, 0, 14832, 5, 51, 1, 14844, 56, 1, 0, 14848,
+  367, 1, 0, 14852, 368, 51, 1, 14856, 419, 1, 0, 14860,
+  5, 51, 1, 14864, 56, 1, 0, 14868, 367, 1, 0, 14872,
+  368, 51, 1, 14876, 419, 1, 0, 14880, 5, 51, 1, 14884,
+  56, 1, 0, 14888, 367, 1, 0, 14892, 368, 51, 1, 14896,
+  5, 51, 1, 14900, 56, 1, 0, 14904, 367, 1, 0, 14908,
+  368, 51, 1, 14912, 5, 51, 1, 14916, 367, 1, 0, 14920,
+  368, 51, 1, 14924, 5, 50, 1, 14928, 55, 1, 0, 14932,
+  367, 1, 0, 14936, 368, 50, 1, 14940, 418, 1, 0, 14944,
+  5, 50, 1, 14948, 55, 1, 0, 14952, 367, 1, 0, 14956,
+  368, 50, 1, 14960, 418, 1, 0, 14964, 5, 50, 1, 14968,
+  55, 1, 0, 14972, 367, 1, 0, 14976, 368, 50, 1, 14980,
+  418, 1, 0, 14984, 5, 50, 1, 14988, 55, 1, 0, 14992,
+  367, 1, 0, 14996, 368, 50, 1, 15000, 418, 1, 0, 15004,
+  5, 50, 1, 15008, 55, 1, 0, 15012, 367, 1, 0, 15016,
+  368, 50, 1, 15020, 418, 1, 0, 15024, 5, 50, 1, 15028,
+  367, 1, 0, 15032, 368, 50, 1, 15036, 5, 49, 1, 15040,
+  54, 1, 0, 15044, 367, 1, 0, 15048, 368, 49, 1, 15052,
+  417, 1, 0, 15056, 5, 49, 1, 15060, 54, 1, 0, 15064,
+  367, 1, 0, 15068, 368, 49, 1, 15072, 417, 1, 0, 15076,
+  5, 49, 1, 15080, 54, 1, 0, 15084, 367, 1, 0, 15088,
+  368, 49, 1, 15092, 417, 1, 0, 15096, 5, 48, 1, 15100,
+  53, 1, 0, 15104, 367, 1, 0, 15108, 368, 49, 1, 15112,
+  5, 48, 1, 15116, 53, 1, 0, 15120, 367, 1, 0, 15124,
+  368, 48, 1, 15128, 416, 1, 0, 15132, 5, 48, 1, 15136,
+  53, 1, 0, 15140, 367, 1, 0, 15144, 368, 48, 1, 15148,
+  416, 1, 0, 15152, 5, 47, 1, 15156, 52, 1, 0, 15160,
+  367, 1, 0, 15164, 368, 48, 1, 15168, 5, 47, 1, 15172,
+  52, 1, 0, 15176, 367, 1, 0, 15180, 368, 47, 1, 15184,
+  415, 1, 0, 15188, 5, 46, 1, 15192, 51, 1, 0, 15196,
+  367, 1, 0, 15200, 368, 47, 1, 15204, 5, 46, 1, 15208,
+  51, 1, 0, 15212, 367, 1, 0, 15216, 368, 46, 1, 15220,
+  414, 1, 0, 15224, 5, 45, 1, 15228, 50, 1, 0, 15232,
+  367, 1, 0, 15236, 368, 46, 1, 15240, 414, 1, 0, 15244,
+  5, 45, 1, 15248, 50, 1, 0, 15252, 367, 1, 0, 15256,
+  368, 45, 1, 15260, 413, 1, 0, 15264, 5, 44, 1, 15268,
+  49, 1, 0, 15272, 367, 1, 0, 15276, 368, 45, 1, 15280,
+  413, 1, 0, 15284, 5, 44, 1, 15288, 49, 1, 0, 15292,
+  367, 1, 0, 15296, 368, 44, 1, 15300, 412, 1, 0, 15304,
+  5, 43, 1, 15308, 48, 1, 0, 15312, 367, 1, 0, 15316,
+  368, 44, 1, 15320, 5, 42, 1, 15324, 47, 1, 0, 15328,
+  367, 1, 0, 15332, 368, 43, 1, 15336, 411, 1, 0, 15340,
+  5, 42, 1, 15344, 47, 1, 0, 15348, 367, 1, 0, 15352,
+  368, 42, 1, 15356, 410, 1, 0, 15360, 5, 41, 1, 15364,
+  46, 1, 0, 15368, 367, 1, 0, 15372, 368, 41, 1, 15376,
+  409, 2, 0, 15380, 5, 40, 1, 15388, 45, 1, 0, 15392,
+  367, 1, 0, 15396, 368, 41, 1, 15400, 409, 1, 0, 15404,
+  5, 40, 1, 15408, 45, 1, 0, 15412, 367, 1, 0, 15416,
+  368, 40, 1, 15420, 408, 1, 0, 15424, 5, 39, 1, 15428,
+  44, 1, 0, 15432, 367, 1, 0, 15436, 368, 39, 1, 15440,
+  407, 1, 0, 15444, 5, 38, 1, 15448, 43, 1, 0, 15452,
+  367, 1, 0, 15456, 368, 39, 1, 15460, 407, 1, 0, 15464,
+  5, 37, 1, 15468, 42, 1, 0, 15472, 367, 1, 0, 15476,
+  368, 38, 1, 15480, 406, 1, 0, 15484, 5, 36, 1, 15488,
+  41, 1, 0, 15492, 367, 1, 0, 15496, 368, 37, 1, 15500,
+  405, 1, 0, 15504, 5, 35, 1, 15508, 40, 1, 0, 15512,
+  367, 1, 0, 15516, 368, 36, 1, 15520, 404, 1, 0, 15524,
+  5, 33, 1, 15528, 38, 2, 0, 15532, 367, 1, 0, 15540,
+  368, 35, 1, 15544, 403, 1, 0, 15548, 5, 32, 1, 15552,
+  37, 2, 0, 15556, 367, 1, 0, 15564, 368, 34, 1, 15568,
+  402, 1, 0, 15572, 5, 31, 1, 15576, 36, 2, 0, 15580,
+  367, 1, 0, 15588, 368, 32, 1, 15592, 400, 2, 0, 15596,
+  5, 30, 1, 15604, 35, 1, 0, 15608, 367, 1, 0, 15612,
+  368, 31, 1, 15616, 399, 2, 0, 15620, 5, 29, 1, 15628,
+  34, 1, 0, 15632, 367, 1, 0, 15636, 368, 30, 1, 15640,
+  398, 1, 0, 15644, 5, 27, 1, 15648, 32, 2, 0, 15652,
+  367, 1, 0, 15660, 368, 29, 1, 15664, 397, 1, 0, 15668,
+  5, 25, 1, 15672, 30, 2, 0, 15676, 367, 1, 0, 15684,
+  368, 27, 1, 15688, 395, 1, 0, 15692, 5, 23, 1, 15696,
+  28, 2, 0, 15700, 367, 1, 0, 15708, 368, 25, 1, 15712,
+  393, 2, 0, 15716, 5, 22, 1, 15724, 27, 2, 0, 15728,
+  367, 1, 0, 15736, 368, 23, 1, 15740, 391, 2, 0, 15744,
+  5, 19, 1, 15752, 24, 3, 0, 15756, 367, 1, 0, 15768,
+  368, 22, 1, 15772, 390, 1, 0, 15776, 5, 16, 1, 15780,
+  21, 3, 0, 15784, 367, 1, 0, 15796, 368, 19, 1, 15800,
+  387, 2, 0, 15804, 5, 13, 1, 15812, 18, 4, 0, 15816,
+  367, 1, 0, 15832, 368, 17, 1, 15836, 385, 2, 0, 15840,
+  5, 10, 1, 15848, 15, 4, 0, 15852, 367, 1, 0, 15868,
+  368, 14, 1, 15872, 382, 2, 0, 15876, 5, 9, 0, 15884,
+  367, 1, 0, 15920, 368, 10, 1, 15924, 378, 3, 0, 15928,
+  367, 10, 0, 15940,
+};
+
+static const int POKY_IMG_XRGB8888_ROW_SPANS[] = {
+  0, 0, 0, 0, 0, 4, 16, 28, 40, 52, 64, 76,
+  88, 100, 112, 124, 136, 148, 160, 172, 184, 196, 208, 220,
+  232, 244, 256, 268, 280, 292, 304, 316, 328, 340, 352, 364,
+  376, 388, 400, 412, 420, 432, 444, 456, 468, 480, 492, 504,
+  512, 524, 536, 548, 560, 572, 584, 596, 620, 684, 780, 876,
+  972, 1072, 1172, 1260, 1348, 1444, 1548, 1656, 1764, 1872, 1976, 2084,
+  2192, 2296, 2404, 2512, 2616, 2724, 2820, 2920, 3020, 3120, 3216, 3316,
+  3408, 3500, 3588, 3680, 3760, 3852, 3936, 4020, 4112, 4200, 4288, 4380,
+  4472, 4560, 4644, 4736, 4824, 4904, 4996, 5096, 5200, 5304, 5396, 5484,
+  5560, 5636, 5732, 5836, 5944, 6036, 6112, 6196, 6280, 6372, 6464, 6556,
+  6656, 6756, 6852, 6948, 7048, 7148, 7244, 7340, 7432, 7528, 7632, 7728,
+  7828, 7924, 8020, 8120, 8220, 8320, 8428, 8524, 8620, 8720, 8820, 8920,
+  9020, 9120, 9220, 9320, 9420, 9520, 9620, 9720, 9816, 9904, 9996, 10088,
+  10176, 10272, 10356, 10432, 10484, 10504, 10524, 10544, 10560, 10576, 10588, 10608,
+  10628, 10648, 10668, 10688, 10700, 10720, 10740, 10760, 10776, 10796, 10816, 10832,
+  10852, 10868, 10888, 10908, 10928, 10948, 10968, 10984, 11004, 11024, 11044, 11064,
+  11084, 11104, 11124, 11144, 11164, 11184, 11204, 11224, 11244, 11264, 11284, 11304,
+  11324, 11344, 11364, 11384, 11404, 11424, 11444, 11460, 11464, 11464, 11464,
+};
+
+static const PSplashFBImage POKY_IMG_XRGB8888 = {
+  .rgbmode   = RGB888,
+  .bpp       = 32,
+  .width     = 427,
+  .height    = 214,
+  .pixels    = (const char *) POKY_IMG_XRGB8888_PIXELS,
+  .spans     = POKY_IMG_XRGB8888_SPANS,
+  .row_spans = POKY_IMG_XRGB8888_ROW_SPANS,
+};
+
+#endif
+
+#ifdef PSPLASH_IMG_NATIVE_XBGR8888
+
+static const uint32_t POKY_IMG_XBGR8888_PIXELS[] = {
+  0x008eddca, 0x007ad7c0, 0x0082d7c6, 0x008eddca, 0x00a0e1d2, 0x00b6e8e2, 0x005ecfb7, 0x0046c7ab,
+  0x0050c8b1, 0x005acbb3, 0x0071d4c0, 0x0085d9c9, 0x00abe4da, 0x005ecfb7, 0x0046c7ab, 0x0050c8b1,
+  0x0066d0b6, 0x0085d9c9, 0x00b4e8db, 0x005ecfb7, 0x0046c7ab, 0x0052cab3, 0x0082d7c6, 0x005ecfb7,
+  0x0046c7ab, 0x005ecfb7, 0x0099e0d2, 0x005ecfb7, 0x0046c7ab, 0x004fc8aa, 0x008eddca, 0x005ecfb7,
+  0x0046c7ab, 0x004fc8aa, 0x008eddca, 0x005ecfb7, 0x0046c7ab, 0x005acbb3, 0x00a3e4d4, 0x005ecfb7,
+  0x0046c7ab, 0x0068d1be, 0x005ecfb7, 0x0046c7ab, 0x0051c9b2, 0x0097ded1, 0x005ecfb7, 0x0046c7ab,
+  0x006ed1bc, 0x005ecfb7, 0x0046c7ab, 0x005acbb3, 0x005ecfb7, 0x0046c7ab, 0x0050c8b1, 0x00abe4da,
+  0x005ecfb7, 0x0046c7ab, 0x0097ded1, 0x005ecfb7, 0x0046c7ab, 0x0082d7c6, 0x005ecfb7, 0x0046c7ab,
+  0x007ad7c0, 0x005ecfb7, 0x0046c7ab, 0x007cd9c3, 0x005ecfb7, 0x0046c7ab, 0x0085d9c9, 0x005ecfb7,
+  0x0046c7ab, 0x0047c7b1, 0x00a0e1d2, 0x005ecfb7, 0x0046c7ab, 0x004fc8aa, 0x00b4e8db, 0x005ecfb7,
+  0x0046c7ab, 0x0051c9b2, 0x005ecfb7, 0x0046c7ab, 0x0068d1be, 0x005ecfb7, 0x0046c7ab, 0x008eddca,
+  0x005ecfb7, 0x0046c7ab, 0x004fc8aa, 0x005ecfb7, 0x0046c7ab, 0x0066cfbc, 0x005ecfb7, 0x0046c7ab,
+  0x008eddca, 0x005ecfb7, 0x0046c7ab, 0x0052cab3, 0x005ecfb7, 0x0046c7ab, 0x0082d7c6, 0x005ecfb7,
+  0x0046c7ab, 0x0051c9b2, 0x005ecfb7, 0x0046c7ab, 0x007ad7c0, 0x005ecfb7, 0x0046c7ab, 0x0050c8b1,
+  0x005ecfb7, 0x0046c7ab, 0x0085d9c9, 0x005ecfb7, 0x0046c7ab, 0x004fc8aa, 0x005ecfb7, 0x0046c7ab,
+  0x00a0e1d2, 0x005ecfb7, 0x0046c7ab, 0x005ecfb7, 0x005ecfb7, 0x0046c7ab, 0x005ecfb7, 0x0046c7ab,
+  0x0099e0d2, 0x005ecfb7, 0x0046c7ab, 0x0066d0b6, 0x005ecfb7, 0x0046c7ab, 0x004fc8aa, 0x005ecfb7,
+  0x0046c7ab, 0x00b4e8db, 0x005ecfb7, 0x0046c7ab, 0x0090dfcc, 0x005ecfb7, 0x0046c7ab, 0x0066cfbc,
+  0x005ecfb7, 0x0046c7ab, 0x0050c8b1, 0x005ecfb7, 0x0046c7ab, 0x005ecfb7, 0x0046c7ab, 0x00ade7dc,
+  0x005ecfb7, 0x0046c7ab, 0x0097ded1, 0x005ecfb7, 0x0046c7ab, 0x0085d9c9, 0x005ecfb7, 0x0046c7ab,
+  0x007cd9c3, 0x005ecfb7, 0x0046c7ab, 0x0071d4c0, 0x005ecfb7, 0x0046c7ab, 0x0066cfbc, 0x005ecfb7,
+  0x0046c7ab, 0x005ecfb7, 0x00abb2fa, 0x008697f6, 0x007582f5, 0x006071f3, 0x005669f2, 0x005669f2,
+  0x004f63f4, 0x005669f2, 0x005669f2, 0x006071f3, 0x006e80f4, 0x008593f8, 0x00a3b0f9, 0x00b2bef8,
+  0x00e0e7b9, 0x00e0e7b9, 0x00e0e7b9, 0x00dbe2b4, 0x00cdd697, 0x00c6d189, 0x00d0d589, 0x00cfd89a,
+  0x00d4dca6, 0x00dbe2b4, 0x005ecfb7, 0x0046c7ab, 0x005acbb3, 0x00b0bafb, 0x007888f5, 0x005669f2,
+  0x004459f1, 0x003a4fef, 0x003248f1, 0x003949f2, 0x003a4fef, 0x004459f1, 0x005669f2, 0x007582f5,
+  0x00aeb8f9, 0x00d2db9c, 0x00d4dca6, 0x00d6dea8, 0x00d6dea8, 0x00dbe2b4, 0x00dbe2b4, 0x00d6dea8,
+  0x00d4dca6, 0x00d3dc9d, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00becb70, 0x00c7cd77,
+  0x00c2ce7d, 0x00cbd68e, 0x00d6dea8, 0x0068d1be, 0x0052cab3, 0x0052cab3, 0x005acbb3, 0x005acbb3,
+  0x005ecfb7, 0x0066d0b6, 0x0066d0b6, 0x0068d3b9, 0x0071d4c0, 0x0068d3b9, 0x0066d0b6, 0x0066d0b6,
+  0x005ecfb7, 0x005acbb3, 0x005acbb3, 0x0052cab3, 0x0052cab3, 0x005acbb3, 0x0066cfbc, 0x006ed1bc,
+  0x0075d4ce, 0x0081d6fa, 0x0081d6fa, 0x0089d8fa, 0x0091dafa, 0x00a3dffd, 0x00a3dffd, 0x0093dcfd,
+  0x0089d8fa, 0x0081d6fa, 0x0081d6fa, 0x008593f8, 0x005669f2, 0x003c52f2, 0x003349f2, 0x003248f1,
+  0x003b51f1, 0x005669f2, 0x007888f5, 0x00d2db9c, 0x00d4dd9e, 0x00d6dea8, 0x00dbe2b4, 0x00dbe2b4,
+  0x00d4dca6, 0x00d3dc9d, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00c2ca68, 0x00c2ce7d,
+  0x00cbd68e, 0x00dbe2b4, 0x0071d4c0, 0x005acbb3, 0x005ecfb7, 0x005ecfb7, 0x0066cfbc, 0x0071d4c0,
+  0x007ad7c0, 0x0082d7c6, 0x0085d9c9, 0x0082d7c6, 0x007ad7c0, 0x0071d4c0, 0x0066d0b6, 0x005ecfb7,
+  0x005ecfb7, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0056c9c7, 0x005ecbf9, 0x0065cbf8,
+  0x006fcffb, 0x0081d6fa, 0x0091dafa, 0x00b4e6f9, 0x009addfc, 0x0081d6fa, 0x0070d0fc, 0x0065cbf8,
+  0x005ecbf9, 0x00a3dffd, 0x008697f6, 0x005669f2, 0x003a4fef, 0x003248f1, 0x003349f2, 0x004f63f4,
+  0x008390f5, 0x00d2db9c, 0x00d4dca6, 0x00dbe2b4, 0x00d9e0aa, 0x00d3dc9d, 0x00d2db9c, 0x00cfd89a,
+  0x00c2ce7d, 0x00bdca6f, 0x00becb70, 0x00c1cd7b, 0x00d0d589, 0x00dbe2b4, 0x0071d4c0, 0x005acbb3,
+  0x005ecfb7, 0x0066cfbc, 0x0071d4c0, 0x007ad7c0, 0x0085d9c9, 0x007ad7c0, 0x0071d4c0, 0x0068d1be,
+  0x005ecfb7, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0056c9c7, 0x005ecbf9, 0x0065cbf8,
+  0x0078d4f8, 0x009addfc, 0x00a3dffd, 0x0081d6fa, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd, 0x006c7bf6,
+  0x003a4fef, 0x003248f1, 0x003949f2, 0x006071f3, 0x00aeb8f9, 0x00d2db9c, 0x00d6dea8, 0x00dbe2b4,
+  0x00d4dca6, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00becb70, 0x00c1cd7b, 0x00d4dca6,
+  0x0071d4c0, 0x005acbb3, 0x005ecfb7, 0x0068d3b9, 0x0071d4c0, 0x0082d7c6, 0x0085d9c9, 0x0082d7c6,
+  0x0071d4c0, 0x0066cfbc, 0x005ecfb7, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0056c9c7,
+  0x005ecbf9, 0x006fcffb, 0x009addfc, 0x00a3dffd, 0x0078d4f8, 0x005ecbf9, 0x00a3dffd, 0x00b0bafb,
+  0x005f6cf5, 0x003248f1, 0x004f63f4, 0x009faaf9, 0x00d3dc9d, 0x00d2db9c, 0x00d4dca6, 0x00e0e7b9,
+  0x00d9e0aa, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00becb70, 0x00cfd89a, 0x007ad7c0,
+  0x005acbb3, 0x005ecfb7, 0x0071d4c0, 0x007cd9c3, 0x0085d9c9, 0x0082d7c6, 0x006ed1bc, 0x005ecfb7,
+  0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x005fcbc8, 0x005ecbf9, 0x0081d6fa, 0x00b4e6f9,
+  0x0089d8fa, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd, 0x00586bf4, 0x003248f1, 0x004c5bf3, 0x00aeb8f9,
+  0x00d4dd9e, 0x00d2db9c, 0x00d4dca6, 0x00e0e7b9, 0x00d6dea8, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d,
+  0x00bdca6f, 0x00c4ca74, 0x00cfd89a, 0x007ad7c0, 0x005acbb3, 0x0068d1be, 0x007cd9c3, 0x0085d9c9,
+  0x007ad7c0, 0x0068d1be, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0061cccf, 0x0064caf7,
+  0x005ecbf9, 0x006ecefa, 0x00ace3fe, 0x0078d4f8, 0x005ecbf9, 0x00a3dffd, 0x006071f3, 0x003248f1,
+  0x00586bf4, 0x00d4dca6, 0x00d2db9c, 0x00cfd89a, 0x00cdd697, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a,
+  0x00c2ce7d, 0x00bdca6f, 0x00becb70, 0x00d4dca6, 0x0085d9c9, 0x005acbb3, 0x0068d3b9, 0x007cd9c3,
+  0x007cd9c3, 0x0068d1be, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x006dd2d4, 0x0064caf7,
+  0x005ecbf9, 0x0065cbf8, 0x00ace3fe, 0x006fcffb, 0x005ecbf9, 0x00a3dffd, 0x008e99f7, 0x003b51f1,
+  0x003248f1, 0x00334fef, 0x007888f5, 0x00d6dea8, 0x00d2db9c, 0x00cfd89a, 0x00c6d189, 0x00c1cd7b,
+  0x00c2ce7d, 0x00c2ce7d, 0x00d0d589, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f,
+  0x00c1cd7b, 0x0085d9c9, 0x005acbb3, 0x0052cab3, 0x0052cab3, 0x0051c9b2, 0x005acbb3, 0x0052cab3,
+  0x0047c7b1, 0x0046c7ab, 0x0080d6dc, 0x0064caf7, 0x005ecbf9, 0x006fcffb, 0x0081d6fa, 0x005ecbf9,
+  0x00a3dffd, 0x005669f2, 0x003349f2, 0x003248f1, 0x004f63f4, 0x00dbe2b4, 0x00d2db9c, 0x00cfd89a,
+  0x00cdd697, 0x00c2ce7d, 0x00c9cf78, 0x00c6d189, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d,
+  0x00bdca6f, 0x00beca79, 0x00cfd89a, 0x008eddca, 0x005acbb3, 0x0052cab3, 0x004fc8aa, 0x0046c7ab,
+  0x0046c7ab, 0x004fc8aa, 0x0051c9b2, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x00a6e0ed,
+  0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x008bdafc, 0x00a3dffd, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd,
+  0x009ca7f6, 0x004358f0, 0x003248f1, 0x003c52f2, 0x008e99f7, 0x00d2db9c, 0x00cfd89a, 0x00c6d189,
+  0x00c2ce7d, 0x00cbd68e, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00c9cf78, 0x0090dfcc,
+  0x005acbb3, 0x0052cab3, 0x0050c8b1, 0x0046c7ab, 0x004fc8aa, 0x0052cab3, 0x005acbb3, 0x0052cab3,
+  0x0047c7b1, 0x0046c7ab, 0x0050c8b1, 0x0064caf7, 0x005ecbf9, 0x006fcffb, 0x0081d6fa, 0x005ecbf9,
+  0x00a3dffd, 0x00818bf7, 0x003349f2, 0x003248f1, 0x003349f2, 0x006a79f3, 0x00d4dca6, 0x00d2db9c,
+  0x00cfd89a, 0x00c6d189, 0x00c2ce7d, 0x00c9cf78, 0x00c6d189, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d,
+  0x00bdca6f, 0x00c1cd7b, 0x00dbe2b4, 0x0097ded1, 0x005ecfb7, 0x005acbb3, 0x0052cab3, 0x0050c8b1,
+  0x0046c7ab, 0x0050c8b1, 0x0052cab3, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0066d0b6,
+  0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x009addfc, 0x00ade6fa, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd,
+  0x006071f3, 0x003248f1, 0x004f63f4, 0x00d4dca6, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00c6d189,
+  0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00c4ca74, 0x00d4dca6, 0x0099e0d2,
+  0x0066d0b6, 0x005acbb3, 0x0052cab3, 0x0046c7ab, 0x0047c7b1, 0x0051c9b2, 0x005acbb3, 0x0052cab3,
+  0x0047c7b1, 0x0046c7ab, 0x008eddca, 0x0064caf7, 0x005ecbf9, 0x0081d6fa, 0x0091dafa, 0x005ecbf9,
+  0x00a3dffd, 0x004f63f4, 0x003248f1, 0x004358f0, 0x00d9e0aa, 0x00d2db9c, 0x00cdd890, 0x00c2ce7d,
+  0x00c6d280, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00cdd697, 0x0099e0d2,
+  0x006ed1bc, 0x005acbb3, 0x004fc8aa, 0x0046c7ab, 0x0050c8b1, 0x005acbb3, 0x0052cab3, 0x0047c7b1,
+  0x0046c7ab, 0x00b4e8db, 0x0064caf7, 0x005ecbf9, 0x006ecefa, 0x0078d4f8, 0x005ecbf9, 0x00a3dffd,
+  0x004c5bf3, 0x003248f1, 0x003c52f2, 0x00b0bafb, 0x00d2db9c, 0x00cbd68e, 0x00c9cf78, 0x00c2ce7d,
+  0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00c6d189, 0x0099e0d2, 0x007ad7c0,
+  0x005acbb3, 0x0052cab3, 0x004fc8aa, 0x0046c7ab, 0x0050c8b1, 0x0052cab3, 0x005acbb3, 0x0052cab3,
+  0x0047c7b1, 0x0046c7ab, 0x0050c8b1, 0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x006fcffb, 0x005ecbf9,
+  0x00a3dffd, 0x004358f0, 0x003248f1, 0x003a4fef, 0x00aeb8f9, 0x00d3dc9d, 0x00d2db9c, 0x00cbd68e,
+  0x00c9cf78, 0x00c2ce7d, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00c6d189,
+  0x0099e0d2, 0x0082d7c6, 0x005ecfb7, 0x005acbb3, 0x004fc8aa, 0x0046c7ab, 0x0050c8b1, 0x005acbb3,
+  0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x005acbb3, 0x0064caf7, 0x005ecbf9, 0x00b4e6f9, 0x0065cbf8,
+  0x005ecbf9, 0x00a3dffd, 0x003c52f2, 0x003248f1, 0x003b51f1, 0x00aeb8f9, 0x00d6dea8, 0x00d2db9c,
+  0x00cbd68e, 0x00c7cd77, 0x00c2ce7d, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f,
+  0x00c6d280, 0x0099e0d2, 0x0085d9c9, 0x0068d3b9, 0x005acbb3, 0x004fc8aa, 0x0046c7ab, 0x004fc8aa,
+  0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0097ded1, 0x0064caf7, 0x005ecbf9, 0x00ade6fa,
+  0x0065cbf8, 0x005ecbf9, 0x00a3dffd, 0x004459f1, 0x003248f1, 0x004358f0, 0x00d2db9c, 0x00cdd697,
+  0x00c2ce7d, 0x00c6d280, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00d0d589,
+  0x0099e0d2, 0x0085d9c9, 0x0071d4c0, 0x005acbb3, 0x0052cab3, 0x004fc8aa, 0x0046c7ab, 0x0050c8b1,
+  0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0050c8b1, 0x0064caf7, 0x005ecbf9, 0x00b4e5ff,
+  0x006ecefa, 0x005ecbf9, 0x00a3dffd, 0x005669f2, 0x003248f1, 0x004c60f1, 0x00d4dca6, 0x00d2db9c,
+  0x00cfd89a, 0x00c2ce7d, 0x00c6d189, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f,
+  0x00cfd89a, 0x0099e0d2, 0x0085d9c9, 0x0085d9c9, 0x005acbb3, 0x004fc8aa, 0x0046c7ab, 0x0050c8b1,
+  0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x005ecfb7, 0x0064caf7, 0x005ecbf9, 0x0065cbf8,
+  0x006fcffb, 0x005ecbf9, 0x00a3dffd, 0x006c7bf6, 0x003248f1, 0x005669f2, 0x00dbe2b4, 0x00d2db9c,
+  0x00cfd89a, 0x00c9cf78, 0x00c2ce7d, 0x00c6d189, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d,
+  0x00bdca6f, 0x00d6dea8, 0x0099e0d2, 0x0085d9c9, 0x0085d9c9, 0x0068d1be, 0x005acbb3, 0x0050c8b1,
+  0x0046c7ab, 0x004fc8aa, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0099e0d2, 0x0064caf7,
+  0x005ecbf9, 0x0065cbf8, 0x0070d0fc, 0x005ecbf9, 0x00a3dffd, 0x008e99f7, 0x003349f2, 0x003248f1,
+  0x006c7bf6, 0x00d2db9c, 0x00cfd89a, 0x00c6d189, 0x00c2ce7d, 0x00cbd68e, 0x00d2db9c, 0x00cfd89a,
+  0x00c2ce7d, 0x00bdca6f, 0x00c4ca74, 0x0099e0d2, 0x0085d9c9, 0x0085d9c9, 0x007ad7c0, 0x005acbb3,
+  0x0051cbad, 0x0046c7ab, 0x0051c9b2, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0052cab3,
+  0x0064caf7, 0x005ecbf9, 0x006fcffb, 0x0081d6fa, 0x005ecbf9, 0x00a3dffd, 0x003a4fef, 0x003248f1,
+  0x009ca7f6, 0x00d6dea8, 0x00d2db9c, 0x00c6d189, 0x00c2ce7d, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a,
+  0x00c2ce7d, 0x00bdca6f, 0x00c2ce7d, 0x0099e0d2, 0x0085d9c9, 0x0085d9c9, 0x0085d9c9, 0x005ecfb7,
+  0x005acbb3, 0x0052cab3, 0x0046c7ab, 0x0052cab3, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab,
+  0x007ad7c0, 0x0064caf7, 0x005ecbf9, 0x0081d6fa, 0x009addfc, 0x005ecbf9, 0x00a3dffd, 0x004c60f1,
+  0x003248f1, 0x003a4fef, 0x00d2db9c, 0x00d2db9c, 0x00d2db9c, 0x00cfd89a, 0x00c9cf78, 0x00c2ce7d,
+  0x00c6d189, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00cbd68e, 0x0099e0d2,
+  0x0085d9c9, 0x0085d9c9, 0x0085d9c9, 0x0071d4c0, 0x005acbb3, 0x0052cab3, 0x004fc8aa, 0x0046c7ab,
+  0x004fc8aa, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x004fc8aa, 0x0064caf7, 0x005ecbf9,
+  0x009addfc, 0x005ecbf9, 0x00a3dffd, 0x007888f5, 0x003248f1, 0x00586bf4, 0x00d4dca6, 0x00d2db9c,
+  0x00cfd89a, 0x00c2ce7d, 0x00c6d189, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00becb70,
+  0x00dbe2b4, 0x0099e0d2, 0x0085d9c9, 0x005ecfb7, 0x005acbb3, 0x005acbb3, 0x005acbb3, 0x004fc8aa,
+  0x0046c7ab, 0x004fc8aa, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0066cfbc, 0x0064caf7,
+  0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd, 0x00b0bafb, 0x003a4fef, 0x003248f1,
+  0x009ca7f6, 0x00d2db9c, 0x00c6d189, 0x00c2ce7d, 0x00c9cf78, 0x00cfd89a, 0x00d2db9c, 0x00cfd89a,
+  0x00c2ce7d, 0x00bdca6f, 0x00c1cd7b, 0x0099e0d2, 0x0085d9c9, 0x006ed1bc, 0x005acbb3, 0x005acbb3,
+  0x0052cab3, 0x0046c7ab, 0x0052cab3, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x00b4e8db,
+  0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x0089d8fa, 0x005ecbf9, 0x00a3dffd, 0x004f63f4, 0x003248f1,
+  0x003b51f1, 0x00d3dc9d, 0x00c2ce7d, 0x00c9cf78, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f,
+  0x00cbd68e, 0x0099e0d2, 0x0085d9c9, 0x0082d7c6, 0x005ecfb7, 0x0052cab3, 0x0046c7ab, 0x0050c8b1,
+  0x0052cab3, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x006ed1bc, 0x0064caf7, 0x005ecbf9,
+  0x0089d8fa, 0x00b4e5ff, 0x005ecbf9, 0x00a3dffd, 0x008e99f7, 0x003349f2, 0x003248f1, 0x007582f5,
+  0x00d4dca6, 0x00c2ce7d, 0x00d0d589, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00becb70,
+  0x0099e0d2, 0x0085d9c9, 0x0071d4c0, 0x0050c8b1, 0x0046c7ab, 0x004fc8aa, 0x005acbb3, 0x0052cab3,
+  0x0047c7b1, 0x0046c7ab, 0x004fc8aa, 0x0064caf7, 0x005ecbf9, 0x006ecefa, 0x005ecbf9, 0x00a3dffd,
+  0x004358f0, 0x003248f1, 0x003a4fef, 0x00d2db9c, 0x00c6d189, 0x00c2ce7d, 0x00cfd89a, 0x00d2db9c,
+  0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00c2ce7d, 0x0099e0d2, 0x0085d9c9, 0x007ad7c0, 0x004fc8aa,
+  0x0046c7ab, 0x0051c9b2, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x007ad7c0, 0x0064caf7,
+  0x005ecbf9, 0x0077d0fb, 0x009addfc, 0x005ecbf9, 0x00a3dffd, 0x007888f5, 0x003248f1, 0x006a79f3,
+  0x00dbe2b4, 0x00d2db9c, 0x00cfd89a, 0x00c9cf78, 0x00c2ce7d, 0x00cbd68e, 0x00d2db9c, 0x00cfd89a,
+  0x00c2ce7d, 0x00bdca6f, 0x0099e0d2, 0x0085d9c9, 0x0066cfbc, 0x0051c9b2, 0x0046c7ab, 0x004fc8aa,
+  0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0051c9b2, 0x0064caf7, 0x005ecbf9, 0x0065cbf8,
+  0x005ecbf9, 0x00a3dffd, 0x003c52f2, 0x003248f1, 0x003a4fef, 0x00d3dc9d, 0x00d2db9c, 0x00d2db9c,
+  0x00c6d189, 0x00c2ce7d, 0x00cfd89a, 0x00d2db9c, 0x00d2db9c, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d,
+  0x00bdca6f, 0x00c2ce7d, 0x0099e0d2, 0x0085d9c9, 0x007ad7c0, 0x005acbb3, 0x005acbb3, 0x004fc8aa,
+  0x0046c7ab, 0x0051c9b2, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x00a0e1d2, 0x0064caf7,
+  0x005ecbf9, 0x0077d0fb, 0x0093dcfd, 0x005ecbf9, 0x00a3dffd, 0x008697f6, 0x003248f1, 0x006a79f3,
+  0x00dbe2b4, 0x00d2db9c, 0x00d2db9c, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00cbd68e, 0x00d2db9c,
+  0x00d2db9c, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x0099e0d2, 0x0085d9c9, 0x0066d0b6,
+  0x005acbb3, 0x005acbb3, 0x0052cab3, 0x0046c7ab, 0x004fc8aa, 0x005acbb3, 0x0052cab3, 0x0047c7b1,
+  0x0046c7ab, 0x0066cfbc, 0x0064caf7, 0x005ecbf9, 0x00b4e6f9, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd,
+  0x004353f3, 0x003248f1, 0x003a4fef, 0x00d3dc9d, 0x00d2db9c, 0x00cfd89a, 0x00c9cf78, 0x00c2ce7d,
+  0x00cbcf83, 0x00cfd89a, 0x00d2db9c, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00c6d189,
+  0x0099e0d2, 0x0085d9c9, 0x0085d9c9, 0x0085d9c9, 0x007ad7c0, 0x005acbb3, 0x0051c9b2, 0x0046c7ab,
+  0x0051c9b2, 0x005acbb3, 0x005acbb3, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0050c8b1,
+  0x0064caf7, 0x005ecbf9, 0x0077d0fb, 0x0091dafa, 0x005ecbf9, 0x00a3dffd, 0x009faaf9, 0x003248f1,
+  0x00818bf7, 0x00d2db9c, 0x00cbd68e, 0x00c9cf78, 0x00c2ce7d, 0x00cbd68e, 0x00d2db9c, 0x00d2db9c,
+  0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x0099e0d2, 0x0085d9c9, 0x0085d9c9, 0x0085d9c9, 0x0068d1be,
+  0x005acbb3, 0x004fc8aa, 0x0046c7ab, 0x004fc8aa, 0x005acbb3, 0x005acbb3, 0x005acbb3, 0x0052cab3,
+  0x0047c7b1, 0x0046c7ab, 0x00a3e4d4, 0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd,
+  0x004f63f4, 0x003248f1, 0x004c5bf3, 0x00d6dea8, 0x00d2db9c, 0x00cbd68e, 0x00c2ce7d, 0x00c6d189,
+  0x00d2db9c, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00d4dca6, 0x0099e0d2, 0x0085d9c9,
+  0x0085d9c9, 0x0082d7c6, 0x005acbb3, 0x0050c8b1, 0x0046c7ab, 0x0052cab3, 0x005acbb3, 0x005acbb3,
+  0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0085d9c9, 0x0064caf7, 0x005ecbf9, 0x0089d8fa, 0x00a3dffd,
+  0x005ecbf9, 0x00a3dffd, 0x003248f1, 0x00aeb8f9, 0x00d2db9c, 0x00c6d189, 0x00c2ce7d, 0x00cfd89a,
+  0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00c1cd7b, 0x0099e0d2, 0x0085d9c9, 0x0085d9c9,
+  0x0071d4c0, 0x005acbb3, 0x0050c8b1, 0x0046c7ab, 0x0050c8b1, 0x005acbb3, 0x005acbb3, 0x0052cab3,
+  0x0047c7b1, 0x0046c7ab, 0x006ed1bc, 0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x0070d0fc, 0x005ecbf9,
+  0x00a3dffd, 0x008697f6, 0x003248f1, 0x006274f6, 0x00dbe2b4, 0x00d2db9c, 0x00cfd89a, 0x00c6d189,
+  0x00c2ce7d, 0x00cbd68e, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x0099e0d2, 0x0085d9c9,
+  0x0085d9c9, 0x0066d0b6, 0x005acbb3, 0x0052cab3, 0x0046c7ab, 0x0050c8b1, 0x005acbb3, 0x005acbb3,
+  0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0066d0b6, 0x0064caf7, 0x005ecbf9, 0x009addfc, 0x005ecbf9,
+  0x00a3dffd, 0x004f63f4, 0x003248f1, 0x004353f3, 0x00d4dca6, 0x00d2db9c, 0x00cfd89a, 0x00c6d189,
+  0x00c2ce7d, 0x00c6d280, 0x00d2db9c, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00d2db9c, 0x0099e0d2,
+  0x0085d9c9, 0x007ad7c0, 0x005acbb3, 0x0051c9b2, 0x0046c7ab, 0x0052cab3, 0x005acbb3, 0x0052cab3,
+  0x0047c7b1, 0x0046c7ab, 0x005acbb3, 0x0064caf7, 0x005ecbf9, 0x0077d0fb, 0x0089d8fa, 0x005ecbf9,
+  0x00a3dffd, 0x003349f2, 0x003248f1, 0x00aeb8f9, 0x00d2db9c, 0x00cfd89a, 0x00c6d189, 0x00c2ce7d,
+  0x00cfd89a, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00c2ce7d, 0x0099e0d2, 0x0085d9c9, 0x0071d4c0,
+  0x005acbb3, 0x0051c9b2, 0x0046c7ab, 0x004fc8aa, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab,
+  0x005acbb3, 0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd, 0x009aa2f8,
+  0x003248f1, 0x007582f5, 0x00dbe2b4, 0x00d2db9c, 0x00cfd89a, 0x00c6d189, 0x00c2ce7d, 0x00cdd697,
+  0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x0099e0d2, 0x0082d7c6, 0x0066d0b6, 0x005acbb3, 0x0051c9b2,
+  0x0047c7b1, 0x0046c7ab, 0x004fc8aa, 0x005acbb3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x005acbb3,
+  0x0064caf7, 0x005ecbf9, 0x00a3dffd, 0x0064caf7, 0x005ecbf9, 0x00a3dffd, 0x006a79f3, 0x003248f1,
+  0x004358f0, 0x00d6dea8, 0x00d2db9c, 0x00cfd89a, 0x00c6d189, 0x00c2ce7d, 0x00c6d189, 0x00cfd89a,
+  0x00c2ce7d, 0x00bdca6f, 0x00d6dea8, 0x0099e0d2, 0x007ad7c0, 0x005acbb3, 0x0051c9b2, 0x0046c7ab,
+  0x0052cab3, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x005ecfb7, 0x0064caf7, 0x005ecbf9, 0x0081d6fa,
+  0x00a3dffd, 0x005ecbf9, 0x00a3dffd, 0x004358f0, 0x003248f1, 0x003a4fef, 0x00d4dca6, 0x00d2db9c,
+  0x00c6d189, 0x00c9cf78, 0x00c2ce7d, 0x00cfd89a, 0x00c2ce7d, 0x00bdca6f, 0x00cdd697, 0x0099e0d2,
+  0x0071d4c0, 0x005acbb3, 0x0051c9b2, 0x0046c7ab, 0x0051c9b2, 0x0052cab3, 0x0047c7b1, 0x0046c7ab,
+  0x0066d0b6, 0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x0070d0fc, 0x005ecbf9, 0x00a3dffd, 0x003349f2,
+  0x003248f1, 0x00abb2fa, 0x00d2db9c, 0x00cdd697, 0x00c9cf78, 0x00c2ce7d, 0x00cfd89a, 0x00c2ce7d,
+  0x00bdca6f, 0x00c2ce7d, 0x0099e0d2, 0x0068d1be, 0x005acbb3, 0x0052cab3, 0x004fc8aa, 0x0046c7ab,
+  0x004fc8aa, 0x0052cab3, 0x0047c7b1, 0x0046c7ab, 0x0071d4c0, 0x0064caf7, 0x005ecbf9, 0x0064caf7,
+  0x0065cbf8, 0x005ecbf9, 0x00a3dffd, 0x009faaf9, 0x003248f1, 0x008e99f7, 0x00d2db9c, 0x00cfd89a,
+  0x00c6d189, 0x00c2ce7d, 0x00c9cf78, 0x00cbd68e, 0x00c2ce7d, 0x00bdca6f, 0x00c4ca74, 0x0097ded1,
+  0x005ecfb7, 0x005acbb3, 0x004fc8aa, 0x0046c7ab, 0x0051c9b2, 0x0047c7b1, 0x0046c7ab, 0x008eddca,
+  0x0064caf7, 0x005ecbf9, 0x00a3dffd, 0x005ecbf9, 0x00a3dffd, 0x00818bf7, 0x003248f1, 0x006071f3,
+  0x00d6dea8, 0x00d2db9c, 0x00cfd89a, 0x00cbd68e, 0x00c2ce7d, 0x00c6d189, 0x00c2ce7d, 0x00bdca6f,
+  0x00becb70, 0x0097ded1, 0x005acbb3, 0x0051c9b2, 0x0046c7ab, 0x0051c9b2, 0x0047c7b1, 0x0046c7ab,
+  0x005acbb3, 0x0064caf7, 0x005ecbf9, 0x0081d6fa, 0x00ace3fe, 0x005ecbf9, 0x00a3dffd, 0x006c7bf6,
+  0x003248f1, 0x004353f3, 0x00d4dca6, 0x00d2db9c, 0x00cfd89a, 0x00c6d189, 0x00c2ce7d, 0x00c6d189,
+  0x00c2ce7d, 0x00bdca6f, 0x00cbda9f, 0x0090dfcc, 0x005acbb3, 0x0052cab3, 0x004fc8aa, 0x0046c7ab,
+  0x0051c9b2, 0x0047c7b1, 0x0046c7ab, 0x004fc8aa, 0x0085d9c9, 0x0064caf7, 0x005ecbf9, 0x0070d0fc,
+  0x0091dafa, 0x005ecbf9, 0x00a3dffd, 0x005669f2, 0x003248f1, 0x00d4dd9e, 0x00d2db9c, 0x00cdd890,
+  0x00c6d189, 0x00c2ce7d, 0x00bdca6f, 0x00c4d591, 0x0085d9c9, 0x005acbb3, 0x004fc8aa, 0x0050c8b1,
+  0x0046c7ab, 0x0050c8b1, 0x0047c7b1, 0x0046c7ab, 0x0066cfbc, 0x00b6e8e2, 0x0064caf7, 0x005ecbf9,
+  0x0065cbf8, 0x006fcffb, 0x005ecbf9, 0x00a3dffd, 0x004459f1, 0x003248f1, 0x003a4fef, 0x003c52f2,
+  0x003a4fef, 0x003248f1, 0x00d3dc9d, 0x00d2db9c, 0x00cfd89a, 0x00cbd68e, 0x00cbcf83, 0x00c9cf78,
+  0x00c2ce7d, 0x00c9cf78, 0x00c6d189, 0x00cbcf83, 0x00becb70, 0x00bdca6f, 0x00c1d386, 0x0085d9c9,
+  0x005acbb3, 0x0052cab3, 0x004fc8aa, 0x0046c7ab, 0x0050c8b1, 0x0047c7b1, 0x0046c7ab, 0x005acbb3,
+  0x0099e0d2, 0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd, 0x003b51f1,
+  0x003248f1, 0x004358f0, 0x008593f8, 0x009aa2f8, 0x004c5bf3, 0x003248f1, 0x00aab7d9, 0x00d3dc9d,
+  0x00d2db9c, 0x00cfd89a, 0x00cdd697, 0x00c6d189, 0x00c2ce7d, 0x00c9cf78, 0x00cdd890, 0x00d4dd9e,
+  0x00c7cd77, 0x00c2ca68, 0x00bdca6f, 0x00c2ce7d, 0x007ed4bc, 0x005acbb3, 0x0051c9b2, 0x004fc8aa,
+  0x0046c7ab, 0x0047c7b1, 0x0052cab3, 0x0051c9b2, 0x0047c7b1, 0x0046c7ab, 0x0052cab3, 0x0085d9c9,
+  0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x005ecbf9, 0x00a3dffd, 0x00334fef, 0x003248f1,
+  0x004459f1, 0x00596cf5, 0x003248f1, 0x009ba6ce, 0x00d2db9c, 0x00cfd89a, 0x00cdd890, 0x00c6d189,
+  0x00c2ce7d, 0x00d4dca6, 0x00c1cd7b, 0x00bdca6f, 0x00c1cd7b, 0x007ad1b2, 0x005acbb3, 0x0051c9b2,
+  0x004fc8aa, 0x0046c7ab, 0x0047c7b1, 0x0071d4c0, 0x00b4e8db, 0x0068d1be, 0x0046c7ab, 0x004fc8aa,
+  0x005acbb3, 0x008eddca, 0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x009addfc, 0x00ace3fe, 0x006ecefa,
+  0x005ecbf9, 0x00a3dffd, 0x003349f2, 0x003248f1, 0x003a4fef, 0x003b51f1, 0x003248f1, 0x008c9cc6,
+  0x00d2db9c, 0x00cfd89a, 0x00cbd68e, 0x00c6d189, 0x00c9cf78, 0x00c2ce7d, 0x00cdd697, 0x00e0e7b9,
+  0x00bdca6f, 0x00beca79, 0x0076cea8, 0x005acbb3, 0x0052cab3, 0x004fc8aa, 0x0047c7b1, 0x0046c7ab,
+  0x0099e0d2, 0x008eddca, 0x0046c7ab, 0x005ecfb7, 0x00a0e1d2, 0x0064caf7, 0x005ecbf9, 0x006ecefa,
+  0x0077d0fb, 0x005ecbf9, 0x00a3dffd, 0x003248f1, 0x005f6cf5, 0x008593f8, 0x003248f1, 0x008c9cc6,
+  0x00d2db9c, 0x00cfd89a, 0x00cdd697, 0x00c6d189, 0x00c2ce7d, 0x00c9cf78, 0x00c2ce7d, 0x00c6d189,
+  0x00bdca6f, 0x00becb70, 0x006ecda9, 0x005acbb3, 0x0051c9b2, 0x0050c8b1, 0x0046c7ab, 0x0085d9c9,
+  0x007ad7c0, 0x0046c7ab, 0x005acbb3, 0x0097ded1, 0x0064caf7, 0x005ecbf9, 0x006ecefa, 0x005ecbf9,
+  0x00a3dffd, 0x003248f1, 0x008e99f7, 0x00abb2fa, 0x003248f1, 0x008c9cc6, 0x00d2db9c, 0x00cfd89a,
+  0x00cfd89a, 0x00cbd68e, 0x00c6d189, 0x00c6d189, 0x00c2ce7d, 0x00cfd89a, 0x00bdca6f, 0x00b8cb75,
+  0x006ecda9, 0x005acbb3, 0x0052cab3, 0x0050c8b1, 0x0050c8b1, 0x0047c7b1, 0x0046c7ab, 0x004fc8aa,
+  0x0046c7ab, 0x0051c9b2, 0x007ad7c0, 0x00a3e4d4, 0x0064caf7, 0x005ecbf9, 0x0081d6fa, 0x009addfc,
+  0x005ecbf9, 0x00a3dffd, 0x004353f3, 0x004353f3, 0x004459f1, 0x004459f1, 0x004c5bf3, 0x004f63f4,
+  0x004f63f4, 0x005669f2, 0x00596cf5, 0x006071f3, 0x00586bf4, 0x005564f4, 0x004f63f4, 0x00abb2fa,
+  0x00aeb8f9, 0x003248f1, 0x008796aa, 0x00c7cd77, 0x00c1cd7b, 0x00c1cd7b, 0x00c1cd7b, 0x00cfd89a,
+  0x00bdca6f, 0x00b8cb75, 0x006ecda9, 0x005acbb3, 0x0052cab3, 0x0052cab3, 0x0051c9b2, 0x004fc8aa,
+  0x0050c8b1, 0x004fc8aa, 0x005ecfb7, 0x005acbb3, 0x0066d0b6, 0x007bd6c7, 0x0097ded1, 0x00abe4da,
+  0x0064caf7, 0x005ecbf9, 0x00a3dffd, 0x005ecbf9, 0x00a3dffd, 0x004358f0, 0x004459f1, 0x004459f1,
+  0x004459f1, 0x004c5bf3, 0x005669f2, 0x006071f3, 0x006a79f3, 0x006e80f4, 0x007582f5, 0x006e80f4,
+  0x006c7bf6, 0x006071f3, 0x005669f2, 0x004f63f4, 0x004c5bf3, 0x004459f1, 0x004459f1, 0x004358f0,
+  0x008593f8, 0x009aa2f8, 0x003248f1, 0x008796aa, 0x00bdca6f, 0x00cbd68e, 0x00bdca6f, 0x00b8cb75,
+  0x0064c9a6, 0x004fc8aa, 0x0050c8b1, 0x0066d0b6, 0x0097ded1, 0x00b4e8db, 0x0064caf7, 0x005ecbf9,
+  0x00a3dffd, 0x0065cbf8, 0x00b4e5ff, 0x004358f0, 0x004459f1, 0x004c60f1, 0x005669f2, 0x006071f3,
+  0x006c7bf6, 0x007582f5, 0x006e80f4, 0x006a79f3, 0x00586bf4, 0x004c60f1, 0x004459f1, 0x004358f0,
+  0x005669f2, 0x00586bf4, 0x003248f1, 0x008796aa, 0x00bdca6f, 0x00cfd89a, 0x00c1cd7b, 0x00bdca6f,
+  0x00b8cb75, 0x0064c9a6, 0x0046c7ab, 0x005acbb3, 0x0046c7ab, 0x0046c7ab, 0x004fc8aa, 0x0052cab3,
+  0x0066d0b6, 0x007ad7c0, 0x00a0e1d2, 0x005ecbf9, 0x0093dcfd, 0x00b4e5ff, 0x005ecbf9, 0x0065cbf8,
+  0x0065cbf8, 0x0065cbf8, 0x006ecefa, 0x00b4e6f9, 0x004459f1, 0x004358f0, 0x004c60f1, 0x005669f2,
+  0x006274f6, 0x006e80f4, 0x007582f5, 0x006e80f4, 0x006a79f3, 0x00596cf5, 0x004c60f1, 0x004459f1,
+  0x004358f0, 0x004459f1, 0x008593f8, 0x0092a0f7, 0x003349f2, 0x003248f1, 0x008c9ab4, 0x00bdca6f,
+  0x00beca79, 0x00cbd68e, 0x00bdca6f, 0x00b8cb75, 0x005ecaa9, 0x0046c7ab, 0x004fc8aa, 0x00b4e8db,
+  0x00a0e1d2, 0x0046c7ab, 0x004fc8aa, 0x005ecfb7, 0x007cd9c3, 0x00ade7dc, 0x005ecbf9, 0x006fcffb,
+  0x0081d6fa, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x0065cbf8, 0x006ecefa, 0x004459f1, 0x004358f0,
+  0x004459f1, 0x004c60f1, 0x006071f3, 0x006c7bf6, 0x007582f5, 0x006e80f4, 0x006071f3, 0x004f63f4,
+  0x004459f1, 0x004358f0, 0x004459f1, 0x008390f5, 0x008390f5, 0x003a4fef, 0x003248f1, 0x0096a4bf,
+  0x00bdca6f, 0x00c1cd7b, 0x00dbe2b4, 0x00d0d589, 0x00bdca6f, 0x00b8cb75, 0x0061cbb1, 0x0046c7ab,
+  0x005ecfb7, 0x0052cab3, 0x0046c7ab, 0x0051c9b2, 0x007ad7c0, 0x00b4e8db, 0x0065cbf8, 0x005ecbf9,
+  0x0093dcfd, 0x00ace3fe, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x006ecefa, 0x004c5bf3,
+  0x004358f0, 0x004459f1, 0x004459f1, 0x00596cf5, 0x006c7bf6, 0x007582f5, 0x007582f5, 0x007582f5,
+  0x006e80f4, 0x006071f3, 0x004f63f4, 0x004459f1, 0x004358f0, 0x004f63f4, 0x007582f5, 0x008593f8,
+  0x006c7bf6, 0x003d58f0, 0x003248f1, 0x00b2b9c1, 0x00bdca6f, 0x00c2ce7d, 0x00cfd89a, 0x00d4dca6,
+  0x00cbd68e, 0x00c4ca74, 0x00bdca6f, 0x00b5ce7d, 0x0061cbb1, 0x0046c7ab, 0x0066d0b6, 0x00b6e8e2,
+  0x005acbb3, 0x0046c7ab, 0x0047c7b1, 0x005acbb3, 0x0097ded1, 0x0065cbf8, 0x005ecbf9, 0x0091dafa,
+  0x00a3dffd, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x004c60f1, 0x004358f0, 0x004459f1,
+  0x005f6cf5, 0x006e80f4, 0x006274f6, 0x004f63f4, 0x004358f0, 0x003b51f1, 0x003248f1, 0x00becb70,
+  0x00bdca6f, 0x00b8cf87, 0x005ecfb7, 0x0046c7ab, 0x0066d0b6, 0x0098e1cc, 0x008eddca, 0x0066d0b6,
+  0x0046c7ab, 0x0050c8b1, 0x0085d9c9, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x0082d7fb, 0x00a3dffd,
+  0x0091dafa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x004f63f4, 0x004358f0, 0x003d58f0,
+  0x003b51f1, 0x003c52f2, 0x004358f0, 0x003b51f1, 0x003248f1, 0x003a4fef, 0x00bfcc71, 0x00bdca6f,
+  0x00bcd293, 0x005ecfb7, 0x0046c7ab, 0x0066d0b6, 0x0052cab3, 0x0046c7ab, 0x0050c8b1, 0x008eddca,
+  0x006fcffb, 0x005ecbf9, 0x0065cbf8, 0x005ecbf9, 0x0064caf7, 0x0065cbf8, 0x006ecefa, 0x006fcffb,
+  0x005669f2, 0x004358f0, 0x003a4fef, 0x003349f2, 0x003248f1, 0x003248f1, 0x003949f2, 0x003d53f3,
+  0x004358f0, 0x003b51f1, 0x003248f1, 0x004f63f4, 0x00c1cd7b, 0x00bdca6f, 0x00c7dca5, 0x005ecfb7,
+  0x0046c7ab, 0x0071d4c0, 0x0052cab3, 0x0046c7ab, 0x0051cbad, 0x00a3e4d4, 0x0078d4f8, 0x005ecbf9,
+  0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0070d0fc, 0x006071f3, 0x004358f0, 0x003d53f3,
+  0x00334fef, 0x003248f1, 0x003c52f2, 0x004358f0, 0x003b51f1, 0x003248f1, 0x007888f5, 0x00c6d189,
+  0x00bdca6f, 0x005ecfb7, 0x0046c7ab, 0x0090ded2, 0x0052cab3, 0x0046c7ab, 0x006ed1bc, 0x0093dcfd,
+  0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x006fcffb, 0x006a79f3,
+  0x004459f1, 0x004358f0, 0x003b51f1, 0x003248f1, 0x003949f2, 0x004353f3, 0x004358f0, 0x003b51f1,
+  0x003248f1, 0x009faaf9, 0x00d3dc9d, 0x00bdca6f, 0x00c7cd77, 0x005ecfb7, 0x0046c7ab, 0x004fc8aa,
+  0x00b6e8e2, 0x0052cab3, 0x0046c7ab, 0x0050c8b1, 0x0097ded1, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8,
+  0x005ecbf9, 0x0064caf7, 0x0065cbf8, 0x006ecefa, 0x0078d4f8, 0x006c7bf6, 0x004459f1, 0x004358f0,
+  0x003d58f0, 0x003a4fef, 0x003248f1, 0x003349f2, 0x003d53f3, 0x004358f0, 0x003b51f1, 0x003248f1,
+  0x003349f2, 0x00bdca6f, 0x00c6d189, 0x005ecfb7, 0x0046c7ab, 0x005acbb3, 0x0052cab3, 0x0046c7ab,
+  0x0047c7b1, 0x0071d4c0, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa,
+  0x0081d6fa, 0x007582f5, 0x004f63f4, 0x004358f0, 0x003d53f3, 0x00334fef, 0x003248f1, 0x003c52f2,
+  0x004358f0, 0x003b51f1, 0x003248f1, 0x003c52f2, 0x00c7cd77, 0x00bdca6f, 0x00d2db9c, 0x005ecfb7,
+  0x0046c7ab, 0x007ad7c0, 0x0052cab3, 0x0046c7ab, 0x005acbb3, 0x006ecefa, 0x005ecbf9, 0x0065cbf8,
+  0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0089d8fa, 0x007582f5, 0x00586bf4, 0x004358f0,
+  0x003d53f3, 0x003248f1, 0x003349f2, 0x003c52f2, 0x004358f0, 0x003b51f1, 0x003248f1, 0x00586bf4,
+  0x00c9cf78, 0x00bdca6f, 0x00e0e7b9, 0x005ecfb7, 0x0046c7ab, 0x00a0e1d2, 0x0052cab3, 0x0046c7ab,
+  0x0050c8b1, 0x00abe4da, 0x0078d4f8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x006fcffb, 0x0089d8fa, 0x007582f5, 0x006274f6, 0x004459f1, 0x004358f0, 0x003d53f3,
+  0x003349f2, 0x003248f1, 0x003b51f1, 0x004358f0, 0x003b51f1, 0x003248f1, 0x009ca7f6, 0x00cfd89a,
+  0x00bdca6f, 0x00beca79, 0x005ecfb7, 0x0046c7ab, 0x0052cab3, 0x0046c7ab, 0x0099e0d2, 0x009addfc,
+  0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0077d0fb,
+  0x0091dafa, 0x007582f5, 0x006e80f4, 0x004459f1, 0x004358f0, 0x004353f3, 0x003349f2, 0x003248f1,
+  0x003b51f1, 0x004358f0, 0x003b51f1, 0x003248f1, 0x003a4fef, 0x00bdca6f, 0x00c6d189, 0x005ecfb7,
+  0x0046c7ab, 0x0050c8b1, 0x0052cab3, 0x0046c7ab, 0x008eddca, 0x0064caf7, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x006ecefa, 0x0081d6fa, 0x0093dcfd,
+  0x007582f5, 0x007582f5, 0x005669f2, 0x004358f0, 0x003d53f3, 0x003349f2, 0x003248f1, 0x003b51f1,
+  0x004358f0, 0x003b51f1, 0x003248f1, 0x004f63f4, 0x00c9cf78, 0x00bdca6f, 0x00dbe2b4, 0x005ecfb7,
+  0x0046c7ab, 0x007cd9c3, 0x0052cab3, 0x0046c7ab, 0x0082d7c6, 0x0070d0fc, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x006ecefa, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x006ecefa, 0x0089d8fa, 0x0093dcfd,
+  0x007582f5, 0x007582f5, 0x006274f6, 0x004358f0, 0x003d58f0, 0x003349f2, 0x003248f1, 0x003b51f1,
+  0x004358f0, 0x003b51f1, 0x003248f1, 0x0092a0f7, 0x00cfd89a, 0x00bdca6f, 0x00c4ca74, 0x005ecfb7,
+  0x0046c7ab, 0x00ade7dc, 0x0052cab3, 0x0046c7ab, 0x0085d9c9, 0x0091dafa, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x006ecefa, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0077d0fb, 0x0091dafa, 0x0093dcfd,
+  0x007582f5, 0x007582f5, 0x007582f5, 0x004c5bf3, 0x004358f0, 0x003349f2, 0x003248f1, 0x003349f2,
+  0x003c52f2, 0x004358f0, 0x003b51f1, 0x003248f1, 0x003c52f2, 0x00c4ca74, 0x00bdca6f, 0x00cbd68e,
+  0x005ecfb7, 0x0046c7ab, 0x0050c8b1, 0x0052cab3, 0x0046c7ab, 0x0047c7b1, 0x0097ded1, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x006ecefa,
+  0x0081d6fa, 0x0093dcfd, 0x0093dcfd, 0x007582f5, 0x007582f5, 0x007582f5, 0x00586bf4, 0x004459f1,
+  0x004358f0, 0x003a4fef, 0x003248f1, 0x003d53f3, 0x004358f0, 0x003b51f1, 0x003248f1, 0x006071f3,
+  0x00c6d189, 0x00bdca6f, 0x005ecfb7, 0x0046c7ab, 0x0082d7c6, 0x0052cab3, 0x0046c7ab, 0x004fc8aa,
+  0x00abe4da, 0x0077d0fb, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x006ecefa, 0x0065cbf8, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x0089d8fa, 0x0093dcfd, 0x0093dcfd, 0x007582f5, 0x007582f5, 0x007582f5,
+  0x006c7bf6, 0x004358f0, 0x003b51f1, 0x003248f1, 0x003349f2, 0x004353f3, 0x004358f0, 0x003b51f1,
+  0x003248f1, 0x00aeb8f9, 0x00dbe2b4, 0x00bdca6f, 0x00c7cd77, 0x005ecfb7, 0x0046c7ab, 0x0052cab3,
+  0x0046c7ab, 0x0050c8b1, 0x00a3dffd, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x006ecefa, 0x006ecefa,
+  0x0065cbf8, 0x005ecbf9, 0x006ecefa, 0x0077d0fb, 0x0091dafa, 0x0093dcfd, 0x0093dcfd, 0x007582f5,
+  0x004f63f4, 0x004459f1, 0x004358f0, 0x004358f0, 0x004358f0, 0x003d53f3, 0x003248f1, 0x003a4fef,
+  0x004358f0, 0x003b51f1, 0x003248f1, 0x004f63f4, 0x00c1cd7b, 0x00bdca6f, 0x00d6dea8, 0x005ecfb7,
+  0x0046c7ab, 0x005ecfb7, 0x0052cab3, 0x0046c7ab, 0x005acbb3, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x006ecefa, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0081d6fa,
+  0x0093dcfd, 0x0093dcfd, 0x0093dcfd, 0x007582f5, 0x006274f6, 0x004459f1, 0x004358f0, 0x004358f0,
+  0x004353f3, 0x003349f2, 0x003248f1, 0x003c52f2, 0x004358f0, 0x003b51f1, 0x003248f1, 0x0092a0f7,
+  0x00d3dc9d, 0x00bdca6f, 0x00becb70, 0x005ecfb7, 0x0046c7ab, 0x00a2e2d9, 0x0052cab3, 0x0046c7ab,
+  0x0071d4c0, 0x0089d8fa, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0064caf7, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x006fcffb, 0x0091dafa, 0x0093dcfd, 0x0093dcfd, 0x0093dcfd, 0x007582f5, 0x004f63f4,
+  0x004459f1, 0x004358f0, 0x003a4fef, 0x003248f1, 0x003349f2, 0x004353f3, 0x004358f0, 0x003b51f1,
+  0x003248f1, 0x004f63f4, 0x00c1cd7b, 0x00bdca6f, 0x00d3dc9d, 0x005ecfb7, 0x0046c7ab, 0x005acbb3,
+  0x0052cab3, 0x0046c7ab, 0x0098e1cc, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x006ecefa, 0x006ecefa, 0x0081d6fa, 0x0093dcfd, 0x007582f5, 0x006274f6,
+  0x004459f1, 0x003c52f2, 0x003248f1, 0x003a4fef, 0x004358f0, 0x003b51f1, 0x003248f1, 0x0092a0f7,
+  0x00d4dca6, 0x00bdca6f, 0x00beca79, 0x005ecfb7, 0x0046c7ab, 0x00a0e1d2, 0x0052cab3, 0x0046c7ab,
+  0x004fc8aa, 0x0081d6fa, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0064caf7, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x006ecefa, 0x006ecefa, 0x0091dafa, 0x0093dcfd, 0x007582f5, 0x004f63f4, 0x003248f1,
+  0x003c52f2, 0x004358f0, 0x003b51f1, 0x003248f1, 0x005564f4, 0x00c7cd77, 0x00bdca6f, 0x00d6dea8,
+  0x005ecfb7, 0x0046c7ab, 0x005ecfb7, 0x0052cab3, 0x0046c7ab, 0x006ed1bc, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0081d6fa, 0x0093dcfd, 0x007582f5,
+  0x005669f2, 0x003248f1, 0x003349f2, 0x004358f0, 0x003b51f1, 0x003248f1, 0x003349f2, 0x00b0bafb,
+  0x00dbe2b4, 0x00bdca6f, 0x00c2ce7d, 0x005ecfb7, 0x0046c7ab, 0x00abe4da, 0x0052cab3, 0x0046c7ab,
+  0x00abe4da, 0x0089d8fa, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x005ecbf9, 0x006fcffb, 0x0093dcfd,
+  0x007582f5, 0x006c7bf6, 0x004459f1, 0x003a4fef, 0x003248f1, 0x003c52f2, 0x004358f0, 0x003b51f1,
+  0x003248f1, 0x006a79f3, 0x00c6d280, 0x00bdca6f, 0x00becb70, 0x00e0e7b9, 0x005ecfb7, 0x0046c7ab,
+  0x0068d1be, 0x0052cab3, 0x0046c7ab, 0x005acbb3, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa,
+  0x0065cbf8, 0x005ecbf9, 0x006fcffb, 0x0093dcfd, 0x007582f5, 0x005669f2, 0x004358f0, 0x004353f3,
+  0x003349f2, 0x003248f1, 0x003349f2, 0x004353f3, 0x004358f0, 0x003b51f1, 0x003248f1, 0x003c52f2,
+  0x00becb70, 0x00bdca6f, 0x00c2ca68, 0x00cfd89a, 0x005ecfb7, 0x0046c7ab, 0x004fc8aa, 0x0052cab3,
+  0x0046c7ab, 0x008eddca, 0x00a3dffd, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9,
+  0x006ecefa, 0x0089d8fa, 0x0093dcfd, 0x007582f5, 0x006c7bf6, 0x004459f1, 0x004358f0, 0x004358f0,
+  0x003c52f2, 0x003248f1, 0x003b51f1, 0x004358f0, 0x003b51f1, 0x003248f1, 0x009ca7f6, 0x00d4dca6,
+  0x00bdca6f, 0x00c2ce7d, 0x005ecfb7, 0x0046c7ab, 0x008eddca, 0x0052cab3, 0x0046c7ab, 0x0052cab3,
+  0x0077d0fb, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa,
+  0x0077d0fb, 0x0093dcfd, 0x007582f5, 0x00586bf4, 0x004358f0, 0x003a4fef, 0x003248f1, 0x003349f2,
+  0x004358f0, 0x003b51f1, 0x003248f1, 0x006071f3, 0x00c6d189, 0x00becb70, 0x00bdca6f, 0x00becb70,
+  0x00e0e7b9, 0x005ecfb7, 0x0046c7ab, 0x0066d0b6, 0x0052cab3, 0x0046c7ab, 0x0085d9c9, 0x0065cbf8,
+  0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x006ecefa,
+  0x006ecefa, 0x0089d8fa, 0x0093dcfd, 0x007582f5, 0x007582f5, 0x007582f5, 0x006e80f4, 0x004459f1,
+  0x004358f0, 0x004353f3, 0x003349f2, 0x003248f1, 0x003c52f2, 0x004358f0, 0x004358f0, 0x004358f0,
+  0x003b51f1, 0x003248f1, 0x004459f1, 0x00c1cd7b, 0x00bdca6f, 0x00cfd89a, 0x005ecfb7, 0x0046c7ab,
+  0x0050c8b1, 0x0052cab3, 0x0046c7ab, 0x0052cab3, 0x009addfc, 0x005ecbf9, 0x0065cbf8, 0x006ecefa,
+  0x0065cbf8, 0x005ecbf9, 0x006ecefa, 0x0078d4f8, 0x0091dafa, 0x0093dcfd, 0x0093dcfd, 0x0093dcfd,
+  0x007582f5, 0x007582f5, 0x007582f5, 0x006071f3, 0x004459f1, 0x004358f0, 0x003d53f3, 0x003248f1,
+  0x003349f2, 0x004358f0, 0x004358f0, 0x004358f0, 0x003b51f1, 0x003248f1, 0x003b51f1, 0x00dbe2b4,
+  0x00becb70, 0x00bdca6f, 0x00c2ca68, 0x00c6d189, 0x005ecfb7, 0x0046c7ab, 0x0097ded1, 0x0052cab3,
+  0x0046c7ab, 0x0099e0d2, 0x0081d6fa, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x0089d8fa, 0x0093dcfd, 0x0093dcfd, 0x0093dcfd, 0x007582f5, 0x007582f5, 0x007582f5,
+  0x004f63f4, 0x004358f0, 0x003d53f3, 0x003248f1, 0x004353f3, 0x004358f0, 0x004358f0, 0x003b51f1,
+  0x003248f1, 0x003349f2, 0x009aa2f8, 0x00d6dea8, 0x00becb70, 0x00bdca6f, 0x00c2ce7d, 0x005ecfb7,
+  0x0046c7ab, 0x0071d4c0, 0x0052cab3, 0x0046c7ab, 0x005ecfb7, 0x006fcffb, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0081d6fa, 0x0093dcfd, 0x0093dcfd,
+  0x0093dcfd, 0x007582f5, 0x007582f5, 0x006c7bf6, 0x004358f0, 0x003c52f2, 0x003248f1, 0x003a4fef,
+  0x004358f0, 0x004358f0, 0x003b51f1, 0x003248f1, 0x008593f8, 0x00cfd89a, 0x00bdca6f, 0x00becb70,
+  0x005ecfb7, 0x0046c7ab, 0x005acbb3, 0x0052cab3, 0x0046c7ab, 0x00b6e8e2, 0x0065cbf8, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x006fcffb, 0x0091dafa,
+  0x0093dcfd, 0x0093dcfd, 0x007582f5, 0x007582f5, 0x00586bf4, 0x004358f0, 0x003b51f1, 0x003248f1,
+  0x003349f2, 0x004358f0, 0x004358f0, 0x003b51f1, 0x003248f1, 0x007888f5, 0x00cbd68e, 0x00bdca6f,
+  0x00becb70, 0x005ecfb7, 0x0046c7ab, 0x005acbb3, 0x0052cab3, 0x0046c7ab, 0x0071d4c0, 0x0065cbf8,
+  0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0089d8fa,
+  0x0093dcfd, 0x0093dcfd, 0x007582f5, 0x006e80f4, 0x004f63f4, 0x004358f0, 0x003a4fef, 0x003248f1,
+  0x003d53f3, 0x004358f0, 0x003b51f1, 0x003248f1, 0x007582f5, 0x00c6d189, 0x00bdca6f, 0x00becb70,
+  0x005ecfb7, 0x0046c7ab, 0x0052cab3, 0x0052cab3, 0x0046c7ab, 0x0051c9b2, 0x00ace3fe, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x006ecefa, 0x0077d0fb,
+  0x0093dcfd, 0x0093dcfd, 0x007582f5, 0x006c7bf6, 0x004459f1, 0x004358f0, 0x003a4fef, 0x003248f1,
+  0x003a4fef, 0x004358f0, 0x003b51f1, 0x003248f1, 0x007582f5, 0x00cbd68e, 0x00bdca6f, 0x00beca79,
+  0x00e0e7b9, 0x005ecfb7, 0x0046c7ab, 0x0052cab3, 0x0052cab3, 0x0046c7ab, 0x0047c7b1, 0x00ade7dc,
+  0x00a3dffd, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa,
+  0x006fcffb, 0x0089d8fa, 0x0093dcfd, 0x007582f5, 0x006071f3, 0x004358f0, 0x003a4fef, 0x003248f1,
+  0x003949f2, 0x004358f0, 0x003b51f1, 0x003248f1, 0x003349f2, 0x00818bf7, 0x00cbd68e, 0x00bdca6f,
+  0x00c1cd7b, 0x005ecfb7, 0x0046c7ab, 0x0052cab3, 0x0052cab3, 0x0046c7ab, 0x0071d4c0, 0x00a3dffd,
+  0x0064caf7, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa,
+  0x0081d6fa, 0x0093dcfd, 0x007582f5, 0x005564f4, 0x004358f0, 0x003c52f2, 0x003248f1, 0x004353f3,
+  0x003b51f1, 0x003248f1, 0x003349f2, 0x008593f8, 0x00d2db9c, 0x00becb70, 0x00bdca6f, 0x00c9cf78,
+  0x005ecfb7, 0x0046c7ab, 0x005acbb3, 0x0052cab3, 0x0046c7ab, 0x0051c9b2, 0x00a3dffd, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0078d4f8, 0x0093dcfd,
+  0x006e80f4, 0x004c5bf3, 0x004358f0, 0x003c52f2, 0x003248f1, 0x003d53f3, 0x003b51f1, 0x003248f1,
+  0x003a4fef, 0x009ca7f6, 0x00d6dea8, 0x00c4ca74, 0x00bdca6f, 0x00c6d189, 0x005ecfb7, 0x0046c7ab,
+  0x0047c7b1, 0x005ecfb7, 0x0052cab3, 0x0046c7ab, 0x004fc8aa, 0x00b4e5ff, 0x0065cbf8, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0077d0fb, 0x0091dafa,
+  0x006c7bf6, 0x004358f0, 0x003d58f0, 0x00334fef, 0x003248f1, 0x003b51f1, 0x003b51f1, 0x003248f1,
+  0x004c60f1, 0x00c2ce7d, 0x00bdca6f, 0x00cfd89a, 0x005ecfb7, 0x0046c7ab, 0x006ed1bc, 0x0052cab3,
+  0x0046c7ab, 0x00a3e4d4, 0x006ecefa, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x006fcffb, 0x0089d8fa, 0x006071f3, 0x004358f0, 0x003a4fef, 0x003248f1,
+  0x003a4fef, 0x003b51f1, 0x003248f1, 0x007582f5, 0x00cbd68e, 0x00bdca6f, 0x00c4ca74, 0x005ecfb7,
+  0x0046c7ab, 0x0085d9c9, 0x0052cab3, 0x0046c7ab, 0x0071d4c0, 0x0081d6fa, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0081d6fa, 0x00586bf4, 0x004358f0,
+  0x003d53f3, 0x003349f2, 0x003248f1, 0x003349f2, 0x003a4fef, 0x003248f1, 0x004459f1, 0x00a3b0f9,
+  0x00dbe2b4, 0x00c7cd77, 0x00bdca6f, 0x00d0d589, 0x005ecfb7, 0x0046c7ab, 0x0051c9b2, 0x00b6e8e2,
+  0x0052cab3, 0x0046c7ab, 0x0052cab3, 0x00a3dffd, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8,
+  0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x006ecefa, 0x0081d6fa, 0x004f63f4, 0x004358f0, 0x004353f3,
+  0x003a4fef, 0x003248f1, 0x003b51f1, 0x003248f1, 0x003349f2, 0x007888f5, 0x00cfd89a, 0x00bdca6f,
+  0x00becb70, 0x00c2ce7d, 0x00dbe2b4, 0x005ecfb7, 0x0046c7ab, 0x007ad7c0, 0x0052cab3, 0x0046c7ab,
+  0x0077d0fb, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa,
+  0x0077d0fb, 0x004c60f1, 0x004358f0, 0x003d53f3, 0x003a4fef, 0x003248f1, 0x003a4fef, 0x003248f1,
+  0x003349f2, 0x006071f3, 0x00c6d189, 0x00bdca6f, 0x00c1cd7b, 0x00d4dca6, 0x005ecfb7, 0x0046c7ab,
+  0x005ecfb7, 0x00b4e8db, 0x0052cab3, 0x0046c7ab, 0x00a3dffd, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8,
+  0x006ecefa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x006ecefa, 0x0070d0fc, 0x004c5bf3,
+  0x004358f0, 0x003c52f2, 0x003349f2, 0x003248f1, 0x003349f2, 0x003248f1, 0x003349f2, 0x005669f2,
+  0x00abb2fa, 0x00dbe2b4, 0x00c6d189, 0x00bdca6f, 0x00c1cd7b, 0x00cfd89a, 0x005ecfb7, 0x0046c7ab,
+  0x0052cab3, 0x008eddca, 0x0052cab3, 0x0046c7ab, 0x00abe4da, 0x0089d8fa, 0x0065cbf8, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x0077d0fb, 0x0081d6fa, 0x0077d0fb, 0x006ecefa, 0x006fcffb, 0x004459f1,
+  0x004358f0, 0x003c52f2, 0x003a4fef, 0x003248f1, 0x003349f2, 0x003248f1, 0x003a4fef, 0x006071f3,
+  0x00b0bafb, 0x00c6d189, 0x00bfcc71, 0x00bdca6f, 0x00c2ce7d, 0x00d3dc9d, 0x005ecfb7, 0x0046c7ab,
+  0x0052cab3, 0x008eddca, 0x0052cab3, 0x0046c7ab, 0x00a0e1d2, 0x0081d6fa, 0x0065cbf8, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x0077d0fb, 0x0081d6fa, 0x0093dcfd, 0x0093dcfd, 0x0093dcfd, 0x0089d8fa,
+  0x0077d0fb, 0x006ecefa, 0x006fcffb, 0x004459f1, 0x004358f0, 0x003d53f3, 0x003b51f1, 0x003349f2,
+  0x003248f1, 0x004459f1, 0x007888f5, 0x00cfd89a, 0x00c2ce7d, 0x00becb70, 0x00bdca6f, 0x00becb70,
+  0x00c4ca74, 0x00c6d189, 0x00dbe2b4, 0x005ecfb7, 0x0046c7ab, 0x005acbb3, 0x008eddca, 0x0052cab3,
+  0x0046c7ab, 0x0090dfcc, 0x0089d8fa, 0x0065cbf8, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0077d0fb,
+  0x0081d6fa, 0x0091dafa, 0x0093dcfd, 0x0089d8fa, 0x0077d0fb, 0x006fcffb, 0x006ecefa, 0x004459f1,
+  0x004358f0, 0x003c52f2, 0x003a4fef, 0x003248f1, 0x003349f2, 0x003248f1, 0x003349f2, 0x003d53f3,
+  0x006274f6, 0x00aeb8f9, 0x00c6d189, 0x00c1cd7b, 0x00c4ca74, 0x00bdca6f, 0x00c4ca74, 0x00c2ce7d,
+  0x00d6dea8, 0x005ecfb7, 0x0046c7ab, 0x0050c8b1, 0x0066d0b6, 0x00a3e4d4, 0x0052cab3, 0x0046c7ab,
+  0x0082d7c6, 0x009addfc, 0x006ecefa, 0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x006fcffb, 0x0078d4f8,
+  0x0089d8fa, 0x0093dcfd, 0x0089d8fa, 0x0079d2fd, 0x006fcffb, 0x006ecefa, 0x004358f0, 0x003d53f3,
+  0x003a4fef, 0x00334fef, 0x003248f1, 0x003949f2, 0x004f63f4, 0x008593f8, 0x00b0bafb, 0x00d4dd9e,
+  0x00c2ce7d, 0x00bdca6f, 0x00becb70, 0x00bdca6f, 0x00beca79, 0x00d0d589, 0x00dbe2b4, 0x005ecfb7,
+  0x0046c7ab, 0x005acbb3, 0x0097ded1, 0x0052cab3, 0x0046c7ab, 0x0071d4c0, 0x0091dafa, 0x0065cbf8,
+  0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x0077d0fb, 0x0081d6fa, 0x0091dafa, 0x0093dcfd, 0x0091dafa,
+  0x0081d6fa, 0x0077d0fb, 0x006ecefa, 0x004358f0, 0x003d53f3, 0x003c52f2, 0x003a4fef, 0x003949f2,
+  0x003349f2, 0x003248f1, 0x003349f2, 0x003b51f1, 0x004c5bf3, 0x006071f3, 0x008593f8, 0x009faaf9,
+  0x00e0e7b9, 0x00d4dca6, 0x00cbd68e, 0x00c9cf78, 0x00c4ca74, 0x00bdca6f, 0x00bdca6f, 0x00becb70,
+  0x00bdca6f, 0x00bdca6f, 0x00bdca6f, 0x00becb70, 0x00becb70, 0x00becb70, 0x00c7cd77, 0x00c6d280,
+  0x00cfd89a, 0x00dbe2b4, 0x005ecfb7, 0x0046c7ab, 0x0047c7b1, 0x0046c7ab, 0x0051c9b2, 0x0071d4c0,
+  0x00a3e4d4, 0x0052cab3, 0x0046c7ab, 0x0068d1be, 0x00a3dffd, 0x0079d2fd, 0x0065cbf8, 0x005ecbf9,
+  0x0065cbf8, 0x006ecefa, 0x0077d0fb, 0x0081d6fa, 0x0082d7fb, 0x0091dafa, 0x0093dcfd, 0x0089d8fa,
+  0x0081d6fa, 0x0077d0fb, 0x006ecefa, 0x003349f2, 0x003248f1, 0x003248f1, 0x003248f1, 0x003349f2,
+  0x003248f1, 0x003248f1, 0x006a79f3, 0x005ecfb7, 0x0046c7ab, 0x0046c7ab, 0x0047c7b1, 0x0050c8b1,
+  0x005acbb3, 0x0066cfbc, 0x0082d7c6, 0x0097ded1, 0x00abe4da, 0x0052cab3, 0x0046c7ab, 0x0066cfbc,
+  0x00ace3fe, 0x00a3dffd, 0x0089d8fa, 0x0078d4f8, 0x0065cbf8, 0x0065cbf8, 0x005ecbf9, 0x005ecbf9,
+  0x005ecbf9, 0x0065cbf8, 0x006ecefa, 0x006fcffb, 0x0077d0fb, 0x0078d4f8, 0x0078d4f8, 0x0081d6fa,
+  0x0089d8fa, 0x0091dafa, 0x0091dafa, 0x0093dcfd, 0x0091dafa, 0x0091dafa, 0x0089d8fa, 0x0081d6fa,
+  0x0079d2fd, 0x0078d4f8, 0x0077d0fb, 0x0070d0fc, 0x006ecefa, 0x00b4e5ff, 0x003248f1, 0x008390f5,
+  0x009addfc, 0x005ecbf9, 0x005ecbf9, 0x0065cbf8, 0x005ecbf9, 0x0064caf7, 0x00ace3fe, 0x003248f1,
+  0x008593f8, 0x00b4e6f9, 0x005ecbf9, 0x00ace3fe, 0x003248f1, 0x008e99f7, 0x00b4e6f9, 0x005ecbf9,
+  0x00b4e5ff, 0x003248f1, 0x009aa2f8, 0x00b4e6f9, 0x005ecbf9, 0x003248f1, 0x00abb2fa, 0x00b4e6f9,
+  0x005ecbf9, 0x003248f1, 0x00b4e6f9, 0x005ecbf9, 0x003248f1, 0x003349f2, 0x00b4e6f9, 0x005ecbf9,
+  0x0065cbf8, 0x003248f1, 0x004459f1, 0x00b4e6f9, 0x005ecbf9, 0x006fcffb, 0x003248f1, 0x006071f3,
+  0x00b4e6f9, 0x005ecbf9, 0x0081d6fa, 0x003248f1, 0x008593f8, 0x00b4e6f9, 0x005ecbf9, 0x0089d8fa,
+  0x003248f1, 0x00abb2fa, 0x00b4e6f9, 0x005ecbf9, 0x00a3dffd, 0x003248f1, 0x00b4e6f9, 0x005ecbf9,
+  0x003248f1, 0x004459f1, 0x00b4e6f9, 0x005ecbf9, 0x0065cbf8, 0x003248f1, 0x008390f5, 0x00b4e6f9,
+  0x005ecbf9, 0x0089d8fa, 0x003248f1, 0x00aeb8f9, 0x00b4e6f9, 0x005ecbf9, 0x00a3dffd, 0x003248f1,
+  0x003a4fef, 0x00b4e6f9, 0x005ecbf9, 0x003248f1, 0x007582f5, 0x00b4e6f9, 0x005ecbf9, 0x0078d4f8,
+  0x003248f1, 0x00b2bef8, 0x00b4e6f9, 0x005ecbf9, 0x00a3dffd, 0x003248f1, 0x004459f1, 0x00b4e6f9,
+  0x005ecbf9, 0x003248f1, 0x0092a0f7, 0x00b4e6f9, 0x005ecbf9, 0x0081d6fa, 0x003248f1, 0x004358f0,
+  0x00b4e6f9, 0x005ecbf9, 0x003248f1, 0x00818bf7, 0x00b4e6f9, 0x005ecbf9, 0x006fcffb, 0x003248f1,
+  0x004353f3, 0x00b4e6f9, 0x005ecbf9, 0x00ace3fe, 0x003248f1, 0x008390f5, 0x00b4e6f9, 0x005ecbf9,
+  0x0065cbf8, 0x003248f1, 0x004459f1, 0x00b4e6f9, 0x005ecbf9, 0x00ace3fe, 0x003248f1, 0x0092a0f7,
+  0x00b4e6f9, 0x005ecbf9, 0x006fcffb, 0x003248f1, 0x00586bf4, 0x00b4e6f9, 0x005ecbf9, 0x003248f1,
+  0x003b51f1, 0x00b4e6f9, 0x005ecbf9, 0x0089d8fa, 0x003248f1, 0x008697f6, 0x00b4e6f9, 0x005ecbf9,
+  0x0065cbf8, 0x003248f1, 0x00586bf4, 0x00b4e6f9, 0x005ecbf9, 0x0064caf7, 0x00ace3fe, 0x003248f1,
+  0x003c52f2, 0x00b4e6f9, 0x005ecbf9, 0x0081d6fa, 0x003248f1, 0x00abb2fa, 0x00b4e6f9, 0x005ecbf9,
+  0x006fcffb, 0x003248f1, 0x008593f8, 0x00b4e6f9, 0x005ecbf9, 0x0065cbf8, 0x003248f1, 0x006e80f4,
+  0x00b4e6f9, 0x005ecbf9, 0x00b4e5ff, 0x003248f1, 0x006a79f3, 0x00b4e6f9, 0x005ecbf9, 0x00a3dffd,
+  0x003248f1, 0x006479f4, 0x00b4e6f9, 0x005ecbf9, 0x0091dafa, 0x003248f1, 0x006a79f3, 0x00b4e6f9,
+  0x005ecbf9, 0x0089d8fa, 0x003248f1, 0x003349f2, 0x006c7bf6, 0x00b4e6f9, 0x005ecbf9, 0x0089d8fa,
+  0x003248f1, 0x003349f2, 0x00818bf7, 0x00b4e6f9, 0x005ecbf9, 0x0093dcfd, 0x003248f1, 0x003a4fef,
+  0x009aa2f8, 0x00b4e6f9, 0x005ecbf9, 0x0065cbf8, 0x00a3dffd, 0x003248f1, 0x003d53f3, 0x00b4e6f9,
+  0x005ecbf9, 0x0065cbf8, 0x00b4e6f9, 0x003248f1, 0x006071f3, 0x00b4e6f9, 0x005ecbf9, 0x006fcffb,
+  0x003248f1, 0x004358f0, 0x009ca7f6, 0x00b4e6f9, 0x005ecbf9, 0x0091dafa, 0x003248f1, 0x003349f2,
+  0x006c7bf6, 0x00b4e6f9, 0x005ecbf9, 0x0065cbf8, 0x003248f1, 0x003349f2, 0x006071f3, 0x00b4e6f9,
+  0x005ecbf9, 0x0065cbf8, 0x0093dcfd, 0x003248f1, 0x005669f2, 0x00aeb8f9, 0x00b4e6f9, 0x005ecbf9,
+  0x0064caf7, 0x0081d6fa, 0x003248f1, 0x003a4fef, 0x00596cf5, 0x00aeb8f9, 0x00b4e6f9, 0x005ecbf9,
+  0x0081d6fa, 0x003248f1, 0x003349f2, 0x004459f1, 0x007582f5, 0x00b4e6f9, 0x005ecbf9, 0x0065cbf8,
+  0x0081d6fa, 0x003248f1, 0x003349f2, 0x004353f3, 0x006274f6, 0x00abb2fa, 0x00b4e6f9, 0x005ecbf9,
+  0x0065cbf8, 0x0093dcfd, 0x003248f1, 0x003349f2, 0x004c60f1, 0x008593f8, 0x00b0bafb, 0x00b4e6f9,
+  0x005ecbf9, 0x0065cbf8, 0x0089d8fa, 0x003248f1, 0x003248f1, 0x003248f1, 0x00334fef, 0x003d53f3,
+  0x004f63f4, 0x006a79f3, 0x008e99f7, 0x00abb2fa, 0x00b4e6f9, 0x005ecbf9, 0x0065cbf8, 0x0078d4f8,
+  0x00a3dffd, 0x00b4e6f9, 0x005ecbf9, 0x005ecbf9, 0x005ecbf9, 0x0065cbf8, 0x0065cbf8, 0x0077d0fb,
+  0x0091dafa, 0x00a3dffd, 0x00b4e6f9,
+};
+
+static const int POKY_IMG_XBGR8888_SPANS[] = {
+  212, 6, 0, 0, 212, 1, 0, 24, 213, 6, 1, 28,
+  219, 5, 0, 32, 212, 1, 0, 52, 213, 11, 1, 56,
+  224, 4, 0, 60, 212, 1, 0, 76, 213, 15, 1, 80,
+  228, 2, 0, 84, 212, 1, 0, 92, 213, 18, 1, 96,
+  231, 2, 0, 100, 212, 1, 0, 108, 213, 20, 1, 112,
+  233, 2, 0, 116, 212, 1, 0, 124, 213, 22, 1, 128,
+  235, 2, 0, 132, 212, 1, 0, 140, 213, 24, 1, 144,
+  237, 2, 0, 148, 212, 1, 0, 156, 213, 26, 1, 160,
+  239, 1, 0, 164, 212, 1, 0, 168, 213, 27, 1, 172,
+  240, 2, 0, 176, 212, 1, 0, 184, 213, 29, 1, 188,
+  242, 1, 0, 192, 212, 1, 0, 196, 213, 30, 1, 200,
+  243, 1, 0, 204, 212, 1, 0, 208, 213, 31, 1, 212,
+  244, 2, 0, 216, 212, 1, 0, 224, 213, 33, 1, 228,
+  246, 1, 0, 232, 212, 1, 0, 236, 213, 34, 1, 240,
+  247, 1, 0, 244, 212, 1, 0, 248, 213, 35, 1, 252,
+  248, 1, 0, 256, 212, 1, 0, 260, 213, 36, 1, 264,
+  249, 1, 0, 268, 212, 1, 0, 272, 213, 37, 1, 276,
+  250, 1, 0, 280, 212, 1, 0, 284, 213, 37, 1, 288,
+  250, 2, 0, 292, 212, 1, 0, 300, 213, 38, 1, 304,
+  251, 2, 0, 308, 212, 1, 0, 316, 213, 39, 1, 320,
+  252, 1, 0, 324, 212, 1, 0, 328, 213, 40, 1, 332,
+  253, 1, 0, 336, 212, 1, 0, 340, 213, 41, 1, 344,
+  254, 1, 0, 348, 212, 1, 0, 352, 213, 41, 1, 356,
+  254, 1, 0, 360, 212, 1, 0, 364, 213, 42, 1, 368,
+  255, 1, 0, 372, 212, 1, 0, 376, 213, 43, 1, 380,
+  256, 1, 0, 384, 212, 1, 0, 388, 213, 43, 1, 392,
+  256, 1, 0, 396, 212, 1, 0, 400, 213, 44, 1, 404,
+  257, 1, 0, 408, 212, 1, 0, 412, 213, 44, 1, 416,
+  257, 1, 0, 420, 212, 1, 0, 424, 213, 45, 1, 428,
+  258, 1, 0, 432, 212, 1, 0, 436, 213, 45, 1, 440,
+  258, 1, 0, 444, 212, 1, 0, 448, 213, 46, 1, 452,
+  259, 1, 0, 456, 212, 1, 0, 460, 213, 46, 1, 464,
+  259, 1, 0, 468, 212, 1, 0, 472, 213, 47, 1, 476,
+  260, 1, 0, 480, 212, 1, 0, 484, 213, 47, 1, 488,
+  260, 1, 0, 492, 212, 1, 0, 496, 213, 48, 1, 500,
+  212, 1, 0, 504, 213, 48, 1, 508, 261, 1, 0, 512,
+  212, 1, 0, 516, 213, 48, 1, 520, 261, 1, 0, 524,
+  212, 1, 0, 528, 213, 48, 1, 532, 261, 1, 0, 536,
+  212, 1, 0, 540, 213, 49, 1, 544, 262, 1, 0, 548,
+  212, 1, 0, 552, 213, 49, 1, 556, 262, 1, 0, 560,
+  212, 1, 0, 564, 213, 49, 1, 568, 262, 1, 0, 572,
+  212, 1, 0, 576, 213, 49, 1, 580, 262, 1, 0, 584,
+  212, 1, 0, 588, 213, 50, 1, 592, 212, 1, 0, 596,
+  213, 50, 1, 600, 263, 1, 0, 604, 212, 1, 0, 608,
+  213, 50, 1, 612, 263, 1, 0, 616, 212, 1, 0, 620,
+  213, 50, 1, 624, 263, 1, 0, 628, 212, 1, 0, 632,
+  213, 50, 1, 636, 263, 1, 0, 640, 212, 1, 0, 644,
+  213, 50, 1, 648, 263, 1, 0, 652, 212, 1, 0, 656,
+  213, 50, 1, 660, 263, 1, 0, 664, 212, 1, 0, 668,
+  213, 50, 1, 672, 263, 1, 0, 676, 50, 14, 0, 680,
+  109, 2, 0, 736, 158, 8, 0, 744, 212, 1, 0, 776,
+  213, 50, 1, 780, 263, 1, 0, 784, 44, 5, 0, 788,
+  49, 14, 1, 808, 63, 6, 0, 812, 109, 6, 1, 836,
+  115, 4, 0, 840, 150, 4, 0, 856, 154, 5, 1, 872,
+  159, 2, 0, 876, 161, 6, 1, 884, 167, 5, 0, 888,
+  212, 9, 0, 908, 221, 34, 1, 944, 255, 10, 0, 948,
+  265, 50, 1, 988, 315, 6, 0, 992, 414, 5, 0, 1016,
+  41, 4, 0, 1036, 45, 24, 1, 1052, 69, 3, 0, 1056,
+  109, 11, 1, 1068, 120, 3, 0, 1072, 146, 3, 0, 1084,
+  149, 10, 1, 1096, 159, 2, 0, 1100, 161, 11, 1, 1108,
+  172, 4, 0, 1112, 212, 1, 0, 1128, 213, 7, 1, 1132,
+  220, 6, 0, 1136, 226, 24, 1, 1160, 250, 6, 0, 1164,
+  256, 7, 1, 1188, 263, 2, 0, 1192, 265, 50, 1, 1200,
+  315, 1, 0, 1204, 316, 7, 1, 1208, 323, 5, 0, 1212,
+  408, 4, 0, 1232, 412, 7, 1, 1248, 419, 1, 0, 1252,
+  38, 3, 0, 1256, 41, 31, 1, 1268, 72, 3, 0, 1272,
+  109, 15, 1, 1284, 124, 2, 0, 1288, 143, 2, 0, 1296,
+  145, 14, 1, 1304, 159, 2, 0, 1308, 161, 14, 1, 1316,
+  175, 4, 0, 1320, 212, 1, 0, 1336, 213, 12, 1, 1340,
+  225, 4, 0, 1344, 229, 18, 1, 1360, 247, 4, 0, 1364,
+  251, 12, 1, 1380, 263, 2, 0, 1384, 265, 50, 1, 1392,
+  315, 1, 0, 1396, 316, 12, 1, 1400, 328, 3, 0, 1404,
+  404, 3, 0, 1416, 407, 12, 1, 1428, 419, 1, 0, 1432,
+  36, 2, 0, 1436, 38, 37, 1, 1444, 75, 3, 0, 1448,
+  109, 18, 1, 1460, 127, 1, 0, 1464, 140, 2, 0, 1468,
+  142, 17, 1, 1476, 159, 2, 0, 1480, 161, 17, 1, 1488,
+  178, 3, 0, 1492, 212, 1, 0, 1504, 213, 15, 1, 1508,
+  228, 4, 0, 1512, 232, 12, 1, 1528, 244, 4, 0, 1532,
+  248, 15, 1, 1548, 263, 2, 0, 1552, 265, 50, 1, 1560,
+  315, 1, 0, 1564, 316, 16, 1, 1568, 332, 2, 0, 1572,
+  401, 2, 0, 1580, 403, 16, 1, 1588, 419, 1, 0, 1592,
+  33, 2, 0, 1596, 35, 43, 1, 1604, 78, 2, 0, 1608,
+  109, 1, 0, 1616, 110, 19, 1, 1620, 129, 2, 0, 1624,
+  138, 1, 0, 1632, 139, 20, 1, 1636, 159, 2, 0, 1640,
+  161, 20, 1, 1648, 181, 2, 0, 1652, 212, 1, 0, 1660,
+  213, 18, 1, 1664, 231, 3, 0, 1668, 234, 8, 1, 1680,
+  242, 3, 0, 1684, 245, 18, 1, 1696, 263, 2, 0, 1700,
+  265, 50, 1, 1708, 315, 1, 0, 1712, 316, 19, 1, 1716,
+  335, 2, 0, 1720, 399, 2, 0, 1728, 401, 18, 1, 1736,
+  419, 1, 0, 1740, 32, 1, 0, 1744, 33, 47, 1, 1748,
+  80, 2, 0, 1752, 109, 1, 0, 1760, 110, 21, 1, 1764,
+  131, 2, 0, 1768, 136, 1, 0, 1776, 137, 22, 1, 1780,
+  159, 2, 0, 1784, 161, 22, 1, 1792, 183, 2, 0, 1796,
+  212, 1, 0, 1804, 213, 21, 1, 1808, 234, 2, 0, 1812,
+  236, 4, 1, 1820, 240, 2, 0, 1824, 242, 21, 1, 1832,
+  263, 2, 0, 1836, 265, 50, 1, 1844, 315, 2, 0, 1848,
+  317, 20, 1, 1856, 337, 2, 0, 1860, 397, 1, 0, 1868,
+  398, 21, 1, 1872, 419, 1, 0, 1876, 30, 1, 0, 1880,
+  31, 51, 1, 1884, 82, 1, 0, 1888, 109, 1, 0, 1892,
+  110, 23, 1, 1896, 133, 3, 0, 1900, 136, 23, 1, 1912,
+  159, 2, 0, 1916, 161, 24, 1, 1924, 185, 2, 0, 1928,
+  212, 1, 0, 1936, 213, 23, 1, 1940, 236, 4, 0, 1944,
+  240, 23, 1, 1960, 263, 2, 0, 1964, 265, 50, 1, 1972,
+  315, 2, 0, 1976, 317, 22, 1, 1984, 339, 2, 0, 1988,
+  395, 1, 0, 1996, 396, 23, 1, 2000, 419, 1, 0, 2004,
+  28, 2, 0, 2008, 30, 53, 1, 2016, 83, 2, 0, 2020,
+  109, 1, 0, 2028, 110, 21, 1, 2032, 131, 7, 0, 2036,
+  138, 21, 1, 2064, 159, 2, 0, 2068, 161, 26, 1, 2076,
+  187, 1, 0, 2080, 212, 1, 0, 2084, 213, 23, 1, 2088,
+  236, 3, 0, 2092, 239, 24, 1, 2104, 263, 2, 0, 2108,
+  265, 50, 1, 2116, 315, 2, 0, 2120, 317, 24, 1, 2128,
+  341, 1, 0, 2132, 393, 1, 0, 2136, 394, 25, 1, 2140,
+  419, 1, 0, 2144, 27, 2, 0, 2148, 29, 56, 1, 2156,
+  85, 1, 0, 2160, 109, 1, 0, 2164, 110, 19, 1, 2168,
+  129, 2, 0, 2172, 131, 5, 1, 2180, 136, 3, 0, 2184,
+  139, 20, 1, 2196, 159, 2, 0, 2200, 161, 27, 1, 2208,
+  188, 2, 0, 2212, 212, 1, 0, 2220, 213, 22, 1, 2224,
+  235, 6, 0, 2228, 241, 22, 1, 2252, 263, 2, 0, 2256,
+  265, 50, 1, 2264, 315, 2, 0, 2268, 317, 25, 1, 2276,
+  342, 2, 0, 2280, 391, 2, 0, 2288, 393, 26, 1, 2296,
+  419, 1, 0, 2300, 25, 2, 0, 2304, 27, 59, 1, 2312,
+  86, 2, 0, 2316, 110, 18, 1, 2324, 128, 2, 0, 2328,
+  130, 9, 1, 2336, 139, 1, 0, 2340, 140, 19, 1, 2344,
+  159, 2, 0, 2348, 161, 29, 1, 2356, 190, 1, 0, 2360,
+  212, 1, 0, 2364, 213, 20, 1, 2368, 233, 2, 0, 2372,
+  235, 6, 1, 2380, 241, 2, 0, 2384, 243, 20, 1, 2392,
+  263, 2, 0, 2396, 265, 49, 1, 2404, 314, 1, 0, 2408,
+  316, 1, 0, 2412, 317, 27, 1, 2416, 344, 1, 0, 2420,
+  390, 1, 0, 2424, 391, 28, 1, 2428, 419, 1, 0, 2432,
+  24, 2, 0, 2436, 26, 61, 1, 2444, 87, 2, 0, 2448,
+  110, 1, 0, 2456, 111, 16, 1, 2460, 127, 2, 0, 2464,
+  129, 10, 1, 2472, 139, 2, 0, 2476, 141, 18, 1, 2484,
+  159, 2, 0, 2488, 161, 30, 1, 2496, 191, 2, 0, 2500,
+  212, 2, 0, 2508, 214, 18, 1, 2516, 232, 2, 0, 2520,
+  234, 8, 1, 2528, 242, 2, 0, 2532, 244, 19, 1, 2540,
+  263, 2, 0, 2544, 265, 49, 1, 2552, 314, 1, 0, 2556,
+  316, 1, 0, 2560, 317, 28, 1, 2564, 345, 2, 0, 2568,
+  388, 2, 0, 2576, 390, 29, 1, 2584, 419, 1, 0, 2588,
+  23, 1, 0, 2592, 24, 65, 1, 2596, 89, 1, 0, 2600,
+  110, 1, 0, 2604, 111, 15, 1, 2608, 126, 1, 0, 2612,
+  127, 14, 1, 2616, 141, 2, 0, 2620, 143, 16, 1, 2628,
+  159, 2, 0, 2632, 161, 31, 1, 2640, 192, 2, 0, 2644,
+  212, 2, 0, 2652, 214, 17, 1, 2660, 231, 1, 0, 2664,
+  232, 11, 1, 2668, 243, 2, 0, 2672, 245, 18, 1, 2680,
+  263, 2, 0, 2684, 265, 49, 1, 2692, 314, 1, 0, 2696,
+  316, 1, 0, 2700, 317, 30, 1, 2704, 347, 1, 0, 2708,
+  387, 1, 0, 2712, 388, 31, 1, 2716, 419, 1, 0, 2720,
+  22, 1, 0, 2724, 23, 67, 1, 2728, 90, 1, 0, 2732,
+  110, 1, 0, 2736, 111, 14, 1, 2740, 125, 1, 0, 2744,
+  126, 16, 1, 2748, 142, 2, 0, 2752, 144, 15, 1, 2760,
+  159, 2, 0, 2764, 161, 33, 1, 2772, 194, 1, 0, 2776,
+  212, 2, 0, 2780, 214, 16, 1, 2788, 230, 1, 0, 2792,
+  231, 14, 1, 2796, 245, 1, 0, 2800, 246, 17, 1, 2804,
+  263, 2, 0, 2808, 265, 49, 1, 2816, 314, 1, 0, 2820,
+  316, 1, 0, 2824, 317, 31, 1, 2828, 348, 1, 0, 2832,
+  386, 1, 0, 2836, 387, 32, 1, 2840, 419, 1, 0, 2844,
+  21, 1, 0, 2848, 22, 69, 1, 2852, 91, 2, 0, 2856,
+  111, 13, 1, 2864, 124, 2, 0, 2868, 126, 18, 1, 2876,
+  144, 1, 0, 2880, 145, 14, 1, 2884, 159, 2, 0, 2888,
+  161, 34, 1, 2896, 195, 1, 0, 2900, 212, 2, 0, 2904,
+  214, 14, 1, 2912, 228, 2, 0, 2916, 230, 16, 1, 2924,
+  246, 2, 0, 2928, 248, 15, 1, 2936, 263, 2, 0, 2940,
+  265, 48, 1, 2948, 313, 1, 0, 2952, 316, 1, 0, 2956,
+  317, 32, 1, 2960, 349, 1, 0, 2964, 385, 1, 0, 2968,
+  386, 33, 1, 2972, 419, 1, 0, 2976, 20, 1, 0, 2980,
+  21, 71, 1, 2984, 92, 2, 0, 2988, 111, 1, 0, 2996,
+  112, 11, 1, 3000, 123, 2, 0, 3004, 125, 20, 1, 3012,
+  145, 1, 0, 3016, 146, 13, 1, 3020, 159, 2, 0, 3024,
+  161, 35, 1, 3032, 196, 1, 0, 3036, 212, 3, 0, 3040,
+  215, 13, 1, 3052, 228, 1, 0, 3056, 229, 18, 1, 3060,
+  247, 1, 0, 3064, 248, 15, 1, 3068, 263, 2, 0, 3072,
+  265, 48, 1, 3080, 313, 1, 0, 3084, 316, 1, 0, 3088,
+  317, 34, 1, 3092, 351, 1, 0, 3096, 384, 1, 0, 3100,
+  385, 34, 1, 3104, 419, 1, 0, 3108, 19, 1, 0, 3112,
+  20, 73, 1, 3116, 93, 2, 0, 3120, 111, 1, 0, 3128,
+  112, 10, 1, 3132, 122, 2, 0, 3136, 124, 22, 1, 3144,
+  146, 1, 0, 3148, 147, 12, 1, 3152, 159, 2, 0, 3156,
+  161, 36, 1, 3164, 197, 1, 0, 3168, 212, 3, 0, 3172,
+  215, 12, 1, 3184, 227, 1, 0, 3188, 228, 20, 1, 3192,
+  248, 1, 0, 3196, 249, 14, 1, 3200, 263, 2, 0, 3204,
+  265, 48, 1, 3212, 313, 1, 0, 3216, 316, 1, 0, 3220,
+  317, 35, 1, 3224, 352, 1, 0, 3228, 383, 1, 0, 3232,
+  384, 35, 1, 3236, 419, 1, 0, 3240, 18, 1, 0, 3244,
+  19, 75, 1, 3248, 94, 1, 0, 3252, 112, 9, 1, 3256,
+  121, 1, 0, 3260, 122, 24, 1, 3264, 146, 2, 0, 3268,
+  148, 11, 1, 3276, 159, 2, 0, 3280, 161, 37, 1, 3288,
+  198, 1, 0, 3292, 212, 3, 0, 3296, 215, 10, 1, 3308,
+  225, 2, 0, 3312, 227, 22, 1, 3320, 249, 1, 0, 3324,
+  250, 13, 1, 3328, 263, 2, 0, 3332, 265, 47, 1, 3340,
+  312, 1, 0, 3344, 316, 1, 0, 3348, 317, 36, 1, 3352,
+  353, 1, 0, 3356, 382, 1, 0, 3360, 383, 36, 1, 3364,
+  419, 1, 0, 3368, 17, 1, 0, 3372, 18, 77, 1, 3376,
+  95, 1, 0, 3380, 112, 1, 0, 3384, 113, 7, 1, 3388,
+  120, 1, 0, 3392, 121, 26, 1, 3396, 147, 2, 0, 3400,
+  149, 10, 1, 3408, 159, 2, 0, 3412, 161, 38, 1, 3420,
+  199, 1, 0, 3424, 212, 3, 0, 3428, 215, 10, 1, 3440,
+  225, 1, 0, 3444, 226, 24, 1, 3448, 250, 1, 0, 3452,
+  251, 12, 1, 3456, 263, 2, 0, 3460, 265, 47, 1, 3468,
+  312, 1, 0, 3472, 316, 1, 0, 3476, 317, 36, 1, 3480,
+  353, 1, 0, 3484, 381, 1, 0, 3488, 382, 37, 1, 3492,
+  419, 1, 0, 3496, 16, 1, 0, 3500, 17, 79, 1, 3504,
+  96, 1, 0, 3508, 112, 1, 0, 3512, 113, 6, 1, 3516,
+  119, 2, 0, 3520, 121, 27, 1, 3528, 148, 2, 0, 3532,
+  150, 9, 1, 3540, 159, 2, 0, 3544, 161, 39, 1, 3552,
+  200, 1, 0, 3556, 212, 4, 0, 3560, 216, 8, 1, 3576,
+  224, 1, 0, 3580, 225, 26, 1, 3584, 251, 1, 0, 3588,
+  252, 11, 1, 3592, 263, 2, 0, 3596, 265, 47, 1, 3604,
+  312, 1, 0, 3608, 316, 1, 0, 3612, 317, 37, 1, 3616,
+  354, 1, 0, 3620, 380, 1, 0, 3624, 381, 38, 1, 3628,
+  419, 1, 0, 3632, 15, 2, 0, 3636, 17, 80, 1, 3644,
+  97, 1, 0, 3648, 113, 5, 1, 3652, 118, 2, 0, 3656,
+  120, 29, 1, 3664, 149, 1, 0, 3668, 150, 9, 1, 3672,
+  159, 2, 0, 3676, 161, 39, 1, 3684, 200, 1, 0, 3688,
+  212, 4, 0, 3692, 216, 7, 1, 3708, 223, 1, 0, 3712,
+  224, 28, 1, 3716, 252, 1, 0, 3720, 253, 10, 1, 3724,
+  263, 2, 0, 3728, 265, 46, 1, 3736, 311, 1, 0, 3740,
+  316, 1, 0, 3744, 317, 38, 1, 3748, 355, 1, 0, 3752,
+  379, 1, 0, 3756, 380, 39, 1, 3760, 419, 1, 0, 3764,
+  15, 1, 0, 3768, 16, 82, 1, 3772, 98, 1, 0, 3776,
+  113, 1, 0, 3780, 114, 4, 1, 3784, 118, 1, 0, 3788,
+  119, 31, 1, 3792, 150, 1, 0, 3796, 151, 8, 1, 3800,
+  159, 2, 0, 3804, 161, 40, 1, 3812, 201, 1, 0, 3816,
+  212, 5, 0, 3820, 217, 5, 1, 3840, 222, 1, 0, 3844,
+  223, 30, 1, 3848, 253, 1, 0, 3852, 254, 9, 1, 3856,
+  263, 2, 0, 3860, 265, 46, 1, 3868, 311, 1, 0, 3872,
+  316, 1, 0, 3876, 317, 39, 1, 3880, 356, 1, 0, 3884,
+  378, 1, 0, 3888, 379, 40, 1, 3892, 419, 1, 0, 3896,
+  14, 1, 0, 3900, 15, 83, 1, 3904, 98, 1, 0, 3908,
+  114, 5, 0, 3912, 119, 31, 1, 3932, 150, 2, 0, 3936,
+  152, 7, 1, 3944, 159, 2, 0, 3948, 161, 41, 1, 3956,
+  202, 1, 0, 3960, 212, 5, 0, 3964, 217, 4, 1, 3984,
+  221, 2, 0, 3988, 223, 30, 1, 3996, 253, 1, 0, 4000,
+  254, 9, 1, 4004, 263, 2, 0, 4008, 265, 45, 1, 4016,
+  310, 1, 0, 4020, 316, 1, 0, 4024, 317, 40, 1, 4028,
+  357, 1, 0, 4032, 378, 41, 1, 4036, 419, 1, 0, 4040,
+  13, 1, 0, 4044, 14, 85, 1, 4048, 99, 1, 0, 4052,
+  114, 3, 0, 4056, 117, 34, 1, 4068, 151, 1, 0, 4072,
+  152, 7, 1, 4076, 159, 2, 0, 4080, 161, 41, 1, 4088,
+  202, 2, 0, 4092, 212, 1, 0, 4100, 213, 4, 1, 4104,
+  217, 5, 0, 4108, 222, 32, 1, 4128, 254, 1, 0, 4132,
+  255, 8, 1, 4136, 263, 2, 0, 4140, 265, 45, 1, 4148,
+  310, 1, 0, 4152, 316, 1, 0, 4156, 317, 40, 1, 4160,
+  357, 1, 0, 4164, 377, 1, 0, 4168, 378, 41, 1, 4172,
+  419, 1, 0, 4176, 12, 2, 0, 4180, 14, 86, 1, 4188,
+  100, 1, 0, 4192, 115, 2, 0, 4196, 117, 34, 1, 4204,
+  151, 2, 0, 4208, 153, 6, 1, 4216, 159, 2, 0, 4220,
+  161, 42, 1, 4228, 203, 1, 0, 4232, 212, 1, 0, 4236,
+  213, 4, 1, 4240, 217, 4, 0, 4244, 221, 34, 1, 4260,
+  255, 1, 0, 4264, 256, 7, 1, 4268, 263, 2, 0, 4272,
+  265, 45, 1, 4280, 310, 1, 0, 4284, 316, 1, 0, 4288,
+  317, 41, 1, 4292, 358, 1, 0, 4296, 376, 1, 0, 4300,
+  377, 42, 1, 4304, 419, 1, 0, 4308, 12, 1, 0, 4312,
+  13, 87, 1, 4316, 100, 1, 0, 4320, 115, 1, 0, 4324,
+  116, 36, 1, 4328, 152, 1, 0, 4332, 153, 6, 1, 4336,
+  159, 2, 0, 4340, 161, 43, 1, 4348, 204, 1, 0, 4352,
+  212, 1, 0, 4356, 213, 4, 1, 4360, 217, 3, 0, 4364,
+  220, 35, 1, 4376, 255, 2, 0, 4380, 257, 6, 1, 4388,
+  263, 2, 0, 4392, 265, 44, 1, 4400, 309, 1, 0, 4404,
+  316, 1, 0, 4408, 317, 42, 1, 4412, 359, 1, 0, 4416,
+  375, 1, 0, 4420, 376, 43, 1, 4424, 419, 1, 0, 4428,
+  11, 2, 0, 4432, 13, 88, 1, 4440, 101, 1, 0, 4444,
+  115, 1, 0, 4448, 116, 37, 1, 4452, 153, 1, 0, 4456,
+  154, 5, 1, 4460, 159, 2, 0, 4464, 161, 43, 1, 4472,
+  204, 1, 0, 4476, 212, 1, 0, 4480, 213, 5, 1, 4484,
+  218, 2, 0, 4488, 220, 36, 1, 4496, 256, 1, 0, 4500,
+  257, 6, 1, 4504, 263, 2, 0, 4508, 265, 43, 1, 4516,
+  308, 1, 0, 4520, 316, 1, 0, 4524, 317, 43, 1, 4528,
+  375, 1, 0, 4532, 376, 43, 1, 4536, 419, 1, 0, 4540,
+  11, 1, 0, 4544, 12, 89, 1, 4548, 101, 1, 0, 4552,
+  115, 2, 0, 4556, 117, 37, 1, 4564, 154, 1, 0, 4568,
+  155, 4, 1, 4572, 159, 2, 0, 4576, 161, 44, 1, 4584,
+  205, 1, 0, 4588, 212, 1, 0, 4592, 213, 5, 1, 4596,
+  218, 2, 0, 4600, 220, 37, 1, 4608, 257, 1, 0, 4612,
+  258, 5, 1, 4616, 263, 2, 0, 4620, 265, 43, 1, 4628,
+  308, 1, 0, 4632, 316, 1, 0, 4636, 317, 43, 1, 4640,
+  360, 1, 0, 4644, 374, 1, 0, 4648, 375, 44, 1, 4652,
+  419, 1, 0, 4656, 10, 1, 0, 4660, 11, 91, 1, 4664,
+  102, 1, 0, 4668, 114, 4, 0, 4672, 118, 36, 1, 4688,
+  154, 1, 0, 4692, 155, 4, 1, 4696, 159, 2, 0, 4700,
+  161, 45, 1, 4708, 212, 1, 0, 4712, 213, 5, 1, 4716,
+  218, 2, 0, 4720, 220, 37, 1, 4728, 257, 1, 0, 4732,
+  258, 5, 1, 4736, 263, 2, 0, 4740, 265, 42, 1, 4748,
+  307, 1, 0, 4752, 316, 1, 0, 4756, 317, 44, 1, 4760,
+  374, 1, 0, 4764, 375, 44, 1, 4768, 419, 1, 0, 4772,
+  10, 1, 0, 4776, 11, 91, 1, 4780, 102, 1, 0, 4784,
+  114, 4, 0, 4788, 118, 37, 1, 4804, 155, 6, 0, 4808,
+  161, 45, 1, 4832, 206, 1, 0, 4836, 212, 1, 0, 4840,
+  213, 4, 1, 4844, 217, 4, 0, 4848, 221, 37, 1, 4864,
+  258, 1, 0, 4868, 259, 4, 1, 4872, 263, 2, 0, 4876,
+  265, 42, 1, 4884, 307, 1, 0, 4888, 316, 1, 0, 4892,
+  317, 44, 1, 4896, 361, 1, 0, 4900, 373, 1, 0, 4904,
+  374, 45, 1, 4908, 419, 1, 0, 4912, 9, 1, 0, 4916,
+  10, 93, 1, 4920, 103, 1, 0, 4924, 113, 5, 0, 4928,
+  118, 37, 1, 4948, 155, 6, 0, 4952, 161, 46, 1, 4976,
+  212, 1, 0, 4980, 213, 4, 1, 4984, 217, 4, 0, 4988,
+  221, 37, 1, 5004, 258, 1, 0, 5008, 259, 4, 1, 5012,
+  263, 2, 0, 5016, 265, 41, 1, 5024, 306, 1, 0, 5028,
+  316, 1, 0, 5032, 317, 45, 1, 5036, 362, 1, 0, 5040,
+  373, 1, 0, 5044, 374, 45, 1, 5048, 419, 1, 0, 5052,
+  9, 1, 0, 5056, 10, 93, 1, 5060, 103, 1, 0, 5064,
+  113, 1, 0, 5068, 114, 4, 1, 5072, 118, 2, 0, 5076,
+  120, 35, 1, 5084, 155, 6, 0, 5088, 161, 46, 1, 5112,
+  207, 1, 0, 5116, 212, 5, 0, 5120, 217, 4, 1, 5140,
+  221, 1, 0, 5144, 222, 37, 1, 5148, 259, 6, 0, 5152,
+  265, 40, 1, 5176, 305, 1, 0, 5180, 316, 1, 0, 5184,
+  317, 45, 1, 5188, 362, 1, 0, 5192, 372, 1, 0, 5196,
+  373, 46, 1, 5200, 419, 1, 0, 5204, 8, 1, 0, 5208,
+  9, 95, 1, 5212, 104, 1, 0, 5216, 113, 6, 1, 5220,
+  119, 2, 0, 5224, 121, 35, 1, 5232, 156, 5, 0, 5236,
+  161, 47, 1, 5256, 212, 5, 0, 5260, 217, 5, 1, 5280,
+  222, 1, 0, 5284, 223, 36, 1, 5288, 259, 6, 0, 5292,
+  265, 40, 1, 5316, 305, 1, 0, 5320, 316, 1, 0, 5324,
+  317, 46, 1, 5328, 372, 1, 0, 5332, 373, 46, 1, 5336,
+  419, 1, 0, 5340, 8, 1, 0, 5344, 9, 95, 1, 5348,
+  104, 1, 0, 5352, 112, 1, 0, 5356, 113, 7, 1, 5360,
+  120, 1, 0, 5364, 121, 35, 1, 5368, 156, 5, 0, 5372,
+  161, 47, 1, 5392, 208, 1, 0, 5396, 212, 4, 0, 5400,
+  216, 7, 1, 5416, 223, 1, 0, 5420, 224, 36, 1, 5424,
+  260, 5, 0, 5428, 265, 39, 1, 5448, 304, 1, 0, 5452,
+  316, 1, 0, 5456, 317, 46, 1, 5460, 363, 1, 0, 5464,
+  371, 1, 0, 5468, 372, 47, 1, 5472, 419, 1, 0, 5476,
+  8, 97, 1, 5480, 105, 1, 0, 5484, 112, 9, 1, 5488,
+  121, 1, 0, 5492, 122, 35, 1, 5496, 157, 4, 0, 5500,
+  161, 47, 1, 5516, 208, 1, 0, 5520, 212, 4, 0, 5524,
+  216, 8, 1, 5540, 224, 1, 0, 5544, 225, 35, 1, 5548,
+  260, 5, 0, 5552, 265, 38, 1, 5572, 303, 1, 0, 5576,
+  316, 1, 0, 5580, 317, 46, 1, 5584, 363, 1, 0, 5588,
+  371, 1, 0, 5592, 372, 47, 1, 5596, 419, 1, 0, 5600,
+  7, 1, 0, 5604, 8, 97, 1, 5608, 105, 1, 0, 5612,
+  111, 1, 0, 5616, 112, 9, 1, 5620, 121, 2, 0, 5624,
+  123, 34, 1, 5632, 157, 4, 0, 5636, 161, 48, 1, 5652,
+  212, 4, 0, 5656, 216, 8, 1, 5672, 224, 1, 0, 5676,
+  225, 35, 1, 5680, 260, 5, 0, 5684, 265, 37, 1, 5704,
+  302, 1, 0, 5708, 316, 1, 0, 5712, 317, 47, 1, 5716,
+  364, 1, 0, 5720, 371, 48, 1, 5724, 419, 1, 0, 5728,
+  7, 1, 0, 5732, 8, 97, 1, 5736, 105, 1, 0, 5740,
+  111, 1, 0, 5744, 112, 10, 1, 5748, 122, 2, 0, 5752,
+  124, 33, 1, 5760, 157, 4, 0, 5764, 161, 48, 1, 5780,
+  209, 1, 0, 5784, 212, 3, 0, 5788, 215, 10, 1, 5800,
+  225, 1, 0, 5804, 226, 35, 1, 5808, 261, 4, 0, 5812,
+  265, 36, 1, 5828, 301, 1, 0, 5832, 316, 1, 0, 5836,
+  317, 47, 1, 5840, 364, 1, 0, 5844, 370, 1, 0, 5848,
+  371, 48, 1, 5852, 419, 1, 0, 5856, 7, 1, 0, 5860,
+  8, 98, 1, 5864, 106, 1, 0, 5868, 111, 12, 1, 5872,
+  123, 2, 0, 5876, 125, 33, 1, 5884, 158, 3, 0, 5888,
+  161, 48, 1, 5900, 209, 1, 0, 5904, 212, 3, 0, 5908,
+  215, 11, 1, 5920, 226, 1, 0, 5924, 227, 34, 1, 5928,
+  261, 4, 0, 5932, 265, 35, 1, 5948, 300, 1, 0, 5952,
+  316, 1, 0, 5956, 317, 47, 1, 5960, 364, 1, 0, 5964,
+  370, 1, 0, 5968, 371, 48, 1, 5972, 419, 1, 0, 5976,
+  6, 1, 0, 5980, 7, 99, 1, 5984, 106, 1, 0, 5988,
+  110, 1, 0, 5992, 111, 13, 1, 5996, 124, 2, 0, 6000,
+  126, 32, 1, 6008, 158, 3, 0, 6012, 161, 49, 1, 6024,
+  212, 3, 0, 6028, 215, 12, 1, 6040, 227, 2, 0, 6044,
+  229, 32, 1, 6052, 261, 4, 0, 6056, 265, 34, 1, 6072,
+  299, 1, 0, 6076, 316, 1, 0, 6080, 317, 48, 1, 6084,
+  365, 1, 0, 6088, 370, 1, 0, 6092, 371, 48, 1, 6096,
+  419, 1, 0, 6100, 6, 1, 0, 6104, 7, 99, 1, 6108,
+  106, 1, 0, 6112, 110, 1, 0, 6116, 111, 14, 1, 6120,
+  125, 2, 0, 6124, 127, 31, 1, 6132, 158, 3, 0, 6136,
+  161, 49, 1, 6148, 210, 1, 0, 6152, 212, 2, 0, 6156,
+  214, 14, 1, 6164, 228, 1, 0, 6168, 229, 33, 1, 6172,
+  262, 3, 0, 6176, 265, 33, 1, 6188, 298, 1, 0, 6192,
+  316, 1, 0, 6196, 317, 48, 1, 6200, 365, 1, 0, 6204,
+  369, 1, 0, 6208, 370, 49, 1, 6212, 419, 1, 0, 6216,
+  6, 1, 0, 6220, 7, 99, 1, 6224, 106, 1, 0, 6228,
+  110, 1, 0, 6232, 111, 16, 1, 6236, 127, 2, 0, 6240,
+  129, 30, 1, 6248, 159, 2, 0, 6252, 161, 49, 1, 6260,
+  210, 1, 0, 6264, 212, 2, 0, 6268, 214, 15, 1, 6276,
+  229, 1, 0, 6280, 230, 32, 1, 6284, 262, 3, 0, 6288,
+  265, 32, 1, 6300, 297, 1, 0, 6304, 316, 1, 0, 6308,
+  317, 48, 1, 6312, 365, 1, 0, 6316, 369, 1, 0, 6320,
+  370, 49, 1, 6324, 419, 1, 0, 6328, 6, 1, 0, 6332,
+  7, 100, 1, 6336, 107, 1, 0, 6340, 110, 18, 1, 6344,
+  128, 2, 0, 6348, 130, 29, 1, 6356, 159, 2, 0, 6360,
+  161, 49, 1, 6368, 210, 1, 0, 6372, 212, 2, 0, 6376,
+  214, 16, 1, 6384, 230, 2, 0, 6388, 232, 30, 1, 6396,
+  262, 3, 0, 6400, 265, 31, 1, 6412, 296, 1, 0, 6416,
+  316, 1, 0, 6420, 317, 48, 1, 6424, 365, 1, 0, 6428,
+  369, 1, 0, 6432, 370, 49, 1, 6436, 419, 1, 0, 6440,
+  5, 1, 0, 6444, 6, 101, 1, 6448, 107, 1, 0, 6452,
+  110, 19, 1, 6456, 129, 2, 0, 6460, 131, 27, 1, 6468,
+  158, 3, 0, 6472, 161, 49, 1, 6484, 210, 1, 0, 6488,
+  212, 2, 0, 6492, 214, 18, 1, 6500, 232, 1, 0, 6504,
+  233, 30, 1, 6508, 263, 2, 0, 6512, 265, 30, 1, 6520,
+  295, 1, 0, 6524, 316, 1, 0, 6528, 317, 49, 1, 6532,
+  366, 1, 0, 6536, 369, 50, 1, 6540, 419, 1, 0, 6544,
+  5, 1, 0, 6548, 6, 101, 1, 6552, 107, 1, 0, 6556,
+  109, 1, 0, 6560, 110, 20, 1, 6564, 130, 2, 0, 6568,
+  132, 27, 1, 6576, 159, 2, 0, 6580, 161, 49, 1, 6588,
+  210, 1, 0, 6592, 212, 1, 0, 6596, 213, 20, 1, 6600,
+  233, 1, 0, 6604, 234, 29, 1, 6608, 263, 2, 0, 6612,
+  265, 28, 1, 6620, 293, 1, 0, 6624, 316, 1, 0, 6628,
+  317, 49, 1, 6632, 366, 1, 0, 6636, 368, 1, 0, 6640,
+  369, 50, 1, 6644, 419, 1, 0, 6648, 5, 1, 0, 6652,
+  6, 101, 1, 6656, 107, 1, 0, 6660, 109, 1, 0, 6664,
+  110, 22, 1, 6668, 132, 2, 0, 6672, 134, 25, 1, 6680,
+  159, 2, 0, 6684, 161, 50, 1, 6692, 211, 2, 0, 6696,
+  213, 21, 1, 6704, 234, 2, 0, 6708, 236, 27, 1, 6716,
+  263, 2, 0, 6720, 265, 26, 1, 6728, 291, 2, 0, 6732,
+  316, 1, 0, 6740, 317, 49, 1, 6744, 366, 1, 0, 6748,
+  368, 1, 0, 6752, 369, 50, 1, 6756, 419, 1, 0, 6760,
+  5, 1, 0, 6764, 6, 102, 1, 6768, 109, 1, 0, 6772,
+  110, 24, 1, 6776, 134, 2, 0, 6780, 136, 25, 1, 6788,
+  161, 50, 1, 6792, 211, 2, 0, 6796, 213, 23, 1, 6804,
+  236, 2, 0, 6808, 238, 25, 1, 6816, 263, 2, 0, 6820,
+  265, 25, 1, 6828, 290, 2, 0, 6832, 316, 1, 0, 6840,
+  317, 49, 1, 6844, 366, 1, 0, 6848, 368, 1, 0, 6852,
+  369, 50, 1, 6856, 419, 1, 0, 6860, 5, 1, 0, 6864,
+  6, 49, 1, 6868, 55, 3, 0, 6872, 58, 50, 1, 6884,
+  109, 1, 0, 6888, 110, 25, 1, 6892, 135, 4, 0, 6896,
+  139, 19, 1, 6912, 158, 4, 0, 6916, 162, 49, 1, 6932,
+  211, 2, 0, 6936, 213, 24, 1, 6944, 237, 2, 0, 6948,
+  239, 24, 1, 6956, 263, 2, 0, 6960, 265, 23, 1, 6968,
+  288, 2, 0, 6972, 316, 1, 0, 6980, 317, 49, 1, 6984,
+  366, 1, 0, 6988, 368, 1, 0, 6992, 369, 50, 1, 6996,
+  419, 1, 0, 7000, 5, 1, 0, 7004, 6, 47, 1, 7008,
+  53, 2, 0, 7012, 58, 2, 0, 7020, 60, 48, 1, 7028,
+  108, 2, 0, 7032, 110, 27, 1, 7040, 137, 3, 0, 7044,
+  140, 16, 1, 7056, 156, 2, 0, 7060, 162, 3, 0, 7068,
+  165, 46, 1, 7080, 211, 2, 0, 7084, 213, 26, 1, 7092,
+  239, 2, 0, 7096, 241, 21, 1, 7104, 262, 4, 0, 7108,
+  266, 20, 1, 7124, 286, 2, 0, 7128, 316, 1, 0, 7136,
+  317, 49, 1, 7140, 366, 1, 0, 7144, 368, 1, 0, 7148,
+  369, 50, 1, 7152, 419, 1, 0, 7156, 5, 1, 0, 7160,
+  6, 46, 1, 7164, 52, 1, 0, 7168, 60, 1, 0, 7172,
+  61, 47, 1, 7176, 108, 1, 0, 7180, 109, 30, 1, 7184,
+  139, 3, 0, 7188, 142, 14, 1, 7200, 156, 1, 0, 7204,
+  164, 1, 0, 7208, 165, 46, 1, 7212, 211, 2, 0, 7216,
+  213, 28, 1, 7224, 241, 2, 0, 7228, 243, 17, 1, 7236,
+  260, 2, 0, 7240, 265, 2, 0, 7248, 267, 16, 1, 7256,
+  283, 3, 0, 7260, 316, 1, 0, 7272, 317, 47, 1, 7276,
+  364, 2, 0, 7280, 369, 2, 0, 7288, 371, 48, 1, 7296,
+  419, 1, 0, 7300, 5, 1, 0, 7304, 6, 45, 1, 7308,
+  51, 1, 0, 7312, 61, 1, 0, 7316, 62, 46, 1, 7320,
+  108, 1, 0, 7324, 109, 33, 1, 7328, 142, 4, 0, 7332,
+  146, 9, 1, 7348, 155, 1, 0, 7352, 164, 1, 0, 7356,
+  165, 46, 1, 7360, 211, 2, 0, 7364, 213, 30, 1, 7372,
+  243, 3, 0, 7376, 246, 14, 1, 7388, 260, 1, 0, 7392,
+  267, 1, 0, 7396, 268, 14, 1, 7400, 282, 2, 0, 7404,
+  316, 1, 0, 7412, 317, 46, 1, 7416, 363, 1, 0, 7420,
+  371, 1, 0, 7424, 372, 47, 1, 7428, 419, 1, 0, 7432,
+  5, 46, 1, 7436, 51, 1, 0, 7440, 61, 1, 0, 7444,
+  62, 46, 1, 7448, 108, 1, 0, 7452, 109, 36, 1, 7456,
+  145, 5, 0, 7460, 150, 5, 1, 7480, 165, 1, 0, 7484,
+  166, 45, 1, 7488, 211, 2, 0, 7492, 213, 33, 1, 7500,
+  246, 2, 0, 7504, 248, 11, 1, 7512, 259, 1, 0, 7516,
+  268, 1, 0, 7520, 269, 10, 1, 7524, 279, 2, 0, 7528,
+  316, 1, 0, 7536, 317, 46, 1, 7540, 372, 1, 0, 7544,
+  373, 46, 1, 7548, 419, 1, 0, 7552, 5, 46, 1, 7556,
+  51, 1, 0, 7560, 61, 1, 0, 7564, 62, 46, 1, 7568,
+  108, 1, 0, 7572, 109, 40, 1, 7576, 149, 6, 0, 7580,
+  165, 1, 0, 7604, 166, 45, 1, 7608, 211, 2, 0, 7612,
+  213, 36, 1, 7620, 249, 4, 0, 7624, 253, 5, 1, 7640,
+  258, 1, 0, 7644, 269, 6, 1, 7648, 275, 3, 0, 7652,
+  316, 1, 0, 7664, 317, 45, 1, 7668, 362, 1, 0, 7672,
+  372, 1, 0, 7676, 373, 46, 1, 7680, 419, 1, 0, 7684,
+  5, 9, 0, 7688, 14, 34, 1, 7724, 48, 4, 0, 7728,
+  61, 1, 0, 7744, 62, 46, 1, 7748, 108, 1, 0, 7752,
+  109, 43, 1, 7756, 152, 3, 0, 7760, 165, 1, 0, 7772,
+  166, 45, 1, 7776, 211, 2, 0, 7780, 213, 39, 1, 7788,
+  252, 7, 0, 7792, 269, 5, 0, 7820, 316, 1, 0, 7840,
+  317, 45, 1, 7844, 362, 1, 0, 7848, 373, 46, 1, 7852,
+  419, 1, 0, 7856, 5, 6, 1, 7860, 11, 8, 0, 7864,
+  19, 23, 1, 7896, 42, 10, 0, 7900, 61, 1, 0, 7940,
+  62, 46, 1, 7944, 108, 1, 0, 7948, 109, 46, 1, 7952,
+  165, 1, 0, 7956, 166, 45, 1, 7960, 211, 2, 0, 7964,
+  213, 44, 1, 7972, 257, 2, 0, 7976, 269, 2, 0, 7984,
+  316, 1, 0, 7992, 317, 45, 1, 7996, 362, 1, 0, 8000,
+  373, 46, 1, 8004, 419, 1, 0, 8008, 5, 12, 1, 8012,
+  17, 5, 0, 8016, 22, 17, 1, 8036, 39, 5, 0, 8040,
+  44, 7, 1, 8060, 51, 1, 0, 8064, 61, 1, 0, 8068,
+  62, 46, 1, 8072, 108, 1, 0, 8076, 109, 46, 1, 8080,
+  155, 1, 0, 8084, 165, 1, 0, 8088, 166, 45, 1, 8092,
+  211, 2, 0, 8096, 213, 45, 1, 8104, 258, 1, 0, 8108,
+  269, 7, 0, 8112, 316, 46, 1, 8140, 362, 1, 0, 8144,
+  372, 1, 0, 8148, 373, 5, 1, 8152, 378, 3, 0, 8156,
+  381, 38, 1, 8168, 419, 1, 0, 8172, 5, 1, 0, 8176,
+  6, 15, 1, 8180, 21, 4, 0, 8184, 25, 11, 1, 8200,
+  36, 5, 0, 8204, 41, 10, 1, 8224, 51, 2, 0, 8228,
+  60, 2, 0, 8236, 62, 46, 1, 8244, 108, 1, 0, 8248,
+  109, 46, 1, 8252, 155, 1, 0, 8256, 164, 1, 0, 8260,
+  165, 46, 1, 8264, 211, 2, 0, 8268, 213, 45, 1, 8276,
+  258, 2, 0, 8280, 268, 1, 0, 8288, 269, 7, 1, 8292,
+  276, 4, 0, 8296, 316, 46, 1, 8312, 362, 1, 0, 8316,
+  372, 1, 0, 8320, 373, 9, 1, 8324, 382, 3, 0, 8328,
+  385, 34, 1, 8340, 5, 1, 0, 8344, 6, 17, 1, 8348,
+  23, 4, 0, 8352, 27, 7, 1, 8368, 34, 4, 0, 8372,
+  38, 14, 1, 8388, 52, 2, 0, 8392, 59, 2, 0, 8400,
+  61, 47, 1, 8408, 108, 1, 0, 8412, 109, 47, 1, 8416,
+  156, 2, 0, 8420, 163, 1, 0, 8428, 164, 47, 1, 8432,
+  211, 2, 0, 8436, 213, 46, 1, 8444, 259, 1, 0, 8448,
+  268, 1, 0, 8452, 269, 11, 1, 8456, 280, 3, 0, 8460,
+  316, 1, 0, 8472, 317, 46, 1, 8476, 363, 1, 0, 8480,
+  371, 2, 0, 8484, 373, 12, 1, 8492, 385, 2, 0, 8496,
+  387, 32, 1, 8504, 5, 1, 0, 8508, 6, 19, 1, 8512,
+  25, 11, 0, 8516, 36, 18, 1, 8560, 54, 5, 0, 8564,
+  59, 49, 1, 8584, 108, 1, 0, 8588, 109, 49, 1, 8592,
+  158, 5, 0, 8596, 163, 48, 1, 8616, 211, 2, 0, 8620,
+  213, 47, 1, 8628, 260, 1, 0, 8632, 266, 2, 0, 8636,
+  268, 14, 1, 8644, 282, 3, 0, 8648, 316, 1, 0, 8660,
+  317, 47, 1, 8664, 364, 1, 0, 8668, 370, 2, 0, 8672,
+  372, 15, 1, 8680, 387, 4, 1, 8684, 391, 28, 1, 8688,
+  5, 1, 0, 8692, 6, 22, 1, 8696, 28, 5, 0, 8700,
+  33, 23, 1, 8720, 56, 1, 0, 8724, 57, 51, 1, 8728,
+  109, 1, 0, 8732, 110, 101, 1, 8736, 211, 2, 0, 8740,
+  213, 49, 1, 8748, 262, 4, 0, 8752, 266, 19, 1, 8768,
+  285, 2, 0, 8772, 316, 1, 0, 8780, 317, 48, 1, 8784,
+  365, 5, 0, 8788, 370, 20, 1, 8808, 390, 1, 0, 8812,
+  391, 28, 1, 8816, 5, 1, 0, 8820, 6, 23, 1, 8824,
+  29, 3, 0, 8828, 32, 24, 1, 8840, 56, 1, 0, 8844,
+  57, 50, 1, 8848, 107, 1, 0, 8852, 109, 1, 0, 8856,
+  110, 101, 1, 8860, 211, 2, 0, 8864, 213, 50, 1, 8872,
+  263, 2, 0, 8876, 265, 22, 1, 8884, 287, 2, 0, 8888,
+  316, 1, 0, 8896, 317, 50, 1, 8900, 367, 1, 0, 8904,
+  368, 23, 1, 8908, 391, 2, 0, 8912, 393, 25, 1, 8920,
+  418, 1, 0, 8924, 5, 1, 0, 8928, 6, 22, 1, 8932,
+  28, 6, 0, 8936, 34, 22, 1, 8960, 56, 1, 0, 8964,
+  57, 50, 1, 8968, 107, 1, 0, 8972, 109, 1, 0, 8976,
+  110, 101, 1, 8980, 211, 2, 0, 8984, 213, 50, 1, 8992,
+  263, 2, 0, 8996, 265, 24, 1, 9004, 289, 2, 0, 9008,
+  316, 1, 0, 9016, 317, 50, 1, 9020, 367, 1, 0, 9024,
+  368, 26, 1, 9028, 394, 1, 0, 9032, 395, 23, 1, 9036,
+  418, 1, 0, 9040, 5, 1, 0, 9044, 6, 20, 1, 9048,
+  26, 2, 0, 9052, 28, 6, 1, 9060, 34, 1, 0, 9064,
+  35, 21, 1, 9068, 56, 1, 0, 9072, 57, 50, 1, 9076,
+  107, 1, 0, 9080, 109, 1, 0, 9084, 110, 101, 1, 9088,
+  212, 1, 0, 9092, 213, 50, 1, 9096, 263, 2, 0, 9100,
+  265, 26, 1, 9108, 291, 1, 0, 9112, 316, 1, 0, 9116,
+  317, 50, 1, 9120, 367, 2, 0, 9124, 369, 26, 1, 9132,
+  395, 1, 0, 9136, 396, 22, 1, 9140, 418, 1, 0, 9144,
+  5, 2, 0, 9148, 7, 18, 1, 9156, 25, 1, 0, 9160,
+  26, 9, 1, 9164, 35, 2, 0, 9168, 37, 19, 1, 9176,
+  56, 1, 0, 9180, 57, 50, 1, 9184, 107, 1, 0, 9188,
+  109, 1, 0, 9192, 110, 100, 1, 9196, 210, 1, 0, 9200,
+  212, 1, 0, 9204, 213, 49, 1, 9208, 262, 3, 0, 9212,
+  265, 27, 1, 9224, 292, 2, 0, 9228, 317, 50, 1, 9236,
+  367, 2, 0, 9240, 369, 27, 1, 9248, 396, 2, 0, 9252,
+  398, 20, 1, 9260, 418, 1, 0, 9264, 5, 2, 0, 9268,
+  7, 16, 1, 9276, 23, 2, 0, 9280, 25, 11, 1, 9288,
+  36, 2, 0, 9292, 38, 18, 1, 9300, 56, 1, 0, 9304,
+  57, 49, 1, 9308, 106, 1, 0, 9312, 110, 100, 1, 9316,
+  210, 1, 0, 9320, 212, 1, 0, 9324, 213, 49, 1, 9328,
+  262, 1, 0, 9332, 264, 1, 0, 9336, 265, 28, 1, 9340,
+  293, 2, 0, 9344, 317, 50, 1, 9352, 367, 2, 0, 9356,
+  369, 29, 1, 9364, 398, 1, 0, 9368, 399, 19, 1, 9372,
+  418, 1, 0, 9376, 5, 2, 0, 9380, 7, 15, 1, 9388,
+  22, 2, 0, 9392, 24, 14, 1, 9400, 38, 1, 0, 9404,
+  39, 17, 1, 9408, 56, 1, 0, 9412, 57, 49, 1, 9416,
+  106, 1, 0, 9420, 110, 1, 0, 9424, 111, 99, 1, 9428,
+  210, 1, 0, 9432, 212, 1, 0, 9436, 213, 49, 1, 9440,
+  262, 1, 0, 9444, 264, 1, 0, 9448, 265, 30, 1, 9452,
+  295, 1, 0, 9456, 317, 1, 0, 9460, 318, 49, 1, 9464,
+  367, 2, 0, 9468, 369, 30, 1, 9476, 399, 1, 0, 9480,
+  400, 18, 1, 9484, 418, 1, 0, 9488, 5, 2, 0, 9492,
+  7, 14, 1, 9500, 21, 1, 0, 9504, 22, 16, 1, 9508,
+  38, 2, 0, 9512, 40, 16, 1, 9520, 56, 1, 0, 9524,
+  57, 49, 1, 9528, 106, 1, 0, 9532, 110, 1, 0, 9536,
+  111, 99, 1, 9540, 210, 1, 0, 9544, 212, 1, 0, 9548,
+  213, 49, 1, 9552, 262, 1, 0, 9556, 264, 1, 0, 9560,
+  265, 31, 1, 9564, 296, 2, 0, 9568, 317, 1, 0, 9576,
+  318, 49, 1, 9580, 367, 2, 0, 9584, 369, 32, 1, 9592,
+  401, 1, 0, 9596, 402, 15, 1, 9600, 417, 2, 0, 9604,
+  5, 3, 0, 9612, 8, 12, 1, 9624, 20, 2, 0, 9628,
+  22, 18, 1, 9636, 40, 1, 0, 9640, 41, 15, 1, 9644,
+  56, 1, 0, 9648, 57, 49, 1, 9652, 106, 1, 0, 9656,
+  110, 1, 0, 9660, 111, 98, 1, 9664, 209, 1, 0, 9668,
+  212, 1, 0, 9672, 213, 49, 1, 9676, 264, 1, 0, 9680,
+  265, 33, 1, 9684, 298, 1, 0, 9688, 317, 1, 0, 9692,
+  318, 49, 1, 9696, 367, 3, 0, 9700, 370, 32, 1, 9712,
+  402, 1, 0, 9716, 403, 14, 1, 9720, 417, 2, 0, 9724,
+  5, 3, 0, 9732, 8, 11, 1, 9744, 19, 2, 0, 9748,
+  21, 20, 1, 9756, 41, 1, 0, 9760, 42, 14, 1, 9764,
+  56, 1, 0, 9768, 57, 48, 1, 9772, 105, 1, 0, 9776,
+  111, 98, 1, 9780, 209, 1, 0, 9784, 212, 1, 0, 9788,
+  213, 48, 1, 9792, 261, 1, 0, 9796, 264, 1, 0, 9800,
+  265, 34, 1, 9804, 299, 1, 0, 9808, 318, 1, 0, 9812,
+  319, 48, 1, 9816, 367, 3, 0, 9820, 370, 33, 1, 9832,
+  403, 2, 0, 9836, 405, 12, 1, 9844, 417, 2, 0, 9848,
+  5, 3, 0, 9856, 8, 10, 1, 9868, 18, 2, 0, 9872,
+  20, 22, 1, 9880, 42, 1, 0, 9884, 43, 13, 1, 9888,
+  56, 1, 0, 9892, 57, 48, 1, 9896, 105, 1, 0, 9900,
+  111, 1, 0, 9904, 112, 97, 1, 9908, 209, 1, 0, 9912,
+  212, 1, 0, 9916, 213, 48, 1, 9920, 261, 1, 0, 9924,
+  264, 1, 0, 9928, 265, 35, 1, 9932, 300, 1, 0, 9936,
+  318, 1, 0, 9940, 319, 48, 1, 9944, 367, 3, 0, 9948,
+  370, 34, 1, 9960, 404, 2, 0, 9964, 406, 11, 1, 9972,
+  417, 2, 0, 9976, 5, 3, 0, 9984, 8, 9, 1, 9996,
+  17, 2, 0, 10000, 19, 24, 1, 10008, 43, 1, 0, 10012,
+  44, 12, 1, 10016, 56, 1, 0, 10020, 57, 48, 1, 10024,
+  105, 1, 0, 10028, 111, 1, 0, 10032, 112, 96, 1, 10036,
+  208, 1, 0, 10040, 212, 1, 0, 10044, 213, 48, 1, 10048,
+  261, 1, 0, 10052, 264, 1, 0, 10056, 265, 36, 1, 10060,
+  301, 1, 0, 10064, 318, 1, 0, 10068, 319, 48, 1, 10072,
+  367, 3, 0, 10076, 370, 35, 1, 10088, 405, 1, 0, 10092,
+  406, 10, 1, 10096, 416, 3, 0, 10100, 5, 4, 0, 10112,
+  9, 8, 1, 10128, 17, 1, 0, 10132, 18, 25, 1, 10136,
+  43, 2, 0, 10140, 45, 11, 1, 10148, 56, 1, 0, 10152,
+  57, 47, 1, 10156, 104, 1, 0, 10160, 112, 1, 0, 10164,
+  113, 95, 1, 10168, 208, 1, 0, 10172, 212, 1, 0, 10176,
+  213, 47, 1, 10180, 260, 1, 0, 10184, 264, 1, 0, 10188,
+  265, 36, 1, 10192, 301, 2, 0, 10196, 319, 48, 1, 10204,
+  367, 4, 0, 10208, 371, 35, 1, 10224, 406, 2, 0, 10228,
+  408, 8, 1, 10236, 416, 3, 0, 10240, 5, 5, 0, 10252,
+  10, 6, 1, 10272, 16, 1, 0, 10276, 17, 28, 1, 10280,
+  45, 1, 0, 10284, 46, 10, 1, 10288, 56, 1, 0, 10292,
+  57, 47, 1, 10296, 104, 1, 0, 10300, 112, 1, 0, 10304,
+  113, 95, 1, 10308, 212, 1, 0, 10312, 213, 47, 1, 10316,
+  260, 1, 0, 10320, 264, 1, 0, 10324, 265, 37, 1, 10328,
+  302, 2, 0, 10332, 319, 1, 0, 10340, 320, 47, 1, 10344,
+  367, 4, 0, 10348, 371, 36, 1, 10364, 407, 1, 0, 10368,
+  408, 8, 1, 10372, 416, 3, 0, 10376, 5, 4, 0, 10388,
+  9, 6, 1, 10404, 15, 1, 0, 10408, 16, 29, 1, 10412,
+  45, 2, 0, 10416, 47, 9, 1, 10424, 56, 1, 0, 10428,
+  57, 47, 1, 10432, 104, 1, 0, 10436, 112, 1, 0, 10440,
+  113, 94, 1, 10444, 207, 1, 0, 10448, 212, 1, 0, 10452,
+  213, 47, 1, 10456, 264, 1, 0, 10460, 265, 38, 1, 10464,
+  303, 1, 0, 10468, 319, 1, 0, 10472, 320, 47, 1, 10476,
+  367, 5, 0, 10480, 372, 36, 1, 10500, 408, 7, 1, 10504,
+  415, 4, 0, 10508, 5, 4, 1, 10524, 9, 6, 0, 10528,
+  15, 31, 1, 10552, 46, 1, 0, 10556, 47, 9, 1, 10560,
+  56, 1, 0, 10564, 57, 46, 1, 10568, 103, 1, 0, 10572,
+  113, 1, 0, 10576, 114, 93, 1, 10580, 207, 1, 0, 10584,
+  212, 1, 0, 10588, 213, 46, 1, 10592, 259, 1, 0, 10596,
+  264, 1, 0, 10600, 265, 39, 1, 10604, 304, 1, 0, 10608,
+  320, 1, 0, 10612, 321, 46, 1, 10616, 367, 5, 0, 10620,
+  372, 36, 1, 10640, 408, 1, 0, 10644, 409, 6, 1, 10648,
+  415, 4, 0, 10652, 5, 4, 1, 10668, 9, 6, 0, 10672,
+  15, 32, 1, 10696, 47, 1, 0, 10700, 48, 8, 1, 10704,
+  56, 1, 0, 10708, 57, 46, 1, 10712, 103, 1, 0, 10716,
+  113, 1, 0, 10720, 114, 92, 1, 10724, 206, 1, 0, 10728,
+  212, 1, 0, 10732, 213, 46, 1, 10736, 259, 1, 0, 10740,
+  264, 1, 0, 10744, 265, 40, 1, 10748, 305, 1, 0, 10752,
+  320, 1, 0, 10756, 321, 46, 1, 10760, 367, 1, 0, 10764,
+  368, 4, 1, 10768, 372, 1, 0, 10772, 373, 36, 1, 10776,
+  409, 1, 0, 10780, 410, 4, 1, 10784, 414, 5, 0, 10788,
+  5, 5, 1, 10808, 10, 4, 0, 10812, 14, 33, 1, 10828,
+  47, 2, 0, 10832, 49, 7, 1, 10840, 56, 1, 0, 10844,
+  57, 45, 1, 10848, 102, 1, 0, 10852, 114, 1, 0, 10856,
+  115, 91, 1, 10860, 206, 1, 0, 10864, 212, 1, 0, 10868,
+  213, 45, 1, 10872, 258, 1, 0, 10876, 264, 1, 0, 10880,
+  265, 41, 1, 10884, 306, 1, 0, 10888, 321, 46, 1, 10892,
+  367, 1, 0, 10896, 368, 4, 1, 10900, 372, 1, 0, 10904,
+  373, 37, 1, 10908, 410, 5, 0, 10912, 415, 4, 1, 10932,
+  5, 5, 1, 10936, 10, 3, 0, 10940, 13, 35, 1, 10952,
+  48, 1, 0, 10956, 49, 7, 1, 10960, 56, 1, 0, 10964,
+  57, 45, 1, 10968, 102, 1, 0, 10972, 114, 1, 0, 10976,
+  115, 90, 1, 10980, 205, 1, 0, 10984, 212, 1, 0, 10988,
+  213, 45, 1, 10992, 258, 1, 0, 10996, 264, 1, 0, 11000,
+  265, 41, 1, 11004, 306, 1, 0, 11008, 321, 1, 0, 11012,
+  322, 45, 1, 11016, 367, 1, 0, 11020, 368, 5, 1, 11024,
+  373, 1, 0, 11028, 374, 36, 1, 11032, 410, 5, 0, 11036,
+  415, 4, 1, 11056, 5, 6, 1, 11060, 11, 1, 0, 11064,
+  12, 37, 1, 11068, 49, 1, 0, 11072, 50, 6, 1, 11076,
+  56, 1, 0, 11080, 57, 44, 1, 11084, 101, 1, 0, 11088,
+  115, 1, 0, 11092, 116, 89, 1, 11096, 205, 1, 0, 11100,
+  212, 1, 0, 11104, 213, 44, 1, 11108, 257, 1, 0, 11112,
+  264, 1, 0, 11116, 265, 42, 1, 11120, 307, 1, 0, 11124,
+  322, 45, 1, 11128, 367, 1, 0, 11132, 368, 5, 1, 11136,
+  373, 1, 0, 11140, 374, 37, 1, 11144, 411, 3, 0, 11148,
+  414, 5, 1, 11160, 5, 6, 1, 11164, 11, 1, 0, 11168,
+  12, 37, 1, 11172, 49, 1, 0, 11176, 50, 6, 1, 11180,
+  56, 1, 0, 11184, 57, 43, 1, 11188, 100, 2, 0, 11192,
+  115, 1, 0, 11200, 116, 88, 1, 11204, 204, 1, 0, 11208,
+  212, 1, 0, 11212, 213, 44, 1, 11216, 257, 1, 0, 11220,
+  264, 1, 0, 11224, 265, 43, 1, 11228, 308, 1, 0, 11232,
+  322, 1, 0, 11236, 323, 44, 1, 11240, 367, 1, 0, 11244,
+  368, 6, 1, 11248, 374, 38, 1, 11252, 412, 1, 0, 11256,
+  413, 6, 1, 11260, 5, 5, 1, 11264, 10, 3, 0, 11268,
+  13, 37, 1, 11280, 50, 1, 0, 11284, 51, 5, 1, 11288,
+  56, 1, 0, 11292, 57, 43, 1, 11296, 100, 1, 0, 11300,
+  116, 1, 0, 11304, 117, 86, 1, 11308, 203, 2, 0, 11312,
+  212, 1, 0, 11320, 213, 43, 1, 11324, 256, 1, 0, 11328,
+  264, 1, 0, 11332, 265, 43, 1, 11336, 308, 1, 0, 11340,
+  323, 1, 0, 11344, 324, 43, 1, 11348, 367, 1, 0, 11352,
+  368, 6, 1, 11356, 374, 1, 0, 11360, 375, 37, 1, 11364,
+  412, 1, 0, 11368, 413, 6, 1, 11372, 5, 5, 1, 11376,
+  10, 4, 0, 11380, 14, 36, 1, 11396, 50, 2, 0, 11400,
+  52, 4, 1, 11408, 56, 1, 0, 11412, 57, 42, 1, 11416,
+  99, 1, 0, 11420, 117, 1, 0, 11424, 118, 84, 1, 11428,
+  202, 2, 0, 11432, 212, 1, 0, 11440, 213, 42, 1, 11444,
+  255, 1, 0, 11448, 264, 1, 0, 11452, 265, 44, 1, 11456,
+  309, 1, 0, 11460, 323, 1, 0, 11464, 324, 43, 1, 11468,
+  367, 1, 0, 11472, 368, 7, 1, 11476, 375, 1, 0, 11480,
+  376, 36, 1, 11484, 412, 2, 0, 11488, 414, 5, 1, 11496,
+  5, 4, 1, 11500, 9, 5, 0, 11504, 14, 37, 1, 11524,
+  51, 1, 0, 11528, 52, 4, 1, 11532, 56, 1, 0, 11536,
+  57, 42, 1, 11540, 99, 1, 0, 11544, 117, 1, 0, 11548,
+  118, 84, 1, 11552, 202, 1, 0, 11556, 212, 1, 0, 11560,
+  213, 42, 1, 11564, 255, 1, 0, 11568, 264, 1, 0, 11572,
+  265, 44, 1, 11576, 309, 1, 0, 11580, 324, 1, 0, 11584,
+  325, 42, 1, 11588, 367, 1, 0, 11592, 368, 7, 1, 11596,
+  375, 1, 0, 11600, 376, 35, 1, 11604, 411, 3, 0, 11608,
+  414, 5, 1, 11620, 5, 4, 1, 11624, 9, 1, 0, 11628,
+  10, 4, 1, 11632, 14, 1, 0, 11636, 15, 36, 1, 11640,
+  51, 1, 0, 11644, 52, 4, 1, 11648, 56, 1, 0, 11652,
+  57, 41, 1, 11656, 98, 1, 0, 11660, 118, 2, 0, 11664,
+  120, 81, 1, 11672, 201, 2, 0, 11676, 212, 1, 0, 11684,
+  213, 41, 1, 11688, 254, 1, 0, 11692, 264, 1, 0, 11696,
+  265, 45, 1, 11700, 310, 1, 0, 11704, 325, 1, 0, 11708,
+  326, 41, 1, 11712, 367, 1, 0, 11716, 368, 8, 1, 11720,
+  376, 1, 0, 11724, 377, 33, 1, 11728, 410, 5, 0, 11732,
+  415, 4, 1, 11752, 5, 5, 0, 11756, 10, 4, 1, 11776,
+  14, 2, 0, 11780, 16, 36, 1, 11788, 52, 5, 0, 11792,
+  57, 40, 1, 11812, 97, 1, 0, 11816, 119, 1, 0, 11820,
+  120, 81, 1, 11824, 201, 1, 0, 11828, 212, 1, 0, 11832,
+  213, 40, 1, 11836, 253, 1, 0, 11840, 264, 1, 0, 11844,
+  265, 45, 1, 11848, 310, 1, 0, 11852, 325, 1, 0, 11856,
+  326, 41, 1, 11860, 367, 1, 0, 11864, 368, 9, 1, 11868,
+  377, 1, 0, 11872, 378, 32, 1, 11876, 410, 4, 1, 11880,
+  414, 5, 0, 11884, 5, 5, 0, 11904, 10, 5, 1, 11924,
+  15, 1, 0, 11928, 16, 36, 1, 11932, 52, 5, 0, 11936,
+  57, 39, 1, 11956, 96, 1, 0, 11960, 119, 2, 0, 11964,
+  121, 78, 1, 11972, 199, 2, 0, 11976, 212, 1, 0, 11984,
+  213, 40, 1, 11988, 253, 1, 0, 11992, 264, 1, 0, 11996,
+  265, 46, 1, 12000, 311, 1, 0, 12004, 326, 1, 0, 12008,
+  327, 40, 1, 12012, 367, 1, 0, 12016, 368, 10, 1, 12020,
+  378, 31, 1, 12024, 409, 1, 0, 12028, 410, 5, 1, 12032,
+  415, 4, 0, 12036, 5, 4, 0, 12052, 9, 7, 1, 12068,
+  16, 1, 0, 12072, 17, 36, 1, 12076, 53, 4, 0, 12080,
+  57, 38, 1, 12096, 95, 2, 0, 12100, 120, 2, 0, 12108,
+  122, 77, 1, 12116, 199, 1, 0, 12120, 212, 1, 0, 12124,
+  213, 39, 1, 12128, 252, 1, 0, 12132, 264, 1, 0, 12136,
+  265, 46, 1, 12140, 311, 1, 0, 12144, 327, 1, 0, 12148,
+  328, 39, 1, 12152, 367, 1, 0, 12156, 368, 10, 1, 12160,
+  378, 1, 0, 12164, 379, 29, 1, 12168, 408, 1, 0, 12172,
+  409, 6, 1, 12176, 415, 4, 0, 12180, 5, 3, 0, 12196,
+  8, 9, 1, 12208, 17, 1, 0, 12212, 18, 35, 1, 12216,
+  53, 4, 0, 12220, 57, 38, 1, 12236, 95, 1, 0, 12240,
+  121, 1, 0, 12244, 122, 76, 1, 12248, 198, 1, 0, 12252,
+  212, 1, 0, 12256, 213, 38, 1, 12260, 251, 1, 0, 12264,
+  264, 1, 0, 12268, 265, 47, 1, 12272, 312, 1, 0, 12276,
+  328, 1, 0, 12280, 329, 38, 1, 12284, 367, 1, 0, 12288,
+  368, 11, 1, 12292, 379, 1, 0, 12296, 380, 27, 1, 12300,
+  407, 1, 0, 12304, 408, 7, 1, 12308, 415, 4, 0, 12312,
+  5, 3, 0, 12328, 8, 10, 1, 12340, 18, 1, 0, 12344,
+  19, 34, 1, 12348, 53, 4, 0, 12352, 57, 37, 1, 12368,
+  94, 1, 0, 12372, 122, 1, 0, 12376, 123, 74, 1, 12380,
+  197, 1, 0, 12384, 212, 1, 0, 12388, 213, 37, 1, 12392,
+  250, 1, 0, 12396, 264, 1, 0, 12400, 265, 47, 1, 12404,
+  312, 1, 0, 12408, 329, 1, 0, 12412, 330, 37, 1, 12416,
+  367, 1, 0, 12420, 368, 12, 1, 12424, 380, 1, 0, 12428,
+  381, 25, 1, 12432, 406, 1, 0, 12436, 407, 9, 1, 12440,
+  416, 3, 0, 12444, 5, 3, 0, 12456, 8, 11, 1, 12468,
+  19, 1, 0, 12472, 20, 34, 1, 12476, 54, 3, 0, 12480,
+  57, 36, 1, 12492, 93, 1, 0, 12496, 123, 1, 0, 12500,
+  124, 72, 1, 12504, 196, 1, 0, 12508, 212, 1, 0, 12512,
+  213, 36, 1, 12516, 249, 1, 0, 12520, 264, 1, 0, 12524,
+  265, 47, 1, 12528, 312, 1, 0, 12532, 329, 1, 0, 12536,
+  330, 37, 1, 12540, 367, 1, 0, 12544, 368, 13, 1, 12548,
+  381, 1, 0, 12552, 382, 23, 1, 12556, 405, 2, 0, 12560,
+  407, 9, 1, 12568, 416, 3, 0, 12572, 5, 3, 0, 12584,
+  8, 12, 1, 12596, 20, 1, 0, 12600, 21, 33, 1, 12604,
+  54, 3, 0, 12608, 57, 35, 1, 12620, 92, 1, 0, 12624,
+  124, 1, 0, 12628, 125, 70, 1, 12632, 195, 2, 0, 12636,
+  212, 1, 0, 12644, 213, 35, 1, 12648, 248, 1, 0, 12652,
+  264, 1, 0, 12656, 265, 47, 1, 12660, 312, 2, 0, 12664,
+  330, 1, 0, 12672, 331, 36, 1, 12676, 367, 1, 0, 12680,
+  368, 14, 1, 12684, 382, 1, 0, 12688, 383, 21, 1, 12692,
+  404, 1, 0, 12696, 405, 11, 1, 12700, 416, 3, 0, 12704,
+  5, 2, 0, 12716, 7, 14, 1, 12724, 21, 1, 0, 12728,
+  22, 32, 1, 12732, 54, 3, 0, 12736, 57, 33, 1, 12748,
+  90, 2, 0, 12752, 125, 1, 0, 12760, 126, 68, 1, 12764,
+  194, 1, 0, 12768, 212, 1, 0, 12772, 213, 34, 1, 12776,
+  247, 1, 0, 12780, 264, 1, 0, 12784, 265, 48, 1, 12788,
+  313, 1, 0, 12792, 331, 2, 0, 12796, 333, 34, 1, 12804,
+  367, 1, 0, 12808, 368, 15, 1, 12812, 383, 1, 0, 12816,
+  384, 19, 1, 12820, 403, 1, 0, 12824, 404, 13, 1, 12828,
+  417, 2, 0, 12832, 5, 2, 0, 12840, 7, 15, 1, 12848,
+  22, 1, 0, 12852, 23, 32, 1, 12856, 55, 2, 0, 12860,
+  57, 32, 1, 12868, 89, 2, 0, 12872, 126, 2, 0, 12880,
+  128, 65, 1, 12888, 193, 1, 0, 12892, 212, 1, 0, 12896,
+  213, 33, 1, 12900, 246, 1, 0, 12904, 264, 1, 0, 12908,
+  265, 48, 1, 12912, 313, 1, 0, 12916, 332, 1, 0, 12920,
+  333, 34, 1, 12924, 367, 1, 0, 12928, 368, 16, 1, 12932,
+  384, 1, 0, 12936, 385, 17, 1, 12940, 402, 1, 0, 12944,
+  403, 14, 1, 12948, 417, 2, 0, 12952, 5, 2, 0, 12960,
+  7, 16, 1, 12968, 23, 1, 0, 12972, 24, 31, 1, 12976,
+  55, 2, 0, 12980, 57, 31, 1, 12988, 88, 2, 0, 12992,
+  127, 2, 0, 13000, 129, 63, 1, 13008, 192, 1, 0, 13012,
+  212, 1, 0, 13016, 213, 31, 1, 13020, 244, 2, 0, 13024,
+  264, 1, 0, 13032, 265, 48, 1, 13036, 313, 1, 0, 13040,
+  333, 2, 0, 13044, 335, 32, 1, 13052, 367, 1, 0, 13056,
+  368, 17, 1, 13060, 385, 1, 0, 13064, 386, 15, 1, 13068,
+  401, 1, 0, 13072, 402, 15, 1, 13076, 417, 2, 0, 13080,
+  5, 1, 0, 13088, 6, 18, 1, 13092, 24, 2, 0, 13096,
+  26, 29, 1, 13104, 55, 2, 0, 13108, 57, 30, 1, 13116,
+  87, 1, 0, 13120, 129, 1, 0, 13124, 130, 61, 1, 13128,
+  191, 1, 0, 13132, 212, 1, 0, 13136, 213, 31, 1, 13140,
+  244, 1, 0, 13144, 264, 1, 0, 13148, 265, 49, 1, 13152,
+  314, 1, 0, 13156, 335, 1, 0, 13160, 336, 31, 1, 13164,
+  367, 1, 0, 13168, 368, 18, 1, 13172, 386, 1, 0, 13176,
+  387, 13, 1, 13180, 400, 1, 0, 13184, 401, 16, 1, 13188,
+  417, 2, 0, 13192, 5, 1, 0, 13200, 6, 20, 1, 13204,
+  26, 1, 0, 13208, 27, 28, 1, 13212, 55, 2, 0, 13216,
+  57, 29, 1, 13224, 86, 1, 0, 13228, 130, 1, 0, 13232,
+  131, 58, 1, 13236, 189, 1, 0, 13240, 212, 1, 0, 13244,
+  213, 30, 1, 13248, 243, 1, 0, 13252, 264, 1, 0, 13256,
+  265, 49, 1, 13260, 314, 1, 0, 13264, 336, 1, 0, 13268,
+  337, 30, 1, 13272, 367, 1, 0, 13276, 368, 19, 1, 13280,
+  387, 1, 0, 13284, 388, 11, 1, 13288, 399, 1, 0, 13292,
+  400, 18, 1, 13296, 418, 1, 0, 13300, 5, 1, 0, 13304,
+  6, 21, 1, 13308, 27, 2, 0, 13312, 29, 26, 1, 13320,
+  55, 2, 0, 13324, 57, 27, 1, 13332, 84, 2, 0, 13336,
+  131, 2, 0, 13344, 133, 55, 1, 13352, 188, 1, 0, 13356,
+  212, 1, 0, 13360, 213, 28, 1, 13364, 241, 2, 0, 13368,
+  264, 1, 0, 13376, 265, 49, 1, 13380, 314, 1, 0, 13384,
+  337, 1, 0, 13388, 338, 29, 1, 13392, 367, 1, 0, 13396,
+  368, 21, 1, 13400, 389, 1, 0, 13404, 390, 7, 1, 13408,
+  397, 2, 0, 13412, 399, 19, 1, 13420, 418, 1, 0, 13424,
+  5, 1, 0, 13428, 6, 22, 1, 13432, 28, 2, 0, 13436,
+  30, 26, 1, 13444, 56, 1, 0, 13448, 57, 25, 1, 13452,
+  82, 2, 0, 13456, 133, 1, 0, 13464, 134, 51, 1, 13468,
+  185, 3, 0, 13472, 212, 1, 0, 13484, 213, 27, 1, 13488,
+  240, 1, 0, 13492, 264, 1, 0, 13496, 265, 50, 1, 13500,
+  339, 1, 0, 13504, 340, 27, 1, 13508, 367, 1, 0, 13512,
+  368, 22, 1, 13516, 390, 1, 0, 13520, 391, 5, 1, 13524,
+  396, 1, 0, 13528, 397, 21, 1, 13532, 418, 1, 0, 13536,
+  5, 1, 0, 13540, 6, 24, 1, 13544, 30, 2, 0, 13548,
+  32, 24, 1, 13556, 56, 1, 0, 13560, 57, 23, 1, 13564,
+  80, 2, 0, 13568, 135, 1, 0, 13576, 136, 48, 1, 13580,
+  184, 2, 0, 13584, 212, 1, 0, 13592, 213, 25, 1, 13596,
+  238, 2, 0, 13600, 264, 1, 0, 13608, 265, 50, 1, 13612,
+  340, 2, 0, 13616, 342, 25, 1, 13624, 367, 1, 0, 13628,
+  368, 24, 1, 13632, 392, 4, 0, 13636, 396, 22, 1, 13652,
+  418, 1, 0, 13656, 5, 1, 0, 13660, 6, 26, 1, 13664,
+  32, 2, 0, 13668, 34, 22, 1, 13676, 56, 1, 0, 13680,
+  57, 21, 1, 13684, 78, 3, 0, 13688, 136, 2, 0, 13700,
+  138, 44, 1, 13708, 182, 2, 0, 13712, 212, 1, 0, 13720,
+  213, 23, 1, 13724, 236, 2, 0, 13728, 264, 1, 0, 13736,
+  265, 50, 1, 13740, 315, 1, 0, 13744, 342, 2, 0, 13748,
+  344, 23, 1, 13756, 367, 1, 0, 13760, 368, 24, 1, 13764,
+  392, 3, 0, 13768, 395, 23, 1, 13780, 418, 1, 0, 13784,
+  5, 1, 0, 13788, 6, 28, 1, 13792, 34, 2, 0, 13796,
+  36, 20, 1, 13804, 56, 1, 0, 13808, 57, 19, 1, 13812,
+  76, 3, 0, 13816, 139, 2, 0, 13828, 141, 39, 1, 13836,
+  180, 2, 0, 13840, 212, 1, 0, 13848, 213, 21, 1, 13852,
+  234, 2, 0, 13856, 264, 1, 0, 13864, 265, 50, 1, 13868,
+  315, 1, 0, 13872, 344, 2, 0, 13876, 346, 21, 1, 13884,
+  367, 1, 0, 13888, 368, 22, 1, 13892, 390, 7, 0, 13896,
+  397, 21, 1, 13924, 418, 1, 0, 13928, 5, 1, 0, 13932,
+  6, 30, 1, 13936, 36, 3, 0, 13940, 39, 35, 1, 13952,
+  74, 2, 0, 13956, 141, 3, 0, 13964, 144, 32, 1, 13976,
+  176, 4, 0, 13980, 212, 1, 0, 13996, 213, 19, 1, 14000,
+  232, 2, 0, 14004, 264, 1, 0, 14012, 265, 50, 1, 14016,
+  315, 1, 0, 14020, 346, 2, 0, 14024, 348, 19, 1, 14032,
+  367, 1, 0, 14036, 368, 20, 1, 14040, 388, 3, 0, 14044,
+  391, 6, 1, 14056, 397, 3, 0, 14060, 400, 19, 1, 14072,
+  5, 1, 0, 14076, 6, 33, 1, 14080, 39, 2, 0, 14084,
+  41, 15, 1, 14092, 56, 1, 0, 14096, 57, 13, 1, 14100,
+  70, 4, 0, 14104, 144, 3, 0, 14120, 147, 27, 1, 14132,
+  174, 3, 0, 14136, 212, 1, 0, 14148, 213, 16, 1, 14152,
+  229, 3, 0, 14156, 264, 1, 0, 14168, 265, 50, 1, 14172,
+  315, 1, 0, 14176, 348, 2, 0, 14180, 350, 17, 1, 14188,
+  367, 1, 0, 14192, 368, 17, 1, 14196, 385, 3, 0, 14200,
+  388, 11, 1, 14212, 399, 3, 0, 14216, 402, 17, 1, 14228,
+  5, 37, 1, 14232, 42, 3, 0, 14236, 45, 22, 1, 14248,
+  67, 4, 0, 14252, 147, 2, 0, 14268, 149, 20, 1, 14276,
+  169, 5, 0, 14280, 212, 1, 0, 14300, 213, 14, 1, 14304,
+  227, 2, 0, 14308, 264, 1, 0, 14316, 265, 50, 1, 14320,
+  315, 1, 0, 14324, 351, 2, 0, 14328, 353, 14, 1, 14336,
+  367, 1, 0, 14340, 368, 15, 1, 14344, 383, 3, 0, 14348,
+  386, 15, 1, 14360, 401, 3, 0, 14364, 404, 15, 1, 14376,
+  5, 41, 1, 14380, 46, 5, 0, 14384, 51, 9, 1, 14404,
+  60, 6, 0, 14408, 151, 18, 0, 14432, 212, 1, 0, 14504,
+  213, 8, 1, 14508, 221, 5, 0, 14512, 264, 1, 0, 14532,
+  265, 50, 1, 14536, 315, 1, 0, 14540, 354, 3, 0, 14544,
+  357, 10, 1, 14556, 367, 1, 0, 14560, 368, 11, 1, 14564,
+  379, 4, 0, 14568, 383, 22, 1, 14584, 405, 3, 0, 14588,
+  408, 11, 1, 14600, 5, 45, 1, 14604, 50, 7, 0, 14608,
+  212, 10, 0, 14636, 264, 1, 0, 14676, 265, 50, 1, 14680,
+  315, 1, 0, 14684, 358, 10, 0, 14688, 368, 4, 1, 14728,
+  372, 8, 0, 14732, 380, 27, 1, 14764, 407, 8, 0, 14768,
+  415, 4, 1, 14800, 419, 1, 0, 14804, 5, 51, 1, 14808,
+  56, 1, 0, 14812, 367, 3, 0, 14816, 370, 47, 1, 14828,
+  417, 3, 0, 14832, 5, 51, 1, 14844, 56, 1, 0, 14848,
+  367, 1, 0, 14852, 368, 51, 1, 14856, 419, 1, 0, 14860,
+  5, 51, 1, 14864, 56, 1, 0, 14868, 367, 1, 0, 14872,
+  368, 51, 1, 14876, 419, 1, 0, 14880, 5, 51, 1, 14884,
+  56, 1, 0, 14888, 367, 1, 0, 14892, 368, 51, 1, 14896,
+  5, 51, 1, 14900, 56, 1, 0, 14904, 367, 1, 0, 14908,
+  368, 51, 1, 14912, 5, 51, 1, 14916, 367, 1, 0, 14920,
+  368, 51, 1, 14924, 5, 50, 1, 14928, 55, 1, 0, 14932,
+  367, 1, 0, 14936, 368, 50, 1, 14940, 418, 1, 0, 14944,
+  5, 50, 1, 14948, 55, 1, 0, 14952, 367, 1, 0, 14956,
+  368, 50, 1, 14960, 418, 1, 0, 14964, 5, 50, 1, 14968,
+  55, 1, 0, 14972, 367, 1, 0, 14976, 368, 50, 1, 14980,
+  418, 1, 0, 14984, 5, 50, 1, 14988, 55, 1, 0, 14992,
+  367, 1, 0, 14996, 368, 50, 1, 15000, 418, 1, 0, 15004,
+  5, 50, 1, 15008, 55, 1, 0, 15012, 367, 1, 0, 15016,
+  368, 50, 1, 15020, 418, 1, 0, 15024, 5, 50, 1, 15028,
+  367, 1, 0, 15032, 368, 50, 1, 15036, 5, 49, 1, 15040,
+  54, 1, 0, 15044, 367, 1, 0, 15048, 368, 49, 1, 15052,
+  417, 1, 0, 15056, 5, 49, 1, 15060, 54, 1, 0, 15064,
+  367, 1, 0, 15068, 368, 49, 1, 15072, 417, 1, 0, 15076,
+  5, 49, 1, 15080, 54, 1, 0, 15084, 367, 1, 0, 15088,
+  368, 49, 1, 15092, 417, 1, 0, 15096, 5, 48, 1, 15100,
+  53, 1, 0, 15104, 367, 1, 0, 15108, 368, 49, 1, 15112,
+  5, 48, 1, 15116, 53, 1, 0, 15120, 367, 1, 0, 15124,
+  368, 48, 1, 15128, 416, 1, 0, 15132, 5, 48, 1, 15136,
+  53, 1, 0, 15140, 367, 1, 0, 15144, 368, 48, 1, 15148,
+  416, 1, 0, 15152, 5, 47, 1, 15156, 52, 1, 0, 15160,
+  367, 1, 0, 15164, 368, 48, 1, 15168, 5, 47, 1, 15172,
+  52, 1, 0, 15176, 367, 1, 0, 15180, 368, 47, 1, 15184,
+  415, 1, 0, 15188, 5, 46, 1, 15192, 51, 1, 0, 15196,
+  367, 1, 0, 15200, 368, 47, 1, 15204, 5, 46, 1, 15208,
+  51, 1, 0, 15212, 367, 1, 0, 15216, 368, 46, 1, 15220,
+  414, 1, 0, 15224, 5, 45, 1, 15228, 50, 1, 0, 15232,
+  367, 1, 0, 15236, 368, 46, 1, 15240, 414, 1, 0, 15244,
+  5, 45, 1, 15248, 50, 1, 0, 15252, 367, 1, 0, 15256,
+  368, 45, 1, 15260, 413, 1, 0, 15264, 5, 44, 1, 15268,
+  49, 1, 0, 15272, 367, 1, 0, 15276, 368, 45, 1, 15280,
+  413, 1, 0, 15284, 5, 44, 1, 15288, 49, 1, 0, 15292,
+  367, 1, 0, 15296, 368, 44, 1, 15300, 412, 1, 0, 15304,
+  5, 43, 1, 15308, 48, 1, 0, 15312, 367, 1, 0, 15316,
+  368, 44, 1, 15320, 5, 42, 1, 15324, 47, 1, 0, 15328,
+  367, 1, 0, 15332, 368, 43, 1, 15336, 411, 1, 0, 15340,
+  5, 42, 1, 15344, 47, 1, 0, 15348, 367, 1, 0, 15352,
+  368, 42, 1, 15356, 410, 1, 0, 15360, 5, 41, 1, 15364,
+  46, 1, 0, 15368, 367, 1, 0, 15372, 368, 41, 1, 15376,
+  409, 2, 0, 15380, 5, 40, 1, 15388, 45, 1, 0, 15392,
+  367, 1, 0, 15396, 368, 41, 1, 15400, 409, 1, 0, 15404,
+  5, 40, 1, 15408, 45, 1, 0, 15412, 367, 1, 0, 15416,
+  368, 40, 1, 15420, 408, 1, 0, 15424, 5, 39, 1, 15428,
+  44, 1, 0, 15432, 367, 1, 0, 15436, 368, 39, 1, 15440,
+  407, 1, 0, 15444, 5, 38, 1, 15448, 43, 1, 0, 15452,
+  367, 1, 0, 15456, 368, 39, 1, 15460, 407, 1, 0, 15464,
+  5, 37, 1, 15468, 42, 1, 0, 15472, 367, 1, 0, 15476,
+  368, 38, 1, 15480, 406, 1, 0, 15484, 5, 36, 1, 15488,
+  41, 1, 0, 15492, 367, 1, 0, 15496, 368, 37, 1, 15500,
+  405, 1, 0, 15504, 5, 35, 1, 15508, 40, 1, 0, 15512,
+  367, 1, 0, 15516, 368, 36, 1, 15520, 404, 1, 0, 15524,
+  5, 33, 1, 15528, 38, 2, 0, 15532, 367, 1, 0, 15540,
+  368, 35, 1, 15544, 403, 1, 0, 15548, 5, 32, 1, 15552,
+  37, 2, 0, 15556, 367, 1, 0, 15564, 368, 34, 1, 15568,
+  402, 1, 0, 15572, 5, 31, 1, 15576, 36, 2, 0, 15580,
+  367, 1, 0, 15588, 368, 32, 1, 15592, 400, 2, 0, 15596,
+  5, 30, 1, 15604, 35, 1, 0, 15608, 367, 1, 0, 15612,
+  368, 31, 1, 15616, 399, 2, 0, 15620, 5, 29, 1, 15628,
+  34, 1, 0, 15632, 367, 1, 0, 15636, 368, 30, 1, 15640,
+  398, 1, 0, 15644, 5, 27, 1, 15648, 32, 2, 0, 15652,
+  367, 1, 0, 15660, 368, 29, 1, 15664, 397, 1, 0, 15668,
+  5, 25, 1, 15672, 30, 2, 0, 15676, 367, 1, 0, 15684,
+  368, 27, 1, 15688, 395, 1, 0, 15692, 5, 23, 1, 15696,
+  28, 2, 0, 15700, 367, 1, 0, 15708, 368, 25, 1, 15712,
+  393, 2, 0, 15716, 5, 22, 1, 15724, 27, 2, 0, 15728,
+  367, 1, 0, 15736, 368, 23, 1, 15740, 391, 2, 0, 15744,
+  5, 19, 1, 15752, 24, 3, 0, 15756, 367, 1, 0, 15768,
+  368, 22, 1, 15772, 390, 1, 0, 15776, 5, 16, 1, 15780,
+  21, 3, 0, 15784, 367, 1, 0, 15796, 368, 19, 1, 15800,
+  387, 2, 0, 15804, 5, 13, 1, 15812, 18, 4, 0, 15816,
+  367, 1, 0, 15832, 368, 17, 1, 15836, 385, 2, 0, 15840,
+  5, 10, 1, 15848, 15, 4, 0, 15852, 367, 1, 0, 15868,
+  368, 14, 1, 15872, 382, 2, 0, 15876, 5, 9, 0, 15884,
+  367, 1, 0, 15920, 368, 10, 1, 15924, 378, 3, 0, 15928,
+  367, 10, 0, 15940,
+};
+
+static const int POKY_IMG_XBGR8888_ROW_SPANS[] = {
+  0, 0, 0, 0, 0, 4, 16, 28, 40, 52, 64, 76,
+  88, 100, 112, 124, 136, 148, 160, 172, 184, 196, 208, 220,
+  232, 244, 256, 268, 280, 292, 304, 316, 328, 340, 352, 364,
+  376, 388, 400, 412, 420, 432, 444, 456, 468, 480, 492, 504,
+  512, 524, 536, 548, 560, 572, 584, 596, 620, 684, 780, 876,
+  972, 1072, 1172, 1260, 1348, 1444, 1548, 1656, 1764, 1872, 1976, 2084,
+  2192, 2296, 2404, 2512, 2616, 2724, 2820, 2920, 3020, 3120, 3216, 3316,
+  3408, 3500, 3588, 3680, 3760, 3852, 3936, 4020, 4112, 4200, 4288, 4380,
+  4472, 4560, 4644, 4736, 4824, 4904, 4996, 5096, 5200, 5304, 5396, 5484,
+  5560, 5636, 5732, 5836, 5944, 6036, 6112, 6196, 6280, 6372, 6464, 6556,
+  6656, 6756, 6852, 6948, 7048, 7148, 7244, 7340, 7432, 7528, 7632, 7728,
+  7828, 7924, 8020, 8120, 8220, 8320, 8428, 8524, 8620, 8720, 8820, 8920,
+  9020, 9120, 9220, 9320, 9420, 9520, 9620, 9720, 9816, 9904, 9996, 10088,
+  10176, 10272, 10356, 10432, 10484, 10504, 10524, 10544, 10560, 10576, 10588, 10608,
+  10628, 10648, 10668, 10688, 10700, 10720, 10740, 10760, 10776, 10796, 10816, 10832,
+  10852, 10868, 10888, 10908, 10928, 10948, 10968, 10984, 11004, 11024, 11044, 11064,
+  11084, 11104, 11124, 11144, 11164, 11184, 11204, 11224, 11244, 11264, 11284, 11304,
+  11324, 11344, 11364, 11384, 11404, 11424, 11444, 11460, 11464, 11464, 11464,
+};
+
+static const PSplashFBImage POKY_IMG_XBGR8888 = {
+  .rgbmode   = BGR888,
+  .bpp       = 32,
+  .width     = 427,
+  .height    = 214,
+  .pixels    = (const char *) POKY_IMG_XBGR8888_PIXELS,
+  .spans     = POKY_IMG_XBGR8888_SPANS,
+  .row_spans = POKY_IMG_XBGR8888_ROW_SPANS,
+};
+
+#endif
+
+static const PSplashFBImage *POKY_IMG_NATIVE_VARIANTS[] = {
+#ifdef PSPLASH_IMG_NATIVE_RGB565
+  &POKY_IMG_RGB565,
+#endif
+#ifdef PSPLASH_IMG_NATIVE_BGR565
+  &POKY_IMG_BGR565,
+#endif
+#ifdef PSPLASH_IMG_NATIVE_XRGB8888
+  &POKY_IMG_XRGB8888,
+#endif
+#ifdef PSPLASH_IMG_NATIVE_XBGR8888
+  &POKY_IMG_XBGR8888,
+#endif
+  NULL
+};
+
+#define POKY_IMG_NATIVE (POKY_IMG_NATIVE_VARIANTS)
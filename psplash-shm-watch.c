@@ -0,0 +1,210 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Shared memory status page, psplash's end: a thread sleeps on the
+ *  futex and hands wakeups to the main loop through an eventfd.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include <linux/futex.h>
+#include <sched.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include "psplash.h"
+
+static long
+psplash_shm_futex (uint32_t *futex, int op, uint32_t value)
+{
+  return syscall (SYS_futex, futex, op, value, NULL, NULL, 0);
+}
+
+int
+psplash_shm_get_progress (PSplashShm *shm, uint32_t *seq, int *value)
+{
+  uint32_t now = __atomic_load_n (&shm->progress_seq, __ATOMIC_ACQUIRE);
+
+  if (now == *seq)
+    return FALSE;
+
+  *value = __atomic_load_n (&shm->progress, __ATOMIC_RELAXED);
+  *seq   = now;
+
+  return TRUE;
+}
+
+int
+psplash_shm_get_msg (PSplashShm *shm, uint32_t *seq, char *msg, size_t size)
+{
+  uint32_t before, after;
+  size_t   length = MIN (size - 1, PSPLASH_SHM_MSG_MAX - 1);
+  int      tries;
+
+  for (tries = 0; tries < PSPLASH_SHM_TRIES; tries++)
+    {
+      /* Give a writer that was preempted mid-copy the chance to finish,
+       * which on one core it otherwise would not get */
+      if (tries > 0)
+	sched_yield ();
+
+      before = __atomic_load_n (&shm->msg_seq, __ATOMIC_ACQUIRE);
+
+      if (before == *seq)
+	return FALSE;
+
+      if (before & 1)
+	continue;
+
+      memcpy (msg, shm->msg, length);
+
+      __atomic_thread_fence (__ATOMIC_ACQUIRE);
+      after = __atomic_load_n (&shm->msg_seq, __ATOMIC_RELAXED);
+
+      if (after == before)
+	{
+	  msg[length] = '\0';
+	  *seq = before;
+	  return TRUE;
+	}
+    }
+
+  return FALSE;
+}
+
+/* Sleeps until there is an update that has not been passed on yet.
+ * 'waiting' is only set around the sleep, and the sleep only starts again
+ * once the main loop has taken what was passed on, so that producers have
+ * no system call to make while psplash is busy anyway. */
+static void*
+psplash_shm_watch_thread (void *data)
+{
+  PSplashShmWatch *watch = data;
+  PSplashShm      *shm = watch->shm;
+  uint32_t         seen;
+  uint64_t         one = 1;
+
+  seen = __atomic_load_n (&shm->wake, __ATOMIC_SEQ_CST);
+
+  while (!__atomic_load_n (&watch->quit, __ATOMIC_SEQ_CST))
+    {
+      __atomic_store_n (&shm->waiting, 1, __ATOMIC_SEQ_CST);
+
+      if (__atomic_load_n (&shm->wake, __ATOMIC_SEQ_CST) == seen)
+	psplash_shm_futex (&shm->wake, FUTEX_WAIT, seen);
+
+      __atomic_store_n (&shm->waiting, 0, __ATOMIC_SEQ_CST);
+
+      /* Taken before the main loop reads the page, so that anything
+       * it misses wakes it again */
+      seen = __atomic_load_n (&shm->wake, __ATOMIC_SEQ_CST);
+
+      __atomic_store_n (&watch->consumed, 0, __ATOMIC_SEQ_CST);
+
+      if (write (watch->fd, &one, sizeof (one)) < 0 && errno != EAGAIN)
+	break;
+
+      while (!__atomic_load_n (&watch->consumed, __ATOMIC_SEQ_CST)
+	     && !__atomic_load_n (&watch->quit, __ATOMIC_SEQ_CST))
+	psplash_shm_futex (&watch->consumed, FUTEX_WAIT_PRIVATE, 0);
+    }
+
+  return NULL;
+}
+
+void
+psplash_shm_watch_consumed (PSplashShmWatch *watch)
+{
+  __atomic_store_n (&watch->consumed, 1, __ATOMIC_SEQ_CST);
+  psplash_shm_futex (&watch->consumed, FUTEX_WAKE_PRIVATE, 1);
+}
+
+PSplashShmWatch*
+psplash_shm_watch_new (const char *path)
+{
+  PSplashShmWatch *watch;
+  PSplashShm      *shm;
+  int              fd;
+
+  if ((watch = calloc (1, sizeof (PSplashShmWatch))) == NULL)
+    {
+      perror ("Error no memory");
+      return NULL;
+    }
+
+  /* Anyone still mapping an old page keeps that one to themselves */
+  unlink (path);
+
+  if ((fd = open (path, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC,
+		  S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP)) < 0)
+    {
+      perror ("Error creating status page");
+      free (watch);
+      return NULL;
+    }
+
+  if (ftruncate (fd, sizeof (PSplashShm)) < 0
+      || (shm = mmap (NULL, sizeof (PSplashShm), PROT_READ | PROT_WRITE,
+		      MAP_SHARED, fd, 0)) == MAP_FAILED)
+    {
+      perror ("Error mapping status page");
+      close (fd);
+      unlink (path);
+      free (watch);
+      return NULL;
+    }
+
+  close (fd);
+
+  shm->version = PSPLASH_SHM_VERSION;
+  __atomic_store_n (&shm->magic, PSPLASH_SHM_MAGIC, __ATOMIC_RELEASE);
+
+  watch->shm = shm;
+
+  if ((watch->fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0)
+    {
+      perror ("eventfd");
+      goto fail;
+    }
+
+  if (pthread_create (&watch->thread, NULL, psplash_shm_watch_thread,
+		      watch) != 0)
+    {
+      fprintf (stderr, "Error starting status page thread\n");
+      close (watch->fd);
+      goto fail;
+    }
+
+  return watch;
+
+ fail:
+  psplash_shm_unmap (shm);
+  unlink (path);
+  free (watch);
+
+  return NULL;
+}
+
+void
+psplash_shm_watch_destroy (PSplashShmWatch *watch)
+{
+  /* Out of either sleep, whichever the thread is in */
+  __atomic_store_n (&watch->quit, TRUE, __ATOMIC_SEQ_CST);
+  __atomic_add_fetch (&watch->shm->wake, 1, __ATOMIC_SEQ_CST);
+  psplash_shm_futex (&watch->shm->wake, FUTEX_WAKE, 1);
+  psplash_shm_watch_consumed (watch);
+
+  pthread_join (watch->thread, NULL);
+
+  close (watch->fd);
+  psplash_shm_unmap (watch->shm);
+  free (watch);
+}
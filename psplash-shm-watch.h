@@ -0,0 +1,56 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_SHM_WATCH_H
+#define _HAVE_PSPLASH_SHM_WATCH_H
+
+/* How often to retry around a message that is being written, before
+ * giving up on it for now */
+#define PSPLASH_SHM_TRIES 1000
+
+/* psplash's end of the status page: a thread sleeps on the futex, so
+ * that updates make 'fd' readable for the main loop */
+typedef struct PSplashShmWatch
+{
+  PSplashShm *shm;
+  int         fd;			/* eventfd */
+  pthread_t   thread;
+  int         quit;
+  uint32_t    consumed;			/* futex, the main loop has read */
+  uint32_t    progress_seq, msg_seq;	/* what has been read */
+}
+PSplashShmWatch;
+
+/* Each of these is TRUE when there is something newer than 'seq', which
+ * is then moved on to it */
+int
+psplash_shm_get_progress (PSplashShm *shm, uint32_t *seq, int *value);
+
+int
+psplash_shm_get_msg (PSplashShm *shm, uint32_t *seq, char *msg, size_t size);
+
+/* Creates a fresh page at 'path' and starts watching it */
+PSplashShmWatch*
+psplash_shm_watch_new (const char *path);
+
+/* For the main loop, once it has read the page after 'fd' woke it: until
+ * then further updates only make their stores */
+void
+psplash_shm_watch_consumed (PSplashShmWatch *watch);
+
+void
+psplash_shm_watch_destroy (PSplashShmWatch *watch);
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Shared memory status page, the producers' end: progress and message
+ *  slots updated in place, waking psplash through a futex only when it
+ *  is asleep. Built into libpsplash-client and psplash-write too.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "psplash-shm.h"
+
+/* How often to give way to another writer of the message before giving
+ * up on it for now */
+#define PSPLASH_SHM_WRITE_TRIES 1000
+
+static long
+psplash_shm_futex (uint32_t *futex, int op, uint32_t value)
+{
+  return syscall (SYS_futex, futex, op, value, NULL, NULL, 0);
+}
+
+static void
+psplash_shm_wake (PSplashShm *shm)
+{
+  __atomic_add_fetch (&shm->wake, 1, __ATOMIC_SEQ_CST);
+
+  if (__atomic_load_n (&shm->waiting, __ATOMIC_SEQ_CST))
+    psplash_shm_futex (&shm->wake, FUTEX_WAKE, 1);
+}
+
+PSplashShm*
+psplash_shm_map (const char *path)
+{
+  PSplashShm  *shm;
+  struct stat  st;
+  int          fd;
+
+  if ((fd = open (path, O_RDWR | O_CLOEXEC)) < 0)
+    return NULL;
+
+  if (fstat (fd, &st) < 0 || st.st_size < (off_t) sizeof (PSplashShm))
+    {
+      close (fd);
+      return NULL;
+    }
+
+  shm = mmap (NULL, sizeof (PSplashShm), PROT_READ | PROT_WRITE, MAP_SHARED,
+	      fd, 0);
+  close (fd);
+
+  if (shm == MAP_FAILED)
+    return NULL;
+
+  if (__atomic_load_n (&shm->magic, __ATOMIC_ACQUIRE) != PSPLASH_SHM_MAGIC
+      || shm->version != PSPLASH_SHM_VERSION)
+    {
+      munmap (shm, sizeof (PSplashShm));
+      return NULL;
+    }
+
+  return shm;
+}
+
+PSplashShm*
+psplash_shm_open (void)
+{
+  char        path[PATH_MAX];
+  const char *tmpdir;
+
+  if ((tmpdir = getenv ("TMPDIR")) == NULL)
+    tmpdir = "/tmp";
+
+  snprintf (path, sizeof (path), "%s/%s", tmpdir, PSPLASH_SHM);
+
+  return psplash_shm_map (path);
+}
+
+void
+psplash_shm_unmap (PSplashShm *shm)
+{
+  munmap (shm, sizeof (PSplashShm));
+}
+
+void
+psplash_shm_set_progress (PSplashShm *shm, int value)
+{
+  __atomic_store_n (&shm->progress, value, __ATOMIC_RELAXED);
+  __atomic_add_fetch (&shm->progress_seq, 1, __ATOMIC_RELEASE);
+
+  psplash_shm_wake (shm);
+}
+
+/* Whether the writer 'owner' has gone without unlocking the message.
+ * EPERM means it is alive, just someone else's. */
+static int
+psplash_shm_owner_died (int32_t owner)
+{
+  return kill (owner, 0) < 0 && errno == ESRCH;
+}
+
+int
+psplash_shm_set_msg (PSplashShm *shm, const char *msg)
+{
+  int32_t  self = getpid (), owner;
+  uint32_t seq;
+  int      tries = 0;
+
+  /* The owner keeps other writers out; it alone moves the sequence
+   * number on, so whoever takes over from a dead one carries on from
+   * wherever that got to */
+  for (;;)
+    {
+      owner = 0;
+      if (__atomic_compare_exchange_n (&shm->msg_owner, &owner, self, false,
+				       __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+	break;
+
+      if (owner != self && psplash_shm_owner_died (owner)
+	  && __atomic_compare_exchange_n (&shm->msg_owner, &owner, self,
+					  false, __ATOMIC_ACQUIRE,
+					  __ATOMIC_RELAXED))
+	break;
+
+      if (++tries == PSPLASH_SHM_WRITE_TRIES)
+	return false;
+
+      sched_yield ();
+    }
+
+  /* An odd sequence number tells readers to try again */
+  seq = __atomic_load_n (&shm->msg_seq, __ATOMIC_RELAXED) | 1;
+  __atomic_store_n (&shm->msg_seq, seq, __ATOMIC_RELAXED);
+  __atomic_thread_fence (__ATOMIC_RELEASE);
+
+  strncpy (shm->msg, msg, PSPLASH_SHM_MSG_MAX - 1);
+  shm->msg[PSPLASH_SHM_MSG_MAX - 1] = '\0';
+
+  __atomic_store_n (&shm->msg_seq, seq + 1, __ATOMIC_RELEASE);
+  __atomic_store_n (&shm->msg_owner, 0, __ATOMIC_RELEASE);
+
+  psplash_shm_wake (shm);
+
+  return true;
+}
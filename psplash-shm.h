@@ -0,0 +1,74 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_SHM_H
+#define _HAVE_PSPLASH_SHM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The page's name, in TMPDIR */
+#define PSPLASH_SHM         "psplash_shm"
+
+#define PSPLASH_SHM_MAGIC   0x50535348	/* "PSSH" */
+#define PSPLASH_SHM_VERSION 2
+#define PSPLASH_SHM_MSG_MAX 256
+
+/* The status page psplash shares as PSPLASH_SHM next to its FIFO.
+ * Updating it is a few stores, plus a futex wake only when psplash is
+ * asleep waiting for one. */
+typedef struct PSplashShm
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t wake;			/* futex, bumped after every update */
+  uint32_t waiting;			/* psplash is asleep on 'wake' */
+  uint32_t progress_seq;		/* bumped after every progress */
+  int32_t  progress;
+  uint32_t msg_seq;			/* odd while 'msg' is being written */
+  int32_t  msg_owner;			/* pid of the writer of 'msg', or 0 */
+  char     msg[PSPLASH_SHM_MSG_MAX];
+}
+PSplashShm;
+
+/* A producer's mapping of the page psplash created at 'path', NULL if
+ * there is none */
+PSplashShm*
+psplash_shm_map (const char *path);
+
+/* The same for the running psplash's page, under TMPDIR */
+PSplashShm*
+psplash_shm_open (void);
+
+void
+psplash_shm_unmap (PSplashShm *shm);
+
+void
+psplash_shm_set_progress (PSplashShm *shm, int value);
+
+/* 0 if another writer kept the message to itself for too long. One
+ * that died while writing is taken over from, which needs producers to
+ * share a pid namespace. */
+int
+psplash_shm_set_msg (PSplashShm *shm, const char *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,253 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Boot timeline: a ring of timestamped events, from startup through to
+ *  each command reaching the screen, for measuring on real devices.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include <time.h>
+#include "psplash.h"
+
+static const char *event_names[] =
+{
+  [PSPLASH_EVENT_START]          = "start",
+  [PSPLASH_EVENT_CONSOLE_SWITCH] = "console_switch",
+  [PSPLASH_EVENT_FB_OPEN]        = "fb_open",
+  [PSPLASH_EVENT_FIRST_FRAME]    = "first_frame",
+  [PSPLASH_EVENT_RECEIVED]       = "received",
+  [PSPLASH_EVENT_PARSED]         = "parsed",
+  [PSPLASH_EVENT_RENDERED]       = "rendered",
+  [PSPLASH_EVENT_FLUSHED]        = "flushed",
+  [PSPLASH_EVENT_QUIT]           = "quit",
+  [PSPLASH_EVENT_BEGIN]          = "begin",
+  [PSPLASH_EVENT_END]            = "end",
+};
+
+/* The threads the trace shows, for commands and for drawing */
+enum {
+    PSPLASH_TRACK_IPC = 1,
+    PSPLASH_TRACK_RENDER,
+};
+
+static struct
+{
+  PSplashEvent  *events;		/* NULL when not recording */
+  unsigned long  total;			/* ever added */
+  char           path[PATH_MAX];
+}
+timeline;
+
+int
+psplash_timeline_start (const char *path)
+{
+  char cwd[PATH_MAX];
+  int  length;
+
+  /* psplash changes to TMPDIR, so hold on to where 'path' was meant */
+  if (path[0] == '/' || getcwd (cwd, sizeof (cwd)) == NULL)
+    length = snprintf (timeline.path, sizeof (timeline.path), "%s", path);
+  else
+    length = snprintf (timeline.path, sizeof (timeline.path), "%s/%s",
+		       cwd, path);
+
+  if (length >= (int) sizeof (timeline.path))
+    {
+      fprintf (stderr, "Error, timeline path too long\n");
+      return FALSE;
+    }
+
+  timeline.events = calloc (PSPLASH_TIMELINE_SIZE, sizeof (PSplashEvent));
+  if (timeline.events == NULL)
+    {
+      perror ("Error no memory for the timeline");
+      return FALSE;
+    }
+
+  psplash_timeline_add (PSPLASH_EVENT_START, 0, NULL);
+
+  return TRUE;
+}
+
+void
+psplash_timeline_add (enum PSplashEventType type,
+		      int                   command,
+		      const char           *detail)
+{
+  PSplashEvent    *event;
+  struct timespec  ts;
+
+  if (timeline.events == NULL)
+    return;
+
+  event = &timeline.events[timeline.total++ % PSPLASH_TIMELINE_SIZE];
+
+  clock_gettime (CLOCK_BOOTTIME, &ts);
+
+  event->ns      = ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+  event->type    = type;
+  event->command = command;
+  snprintf (event->detail, sizeof (event->detail), "%s",
+	    detail ? detail : "");
+}
+
+static void
+psplash_timeline_write_text (FILE *f, unsigned long first)
+{
+  const PSplashEvent *event;
+  unsigned long       i;
+
+  fprintf (f, "# psplash timeline, CLOCK_BOOTTIME seconds, %lu events"
+	   " lost\n# time event command detail\n", first);
+
+  for (i = first; i < timeline.total; i++)
+    {
+      event = &timeline.events[i % PSPLASH_TIMELINE_SIZE];
+      fprintf (f, "%llu.%09llu %s %i %s\n",
+	       (unsigned long long) event->ns / 1000000000ULL,
+	       (unsigned long long) event->ns % 1000000000ULL,
+	       event_names[event->type], event->command, event->detail);
+    }
+}
+
+/* Anything but plain ASCII is taken to be Latin-1, which is all the font
+ * has anyway */
+static void
+psplash_timeline_write_json_string (FILE *f, const char *s)
+{
+  fputc ('"', f);
+
+  for (; *s; s++)
+    {
+      if (*s == '"' || *s == '\\')
+	fprintf (f, "\\%c", *s);
+      else if ((uint8) *s < 0x20 || (uint8) *s >= 0x80)
+	fprintf (f, "\\u%04x", (uint8) *s);
+      else
+	fputc (*s, f);
+    }
+
+  fputc ('"', f);
+}
+
+/* Chrome's trace event format. Commands are slices on the IPC track from
+ * being received to being parsed, drawing is slices on the render track
+ * and everything else is an instant. The timestamps stay CLOCK_BOOTTIME,
+ * the same clock as the kernel's trace. */
+static void
+psplash_timeline_write_trace (FILE *f, unsigned long first)
+{
+  const PSplashEvent *event;
+  const char         *ph, *name;
+  unsigned long       i;
+  int                 pid = getpid (), tid, depth[3] = { 0, 0, 0 };
+
+  fprintf (f,
+	   "{\"displayTimeUnit\":\"ms\","
+	   "\"otherData\":{\"lost_events\":%lu},\n"
+	   "\"traceEvents\":[\n"
+	   "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%i,"
+	   "\"args\":{\"name\":\"psplash\"}},\n"
+	   "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%i,\"tid\":%i,"
+	   "\"args\":{\"name\":\"ipc\"}},\n"
+	   "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%i,\"tid\":%i,"
+	   "\"args\":{\"name\":\"render\"}}",
+	   first, pid, pid, PSPLASH_TRACK_IPC, pid, PSPLASH_TRACK_RENDER);
+
+  for (i = first; i < timeline.total; i++)
+    {
+      event = &timeline.events[i % PSPLASH_TIMELINE_SIZE];
+      tid   = PSPLASH_TRACK_RENDER;
+      ph    = "i";
+      name  = event_names[event->type];
+
+      switch (event->type)
+	{
+	case PSPLASH_EVENT_RECEIVED:
+	  tid  = PSPLASH_TRACK_IPC;
+	  ph   = "B";
+	  name = event->detail;
+	  break;
+	case PSPLASH_EVENT_PARSED:
+	  tid  = PSPLASH_TRACK_IPC;
+	  ph   = "E";
+	  break;
+	case PSPLASH_EVENT_QUIT:
+	  tid  = PSPLASH_TRACK_IPC;
+	  break;
+	case PSPLASH_EVENT_BEGIN:
+	  ph   = "B";
+	  name = event->detail;
+	  break;
+	case PSPLASH_EVENT_END:
+	  ph   = "E";
+	  break;
+	default:
+	  break;
+	}
+
+      /* The start of a slice may have been overwritten already */
+      if (ph[0] == 'B')
+	depth[tid]++;
+      else if (ph[0] == 'E' && depth[tid]-- == 0)
+	{
+	  depth[tid] = 0;
+	  continue;
+	}
+
+      fprintf (f, ",\n{\"name\":");
+      psplash_timeline_write_json_string (f, name);
+      fprintf (f, ",\"ph\":\"%s\",%s\"ts\":%llu.%03llu,"
+	       "\"pid\":%i,\"tid\":%i,\"args\":{\"command\":%i}}",
+	       ph, ph[0] == 'i' ? "\"s\":\"t\"," : "",
+	       (unsigned long long) event->ns / 1000ULL,
+	       (unsigned long long) event->ns % 1000ULL,
+	       pid, tid, event->command);
+    }
+
+  fprintf (f, "\n]}\n");
+}
+
+int
+psplash_timeline_write (void)
+{
+  unsigned long  first = 0;
+  size_t         length;
+  FILE          *f;
+  int            ok;
+
+  if (timeline.events == NULL)
+    return FALSE;
+
+  if ((f = fopen (timeline.path, "w")) == NULL)
+    {
+      perror ("Error writing the timeline");
+      return FALSE;
+    }
+
+  if (timeline.total > PSPLASH_TIMELINE_SIZE)
+    first = timeline.total - PSPLASH_TIMELINE_SIZE;
+
+  length = strlen (timeline.path);
+
+  if (length >= 5 && !strcmp (timeline.path + length - 5, ".json"))
+    psplash_timeline_write_trace (f, first);
+  else
+    psplash_timeline_write_text (f, first);
+
+  ok = !ferror (f);
+  if (fclose (f) != 0)
+    ok = FALSE;
+
+  return ok;
+}
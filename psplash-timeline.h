@@ -0,0 +1,60 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_TIMELINE_H
+#define _HAVE_PSPLASH_TIMELINE_H
+
+/* How many events are kept; older ones are overwritten */
+#define PSPLASH_TIMELINE_SIZE 1024
+
+enum PSplashEventType {
+    PSPLASH_EVENT_START,
+    PSPLASH_EVENT_CONSOLE_SWITCH,
+    PSPLASH_EVENT_FB_OPEN,
+    PSPLASH_EVENT_FIRST_FRAME,
+    PSPLASH_EVENT_RECEIVED,		/* a command came in */
+    PSPLASH_EVENT_PARSED,
+    PSPLASH_EVENT_RENDERED,		/* drawn, but not yet flushed */
+    PSPLASH_EVENT_FLUSHED,		/* on the screen */
+    PSPLASH_EVENT_QUIT,
+    PSPLASH_EVENT_BEGIN,		/* of drawing 'detail' */
+    PSPLASH_EVENT_END,			/* of the latest BEGIN */
+};
+
+typedef struct PSplashEvent
+{
+  uint64_t              ns;		/* CLOCK_BOOTTIME */
+  enum PSplashEventType type;
+  int                   command;	/* number of the latest command */
+  char                  detail[48];
+}
+PSplashEvent;
+
+/* Starts recording, to be written to 'path': as Chrome trace event JSON,
+ * for Perfetto or chrome://tracing, if it ends in .json and as text
+ * otherwise. Until this is called the other calls do nothing. */
+int
+psplash_timeline_start (const char *path);
+
+void
+psplash_timeline_add (enum PSplashEventType type,
+		      int                   command,
+		      const char           *detail);
+
+/* Writes out what has been recorded so far, oldest first */
+int
+psplash_timeline_write (void);
+
+#endif
@@ -27,25 +27,91 @@
 #include <errno.h>
 #include "psplash.h"
 
+/* With -s|--shm, the status page that PROGRESS and MSG go to. psplash
+ * reads the page and the FIFO independently, so these may be seen after
+ * commands given later that go over the FIFO, QUIT included. */
+static PSplashShm *shm;
+
+static int
+write_command (int pipe_fd, const char *command, size_t length)
+{
+  ssize_t n;
+
+  /* No round trip through psplash's command parser for these */
+  if (shm && !strncmp (command, "PROGRESS ", 9))
+    {
+      psplash_shm_set_progress (shm, atoi (command + 9));
+      return TRUE;
+    }
+
+  if (shm && !strncmp (command, "MSG ", 4))
+    return psplash_shm_set_msg (shm, command + 4);
+
+  while (length > 0)
+    {
+      if ((n = write (pipe_fd, command, length)) == -1)
+	{
+	  if (errno == EINTR)
+	    continue;
+	  return FALSE;
+	}
+
+      command += n;
+      length  -= n;
+    }
+
+  return TRUE;
+}
+
+/* Sends every line of 'f' as a command, over the one FIFO connection */
+static int
+write_commands (int pipe_fd, FILE *f)
+{
+  char    *line = NULL;
+  size_t   size = 0;
+  ssize_t  length;
+  int      ok = TRUE;
+
+  while (ok && (length = getline (&line, &size, f)) != -1)
+    {
+      if (line[length-1] == '\n')
+	line[--length] = '\0';
+
+      if (length > 0)
+	ok = write_command (pipe_fd, line, length+1);
+    }
+
+  free (line);
+
+  return ok;
+}
+
 int main(int argc, char **argv) 
 {
-  char *tmpdir;
-  int   pipe_fd;
+  char *tmpdir, fifo[PATH_MAX];
+  int   pipe_fd, i, ok = TRUE;
+  FILE *f;
 
   tmpdir = getenv("TMPDIR");
 
   if (!tmpdir)
     tmpdir = "/tmp";
 
-  if (argc!=2) 
+  if (argc < 2) 
     {
-      fprintf(stderr, "Wrong number of arguments\n");
+      fprintf(stderr, "Wrong number of arguments\n"
+	      "Usage: %s [-s|--shm] "
+	      "[<command>|-b|--batch|-f|--file <file>]...\n"
+	      "With -s, PROGRESS and MSG go through the status page and may\n"
+	      "be seen after the other commands, which use the FIFO\n",
+	      argv[0]);
       exit(-1);
     }
   
-  chdir(tmpdir);
+  /* Not chdir(), so that command files are where they were said to be */
+  snprintf (fifo, sizeof (fifo), "%s/%s", tmpdir, PSPLASH_FIFO);
   
-  if ((pipe_fd = open (PSPLASH_FIFO,O_WRONLY|O_NONBLOCK)) == -1)
+  if ((pipe_fd = open (fifo,O_WRONLY|O_NONBLOCK)) == -1)
     {
       /* Silently error out instead of covering the boot process in 
          errors when psplash has exitted due to a VC switch */
@@ -53,8 +119,56 @@ int main(int argc, char **argv)
       exit (-1);
     }
 
-  write(pipe_fd, argv[1], strlen(argv[1])+1);
+  /* Only the open should fail when psplash isn't there. Once it is, a
+   * batch waits for it to catch up rather than losing commands, and
+   * finds out that it quit from write() */
+  fcntl (pipe_fd, F_SETFL, fcntl (pipe_fd, F_GETFL) & ~O_NONBLOCK);
+  signal (SIGPIPE, SIG_IGN);
 
-  return 0;
-}
+  /* -s applies to every command, wherever it is given. Without a status
+   * page everything still goes over the FIFO. */
+  for (i = 1; i < argc; i++)
+    {
+      if (!strcmp(argv[i],"-f") || !strcmp(argv[i],"--file"))
+	i++;
+      else if ((!strcmp(argv[i],"-s") || !strcmp(argv[i],"--shm"))
+	       && shm == NULL)
+	shm = psplash_shm_open ();
+    }
 
+  for (i = 1; ok && i < argc; i++)
+    {
+      if (!strcmp(argv[i],"-s") || !strcmp(argv[i],"--shm"))
+	{
+	  /* Already seen to above */
+	}
+      else if (!strcmp(argv[i],"-b") || !strcmp(argv[i],"--batch"))
+	{
+	  ok = write_commands (pipe_fd, stdin);
+	}
+      else if (!strcmp(argv[i],"-f") || !strcmp(argv[i],"--file"))
+	{
+	  if (++i >= argc)
+	    {
+	      fprintf(stderr, "Missing file after %s\n", argv[i-1]);
+	      exit (-1);
+	    }
+	  if ((f = fopen (argv[i], "r")) == NULL)
+	    {
+	      perror ("Error opening command file");
+	      exit (-1);
+	    }
+	  ok = write_commands (pipe_fd, f);
+	  fclose (f);
+	}
+      else
+	{
+	  ok = write_command (pipe_fd, argv[i], strlen(argv[i])+1);
+	}
+    }
+
+  if (shm)
+    psplash_shm_unmap (shm);
+
+  return ok ? 0 : -1;
+}
@@ -18,12 +18,14 @@
  *
  */
 
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
 #include "psplash.h"
 #include "psplash-config.h"
 #include "psplash-colors.h"
-#include "psplash-poky-img.h"
-#include "psplash-bar-img.h"
-#include "radeon-font.h"
 
 /* Here you can define a message which will be displayed above the
  * progress bar.
@@ -40,184 +42,558 @@
  *    If MSG_FILE is not set or not readable
  *    the content of MSG will be used as message. */
 #define MSG ""
-#define SPLIT_LINE_POS(fb)                                  \
-	(  (fb)->height                                     \
-	 - ((  PSPLASH_IMG_SPLIT_DENOMINATOR                \
-	     - PSPLASH_IMG_SPLIT_NUMERATOR)                 \
-	    * (fb)->height / PSPLASH_IMG_SPLIT_DENOMINATOR) \
-	)
-
-void
-psplash_exit (int UNUSED(signum))
+
+/* Signals handled by the main loop rather than by handlers: SIGUSR1 for
+ * VT switches and the rest to quit */
+static void
+psplash_signal_mask (sigset_t *mask)
 {
-  DBG("mark");
+  sigemptyset (mask);
+  sigaddset (mask, SIGUSR1);
+  sigaddset (mask, SIGHUP);
+  sigaddset (mask, SIGINT);
+  sigaddset (mask, SIGQUIT);
+  sigaddset (mask, SIGTERM);
+}
 
-  psplash_console_reset ();
+/* The newest state the commands read so far ask for. Only this is drawn
+ * once they have all been read, however many there were */
+typedef struct PSplashPending
+{
+  bool progress_set, msg_set;
+  int  progress;
+  char msg[PSPLASH_COMMAND_MAX];
 }
+PSplashPending;
 
-void
-psplash_draw_msg (PSplashFB *fb, const char *msg)
+/* Commands so far, which the timeline numbers them by */
+static int n_commands;
+
+static int 
+parse_command (PSplashPending *pending, char *string)
 {
-  int w, h;
+  char *command, *arg;
+
+  DBG("got cmd %s", string);
+	
+  if (strcmp(string,"QUIT") == 0)
+    return 1;
+
+  if ((command = strtok(string," ")) == NULL)
+    return 0;
 
-  psplash_fb_text_size (&w, &h, &radeon_font, msg);
+  arg = strtok(NULL,"\0");
 
-  DBG("displaying '%s' %ix%i\n", msg, w, h);
+  if (!strcmp(command,"PROGRESS")) 
+    {
+      if (arg)
+	{
+	  pending->progress     = atoi(arg);
+	  pending->progress_set = TRUE;
+	}
+    } 
+  else if (!strcmp(command,"MSG")) 
+    {
+      snprintf (pending->msg, sizeof (pending->msg), "%s", arg ? arg : "");
+      pending->msg_set = TRUE;
+    } 
+  else if (!strcmp(command,"TIMELINE")) 
+    {
+      psplash_timeline_write ();
+    } 
+  else if (!strcmp(command,"QUIT")) 
+    {
+      return 1;
+    }
 
-  /* Clear */
+  return 0;
+}
 
-  psplash_fb_draw_rect (fb, 
-			0, 
-			SPLIT_LINE_POS(fb) - h, 
-			fb->width,
-			h,
-			PSPLASH_BACKGROUND_COLOR);
+static int
+psplash_handle_command (PSplashPending *pending, char *command)
+{
+  int quit;
 
-  psplash_fb_draw_text (fb,
-			(fb->width-w)/2, 
-			SPLIT_LINE_POS(fb) - h,
-			PSPLASH_TEXT_COLOR,
-			&radeon_font,
-			msg);
+  psplash_timeline_add (PSPLASH_EVENT_RECEIVED, ++n_commands, command);
+  quit = parse_command (pending, command);
+  psplash_timeline_add (PSPLASH_EVENT_PARSED, n_commands, NULL);
 
-  psplash_fb_flush (fb);
+  return quit;
 }
 
-void
-psplash_draw_progress (PSplashFB *fb, int value)
+/* Slices of the timeline's render track */
+#define TIMELINE_BEGIN(name) \
+  psplash_timeline_add (PSPLASH_EVENT_BEGIN, n_commands, name)
+#define TIMELINE_END() \
+  psplash_timeline_add (PSPLASH_EVENT_END, n_commands, NULL)
+
+static void
+psplash_draw_pending (PSplashFB *fb, PSplashPending *pending)
 {
-  int x, y, width, height, barwidth;
+  if (pending->progress_set)
+    {
+      TIMELINE_BEGIN ("psplash_draw_progress");
+      psplash_draw_progress (fb, pending->progress);
+      TIMELINE_END ();
+    }
 
-  /* 4 pix border */
-  x      = ((fb->width  - BAR_IMG_WIDTH)/2) + 4 ;
-  y      = SPLIT_LINE_POS(fb) + 4;
-  width  = BAR_IMG_WIDTH - 8; 
-  height = BAR_IMG_HEIGHT - 8;
+  if (pending->msg_set)
+    {
+      TIMELINE_BEGIN ("psplash_draw_msg");
+      psplash_draw_msg (fb, pending->msg);
+      TIMELINE_END ();
+    }
 
-  if (value > 0)
+  if (pending->progress_set || pending->msg_set)
     {
-      barwidth = (CLAMP(value,0,100) * width) / 100;
-      psplash_fb_draw_rect (fb, x + barwidth, y, 
-    			width - barwidth, height,
-			PSPLASH_BAR_BACKGROUND_COLOR);
-      psplash_fb_draw_rect (fb, x, y, barwidth,
-			    height, PSPLASH_BAR_COLOR);
+      psplash_timeline_add (PSPLASH_EVENT_RENDERED, n_commands, NULL);
+      TIMELINE_BEGIN ("psplash_fb_flush");
+      psplash_fb_flush (fb);
+      TIMELINE_END ();
+      psplash_timeline_add (PSPLASH_EVENT_FLUSHED, n_commands, NULL);
     }
-  else
+}
+
+/* What the main loop waits on. The epoll data of each holds this and
+ * the fd, since there can be any number of clients. */
+enum PSplashSource {
+    PSPLASH_SOURCE_FIFO,
+    PSPLASH_SOURCE_SIGNAL,
+    PSPLASH_SOURCE_TIMEOUT,
+    PSPLASH_SOURCE_LISTEN,
+    PSPLASH_SOURCE_CLIENT,
+    PSPLASH_SOURCE_CLIENT_ACK,	/* a client that has sent ACK */
+    PSPLASH_SOURCE_SHM,
+};
+
+#define PSPLASH_MAX_EVENTS 16
+
+static int
+psplash_watch (int epoll_fd, int op, int fd, enum PSplashSource source)
+{
+  struct epoll_event ev;
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events   = EPOLLIN;
+  ev.data.u64 = (uint64_t) fd << 32 | source;
+
+  return epoll_ctl (epoll_fd, op, fd, &ev);
+}
+
+/* (Re)starts the idle timeout, if there is one */
+static void
+psplash_arm_timeout (int timer_fd, int timeout)
+{
+  struct itimerspec its;
+
+  if (timer_fd < 0)
+    return;
+
+  memset (&its, 0, sizeof (its));
+  its.it_value.tv_sec = timeout;
+  timerfd_settime (timer_fd, 0, &its, NULL);
+}
+
+/* Returns TRUE when asked to quit */
+static int
+psplash_handle_signal (PSplashFB *fb, int signal_fd)
+{
+  struct signalfd_siginfo si;
+
+  while (read (signal_fd, &si, sizeof (si)) == sizeof (si))
     {
-      barwidth = (CLAMP(-value,0,100) * width) / 100;
-      psplash_fb_draw_rect (fb, x, y, 
-    			width - barwidth, height,
-			PSPLASH_BAR_BACKGROUND_COLOR);
-      psplash_fb_draw_rect (fb, x + width - barwidth,
-			    y, barwidth, height,
-			    PSPLASH_BAR_COLOR);
+      DBG("got signal %i", si.ssi_signo);
+
+      if (si.ssi_signo != SIGUSR1)
+	return TRUE;
+
+      if (psplash_console_handle_request ())
+	psplash_fb_resume (fb);
+      else
+	psplash_fb_suspend (fb);
     }
 
-  psplash_fb_flush (fb);
+  return FALSE;
+}
 
-  DBG("value: %i, width: %i, barwidth :%i\n", value, 
-		width, barwidth);
+/* Splits what is read from the FIFO into commands, each ending in a NUL
+ * or a newline. Commands are handed out where they were read to, and the
+ * buffer starts over once they have all been taken, so the only copying
+ * is of a partial command that runs into its end. */
+typedef struct PSplashFramer
+{
+  char   buf[PSPLASH_COMMAND_MAX];
+  size_t head;			/* start of the next command */
+  size_t scan;			/* how far a terminator has been looked for */
+  size_t tail;			/* end of what has been read */
+  bool   discard;		/* dropping a command too long to keep */
 }
+PSplashFramer;
 
-static int 
-parse_command (PSplashFB *fb, char *string)
+static ssize_t
+psplash_framer_read (PSplashFramer *framer, int fd)
 {
-  char *command;
+  ssize_t n;
 
-  DBG("got cmd %s", string);
-	
-  if (strcmp(string,"QUIT") == 0)
-    return 1;
+  if (framer->tail == sizeof (framer->buf))
+    {
+      if (framer->head == 0)
+	{
+	  /* One command fills all of it; drop it up to its terminator */
+	  framer->discard = TRUE;
+	  framer->scan = framer->tail = 0;
+	}
+      else
+	{
+	  memmove (framer->buf, framer->buf + framer->head,
+		   framer->tail - framer->head);
+	  framer->scan -= framer->head;
+	  framer->tail -= framer->head;
+	  framer->head  = 0;
+	}
+    }
 
-  command = strtok(string," ");
+  n = read (fd, framer->buf + framer->tail,
+	    sizeof (framer->buf) - framer->tail);
 
-  if (!strcmp(command,"PROGRESS")) 
+  if (n > 0)
+    framer->tail += n;
+
+  return n;
+}
+
+/* The next complete command, NUL terminated in place, or NULL */
+static char*
+psplash_framer_next (PSplashFramer *framer)
+{
+  char *p, *command;
+
+  while (framer->scan < framer->tail)
     {
-      psplash_draw_progress (fb, atoi(strtok(NULL,"\0")));
-    } 
-  else if (!strcmp(command,"MSG")) 
+      p = framer->buf + framer->scan++;
+
+      if (*p != '\0' && *p != '\n')
+	continue;
+
+      *p = '\0';
+      command = framer->buf + framer->head;
+      framer->head = framer->scan;
+
+      if (!framer->discard)
+	return command;
+
+      framer->discard = FALSE;
+    }
+
+  if (framer->head == framer->tail)
+    framer->head = framer->scan = framer->tail = 0;
+
+  return NULL;
+}
+
+/* Reads every command there is without blocking. Returns TRUE when told
+ * to QUIT */
+static int
+psplash_handle_fifo (int            *pipe_fd,
+		     int             epoll_fd,
+		     PSplashFramer  *framer,
+		     PSplashPending *pending)
+{
+  char    *command;
+  ssize_t  n;
+  int      quit = FALSE;
+
+  do
     {
-      psplash_draw_msg (fb, strtok(NULL,"\0"));
-    } 
-  else if (!strcmp(command,"QUIT")) 
+      if ((n = psplash_framer_read (framer, *pipe_fd)) <= 0)
+	break;
+
+      while (!quit && (command = psplash_framer_next (framer)) != NULL)
+	quit = psplash_handle_command (pending, command);
+    }
+  while (!quit);
+
+  if (n == 0)
     {
-      return 1;
+      /* Reopen to see if there's anything more for us */
+      close(*pipe_fd);
+      *pipe_fd = open(PSPLASH_FIFO,O_RDONLY|O_NONBLOCK);
+      if (*pipe_fd >= 0)
+	psplash_watch (epoll_fd, EPOLL_CTL_ADD, *pipe_fd,
+		       PSPLASH_SOURCE_FIFO);
     }
 
-  return 0;
+  return quit;
 }
 
+/* The control socket: one command per message, from as many clients at
+ * once as like. Not having it is not fatal, there is still the FIFO. */
+static int
+psplash_listen (void)
+{
+  struct sockaddr_un addr;
+  int                fd;
+
+  memset (&addr, 0, sizeof (addr));
+  addr.sun_family = AF_UNIX;
+  strcpy (addr.sun_path, PSPLASH_SOCKET);
+
+  unlink (PSPLASH_SOCKET);
+
+  if ((fd = socket (AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC,
+		    0)) < 0)
+    {
+      perror ("socket");
+      return -1;
+    }
+
+  if (bind (fd, (struct sockaddr *) &addr, sizeof (addr)) < 0)
+    {
+      perror ("bind");
+      close (fd);
+      return -1;
+    }
+
+  /* The same as the FIFO, whatever the umask; before listen() so that
+   * nobody can connect in between */
+  if (chmod (PSPLASH_SOCKET, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP) < 0
+      || listen (fd, 16) < 0)
+    {
+      perror ("listen");
+      close (fd);
+      unlink (PSPLASH_SOCKET);
+      return -1;
+    }
+
+  return fd;
+}
+
+static void
+psplash_accept (int epoll_fd, int listen_fd)
+{
+  int fd;
+
+  while ((fd = accept4 (listen_fd, NULL, NULL,
+			SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0)
+    if (psplash_watch (epoll_fd, EPOLL_CTL_ADD, fd,
+		       PSPLASH_SOURCE_CLIENT) < 0)
+      close (fd);
+}
+
+/* Commands from one client that are owed an OK once drawn */
+typedef struct PSplashAck
+{
+  int fd;
+  int count;
+}
+PSplashAck;
+
+/* Reads every command the client has sent. Sending ACK asks for every
+ * command from then on, ACK included, to be answered with "OK" once what
+ * it asked for is on the screen. Returns TRUE when told to QUIT */
+static int
+psplash_handle_client (int                 epoll_fd,
+		       int                 fd,
+		       enum PSplashSource  source,
+		       PSplashPending     *pending,
+		       PSplashAck         *ack)
+{
+  char    command[PSPLASH_COMMAND_MAX];
+  ssize_t n;
+  int     quit = FALSE;
+
+  ack->fd    = fd;
+  ack->count = 0;
+
+  while (!quit
+	 && (n = recv (fd, command, sizeof (command), MSG_TRUNC)) > 0)
+    {
+      /* Too long to be a command, but still answered */
+      if (n >= (ssize_t) sizeof (command))
+	n = 0;
+
+      command[n] = '\0';
+      if (n > 0 && command[n-1] == '\n')
+	command[n-1] = '\0';
+
+      if (strcmp (command, "ACK") == 0)
+	{
+	  source = PSPLASH_SOURCE_CLIENT_ACK;
+	  psplash_watch (epoll_fd, EPOLL_CTL_MOD, fd, source);
+	}
+      else if (n > 0)
+	quit = psplash_handle_command (pending, command);
+
+      if (source == PSPLASH_SOURCE_CLIENT_ACK)
+	ack->count++;
+    }
+
+  if (!quit && (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)))
+    {
+      close (fd);
+      ack->fd = -1;
+    }
+
+  return quit;
+}
+
+static void
+psplash_send_acks (PSplashAck *acks, int n_acks)
+{
+  int i;
+
+  for (i = 0; i < n_acks; i++)
+    if (acks[i].fd >= 0)
+      while (acks[i].count-- > 0)
+	send (acks[i].fd, "OK", 3, MSG_DONTWAIT | MSG_NOSIGNAL);
+}
+
+/* Takes whatever is newer in the status page than what was read last */
+static void
+psplash_handle_shm (PSplashShmWatch *watch, PSplashPending *pending)
+{
+  uint64_t count;
+  char     detail[32];
+
+  /* This only clears the eventfd, the page itself says what is new */
+  if (read (watch->fd, &count, sizeof (count)) < 0 && errno != EAGAIN)
+    perror ("Error reading status page wakeup");
+
+  if (psplash_shm_get_progress (watch->shm, &watch->progress_seq,
+				&pending->progress))
+    {
+      pending->progress_set = TRUE;
+      snprintf (detail, sizeof (detail), "PROGRESS %i (shm)",
+		pending->progress);
+      psplash_timeline_add (PSPLASH_EVENT_RECEIVED, ++n_commands, detail);
+      psplash_timeline_add (PSPLASH_EVENT_PARSED, n_commands, NULL);
+    }
+
+  if (psplash_shm_get_msg (watch->shm, &watch->msg_seq,
+			   pending->msg, sizeof (pending->msg)))
+    {
+      pending->msg_set = TRUE;
+      psplash_timeline_add (PSPLASH_EVENT_RECEIVED, ++n_commands,
+			    "MSG (shm)");
+      psplash_timeline_add (PSPLASH_EVENT_PARSED, n_commands, NULL);
+    }
+
+  psplash_shm_watch_consumed (watch);
+}
+
+/* Waits on the command FIFO, socket and status page, signals and the idle
+ * timeout, which is in seconds and off when 0, all at once. What the
+ * commands of one wakeup ask for is drawn together, once they have all
+ * been read. */
 void 
 psplash_main (PSplashFB *fb, int pipe_fd, int timeout) 
 {
-  int            err;
-  ssize_t        length = 0;
-  fd_set         descriptors;
-  struct timeval tv;
-  char          *end;
-  char           command[2048];
+  struct epoll_event events[PSPLASH_MAX_EVENTS];
+  PSplashAck         acks[PSPLASH_MAX_EVENTS];
+  PSplashPending     pending;
+  PSplashFramer      framer;
+  PSplashShmWatch   *watch;
+  sigset_t           mask;
+  int                epoll_fd, signal_fd, timer_fd = -1, listen_fd;
+  int                i, n, n_acks, fd, quit = FALSE, active;
+
+  psplash_signal_mask (&mask);
+  memset (&framer, 0, sizeof (framer));
+
+  if ((epoll_fd = epoll_create1 (EPOLL_CLOEXEC)) < 0)
+    {
+      perror ("epoll_create1");
+      return;
+    }
+
+  if ((signal_fd = signalfd (-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC)) < 0
+      || psplash_watch (epoll_fd, EPOLL_CTL_ADD, signal_fd,
+			PSPLASH_SOURCE_SIGNAL) < 0)
+    perror ("signalfd");
+
+  if (timeout != 0
+      && ((timer_fd = timerfd_create (CLOCK_MONOTONIC, TFD_CLOEXEC)) < 0
+	  || psplash_watch (epoll_fd, EPOLL_CTL_ADD, timer_fd,
+			    PSPLASH_SOURCE_TIMEOUT) < 0))
+    perror ("timerfd");
 
-  tv.tv_sec = timeout;
-  tv.tv_usec = 0;
+  if ((listen_fd = psplash_listen ()) >= 0)
+    psplash_watch (epoll_fd, EPOLL_CTL_ADD, listen_fd, PSPLASH_SOURCE_LISTEN);
 
-  FD_ZERO(&descriptors);
-  FD_SET(pipe_fd, &descriptors);
+  if ((watch = psplash_shm_watch_new (PSPLASH_SHM)) != NULL)
+    psplash_watch (epoll_fd, EPOLL_CTL_ADD, watch->fd, PSPLASH_SOURCE_SHM);
 
-  end = command;
+  psplash_watch (epoll_fd, EPOLL_CTL_ADD, pipe_fd, PSPLASH_SOURCE_FIFO);
+  psplash_arm_timeout (timer_fd, timeout);
 
-  while (1) 
+  while (!quit) 
     {
-      if (timeout != 0) 
-	err = select(pipe_fd+1, &descriptors, NULL, NULL, &tv);
-      else
-	err = select(pipe_fd+1, &descriptors, NULL, NULL, NULL);
-      
-      if (err <= 0) 
+      n = epoll_wait (epoll_fd, events, PSPLASH_MAX_EVENTS, -1);
+
+      if (n < 0)
 	{
-	  /*
 	  if (errno == EINTR)
 	    continue;
-	  */
-	  return;
+	  perror ("epoll_wait");
+	  break;
 	}
-      
-      length += read (pipe_fd, end, sizeof(command) - (end - command));
 
-      if (length == 0) 
+      memset (&pending, 0, sizeof (pending));
+      n_acks = 0;
+      active = FALSE;
+
+      for (i = 0; i < n && !quit; i++)
 	{
-	  /* Reopen to see if there's anything more for us */
-	  close(pipe_fd);
-	  pipe_fd = open(PSPLASH_FIFO,O_RDONLY|O_NONBLOCK);
-	  goto out;
+	  fd = events[i].data.u64 >> 32;
+
+	  switch (events[i].data.u64 & 0xffffffff)
+	    {
+	    case PSPLASH_SOURCE_FIFO:
+	      quit = psplash_handle_fifo (&pipe_fd, epoll_fd, &framer,
+					  &pending);
+	      active = TRUE;
+	      break;
+	    case PSPLASH_SOURCE_LISTEN:
+	      psplash_accept (epoll_fd, listen_fd);
+	      break;
+	    case PSPLASH_SOURCE_CLIENT:
+	    case PSPLASH_SOURCE_CLIENT_ACK:
+	      quit = psplash_handle_client (epoll_fd, fd,
+					    events[i].data.u64 & 0xffffffff,
+					    &pending, &acks[n_acks++]);
+	      active = TRUE;
+	      break;
+	    case PSPLASH_SOURCE_SHM:
+	      psplash_handle_shm (watch, &pending);
+	      active = TRUE;
+	      break;
+	    case PSPLASH_SOURCE_SIGNAL:
+	      quit = psplash_handle_signal (fb, signal_fd);
+	      break;
+	    case PSPLASH_SOURCE_TIMEOUT:
+	      quit = TRUE;
+	      break;
+	    }
 	}
-      
-      if (command[length-1] == '\0') 
-	{
-	  if (parse_command(fb, command))
-	    return;
-	  length = 0;
-	} 
-      else if (command[length-1] == '\n') 
-	{
-	  command[length-1] = '\0';
-	  if (parse_command(fb, command))
-	    return;
-	  length = 0;
-	} 
-
-
-    out:
-      end = &command[length];
-    
-      tv.tv_sec = timeout;
-      tv.tv_usec = 0;
-      
-      FD_ZERO(&descriptors);
-      FD_SET(pipe_fd,&descriptors);
+
+      psplash_draw_pending (fb, &pending);
+      psplash_send_acks (acks, n_acks);
+
+      if (active)
+	psplash_arm_timeout (timer_fd, timeout);
     }
 
-  return;
+  if (timer_fd >= 0)
+    close (timer_fd);
+  if (signal_fd >= 0)
+    close (signal_fd);
+  if (listen_fd >= 0)
+    close (listen_fd);
+  if (watch)
+    psplash_shm_watch_destroy (watch);
+  close (epoll_fd);
+  if (pipe_fd >= 0)
+    close (pipe_fd);
 }
 
 int 
@@ -230,12 +606,18 @@ main (int argc, char** argv)
   bool       disable_message = FALSE;
   bool       disable_progress_bar = FALSE;
   bool       disable_logo = FALSE;
+  bool       double_buffer = FALSE;
+#ifdef ENABLE_DRM
+  bool       use_drm = FALSE;
+#endif
   FILE      *fd_msg;
   char      *str_msg;
+  char      *timeline_path = NULL;
+  sigset_t   mask;
   
-  signal(SIGHUP, psplash_exit);
-  signal(SIGINT, psplash_exit);
-  signal(SIGQUIT, psplash_exit);
+  /* Leave these pending for the main loop to pick up */
+  psplash_signal_mask (&mask);
+  sigprocmask (SIG_BLOCK, &mask, NULL);
 
   while (++i < argc) {
     if (!strcmp(argv[i],"-n") || !strcmp(argv[i],"--no-console-switch"))
@@ -282,14 +664,42 @@ main (int argc, char** argv)
 	  angle = atoi(argv[i]);
 	  continue;
 	}
+
+      if (!strcmp(argv[i],"-d") || !strcmp(argv[i],"--double-buffer"))
+        {
+	  double_buffer = TRUE;
+	  continue;
+	}
+
+      if (!strcmp(argv[i],"-t") || !strcmp(argv[i],"--timeline"))
+        {
+	  if (++i >= argc) goto fail;
+	  timeline_path = argv[i];
+	  continue;
+	}
+
+#ifdef ENABLE_DRM
+      if (!strcmp(argv[i],"-k") || !strcmp(argv[i],"--drm"))
+        {
+	  use_drm = TRUE;
+	  continue;
+	}
+#endif
       
     fail:
       fprintf(stderr, 
-	      "Usage: %s [-n|--no-console-switch][-m|--no-message][-p|--no-progress][-l|--no-logo][-a|--angle <0|90|180|270>]\n",
+	      "Usage: %s [-n|--no-console-switch][-m|--no-message][-p|--no-progress][-l|--no-logo][-a|--angle <0|90|180|270>][-d|--double-buffer][-t|--timeline <file>]"
+#ifdef ENABLE_DRM
+	      "[-k|--drm]"
+#endif
+	      "\n",
 	      argv[0]);
       exit(-1);
   }
 
+  if (timeline_path)
+    psplash_timeline_start (timeline_path);
+
   tmpdir = getenv("TMPDIR");
 
   if (!tmpdir)
@@ -315,50 +725,54 @@ main (int argc, char** argv)
     }
 
   if (!disable_console_switch)
-    psplash_console_switch ();
+    {
+      psplash_console_switch ();
+      psplash_timeline_add (PSPLASH_EVENT_CONSOLE_SWITCH, 0, NULL);
+    }
 
-  if ((fb = psplash_fb_new(angle,fbdev_id)) == NULL)
+#ifdef ENABLE_DRM
+  /* -f picks the card with --drm, and DRM is tried if there is no fbdev */
+  if (use_drm)
+    fb = psplash_drm_new(angle,fbdev_id);
+  else if ((fb = psplash_fb_new(angle,fbdev_id,double_buffer)) == NULL)
+    fb = psplash_drm_new(angle,fbdev_id);
+
+  if (fb == NULL)
+#else
+  if ((fb = psplash_fb_new(angle,fbdev_id,double_buffer)) == NULL)
+#endif
     {
 	  ret = -1;
 	  goto fb_fail;
     }
 
+  psplash_timeline_add (PSPLASH_EVENT_FB_OPEN, 0, fb->backend->name);
+
   /* Clear the background with #ecece1 */
+  TIMELINE_BEGIN ("psplash_fb_draw_rect (clear)");
   psplash_fb_draw_rect (fb, 0, 0, fb->width, fb->height,
                         PSPLASH_BACKGROUND_COLOR);
+  TIMELINE_END ();
 
   /* Draw the Poky logo  */
   if (!disable_logo) {
-    psplash_fb_draw_image (fb, 
-      (fb->width  - POKY_IMG_WIDTH)/2,
-#if PSPLASH_IMG_FULLSCREEN
-      (fb->height - POKY_IMG_HEIGHT)/2,
-#else
-      (fb->height * PSPLASH_IMG_SPLIT_NUMERATOR
-        / PSPLASH_IMG_SPLIT_DENOMINATOR - POKY_IMG_HEIGHT)/2,
-#endif
-      POKY_IMG_WIDTH,
-      POKY_IMG_HEIGHT,
-      POKY_IMG_BYTES_PER_PIXEL,
-      POKY_IMG_ROWSTRIDE,
-      POKY_IMG_RLE_PIXEL_DATA);
+	  TIMELINE_BEGIN ("psplash_fb_draw_image (logo)");
+	  psplash_draw_logo (fb);
+	  TIMELINE_END ();
   }
 
   /* Draw progress bar border */
   if (!disable_progress_bar) {
-	  psplash_fb_draw_image (fb, 
-				 (fb->width  - BAR_IMG_WIDTH)/2, 
-				 fb->height - (fb->height/6), 
-				 BAR_IMG_WIDTH,
-				 BAR_IMG_HEIGHT,
-				 BAR_IMG_BYTES_PER_PIXEL,
-				 BAR_IMG_ROWSTRIDE,
-				 BAR_IMG_RLE_PIXEL_DATA);
-
+	  TIMELINE_BEGIN ("psplash_fb_draw_image (bar)");
+	  psplash_draw_bar (fb);
+	  TIMELINE_END ();
+	  TIMELINE_BEGIN ("psplash_draw_progress");
 	  psplash_draw_progress (fb, 0);
+	  TIMELINE_END ();
   }
 
   /* Draw message from file or defined MSG */
+  TIMELINE_BEGIN ("psplash_draw_msg");
   if(!disable_message) {
     fd_msg = fopen (MSG_FILE_PATH, "r");
     if (fd_msg==NULL) {
@@ -388,15 +802,24 @@ main (int argc, char** argv)
 #ifdef PSPLASH_STARTUP_MSG
   psplash_draw_msg (fb, PSPLASH_STARTUP_MSG);
 #endif
+  TIMELINE_END ();
+
+  TIMELINE_BEGIN ("psplash_fb_flush");
   psplash_fb_flush (fb);
+  TIMELINE_END ();
+  psplash_timeline_add (PSPLASH_EVENT_FIRST_FRAME, 0, NULL);
 
   psplash_main (fb, pipe_fd, 0);
 
+  psplash_timeline_add (PSPLASH_EVENT_QUIT, n_commands, NULL);
+  psplash_timeline_write ();
 
   psplash_fb_destroy (fb);
 
  fb_fail:
   unlink(PSPLASH_FIFO);
+  unlink(PSPLASH_SOCKET);
+  unlink(PSPLASH_SHM);
 
   if (!disable_console_switch)
     psplash_console_reset ();
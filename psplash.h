@@ -18,6 +18,10 @@
 #ifndef _HAVE_PSPLASH_H
 #define _HAVE_PSPLASH_H
 
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
 #define _GNU_SOURCE 1
 #include <assert.h>
 #include <errno.h>
@@ -26,6 +30,7 @@
 #include <linux/fb.h>
 #include <linux/kd.h>
 #include <linux/vt.h>
+#include <pthread.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -56,10 +61,22 @@ typedef int            bool;
 #endif
 
 #define PSPLASH_FIFO "psplash_fifo"
+#define PSPLASH_SOCKET "psplash_socket"
+
+/* Longest command, terminator included */
+#define PSPLASH_COMMAND_MAX 2048
 
 #define CLAMP(x, low, high) \
    (((x) > (high)) ? (high) : (((x) < (low)) ? (low) : (x)))
 
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
 #define DEBUG 0
 
 #if DEBUG
@@ -88,6 +105,17 @@ PSplashFont;
 
 
 #include "psplash-fb.h"
+#include "psplash-fill.h"
+#include "psplash-blend.h"
 #include "psplash-console.h"
+#include "psplash-headless.h"
+#include "psplash-draw.h"
+#include "psplash-shm.h"
+#include "psplash-shm-watch.h"
+#include "psplash-timeline.h"
+
+#ifdef ENABLE_DRM
+#include "psplash-drm.h"
+#endif
 
 #endif